@@ -0,0 +1,92 @@
+#
+# Convert binary log files (log_file_format = BINARY) into the CSV format
+#
+# arg[1] : logs-dir : logs directory like "../../data/sample/logs"
+# arg[2] : file-tag : time tag for log files. ex. 220627_142946
+# arg[3] : files : binary log files to convert. When this is not set, all `.bin` files in the log directory are converted.
+#
+
+#
+# Import
+#
+import os
+import struct
+import datetime
+import numpy as np
+# local function
+from common import find_latest_log_tag
+from common import add_log_file_arguments
+# arguments
+import argparse
+
+# Definitions of the binary log format (See src/library/logger/binary_log_sink.hpp)
+MAGIC = b'S2EBLOG\0'
+SUPPORTED_VERSION = 1
+TYPE_REAL = 0
+TYPE_DATE_TIME = 1
+DATE_TIME_EPOCH = datetime.datetime(2000, 1, 1)
+
+def format_date_time(seconds):
+  days = np.floor(seconds / 86400.0)
+  second_of_day = seconds - days * 86400.0
+  hour = int(second_of_day // 3600.0)
+  minute = int((second_of_day - hour * 3600.0) // 60.0)
+  second = second_of_day - hour * 3600.0 - minute * 60.0
+  date = DATE_TIME_EPOCH + datetime.timedelta(days=int(days))
+  return "%4d/%02d/%02d %02d:%02d:%.3f" % (date.year, date.month, date.day, hour, minute, second)
+
+def format_column(values, column_type):
+  if column_type == TYPE_DATE_TIME:
+    return np.array([format_date_time(v) for v in values])
+  return np.char.mod('%.16g', values)
+
+def convert_binary_log_to_csv(binary_file_name, csv_file_name):
+  with open(binary_file_name, 'rb') as binary_file, open(csv_file_name, 'w', newline='\n') as csv_file:
+    magic = binary_file.read(8)
+    if magic != MAGIC:
+      raise ValueError(binary_file_name + " is not a S2E binary log file")
+    version, number_of_columns, _ = struct.unpack('<III', binary_file.read(12))
+    if version != SUPPORTED_VERSION:
+      raise ValueError("Unsupported binary log version: " + str(version))
+
+    column_names = []
+    column_types = []
+    for _ in range(number_of_columns):
+      column_type, name_length = struct.unpack('<BI', binary_file.read(5))
+      column_names.append(binary_file.read(name_length).decode('utf-8'))
+      column_types.append(column_type)
+    csv_file.write(''.join(name + ',' for name in column_names) + '\n')
+
+    while True:
+      row_data = binary_file.read(4)
+      if len(row_data) < 4:
+        break
+      number_of_rows = struct.unpack('<I', row_data)[0]
+      chunk = np.fromfile(binary_file, dtype='<f8', count=number_of_columns * number_of_rows)
+      chunk = chunk.reshape((number_of_columns, number_of_rows))
+      formatted_columns = [format_column(chunk[i], column_types[i]) for i in range(number_of_columns)]
+      for row in range(number_of_rows):
+        csv_file.write(''.join(column[row] + ',' for column in formatted_columns) + '\n')
+
+if __name__ == '__main__':
+  # Arguments
+  aparser = argparse.ArgumentParser()
+  aparser = add_log_file_arguments(aparser)
+  aparser.add_argument('files', nargs='*', help='binary log files to convert')
+  args = aparser.parse_args()
+
+  binary_files = args.files
+  if len(binary_files) == 0:
+    # log file path
+    path_to_logs = args.logs_dir
+    read_file_tag = args.file_tag
+    if read_file_tag == None:
+      print("file tag does not found. use latest.")
+      read_file_tag = find_latest_log_tag(path_to_logs)
+    log_directory = path_to_logs + '/' + 'logs_' + read_file_tag + '/'
+    binary_files = [log_directory + f for f in sorted(os.listdir(log_directory)) if f.endswith('.bin')]
+
+  for binary_file_name in binary_files:
+    csv_file_name = os.path.splitext(binary_file_name)[0] + '.csv'
+    print("Convert " + binary_file_name + " -> " + csv_file_name)
+    convert_binary_log_to_csv(binary_file_name, csv_file_name)
@@ -5,6 +5,9 @@
 
 #include "component.hpp"
 
+#include <library/utilities/profiler.hpp>
+#include <typeinfo>
+
 Component::Component(const unsigned int prescaler, ClockGenerator* clock_generator, const unsigned int fast_prescaler)
     : clock_generator_(clock_generator) {
   power_port_ = new PowerPort();
@@ -33,6 +36,7 @@ Component::~Component() { clock_generator_->RemoveComponent(this); }
 
 void Component::Tick(const unsigned int count) {
   if (count % prescaler_ > 0) return;
+  S2E_PROFILE_SCOPE(typeid(*this).name());
   if (power_port_->GetIsOn()) {
     MainRoutine(count);
   } else {
@@ -48,3 +52,13 @@ void Component::FastTick(const unsigned int fast_count) {
     PowerOffRoutine();
   }
 }
+
+void Component::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("Component");
+  power_port_->SaveState(writer);
+}
+
+void Component::LoadState(CheckpointReader& reader) {
+  reader.BeginSection("Component");
+  power_port_->LoadState(reader);
+}
@@ -59,6 +59,16 @@ class Component : public ITickable {
    * @brief The methods to input fast clock. This will be called periodically.
    */
   virtual void FastTick(const unsigned int fast_count);
+  /**
+   * @fn SaveState
+   * @brief Write the power port state to the checkpoint. Override this and call it to add the internal state of the component.
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the power port state from the checkpoint. Override this and call it to add the internal state of the component.
+   */
+  virtual void LoadState(CheckpointReader& reader);
 
  protected:
   unsigned int prescaler_;           //!< Frequency scale factor for normal update
@@ -6,6 +6,9 @@
 #ifndef S2E_COMPONENTS_BASE_CLASSES_INTERFACE_TICKABLE_HPP_
 #define S2E_COMPONENTS_BASE_CLASSES_INTERFACE_TICKABLE_HPP_
 
+#include <library/utilities/checkpoint.hpp>
+#include <library/utilities/macros.hpp>
+
 /**
  * @class ITickable
  * @brief Interface class for time update of components
@@ -24,6 +27,20 @@ class ITickable {
    */
   virtual void FastTick(const unsigned int fast_count) = 0;
 
+  /**
+   * @fn SaveState
+   * @brief Write the internal state to the checkpoint
+   * @note Override this when the class has the internal state which changes during the simulation. The default function writes nothing.
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveState(CheckpointWriter& writer) const { UNUSED(writer); }
+  /**
+   * @fn LoadState
+   * @brief Restore the internal state from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadState(CheckpointReader& reader) { UNUSED(reader); }
+
   // Whether or not high-frequency disturbances need to be calculated
   /**
    * @fn GetNeedsFastUpdate
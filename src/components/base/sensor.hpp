@@ -48,6 +48,18 @@ class Sensor {
    * @return Observed value with noise at the component frame
    */
   libra::Vector<N> Measure(const libra::Vector<N> true_value_c);
+  /**
+   * @fn SaveState
+   * @brief Write the noise state to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the noise state from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
 
  private:
   libra::Matrix<N, N> scale_factor_;            //!< Scale factor matrix
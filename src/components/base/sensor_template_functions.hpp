@@ -40,6 +40,24 @@ libra::Vector<N> Sensor<N>::Measure(const libra::Vector<N> true_value_c) {
   return Clip(calc_value_c);
 }
 
+template <size_t N>
+void Sensor<N>::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("Sensor");
+  for (size_t i = 0; i < N; i++) {
+    normal_random_noise_c_[i].SaveState(writer);
+  }
+  random_walk_noise_c_.SaveState(writer);
+}
+
+template <size_t N>
+void Sensor<N>::LoadState(CheckpointReader& reader) {
+  reader.BeginSection("Sensor");
+  for (size_t i = 0; i < N; i++) {
+    normal_random_noise_c_[i].LoadState(reader);
+  }
+  random_walk_noise_c_.LoadState(reader);
+}
+
 template <size_t N>
 libra::Vector<N> Sensor<N>::Clip(const libra::Vector<N> input_c) {
   libra::Vector<N> output_c;
@@ -39,3 +39,13 @@ void ExampleI2cTargetForHils::MainRoutine(const int time_count) {
 
   return;
 }
+
+void ExampleI2cTargetForHils::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write(tlm_counter_);
+}
+
+void ExampleI2cTargetForHils::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.Read(tlm_counter_);
+}
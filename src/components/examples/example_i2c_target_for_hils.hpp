@@ -40,6 +40,17 @@ class ExampleI2cTargetForHils : public Component, public I2cTargetCommunicationW
    */
   ~ExampleI2cTargetForHils();
 
+  /**
+   * @fn SaveState
+   * @brief Write the telemetry counter to the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Restore the telemetry counter from the checkpoint
+   */
+  void LoadState(CheckpointReader& reader) override;
+
  protected:
   // Override functions for Component
   /**
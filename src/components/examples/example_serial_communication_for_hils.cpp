@@ -59,3 +59,17 @@ void ExampleSerialCommunicationForHils::MainRoutine(const int time_count) {
   ReceiveCommand(0, kMemorySize);
   SendTelemetry(0);
 }
+
+void ExampleSerialCommunicationForHils::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write(memory_);
+  writer.Write(tx_);
+  writer.Write(counter_);
+}
+
+void ExampleSerialCommunicationForHils::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.Read(memory_);
+  reader.Read(tx_);
+  reader.Read(counter_);
+}
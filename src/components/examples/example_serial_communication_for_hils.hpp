@@ -42,6 +42,17 @@ class ExampleSerialCommunicationForHils : public Component, public UartCommunica
    */
   ~ExampleSerialCommunicationForHils();
 
+  /**
+   * @fn SaveState
+   * @brief Write the memory and the counter to the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Restore the memory and the counter from the checkpoint
+   */
+  void LoadState(CheckpointReader& reader) override;
+
  protected:
   // Override functions for Component
   /**
@@ -54,3 +54,13 @@ void ExampleSerialCommunicationWithObc::MainRoutine(const int time_count) {
 void ExampleSerialCommunicationWithObc::GpioStateChanged(const int port_id, const bool is_positive_edge) {
   printf("interrupted. portid = %d, isPosedge = %d./n", port_id, is_positive_edge);
 }
+
+void ExampleSerialCommunicationWithObc::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write(memory_);
+}
+
+void ExampleSerialCommunicationWithObc::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.Read(memory_);
+}
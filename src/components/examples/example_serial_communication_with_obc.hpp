@@ -51,6 +51,17 @@ class ExampleSerialCommunicationWithObc : public Component, public UartCommunica
    */
   ~ExampleSerialCommunicationWithObc();
 
+  /**
+   * @fn SaveState
+   * @brief Write the memory for the telemetry to the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Restore the memory for the telemetry from the checkpoint
+   */
+  void LoadState(CheckpointReader& reader) override;
+
  protected:
   // Override functions for Component
   /**
@@ -103,3 +103,23 @@ libra::Quaternion ForceGenerator::GenerateDirectionNoiseQuaternion(libra::Vector
   libra::Quaternion error_quaternion(rotation_axis, error_angle_rad);
   return error_quaternion;
 }
+
+void ForceGenerator::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write(ordered_force_b_N_);
+  writer.Write(generated_force_b_N_);
+  writer.Write(generated_force_i_N_);
+  writer.Write(generated_force_rtn_N_);
+  magnitude_noise_.SaveState(writer);
+  direction_noise_.SaveState(writer);
+}
+
+void ForceGenerator::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.Read(ordered_force_b_N_);
+  reader.Read(generated_force_b_N_);
+  reader.Read(generated_force_i_N_);
+  reader.Read(generated_force_rtn_N_);
+  magnitude_noise_.LoadState(reader);
+  direction_noise_.LoadState(reader);
+}
@@ -46,6 +46,16 @@ class ForceGenerator : public Component, public ILoggable {
    * @brief Power off routine to stop force generation
    */
   void PowerOffRoutine();
+  /**
+   * @fn SaveState
+   * @brief Write the ordered force and the noise state to the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Restore the ordered force and the noise state from the checkpoint
+   */
+  void LoadState(CheckpointReader& reader) override;
 
   // Override ILoggable
   /**
@@ -76,3 +76,19 @@ libra::Quaternion TorqueGenerator::GenerateDirectionNoiseQuaternion(libra::Vecto
   libra::Quaternion error_quaternion(rotation_axis, error_angle_rad);
   return error_quaternion;
 }
+
+void TorqueGenerator::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write(ordered_torque_b_Nm_);
+  writer.Write(generated_torque_b_Nm_);
+  magnitude_noise_.SaveState(writer);
+  direction_noise_.SaveState(writer);
+}
+
+void TorqueGenerator::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.Read(ordered_torque_b_Nm_);
+  reader.Read(generated_torque_b_Nm_);
+  magnitude_noise_.LoadState(reader);
+  direction_noise_.LoadState(reader);
+}
@@ -24,3 +24,7 @@ int GpioPort::DigitalWrite(const bool is_high) {
 }
 
 bool GpioPort::DigitalRead() { return high_low_state_; }
+
+void GpioPort::SaveState(CheckpointWriter& writer) const { writer.Write(high_low_state_); }
+
+void GpioPort::LoadState(CheckpointReader& reader) { reader.Read(high_low_state_); }
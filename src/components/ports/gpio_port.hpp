@@ -7,6 +7,7 @@
 #define S2E_COMPONENTS_PORTS_GPIO_PORT_HPP_
 
 #include <components/base/interface_gpio_component.hpp>
+#include <library/utilities/checkpoint.hpp>
 
 #define GPIO_HIGH true
 #define GPIO_LOW false
@@ -45,6 +46,19 @@ class GpioPort {
    */
   bool DigitalRead();
 
+  /**
+   * @fn SaveState
+   * @brief Write the High/Low state to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the High/Low state from the checkpoint without notifying the component
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
+
  private:
   const unsigned int kPortId;  //!< Port ID
   IGPIOCompo* component_;      //!< Component which has the GPIO port
@@ -8,11 +8,12 @@
 // #define HILS_I2C_TARGET_PORT_SHOW_DEBUG_DATA //!< Remove comment when you want to show the debug message
 
 // FIXME: The magic number. This is depending on the converter.
-HilsI2cTargetPort::HilsI2cTargetPort(const unsigned int port_id) : HilsUartPort(port_id, 115200, 512, 512) {}
+HilsI2cTargetPort::HilsI2cTargetPort(const unsigned int port_id, const std::string transport_address)
+    : HilsUartPort(port_id, 115200, 512, 512, transport_address) {}
 
 // FIXME: The magic number. This is depending on the converter.
 HilsI2cTargetPort::HilsI2cTargetPort(const unsigned int port_id, const unsigned char max_register_number)
-    : max_register_number_(max_register_number), HilsUartPort(port_id, 115200, 512, 512) {}
+    : HilsUartPort(port_id, 115200, 512, 512), max_register_number_(max_register_number) {}
 
 HilsI2cTargetPort::~HilsI2cTargetPort() {}
 
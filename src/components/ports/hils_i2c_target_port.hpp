@@ -22,8 +22,9 @@ class HilsI2cTargetPort : public HilsUartPort {
    * @fn HilsI2cTargetPort
    * @brief Constructor
    * @param [in] port_id: COM port ID
+   * @param [in] transport_address: Address of the transport (see HilsUartPort)
    */
-  HilsI2cTargetPort(const unsigned int port_id);
+  HilsI2cTargetPort(const unsigned int port_id, const std::string transport_address = "");
   /**
    * @fn HilsI2cTargetPort
    * @brief Constructor
@@ -1,8 +1,9 @@
 ﻿/**
  * @file hils_uart_port.cpp
  * @brief Class to manage PC's COM port
- * @details Currently, this feature supports Windows Visual Studio only.(FIXME)
+ * @details On Windows, the port is managed with .NET SerialPort.
  * Reference: https://docs.microsoft.com/en-us/dotnet/api/system.io.ports.serialport?view=netframework-4.7.2
+ * On the other platforms, the port is managed with the non-blocking HilsTransport (serial, pseudo-terminal, TCP, UDP, or loopback).
  * @note TODO :We need to clarify the difference with ComPortInterface
  */
 
@@ -10,9 +11,11 @@
 
 // # define HILS_UART_PORT_SHOW_DEBUG_DATA
 
+#ifdef WIN32
 HilsUartPort::HilsUartPort(const unsigned int port_id, const unsigned int baud_rate, const unsigned int tx_buffer_size,
-                           const unsigned int rx_buffer_size)
+                           const unsigned int rx_buffer_size, const std::string transport_address)
     : kPortName(GetPortName(port_id)), baud_rate_(baud_rate), kTxBufferSize(tx_buffer_size), kRxBufferSize(rx_buffer_size) {
+  (void)transport_address;
   // Allocate managed arrays.
   tx_buffer_ = gcnew bytearray(kTxBufferSize);
   rx_buffer_ = gcnew bytearray(kRxBufferSize);
@@ -186,3 +189,64 @@ int HilsUartPort::DiscardOutBuffer() {
   }
   return 0;
 }
+#else
+HilsUartPort::HilsUartPort(const unsigned int port_id, const unsigned int baud_rate, const unsigned int tx_buffer_size,
+                           const unsigned int rx_buffer_size, const std::string transport_address)
+    : kTxBufferSize(tx_buffer_size),
+      kRxBufferSize(rx_buffer_size),
+      kPortName(transport_address.empty() ? GetPortName(port_id) : transport_address),
+      baud_rate_(baud_rate) {
+  transport_ = CreateHilsTransport(kPortName, baud_rate_);
+  Initialize();
+}
+
+HilsUartPort::~HilsUartPort() { ClosePort(); }
+
+std::string HilsUartPort::GetPortName(const unsigned int port_id) { return "serial:/dev/ttyUSB" + std::to_string(port_id); }
+
+int HilsUartPort::Initialize() { return OpenPort(); }
+
+int HilsUartPort::ClosePort() {
+  if (transport_ == nullptr) return -1;
+  transport_->Close();
+  return 0;
+}
+
+int HilsUartPort::OpenPort() {
+  if (transport_ == nullptr) return -1;
+  if (!transport_->Open()) return -1;
+  return 0;
+}
+
+int HilsUartPort::WriteTx(const unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
+  if (transport_ == nullptr) return -1;
+  return transport_->Write(buffer + offset, data_length);
+}
+
+int HilsUartPort::ReadRx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
+  if (transport_ == nullptr) return -2;
+  // 0 is returned without waiting when no bytes are available
+  int received_bytes = transport_->Read(buffer + offset, data_length);
+#ifdef HILS_UART_PORT_SHOW_DEBUG_DATA
+  if (received_bytes < 0) printf("HILS UART port %s: read error\n", kPortName.c_str());
+#endif
+  return received_bytes < 0 ? -2 : received_bytes;
+}
+
+int HilsUartPort::GetBytesToRead() {
+  if (transport_ == nullptr) return -1;
+  return transport_->GetBytesToRead();
+}
+
+int HilsUartPort::DiscardInBuffer() {
+  if (transport_ == nullptr) return -1;
+  transport_->DiscardReceivedData();
+  return 0;
+}
+
+int HilsUartPort::DiscardOutBuffer() {
+  if (transport_ == nullptr) return -1;
+  transport_->DiscardQueuedData();
+  return 0;
+}
+#endif  // WIN32
@@ -1,20 +1,28 @@
 /**
  * @file hils_uart_port.hpp
  * @brief Class to manage PC's COM port
- * @details Currently, this feature supports Windows Visual Studio only.(FIXME)
+ * @details On Windows, the port is managed with .NET SerialPort.
  * Reference: https://docs.microsoft.com/en-us/dotnet/api/system.io.ports.serialport?view=netframework-4.7.2
+ * On the other platforms, the port is managed with the non-blocking HilsTransport (serial, pseudo-terminal, TCP, UDP, or loopback).
  * @note TODO :We need to clarify the difference with ComPortInterface
  */
 
 #ifndef S2E_COMPONENTS_PORTS_HILS_UART_PORT_HPP_
 #define S2E_COMPONENTS_PORTS_HILS_UART_PORT_HPP_
 
+#ifdef WIN32
 #include <msclr/gcroot.h>
 #include <msclr/marshal_cppstd.h>
+#else
+#include <library/communication/hils_transport.hpp>
+#include <memory>
+#endif
 
 #include <string>
 
+#ifdef WIN32
 typedef cli::array<System::Byte> bytearray;  //!< System::Byte: an 8-bit unsigned integer
+#endif
 
 /**
  * @class HilsUartPort
@@ -31,8 +39,11 @@ class HilsUartPort {
    * @param [in] baud_rate: Baudrate of the COM port
    * @param [in] tx_buffer_size: TX buffer size
    * @param [in] rx_buffer_size: RX buffer size
+   * @param [in] transport_address: Address of the transport (see CreateHilsTransport). Empty means serial:/dev/ttyUSB<port_id>.
+   *                                This is ignored on Windows.
    */
-  HilsUartPort(const unsigned int port_id, const unsigned int baud_rate, const unsigned int tx_buffer_size, const unsigned int rx_buffer_size);
+  HilsUartPort(const unsigned int port_id, const unsigned int baud_rate, const unsigned int tx_buffer_size, const unsigned int rx_buffer_size,
+               const std::string transport_address = "");
   /**
    * @fn ~HilsUartPort
    * @brief Destructor.
@@ -74,6 +85,13 @@ class HilsUartPort {
    * @return Length of byte to read or -1 when error happened
    */
   int GetBytesToRead();
+#ifndef WIN32
+  /**
+   * @fn GetTransport
+   * @brief Return the transport to register it to the poller
+   */
+  inline HilsTransport* GetTransport() { return transport_.get(); }
+#endif
 
  private:
   const unsigned int kTxBufferSize;  //!< TX Buffer size
@@ -81,17 +99,21 @@ class HilsUartPort {
   const std::string kPortName;       //!< Port name like "COM4"
   unsigned int baud_rate_;           //!< Baud rate ex. 9600, 115200
 
+#ifdef WIN32
   // gcroot is the type-safe wrapper template to refer to a CLR object from the c++ heap reference:
   // https://docs.microsoft.com/en-us/cpp/dotnet/how-to-declare-handles-in-native-types?view=msvc-160
   msclr::gcroot<System::IO::Ports::SerialPort ^> port_;  //!< Port
   msclr::gcroot<bytearray ^> tx_buffer_;                 //!< TX Buffer
   msclr::gcroot<bytearray ^> rx_buffer_;                 //!< RX Buffer
+#else
+  std::unique_ptr<HilsTransport> transport_;  //!< Transport
+#endif
 
   /**
    * @fn GetPortName
    * @brief Convert port id to port name
    * @param [in] port_id: Port ID like 4
-   * @return Port name like "COM4"
+   * @return Port name like "COM4" on Windows, and transport address like "serial:/dev/ttyUSB4" on the other platforms
    */
   static std::string GetPortName(const unsigned int port_id);
   /**
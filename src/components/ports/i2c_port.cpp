@@ -93,3 +93,31 @@ unsigned char I2cPort::ReadCommand(const unsigned char i2c_address, unsigned cha
   }
   return length;
 }
+
+void I2cPort::SaveState(CheckpointWriter& writer) const {
+  writer.Write(saved_register_address_);
+  for (const auto* map : {&device_registers_, &command_buffer_}) {
+    writer.Write((uint64_t)map->size());
+    for (const auto& element : *map) {
+      writer.Write(element.first.first);
+      writer.Write(element.first.second);
+      writer.Write(element.second);
+    }
+  }
+}
+
+void I2cPort::LoadState(CheckpointReader& reader) {
+  reader.Read(saved_register_address_);
+  for (auto* map : {&device_registers_, &command_buffer_}) {
+    uint64_t size = 0;
+    reader.Read(size);
+    map->clear();
+    for (uint64_t i = 0; i < size && reader.IsValid(); i++) {
+      unsigned char i2c_address = 0, address = 0, value = 0;
+      reader.Read(i2c_address);
+      reader.Read(address);
+      reader.Read(value);
+      (*map)[std::make_pair(i2c_address, address)] = value;
+    }
+  }
+}
@@ -6,6 +6,7 @@
 #ifndef S2E_COMPONENTS_PORTS_I2C_PORT_HPP_
 #define S2E_COMPONENTS_PORTS_I2C_PORT_HPP_
 
+#include <library/utilities/checkpoint.hpp>
 #include <map>
 
 /**
@@ -96,6 +97,19 @@ class I2cPort {
    */
   unsigned char ReadCommand(const unsigned char i2c_address, unsigned char* rx_data, const unsigned char length);
 
+  /**
+   * @fn SaveState
+   * @brief Write the registers and the command buffer to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the registers and the command buffer from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
+
  private:
   const int kDefaultCmdBufferSize = 0xff;        //!< Default command buffer size
   unsigned char max_register_number_ = 0xff;     //!< Maximum register number
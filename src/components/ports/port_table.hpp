@@ -0,0 +1,69 @@
+/**
+ * @file port_table.hpp
+ * @brief Dense table of communication ports addressed by port ID
+ */
+
+#ifndef S2E_COMPONENTS_PORTS_PORT_TABLE_HPP_
+#define S2E_COMPONENTS_PORTS_PORT_TABLE_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * @class PortTable
+ * @brief Dense table of communication ports addressed by port ID
+ * @details The ports are stored in a vector indexed by the port ID, so Get is an array access without searching.
+ *          Connect and Close change the table, so they should be called while the other threads do not access the table.
+ */
+template <typename T>
+class PortTable {
+ public:
+  static const int kMaxPortId = 4095;  //!< Maximum port ID to keep the table small
+
+  /**
+   * @fn Get
+   * @brief Return the port, or nullptr when the port is not connected
+   * @param [in] port_id: Port ID
+   */
+  inline T* Get(const int port_id) const {
+    if (port_id < 0 || (size_t)port_id >= ports_.size()) return nullptr;
+    return ports_[port_id].get();
+  }
+  /**
+   * @fn Connect
+   * @brief Register the port
+   * @param [in] port_id: Port ID
+   * @param [in] port: Port to register
+   * @return True when success, false when the port ID is invalid or already used
+   */
+  bool Connect(const int port_id, std::unique_ptr<T> port) {
+    if (port_id < 0 || port_id > kMaxPortId || Get(port_id) != nullptr) return false;
+    if ((size_t)port_id >= ports_.size()) ports_.resize(port_id + 1);
+    ports_[port_id] = std::move(port);
+    return true;
+  }
+  /**
+   * @fn Close
+   * @brief Delete the port
+   * @param [in] port_id: Port ID
+   * @return True when success, false when the port is not connected
+   */
+  bool Close(const int port_id) {
+    if (Get(port_id) == nullptr) return false;
+    ports_[port_id].reset();
+    return true;
+  }
+
+  /**
+   * @fn GetSize
+   * @brief Return the table size, which is larger than the maximum connected port ID
+   */
+  inline size_t GetSize() const { return ports_.size(); }
+
+ private:
+  std::vector<std::unique_ptr<T>> ports_;  //!< Ports indexed by port ID
+};
+
+#endif  // S2E_COMPONENTS_PORTS_PORT_TABLE_HPP_
@@ -63,6 +63,18 @@ void PowerPort::SubtractAssumedPowerConsumption_W(const double power_W) {
   return;
 }
 
+void PowerPort::SaveState(CheckpointWriter& writer) const {
+  writer.Write(voltage_V_);
+  writer.Write(current_consumption_A_);
+  writer.Write(is_on_);
+}
+
+void PowerPort::LoadState(CheckpointReader& reader) {
+  reader.Read(voltage_V_);
+  reader.Read(current_consumption_A_);
+  reader.Read(is_on_);
+}
+
 void PowerPort::InitializeWithInitializeFile(const std::string file_name) {
   IniAccess initialize_file(file_name);
   const std::string section_name = "POWER_PORT";
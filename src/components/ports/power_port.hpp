@@ -6,6 +6,7 @@
 #ifndef S2E_COMPONENTS_PORTS_POWER_PORT_HPP_
 #define S2E_COMPONENTS_PORTS_POWER_PORT_HPP_
 
+#include <library/utilities/checkpoint.hpp>
 #include <string>
 
 /**
@@ -107,6 +108,19 @@ class PowerPort {
    * @brief Subtract assumed power consumption [W] to emulate power line which has multiple loads
    */
   void SubtractAssumedPowerConsumption_W(const double power_W);
+  /**
+   * @fn SaveState
+   * @brief Write the voltage, the current consumption, and the power switch state to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the voltage, the current consumption, and the power switch state from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
+
   /**
    * @fn InitializeWithInitializeFile
    * @brief Initialize PowerPort class with initialize file
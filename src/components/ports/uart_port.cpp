@@ -7,32 +7,31 @@
 
 UartPort::UartPort() : UartPort(kDefaultBufferSize, kDefaultBufferSize) {}
 
-UartPort::UartPort(const unsigned int rx_buffer_size, const unsigned int tx_buffer_size) {
-  unsigned int checked_rx_buffer_size = rx_buffer_size;
-  unsigned int checked_tx_buffer_size = tx_buffer_size;
-  if (rx_buffer_size <= 0) checked_rx_buffer_size = kDefaultBufferSize;
-  if (tx_buffer_size <= 0) checked_tx_buffer_size = kDefaultBufferSize;
-  rx_buffer_ = new RingBuffer(checked_rx_buffer_size);
-  tx_buffer_ = new RingBuffer(checked_tx_buffer_size);
-}
-
-UartPort::~UartPort() {
-  delete rx_buffer_;
-  delete tx_buffer_;
-}
+UartPort::UartPort(const unsigned int rx_buffer_size, const unsigned int tx_buffer_size)
+    : rx_buffer_(rx_buffer_size > 0 ? rx_buffer_size : kDefaultBufferSize), tx_buffer_(tx_buffer_size > 0 ? tx_buffer_size : kDefaultBufferSize) {}
 
 int UartPort::WriteTx(const unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
-  return tx_buffer_->Write(buffer, offset, data_length);
+  return tx_buffer_.Write(buffer, offset, data_length);
 }
 
 int UartPort::WriteRx(const unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
-  return rx_buffer_->Write(buffer, offset, data_length);
+  return rx_buffer_.Write(buffer, offset, data_length);
 }
 
 int UartPort::ReadTx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
-  return tx_buffer_->Read(buffer, offset, data_length);
+  return tx_buffer_.Read(buffer, offset, data_length);
 }
 
 int UartPort::ReadRx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length) {
-  return rx_buffer_->Read(buffer, offset, data_length);
+  return rx_buffer_.Read(buffer, offset, data_length);
+}
+
+void UartPort::SaveState(CheckpointWriter& writer) const {
+  rx_buffer_.SaveState(writer);
+  tx_buffer_.SaveState(writer);
+}
+
+void UartPort::LoadState(CheckpointReader& reader) {
+  rx_buffer_.LoadState(reader);
+  tx_buffer_.LoadState(reader);
 }
@@ -12,6 +12,8 @@
  * @class UartPort
  * @brief Class to emulate UART communication port
  * @details The distinction of the area should be done where the upper port ID is assigned.
+ *          Each buffer is a single-producer single-consumer ring buffer, so the flight software and the simulator can exchange data
+ *          from different threads. The data which exceeds the free space of the buffer is dropped and counted as overflow.
  */
 class UartPort {
  public:
@@ -27,11 +29,8 @@ class UartPort {
    * @param [in] tx_buffer_size: TX(OBC-> Component) buffer size
    */
   UartPort(const unsigned int rx_buffer_size, const unsigned int tx_buffer_size);
-  /**
-   * @fn ~UartPort
-   * @brief Destructor
-   */
-  ~UartPort();
+  UartPort(const UartPort&) = delete;
+  UartPort& operator=(const UartPort&) = delete;
 
   /**
    * @fn WriteTx
@@ -71,11 +70,46 @@ class UartPort {
    */
   int ReadRx(unsigned char* buffer, const unsigned int offset, const unsigned int data_length);
 
+  /**
+   * @fn SaveState
+   * @brief Write the data remaining in the buffers to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the data remaining in the buffers from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
+
+  // Getters
+  /**
+   * @fn GetTxBuffer
+   * @brief Return the TX buffer for the zero-copy access
+   */
+  inline RingBuffer& GetTxBuffer() { return tx_buffer_; }
+  /**
+   * @fn GetRxBuffer
+   * @brief Return the RX buffer for the zero-copy access
+   */
+  inline RingBuffer& GetRxBuffer() { return rx_buffer_; }
+  /**
+   * @fn GetTxOverflowCount
+   * @brief Return number of bytes dropped because the TX buffer was full
+   */
+  inline uint64_t GetTxOverflowCount() const { return tx_buffer_.GetOverflowCount(); }
+  /**
+   * @fn GetRxOverflowCount
+   * @brief Return number of bytes dropped because the RX buffer was full
+   */
+  inline uint64_t GetRxOverflowCount() const { return rx_buffer_.GetOverflowCount(); }
+
  private:
   const static unsigned int kDefaultBufferSize = 1024;  //!< Default buffer size
 
-  RingBuffer* rx_buffer_;  //!< Receive buffer (Component -> OBC)
-  RingBuffer* tx_buffer_;  //!< Transmit buffer (OBC-> Component)
+  RingBuffer rx_buffer_;  //!< Receive buffer (Component -> OBC)
+  RingBuffer tx_buffer_;  //!< Transmit buffer (OBC-> Component)
 };
 
 #endif  // S2E_COMPONENTS_PORTS_UART_PORT_HPP_
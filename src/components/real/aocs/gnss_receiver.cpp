@@ -235,3 +235,37 @@ std::string GnssReceiver::GetLogValue() const  // For logs
 
   return str_tmp;
 }
+
+void GnssReceiver::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write(position_eci_m_);
+  writer.Write(velocity_eci_m_s_);
+  writer.Write(position_ecef_m_);
+  writer.Write(velocity_ecef_m_s_);
+  writer.Write(position_llh_);
+  writer.Write(utc_);
+  writer.Write(gps_time_week_);
+  writer.Write(gps_time_s_);
+  writer.Write(is_gnss_visible_);
+  writer.Write(visible_satellite_number_);
+  random_noise_i_x_.SaveState(writer);
+  random_noise_i_y_.SaveState(writer);
+  random_noise_i_z_.SaveState(writer);
+}
+
+void GnssReceiver::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.Read(position_eci_m_);
+  reader.Read(velocity_eci_m_s_);
+  reader.Read(position_ecef_m_);
+  reader.Read(velocity_ecef_m_s_);
+  reader.Read(position_llh_);
+  reader.Read(utc_);
+  reader.Read(gps_time_week_);
+  reader.Read(gps_time_s_);
+  reader.Read(is_gnss_visible_);
+  reader.Read(visible_satellite_number_);
+  random_noise_i_x_.LoadState(reader);
+  random_noise_i_y_.LoadState(reader);
+  random_noise_i_z_.LoadState(reader);
+}
@@ -91,6 +91,16 @@ class GnssReceiver : public Component, public ILoggable {
    * @brief Main routine for sensor observation
    */
   void MainRoutine(const int time_count);
+  /**
+   * @fn SaveState
+   * @brief Write the observed values and the noise state to the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Restore the observed values and the noise state from the checkpoint
+   */
+  void LoadState(CheckpointReader& reader) override;
 
   // Getter
   /**
@@ -42,3 +42,15 @@ std::string GyroSensor::GetLogValue() const {
 
   return str_tmp;
 }
+
+void GyroSensor::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  Sensor::SaveState(writer);
+  writer.Write(angular_velocity_c_rad_s_);
+}
+
+void GyroSensor::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  Sensor::LoadState(reader);
+  reader.Read(angular_velocity_c_rad_s_);
+}
@@ -45,3 +45,15 @@ std::string Magnetometer::GetLogValue() const {
 
   return str_tmp;
 }
+
+void Magnetometer::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  Sensor::SaveState(writer);
+  writer.Write(magnetic_field_c_nT_);
+}
+
+void Magnetometer::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  Sensor::LoadState(reader);
+  reader.Read(magnetic_field_c_nT_);
+}
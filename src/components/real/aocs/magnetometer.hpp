@@ -58,6 +58,16 @@ class Magnetometer : public Component, public Sensor<kMagnetometerDimension>, pu
    * @brief Main routine for sensor observation
    */
   void MainRoutine(const int time_count) override;
+  /**
+   * @fn SaveState
+   * @brief Write the noise state and the measured value to the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Restore the noise state and the measured value from the checkpoint
+   */
+  void LoadState(CheckpointReader& reader) override;
 
   // Override ILoggable
   /**
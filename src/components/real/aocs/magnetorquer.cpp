@@ -109,3 +109,21 @@ std::string Magnetorquer::GetLogValue() const {
 
   return str_tmp;
 }
+
+void Magnetorquer::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write(output_magnetic_moment_c_Am2_);
+  writer.Write(output_magnetic_moment_b_Am2_);
+  writer.Write(torque_b_Nm_);
+  random_walk_c_Am2_.SaveState(writer);
+  for (size_t i = 0; i < kMtqDimension; i++) random_noise_c_Am2_[i].SaveState(writer);
+}
+
+void Magnetorquer::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.Read(output_magnetic_moment_c_Am2_);
+  reader.Read(output_magnetic_moment_b_Am2_);
+  reader.Read(torque_b_Nm_);
+  random_walk_c_Am2_.LoadState(reader);
+  for (size_t i = 0; i < kMtqDimension; i++) random_noise_c_Am2_[i].LoadState(reader);
+}
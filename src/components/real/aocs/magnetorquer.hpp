@@ -83,6 +83,16 @@ class Magnetorquer : public Component, public ILoggable {
    * @brief Power off routine to stop actuation
    */
   void PowerOffRoutine() override;
+  /**
+   * @fn SaveState
+   * @brief Write the ordered magnetic moment, the output torque, and the noise state to the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Restore the ordered magnetic moment, the output torque, and the noise state from the checkpoint
+   */
+  void LoadState(CheckpointReader& reader) override;
 
   // Override ILoggable
   /**
@@ -220,3 +220,33 @@ std::string ReactionWheel::GetLogValue() const {
 
   return str_tmp;
 }
+
+void ReactionWheel::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write(drive_flag_);
+  writer.Write(velocity_limit_rpm_);
+  writer.Write(target_acceleration_rad_s2_);
+  writer.Write(acceleration_delay_buffer_);
+  writer.Write(angular_acceleration_rad_s2_);
+  writer.Write(angular_velocity_rpm_);
+  writer.Write(angular_velocity_rad_s_);
+  writer.Write(output_torque_b_Nm_);
+  writer.Write(angular_momentum_b_Nms_);
+  ode_angular_velocity_.SaveState(writer);
+  rw_jitter_.SaveState(writer);
+}
+
+void ReactionWheel::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.Read(drive_flag_);
+  reader.Read(velocity_limit_rpm_);
+  reader.Read(target_acceleration_rad_s2_);
+  reader.Read(acceleration_delay_buffer_);
+  reader.Read(angular_acceleration_rad_s2_);
+  reader.Read(angular_velocity_rpm_);
+  reader.Read(angular_velocity_rad_s_);
+  reader.Read(output_torque_b_Nm_);
+  reader.Read(angular_momentum_b_Nms_);
+  ode_angular_velocity_.LoadState(reader);
+  rw_jitter_.LoadState(reader);
+}
@@ -119,6 +119,16 @@ class ReactionWheel : public Component, public ILoggable {
    * @brief Main routine to output torque of RW jitter
    */
   void FastUpdate() override;
+  /**
+   * @fn SaveState
+   * @brief Write the commands, the delay buffer, the angular velocity, and the jitter state to the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Restore the commands, the delay buffer, the angular velocity, and the jitter state from the checkpoint
+   */
+  void LoadState(CheckpointReader& reader) override;
 
   // Override ILoggable
   /**
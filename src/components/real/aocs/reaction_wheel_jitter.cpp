@@ -124,3 +124,41 @@ void ReactionWheelJitter::CalcCoefficients() {
   coefficients_[5] = 4.0 - 4.0 * damping_factor_ * update_interval_s_ * structural_resonance_angular_frequency_Hz_ +
                      pow(update_interval_s_, 2.0) * pow(structural_resonance_angular_frequency_Hz_, 2.0);
 }
+
+void ReactionWheelJitter::SaveState(CheckpointWriter& writer) const {
+  writer.Write(jitter_force_rotation_phase_);
+  writer.Write(jitter_torque_rotation_phase_);
+  writer.Write(unfiltered_jitter_force_n_c_);
+  writer.Write(unfiltered_jitter_force_n_1_c_);
+  writer.Write(unfiltered_jitter_force_n_2_c_);
+  writer.Write(unfiltered_jitter_torque_n_c_);
+  writer.Write(unfiltered_jitter_torque_n_1_c_);
+  writer.Write(unfiltered_jitter_torque_n_2_c_);
+  writer.Write(filtered_jitter_force_n_c_);
+  writer.Write(filtered_jitter_force_n_1_c_);
+  writer.Write(filtered_jitter_force_n_2_c_);
+  writer.Write(filtered_jitter_torque_n_c_);
+  writer.Write(filtered_jitter_torque_n_1_c_);
+  writer.Write(filtered_jitter_torque_n_2_c_);
+  writer.Write(jitter_force_b_N_);
+  writer.Write(jitter_torque_b_Nm_);
+}
+
+void ReactionWheelJitter::LoadState(CheckpointReader& reader) {
+  reader.Read(jitter_force_rotation_phase_);
+  reader.Read(jitter_torque_rotation_phase_);
+  reader.Read(unfiltered_jitter_force_n_c_);
+  reader.Read(unfiltered_jitter_force_n_1_c_);
+  reader.Read(unfiltered_jitter_force_n_2_c_);
+  reader.Read(unfiltered_jitter_torque_n_c_);
+  reader.Read(unfiltered_jitter_torque_n_1_c_);
+  reader.Read(unfiltered_jitter_torque_n_2_c_);
+  reader.Read(filtered_jitter_force_n_c_);
+  reader.Read(filtered_jitter_force_n_1_c_);
+  reader.Read(filtered_jitter_force_n_2_c_);
+  reader.Read(filtered_jitter_torque_n_c_);
+  reader.Read(filtered_jitter_torque_n_1_c_);
+  reader.Read(filtered_jitter_torque_n_2_c_);
+  reader.Read(jitter_force_b_N_);
+  reader.Read(jitter_torque_b_Nm_);
+}
@@ -9,6 +9,7 @@
 #pragma once
 #include <library/math/quaternion.hpp>
 #include <library/math/vector.hpp>
+#include <library/utilities/checkpoint.hpp>
 #include <vector>
 
 /*
@@ -45,6 +46,18 @@ class ReactionWheelJitter {
    * @param [in] angular_velocity_rad: Current angular velocity of RW [rad/s]
    */
   void CalcJitter(double angular_velocity_rad);
+  /**
+   * @fn SaveState
+   * @brief Write the rotation phases and the variables of the difference equations to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the rotation phases and the variables of the difference equations from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
 
   /**
    * @fn GetJitterForce_b_N
@@ -34,3 +34,15 @@ void ReactionWheelOde::DerivativeFunction(double x, const libra::Vector<1> &stat
   // Only target
   // rhs[0]   = (target_angular_velocity_rad_s_);
 }
+
+void ReactionWheelOde::SaveState(CheckpointWriter& writer) const {
+  OrdinaryDifferentialEquation<1>::SaveState(writer);
+  writer.Write(lag_coefficients_);
+  writer.Write(target_angular_velocity_rad_s_);
+}
+
+void ReactionWheelOde::LoadState(CheckpointReader& reader) {
+  OrdinaryDifferentialEquation<1>::LoadState(reader);
+  reader.Read(lag_coefficients_);
+  reader.Read(target_angular_velocity_rad_s_);
+}
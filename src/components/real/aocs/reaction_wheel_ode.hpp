@@ -54,6 +54,19 @@ class ReactionWheelOde : public libra::OrdinaryDifferentialEquation<1> {
    */
   void SetLagCoefficients(libra::Vector<3> lag_coefficients) { lag_coefficients_ = lag_coefficients; }
 
+  /**
+   * @fn SaveState
+   * @brief Override function of OrdinaryDifferentialEquation to write the lag coefficients and the target together
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Override function of OrdinaryDifferentialEquation to restore the lag coefficients and the target together
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader) override;
+
  private:
   ReactionWheelOde(double step_width_s);  //!< Prohibit calling constructor
   libra::Vector<3> lag_coefficients_;     //!< Coefficients for the first order lag
@@ -211,3 +211,29 @@ void StarSensor::MainRoutine(const int time_count) {
 
   Measure(&(local_environment_->GetCelestialInformation()), &(dynamics_->GetAttitude()));
 }
+
+void StarSensor::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write(measured_quaternion_i2c_);
+  writer.Write((uint64_t)delay_buffer_.size());
+  for (const auto& quaternion : delay_buffer_) writer.Write(quaternion);
+  writer.Write(buffer_position_);
+  writer.Write(update_count_);
+  writer.Write(error_flag_);
+  rotation_noise_.SaveState(writer);
+  orthogonal_direction_noise_.SaveState(writer);
+  sight_direction_noise_.SaveState(writer);
+}
+
+void StarSensor::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.Read(measured_quaternion_i2c_);
+  reader.ReadSizeAndCheck(delay_buffer_.size(), "star sensor delay buffer");
+  for (auto& quaternion : delay_buffer_) reader.Read(quaternion);
+  reader.Read(buffer_position_);
+  reader.Read(update_count_);
+  reader.Read(error_flag_);
+  rotation_noise_.LoadState(reader);
+  orthogonal_direction_noise_.LoadState(reader);
+  sight_direction_noise_.LoadState(reader);
+}
@@ -81,6 +81,16 @@ class StarSensor : public Component, public ILoggable {
    * @brief Main routine for sensor observation
    */
   void MainRoutine(const int time_count) override;
+  /**
+   * @fn SaveState
+   * @brief Write the measured quaternion, the delay buffer, and the noise state to the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Restore the measured quaternion, the delay buffer, and the noise state from the checkpoint
+   */
+  void LoadState(CheckpointReader& reader) override;
 
   // Override ILoggable
   /**
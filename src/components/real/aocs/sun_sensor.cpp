@@ -149,3 +149,21 @@ string SunSensor::GetLogValue() const {
 
   return str_tmp;
 }
+
+void SunSensor::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write(alpha_rad_);
+  writer.Write(beta_rad_);
+  writer.Write(sun_detected_flag_);
+  random_noise_alpha_.SaveState(writer);
+  random_noise_beta_.SaveState(writer);
+}
+
+void SunSensor::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.Read(alpha_rad_);
+  reader.Read(beta_rad_);
+  reader.Read(sun_detected_flag_);
+  random_noise_alpha_.LoadState(reader);
+  random_noise_beta_.LoadState(reader);
+}
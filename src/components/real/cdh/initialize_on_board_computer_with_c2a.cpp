@@ -0,0 +1,35 @@
+/**
+ * @file initialize_on_board_computer_with_c2a.cpp
+ * @brief Initialize function for ObcWithC2a
+ */
+
+#include "initialize_on_board_computer_with_c2a.hpp"
+
+#include <iostream>
+#include <library/initialize/initialize_file_access.hpp>
+
+ObcWithC2a* InitObcWithC2a(ClockGenerator* clock_generator, PowerPort* power_port, const std::string file_name) {
+  IniAccess obc_conf(file_name);
+  const char* section = "OBC_WITH_C2A";
+
+  int prescaler = obc_conf.ReadInt(section, "prescaler");
+  if (prescaler <= 1) prescaler = 1;
+  int timing_regulator = obc_conf.ReadInt(section, "timing_regulator");
+  if (timing_regulator <= 1) timing_regulator = 1;
+
+  ObcWithC2a* obc = new ObcWithC2a(prescaler, clock_generator, timing_regulator, power_port);
+
+  if (obc_conf.ReadEnable(section, "flight_software_thread")) {
+    int sync_interval = obc_conf.ReadInt(section, "sync_interval");
+    if (sync_interval <= 1) {
+      sync_interval = 1;
+    } else {
+      std::cerr << "WARNING: OBC with C2A: C2A runs in parallel with the other components between the sync points, so the simulation "
+                   "results are nondeterministic when sync_interval > 1."
+                << std::endl;
+    }
+    obc->EnableFlightSoftwareThread((size_t)sync_interval);
+  }
+
+  return obc;
+}
@@ -0,0 +1,22 @@
+/**
+ * @file initialize_on_board_computer_with_c2a.hpp
+ * @brief Initialize function for ObcWithC2a
+ */
+
+#ifndef S2E_COMPONENTS_REAL_CDH_INITIALIZE_ON_BOARD_COMPUTER_WITH_C2A_HPP_
+#define S2E_COMPONENTS_REAL_CDH_INITIALIZE_ON_BOARD_COMPUTER_WITH_C2A_HPP_
+
+#include <components/real/cdh/on_board_computer_with_c2a.hpp>
+#include <string>
+
+/**
+ * @fn InitObcWithC2a
+ * @brief Initialize function for ObcWithC2a
+ * @note The object is returned as a pointer since the flight software thread is not copyable.
+ * @param [in] clock_generator: Clock generator
+ * @param [in] power_port: Power port
+ * @param [in] file_name: Path to the initialize file
+ */
+ObcWithC2a* InitObcWithC2a(ClockGenerator* clock_generator, PowerPort* power_port, const std::string file_name);
+
+#endif  // S2E_COMPONENTS_REAL_CDH_INITIALIZE_ON_BOARD_COMPUTER_WITH_C2A_HPP_
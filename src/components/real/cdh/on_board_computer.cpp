@@ -26,45 +26,38 @@ void OnBoardComputer::Initialize() {}
 void OnBoardComputer::MainRoutine(const int time_count) { UNUSED(time_count); }
 
 int OnBoardComputer::ConnectComPort(int port_id, int tx_buffer_size, int rx_buffer_size) {
-  if (uart_ports_[port_id] != nullptr) {
-    // Port already used
-    return -1;
-  }
-  uart_ports_[port_id] = new UartPort(tx_buffer_size, rx_buffer_size);
+  // Port already used or invalid port ID
+  if (!uart_ports_.Connect(port_id, std::make_unique<UartPort>(tx_buffer_size, rx_buffer_size))) return -1;
   return 0;
 }
 
 // Close port and free resources
 int OnBoardComputer::CloseComPort(int port_id) {
   // Port not used
-  if (uart_ports_[port_id] == nullptr) return -1;
-
-  UartPort* port = uart_ports_.at(port_id);
-  delete port;
-  uart_ports_.erase(port_id);
+  if (!uart_ports_.Close(port_id)) return -1;
   return 0;
 }
 
 int OnBoardComputer::SendFromObc(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = uart_ports_[port_id];
+  UartPort* port = uart_ports_.Get(port_id);
   if (port == nullptr) return -1;
   return port->WriteTx(buffer, offset, length);
 }
 
 int OnBoardComputer::ReceivedByCompo(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = uart_ports_[port_id];
+  UartPort* port = uart_ports_.Get(port_id);
   if (port == nullptr) return -1;
   return port->ReadTx(buffer, offset, length);
 }
 
 int OnBoardComputer::SendFromCompo(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = uart_ports_[port_id];
+  UartPort* port = uart_ports_.Get(port_id);
   if (port == nullptr) return -1;
   return port->WriteRx(buffer, offset, length);
 }
 
 int OnBoardComputer::ReceivedByObc(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = uart_ports_[port_id];
+  UartPort* port = uart_ports_.Get(port_id);
   if (port == nullptr) return -1;
   return port->ReadRx(buffer, offset, length);
 }
@@ -132,3 +125,65 @@ bool OnBoardComputer::GpioComponentRead(int port_id) {
   if (port == nullptr) return false;
   return port->DigitalRead();
 }
+
+namespace {
+void ReadPortListEnd(CheckpointReader& reader, const std::string& port_type) {
+  int terminator = 0;
+  reader.Read(terminator);
+  if (terminator != -1) reader.SetError("the snapshot has more " + port_type + " ports than the current setting");
+}
+}  // namespace
+
+void OnBoardComputer::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write((uint64_t)uart_ports_.GetSize());
+  for (size_t port_id = 0; port_id < uart_ports_.GetSize(); port_id++) {
+    const UartPort* port = uart_ports_.Get((int)port_id);
+    writer.Write(port != nullptr);
+    if (port != nullptr) port->SaveState(writer);
+  }
+  for (const auto& port : i2c_ports_) {
+    if (port.second == nullptr) continue;
+    writer.Write(port.first);
+    port.second->SaveState(writer);
+  }
+  writer.Write(-1);
+  for (const auto& port : gpio_ports_) {
+    if (port.second == nullptr) continue;
+    writer.Write(port.first);
+    port.second->SaveState(writer);
+  }
+  writer.Write(-1);
+}
+
+void OnBoardComputer::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.ReadSizeAndCheck(uart_ports_.GetSize(), "UART ports");
+  for (size_t port_id = 0; port_id < uart_ports_.GetSize() && reader.IsValid(); port_id++) {
+    UartPort* port = uart_ports_.Get((int)port_id);
+    bool is_connected = false;
+    reader.Read(is_connected);
+    if (is_connected != (port != nullptr)) {
+      reader.SetError("UART port " + std::to_string(port_id) + " is not connected in the same way");
+      return;
+    }
+    if (port != nullptr) port->LoadState(reader);
+  }
+  // The connected ports are terminated by -1, which is not a valid port ID
+  for (const auto& port : i2c_ports_) {
+    if (port.second == nullptr) continue;
+    int port_id = -1;
+    reader.Read(port_id);
+    if (port_id != port.first) reader.SetError("I2C port " + std::to_string(port.first) + " is not found");
+    port.second->LoadState(reader);
+  }
+  ReadPortListEnd(reader, "I2C");
+  for (const auto& port : gpio_ports_) {
+    if (port.second == nullptr) continue;
+    int port_id = -1;
+    reader.Read(port_id);
+    if (port_id != port.first) reader.SetError("GPIO port " + std::to_string(port.first) + " is not found");
+    port.second->LoadState(reader);
+  }
+  ReadPortListEnd(reader, "GPIO");
+}
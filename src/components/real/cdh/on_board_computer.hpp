@@ -8,6 +8,7 @@
 
 #include <components/ports/gpio_port.hpp>
 #include <components/ports/i2c_port.hpp>
+#include <components/ports/port_table.hpp>
 #include <components/ports/uart_port.hpp>
 #include <map>
 
@@ -185,6 +186,16 @@ class OnBoardComputer : public Component {
    * @return GPIO state or return false when the port_id is not used
    */
   virtual bool GpioComponentRead(int port_id);
+  /**
+   * @fn SaveState
+   * @brief Write the states of the UART, I2C, and GPIO ports to the checkpoint. The internal state of the flight software is not included.
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Restore the states of the UART, I2C, and GPIO ports from the checkpoint. The same ports should be connected.
+   */
+  void LoadState(CheckpointReader& reader) override;
 
  protected:
   /**
@@ -202,7 +213,7 @@ class OnBoardComputer : public Component {
   virtual void MainRoutine(const int time_count);
 
  private:
-  std::map<int, UartPort*> uart_ports_;  //!< UART ports
+  PortTable<UartPort> uart_ports_;       //!< UART ports
   std::map<int, I2cPort*> i2c_ports_;    //!< I2C ports
   std::map<int, GpioPort*> gpio_ports_;  //!< GPIO ports
 };
@@ -12,9 +12,10 @@
 #include "src_core/c2a_core_main.h"
 #endif
 
-std::map<int, UartPort*> ObcWithC2a::com_ports_c2a_;
+PortTable<UartPort> ObcWithC2a::com_ports_c2a_;
 std::map<int, I2cPort*> ObcWithC2a::i2c_com_ports_c2a_;
 std::map<int, GpioPort*> ObcWithC2a::gpio_ports_c2a_;
+std::mutex ObcWithC2a::port_mutex_;
 
 ObcWithC2a::ObcWithC2a(ClockGenerator* clock_generator) : OnBoardComputer(clock_generator), timing_regulator_(1) {
   // Initialize();
@@ -30,7 +31,26 @@ ObcWithC2a::ObcWithC2a(int prescaler, ClockGenerator* clock_generator, int timin
   // Initialize();
 }
 
-ObcWithC2a::~ObcWithC2a() {}
+ObcWithC2a::~ObcWithC2a() {
+  // Stop the flight software thread before the ports are released
+  flight_software_thread_.reset();
+}
+
+void ObcWithC2a::EnableFlightSoftwareThread(const size_t sync_interval) {
+  if (flight_software_thread_ != nullptr) return;
+  // C2A is initialized in the first tick, so it is also initialized on the flight software thread
+  flight_software_thread_ = std::make_unique<LockstepThread>([this] { ExecuteFlightSoftwareTick(); }, sync_interval);
+}
+
+void ObcWithC2a::SynchronizeFlightSoftware() {
+  if (flight_software_thread_ != nullptr) flight_software_thread_->Synchronize();
+}
+
+void ObcWithC2a::SaveState(CheckpointWriter& writer) const {
+  // No tick is executed during the save when sync_interval > 1
+  if (flight_software_thread_ != nullptr) flight_software_thread_->Synchronize();
+  OnBoardComputer::SaveState(writer);
+}
 
 void ObcWithC2a::Initialize() {
 #ifdef USE_C2A
@@ -48,37 +68,40 @@ void ObcWithC2a::Initialize() {
 void ObcWithC2a::MainRoutine(const int time_count) {
   UNUSED(time_count);
 
-#ifdef USE_C2A
+  // The ticks are executed on the flight software thread. They overlap with the rest of the simulation step only between the sync points.
+  if (flight_software_thread_ != nullptr) {
+    flight_software_thread_->Advance(timing_regulator_);
+    return;
+  }
+
+  for (int i = 0; i < timing_regulator_; i++) {
+    ExecuteFlightSoftwareTick();
+  }
+}
+
+void ObcWithC2a::ExecuteFlightSoftwareTick() {
   if (is_initialized == false) {
     is_initialized = true;
     Initialize();
   }
-  for (int i = 0; i < timing_regulator_; i++) {
-    TMGR_count_up_master_clock();  // The update time oc C2A clock should be
-                                   // 1msec
-    TDSP_execute_pl_as_task_list();
-  }
+#ifdef USE_C2A
+  TMGR_count_up_master_clock();  // The update time oc C2A clock should be
+                                 // 1msec
+  TDSP_execute_pl_as_task_list();
 #endif
 }
 
 // Override functions
 int ObcWithC2a::ConnectComPort(int port_id, int tx_buffer_size, int rx_buffer_size) {
-  if (com_ports_c2a_[port_id] != nullptr) {
-    // Port already used
-    return -1;
-  }
-  com_ports_c2a_[port_id] = new UartPort(tx_buffer_size, rx_buffer_size);
+  // Port already used or invalid port ID
+  if (!com_ports_c2a_.Connect(port_id, std::make_unique<UartPort>(tx_buffer_size, rx_buffer_size))) return -1;
   return 0;
 }
 
 // Close port and free resources
 int ObcWithC2a::CloseComPort(int port_id) {
   // Port not used
-  if (com_ports_c2a_[port_id] == nullptr) return -1;
-
-  UartPort* port = com_ports_c2a_.at(port_id);
-  delete port;
-  com_ports_c2a_.erase(port_id);
+  if (!com_ports_c2a_.Close(port_id)) return -1;
   return 0;
 }
 
@@ -87,13 +110,13 @@ int ObcWithC2a::SendFromObc(int port_id, unsigned char* buffer, int offset, int
 }
 
 int ObcWithC2a::ReceivedByCompo(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = com_ports_c2a_[port_id];
+  UartPort* port = com_ports_c2a_.Get(port_id);
   if (port == nullptr) return -1;
   return port->ReadTx(buffer, offset, length);
 }
 
 int ObcWithC2a::SendFromCompo(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = com_ports_c2a_[port_id];
+  UartPort* port = com_ports_c2a_.Get(port_id);
   if (port == nullptr) return -1;
   return port->WriteRx(buffer, offset, length);
 }
@@ -104,12 +127,12 @@ int ObcWithC2a::ReceivedByObc(int port_id, unsigned char* buffer, int offset, in
 
 // Static functions
 int ObcWithC2a::SendFromObc_C2A(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = com_ports_c2a_[port_id];
+  UartPort* port = com_ports_c2a_.Get(port_id);
   if (port == nullptr) return -1;
   return port->WriteTx(buffer, offset, length);
 }
 int ObcWithC2a::ReceivedByObc_C2A(int port_id, unsigned char* buffer, int offset, int length) {
-  UartPort* port = com_ports_c2a_[port_id];
+  UartPort* port = com_ports_c2a_.Get(port_id);
   if (port == nullptr) return -1;
   return port->ReadRx(buffer, offset, length);
 }
@@ -124,6 +147,7 @@ int OBC_C2A_ReceivedByObc(int port_id, unsigned char* buffer, int offset, int le
 }
 
 int ObcWithC2a::I2cConnectPort(int port_id, const unsigned char i2c_address) {
+  std::lock_guard<std::mutex> lock(port_mutex_);
   if (i2c_com_ports_c2a_[port_id] != nullptr) {
     // Port already used
   } else {
@@ -135,6 +159,7 @@ int ObcWithC2a::I2cConnectPort(int port_id, const unsigned char i2c_address) {
 }
 
 int ObcWithC2a::I2cCloseComPort(int port_id) {
+  std::lock_guard<std::mutex> lock(port_mutex_);
   // Port not used
   if (i2c_com_ports_c2a_[port_id] == nullptr) return -1;
 
@@ -145,12 +170,14 @@ int ObcWithC2a::I2cCloseComPort(int port_id) {
 }
 
 int ObcWithC2a::I2cWriteCommand(int port_id, const unsigned char i2c_address, const unsigned char* data, const unsigned char length) {
+  std::lock_guard<std::mutex> lock(port_mutex_);
   I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
   i2c_port->WriteCommand(i2c_address, data, length);
   return 0;
 }
 
 int ObcWithC2a::I2cWriteRegister(int port_id, const unsigned char i2c_address, const unsigned char* data, const unsigned char length) {
+  std::lock_guard<std::mutex> lock(port_mutex_);
   I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
 
   if (length == 1) {
@@ -164,6 +191,7 @@ int ObcWithC2a::I2cWriteRegister(int port_id, const unsigned char i2c_address, c
 }
 
 int ObcWithC2a::I2cReadRegister(int port_id, const unsigned char i2c_address, unsigned char* data, const unsigned char length) {
+  std::lock_guard<std::mutex> lock(port_mutex_);
   I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
   for (int i = 0; i < length; i++) {
     data[i] = i2c_port->ReadRegister(i2c_address);
@@ -173,6 +201,7 @@ int ObcWithC2a::I2cReadRegister(int port_id, const unsigned char i2c_address, un
 
 int ObcWithC2a::I2cComponentWriteRegister(int port_id, const unsigned char i2c_address, const unsigned char register_address,
                                           const unsigned char* data, const unsigned char length) {
+  std::lock_guard<std::mutex> lock(port_mutex_);
   I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
   for (unsigned char i = 0; i < length; i++) {
     i2c_port->WriteRegister(i2c_address, register_address + i, data[i]);
@@ -181,6 +210,7 @@ int ObcWithC2a::I2cComponentWriteRegister(int port_id, const unsigned char i2c_a
 }
 int ObcWithC2a::I2cComponentReadRegister(int port_id, const unsigned char i2c_address, const unsigned char register_address, unsigned char* data,
                                          const unsigned char length) {
+  std::lock_guard<std::mutex> lock(port_mutex_);
   I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
   for (unsigned char i = 0; i < length; i++) {
     data[i] = i2c_port->ReadRegister(i2c_address, register_address + i);
@@ -188,6 +218,7 @@ int ObcWithC2a::I2cComponentReadRegister(int port_id, const unsigned char i2c_ad
   return 0;
 }
 int ObcWithC2a::I2cComponentReadCommand(int port_id, const unsigned char i2c_address, unsigned char* data, const unsigned char length) {
+  std::lock_guard<std::mutex> lock(port_mutex_);
   I2cPort* i2c_port = i2c_com_ports_c2a_[port_id];
   i2c_port->ReadCommand(i2c_address, data, length);
   return 0;
@@ -204,6 +235,7 @@ int OBC_C2A_I2cReadRegister(int port_id, const unsigned char i2c_address, unsign
 }
 
 int ObcWithC2a::GpioConnectPort(int port_id) {
+  std::lock_guard<std::mutex> lock(port_mutex_);
   if (gpio_ports_c2a_[port_id] != nullptr) {
     // Port already used
     return -1;
@@ -213,24 +245,28 @@ int ObcWithC2a::GpioConnectPort(int port_id) {
 }
 
 int ObcWithC2a::GpioComponentWrite(int port_id, const bool is_high) {
+  std::lock_guard<std::mutex> lock(port_mutex_);
   GpioPort* port = gpio_ports_c2a_[port_id];
   if (port == nullptr) return -1;
   return port->DigitalWrite(is_high);
 }
 
 bool ObcWithC2a::GpioComponentRead(int port_id) {
+  std::lock_guard<std::mutex> lock(port_mutex_);
   GpioPort* port = gpio_ports_c2a_[port_id];
   if (port == nullptr) return false;
   return port->DigitalRead();
 }
 
 int ObcWithC2a::GpioWrite_C2A(int port_id, const bool is_high) {
+  std::lock_guard<std::mutex> lock(port_mutex_);
   GpioPort* port = gpio_ports_c2a_[port_id];
   if (port == nullptr) return -1;
   return port->DigitalWrite(is_high);
 }
 
 bool ObcWithC2a::GpioRead_C2A(int port_id) {
+  std::lock_guard<std::mutex> lock(port_mutex_);
   GpioPort* port = gpio_ports_c2a_[port_id];
   if (port == nullptr) return false;
   return port->DigitalRead();
@@ -7,12 +7,19 @@
 #define S2E_COMPONENTS_REAL_CDH_OBC_C2A_HPP_
 
 #include <components/ports/gpio_port.hpp>
+#include <library/utilities/lockstep_thread.hpp>
+#include <memory>
+#include <mutex>
 
 #include "on_board_computer.hpp"
 
 /*
  * @class ObcWithC2a
  * @brief Class to emulate on board computer with C2A flight software
+ * @details C2A is executed in the component update by default. When the flight software thread is enabled, C2A is executed on a dedicated
+ *          thread, and the two threads are synchronized with the credits of the C2A clock ticks. The UART ports are lock-free
+ *          single-producer single-consumer buffers, and the I2C and GPIO ports are protected by a mutex, so the components can communicate
+ *          with C2A from the simulation thread.
  */
 class ObcWithC2a : public OnBoardComputer {
  public:
@@ -44,6 +51,31 @@ class ObcWithC2a : public OnBoardComputer {
    */
   ~ObcWithC2a();
 
+  /**
+   * @fn EnableFlightSoftwareThread
+   * @brief Execute C2A on a dedicated thread
+   * @note This function should be called before the first update of the component.
+   *       In each update, the timing_regulator ticks of C2A are granted to the thread. At every sync_interval-th update, the update waits
+   *       until C2A executes all of the granted ticks, so the other components access the ports after C2A as in the update without the
+   *       thread. With sync_interval = 1, the simulation results are the same as without the thread. When sync_interval > 1, C2A runs in
+   *       parallel with the other components between the sync points, and the port data exchanged with them depends on the thread
+   *       scheduling, so the simulation results are nondeterministic.
+   * @param [in] sync_interval: Number of the component updates between the sync points
+   */
+  void EnableFlightSoftwareThread(const size_t sync_interval = 1);
+  /**
+   * @fn SynchronizeFlightSoftware
+   * @brief Wait until C2A executes all of the granted ticks. It does nothing when the flight software thread is not enabled.
+   */
+  void SynchronizeFlightSoftware();
+
+  /**
+   * @fn SaveState
+   * @brief Wait for the flight software thread and write the states of the ports to the checkpoint
+   * @note The internal state of C2A is not included.
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+
   // UART Communication port functions. TODO:Rename the following functions to UartHogeHoge
   /**
    * @fn ConnectComPort
@@ -250,8 +282,9 @@ class ObcWithC2a : public OnBoardComputer {
   static bool GpioRead_C2A(int port_id);
 
  private:
-  bool is_initialized = false;  //!< Is initialized flag
-  const int timing_regulator_;  //!< Timing regulator to update flight software faster than the component update
+  bool is_initialized = false;                              //!< Is initialized flag
+  const int timing_regulator_;                              //!< Timing regulator to update flight software faster than the component update
+  std::unique_ptr<LockstepThread> flight_software_thread_;  //!< Thread to execute C2A (nullptr when C2A is executed in the update)
 
   // Override functions for Component
   /**
@@ -264,8 +297,14 @@ class ObcWithC2a : public OnBoardComputer {
    * @brief Initialize function
    */
   void Initialize();
+  /**
+   * @fn ExecuteFlightSoftwareTick
+   * @brief Execute one tick (1 msec) of C2A. C2A is initialized before the first tick.
+   */
+  void ExecuteFlightSoftwareTick();
 
-  static std::map<int, UartPort*> com_ports_c2a_;     //!< UART ports
+  static PortTable<UartPort> com_ports_c2a_;          //!< UART ports
+  static std::mutex port_mutex_;                      //!< Mutex for the I2C and GPIO ports accessed from the flight software thread
   static std::map<int, I2cPort*> i2c_com_ports_c2a_;  //!< I2C ports
   static std::map<int, GpioPort*> gpio_ports_c2a_;    //!< GPIO ports
 };
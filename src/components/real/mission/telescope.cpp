@@ -107,10 +107,17 @@ void Telescope::ObserveStars() {
   Quaternion quaternion_i2b = attitude_->GetQuaternion_i2b();
 
   star_list_in_sight.clear();  // Clear first
-  int count = 0;               // Counter for while loop
 
-  while (star_list_in_sight.size() < number_of_logged_stars_) {
-    libra::Vector<3> target_b = hipparcos_->GetStarDirection_b(count, quaternion_i2b);
+  // Candidates in brightness order from the sky index. The cone circumscribes the rectangular field of view.
+  libra::Vector<3> sight_direction_i = quaternion_i2b.InverseFrameConversion(quaternion_b2c_.InverseFrameConversion(sight_direction_c_));
+  const double tan_x = tan(x_field_of_view_rad);
+  const double tan_y = tan(y_field_of_view_rad);
+  const double half_angle_rad = atan(sqrt(tan_x * tan_x + tan_y * tan_y));
+  hipparcos_->FindStarsInCone(sight_direction_i, half_angle_rad, candidate_ranks_);
+
+  for (size_t i = 0; i < candidate_ranks_.size() && star_list_in_sight.size() < number_of_logged_stars_; i++) {
+    const int rank = (int)candidate_ranks_[i];
+    libra::Vector<3> target_b = hipparcos_->GetStarDirection_b(rank, quaternion_i2b);
     libra::Vector<3> target_c = quaternion_b2c_.FrameConversion(target_b);
 
     double arg_x = atan2(target_c[2], target_c[0]);  // Angle from X-axis on XZ plane in the component frame
@@ -118,34 +125,28 @@ void Telescope::ObserveStars() {
 
     if (abs(arg_x) <= x_field_of_view_rad && abs(arg_y) <= y_field_of_view_rad) {
       Star star;
-      star.hipparcos_data.hipparcos_id = hipparcos_->GetHipparcosId(count);
-      star.hipparcos_data.visible_magnitude = hipparcos_->GetVisibleMagnitude(count);
-      star.hipparcos_data.right_ascension_deg = hipparcos_->GetRightAscension_deg(count);
-      star.hipparcos_data.declination_deg = hipparcos_->GetDeclination_deg(count);
+      star.hipparcos_data.hipparcos_id = hipparcos_->GetHipparcosId(rank);
+      star.hipparcos_data.visible_magnitude = hipparcos_->GetVisibleMagnitude(rank);
+      star.hipparcos_data.right_ascension_deg = hipparcos_->GetRightAscension_deg(rank);
+      star.hipparcos_data.declination_deg = hipparcos_->GetDeclination_deg(rank);
       star.position_image_sensor[0] = x_number_of_pix_ / 2.0 * tan(arg_x) / tan(x_field_of_view_rad) + x_number_of_pix_ / 2.0;
       star.position_image_sensor[1] = y_number_of_pix_ / 2.0 * tan(arg_y) / tan(y_field_of_view_rad) + y_number_of_pix_ / 2.0;
 
       star_list_in_sight.push_back(star);
     }
+  }
 
-    count++;
-
-    // If read all catalogue, fill -1 and break the loop
-    if (count >= hipparcos_->GetCatalogueSize()) {
-      while (star_list_in_sight.size() < number_of_logged_stars_) {
-        Star star;
-        star.hipparcos_data.hipparcos_id = -1;
-        star.hipparcos_data.visible_magnitude = -1;
-        star.hipparcos_data.right_ascension_deg = -1;
-        star.hipparcos_data.declination_deg = -1;
-        star.position_image_sensor[0] = -1;
-        star.position_image_sensor[1] = -1;
-
-        star_list_in_sight.push_back(star);
-      }
+  // If there are not enough stars in the field of view, fill -1
+  while (star_list_in_sight.size() < number_of_logged_stars_) {
+    Star star;
+    star.hipparcos_data.hipparcos_id = -1;
+    star.hipparcos_data.visible_magnitude = -1;
+    star.hipparcos_data.right_ascension_deg = -1;
+    star.hipparcos_data.declination_deg = -1;
+    star.position_image_sensor[0] = -1;
+    star.position_image_sensor[1] = -1;
 
-      break;
-    }
+    star_list_in_sight.push_back(star);
   }
 }
 
@@ -201,3 +202,25 @@ string Telescope::GetLogValue() const {
   //**********************************************************
   return str_tmp;
 }
+
+void Telescope::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write(is_sun_in_forbidden_angle);
+  writer.Write(is_earth_in_forbidden_angle);
+  writer.Write(is_moon_in_forbidden_angle);
+  writer.Write(sun_position_image_sensor);
+  writer.Write(earth_position_image_sensor);
+  writer.Write(moon_position_image_sensor);
+  writer.Write(star_list_in_sight);
+}
+
+void Telescope::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.Read(is_sun_in_forbidden_angle);
+  reader.Read(is_earth_in_forbidden_angle);
+  reader.Read(is_moon_in_forbidden_angle);
+  reader.Read(sun_position_image_sensor);
+  reader.Read(earth_position_image_sensor);
+  reader.Read(moon_position_image_sensor);
+  reader.Read(star_list_in_sight);
+}
@@ -58,6 +58,18 @@ class Telescope : public Component, public ILoggable {
    */
   ~Telescope();
 
+  // Override functions for Component
+  /**
+   * @fn SaveState
+   * @brief Write the observation results to the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Restore the observation results from the checkpoint
+   */
+  void LoadState(CheckpointReader& reader) override;
+
   // Getter
   inline bool GetIsSunInForbiddenAngle() const { return is_sun_in_forbidden_angle; }
   inline bool GetIsEarthInForbiddenAngle() const { return is_earth_in_forbidden_angle; }
@@ -90,6 +102,7 @@ class Telescope : public Component, public ILoggable {
   libra::Vector<2> moon_position_image_sensor{-1};   //!< Position of the moon on the image plane
 
   std::vector<Star> star_list_in_sight;  //!< Star information in the field of view
+  std::vector<size_t> candidate_ranks_;  //!< Ranks of the stars in the cone circumscribing the field of view
 
   /**
    * @fn JudgeForbiddenAngle
@@ -85,3 +85,17 @@ void Battery::UpdateBatVoltage() {
   }
   battery_voltage_V_ = temp * number_of_series_;
 }
+
+void Battery::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write(battery_voltage_V_);
+  writer.Write(depth_of_discharge_percent_);
+  writer.Write(charge_current_A_);
+}
+
+void Battery::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.Read(battery_voltage_V_);
+  reader.Read(depth_of_discharge_percent_);
+  reader.Read(charge_current_A_);
+}
@@ -95,6 +95,18 @@ class Battery : public Component, public ILoggable {
    */
   inline double GetCvChargeVoltage_V() const { return cv_charge_voltage_V_; }
 
+  // Override functions for Component
+  /**
+   * @fn SaveState
+   * @brief Write the depth of discharge, the voltage, and the charge current to the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Restore the depth of discharge, the voltage, and the charge current from the checkpoint
+   */
+  void LoadState(CheckpointReader& reader) override;
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -109,3 +109,15 @@ void PcuInitialStudy::UpdateChargeCurrentAndBusVoltage() {
     }
   }
 }
+
+void PcuInitialStudy::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write(bus_voltage_V_);
+  writer.Write(power_consumption_W_);
+}
+
+void PcuInitialStudy::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.Read(bus_voltage_V_);
+  reader.Read(power_consumption_W_);
+}
@@ -40,6 +40,18 @@ class PcuInitialStudy : public Component, public ILoggable {
    */
   ~PcuInitialStudy();
 
+  // Override functions for Component
+  /**
+   * @fn SaveState
+   * @brief Write the bus voltage and the power consumption to the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Restore the bus voltage and the power consumption from the checkpoint
+   */
+  void LoadState(CheckpointReader& reader) override;
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -112,3 +112,15 @@ void SolarArrayPanel::MainRoutine(const int time_count) {
   }
   if (power_generation_W_ < 0) power_generation_W_ = 0.0;
 }
+
+void SolarArrayPanel::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write(voltage_V_);
+  writer.Write(power_generation_W_);
+}
+
+void SolarArrayPanel::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.Read(voltage_V_);
+  reader.Read(power_generation_W_);
+}
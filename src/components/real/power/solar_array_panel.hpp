@@ -94,6 +94,18 @@ class SolarArrayPanel : public Component, public ILoggable {
    */
   void SetVoltage_V(const double voltage_V) { voltage_V_ = voltage_V; }
 
+  // Override functions for Component
+  /**
+   * @fn SaveState
+   * @brief Write the voltage and the generated power to the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Restore the voltage and the generated power from the checkpoint
+   */
+  void LoadState(CheckpointReader& reader) override;
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
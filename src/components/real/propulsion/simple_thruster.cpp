@@ -118,3 +118,21 @@ libra::Vector<3> SimpleThruster::CalcThrustDirection() {
 
   return thrust_dir_b_true;
 }
+
+void SimpleThruster::SaveState(CheckpointWriter& writer) const {
+  Component::SaveState(writer);
+  writer.Write(duty_);
+  writer.Write(output_thrust_b_N_);
+  writer.Write(output_torque_b_Nm_);
+  magnitude_random_noise_.SaveState(writer);
+  direction_random_noise_.SaveState(writer);
+}
+
+void SimpleThruster::LoadState(CheckpointReader& reader) {
+  Component::LoadState(reader);
+  reader.Read(duty_);
+  reader.Read(output_thrust_b_N_);
+  reader.Read(output_torque_b_Nm_);
+  magnitude_random_noise_.LoadState(reader);
+  direction_random_noise_.LoadState(reader);
+}
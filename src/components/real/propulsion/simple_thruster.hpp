@@ -74,6 +74,16 @@ class SimpleThruster : public Component, public ILoggable {
    * @brief Power off routine to stop force generation
    */
   void PowerOffRoutine() override;
+  /**
+   * @fn SaveState
+   * @brief Write the duty, the output thrust, and the noise state to the checkpoint
+   */
+  void SaveState(CheckpointWriter& writer) const override;
+  /**
+   * @fn LoadState
+   * @brief Restore the duty, the output thrust, and the noise state from the checkpoint
+   */
+  void LoadState(CheckpointReader& reader) override;
 
   // Override ILoggable
   /**
@@ -31,41 +31,52 @@ void AirDrag::Update(const LocalEnvironment& local_environment, const Dynamics&
 void AirDrag::CalcCoefficients(const libra::Vector<3>& velocity_b_m_s, const double air_density_kg_m3) {
   double velocity_norm_m_s = velocity_b_m_s.CalcNorm();
   CalcCnCt(velocity_b_m_s);
-  for (size_t i = 0; i < surfaces_.size(); i++) {
-    double k = 0.5 * air_density_kg_m3 * velocity_norm_m_s * velocity_norm_m_s * surfaces_[i].GetArea_m2();
+  const double dynamic_pressure_N_m2 = 0.5 * air_density_kg_m3 * velocity_norm_m_s * velocity_norm_m_s;
+  const size_t number_of_surfaces = cos_theta_.size();
+  for (size_t i = 0; i < number_of_surfaces; i++) {
+    double k = dynamic_pressure_N_m2 * area_m2_[i];
     normal_coefficients_[i] = k * cn_[i];
     tangential_coefficients_[i] = k * ct_[i];
   }
 }
 
-double AirDrag::CalcFunctionPi(const double s) {
-  double x;
-  double erfs = erf(s);  // ERF function is defined in math standard library
-  x = s * exp(-s * s) + sqrt(libra::pi) * (s * s + 0.5) * (1.0 + erfs);
-  return x;
-}
-
-double AirDrag::CalcFunctionChi(const double s) {
-  double x;
-  double erfs = erf(s);
-  x = exp(-s * s) + sqrt(libra::pi) * s * (1.0 + erfs);
-  return x;
+void AirDrag::CalcFunctionPiChi(const double s, double& pi, double& chi) {
+  // The exponential and the ERF function (defined in math standard library) are shared by the two functions
+  const double exp_s2 = exp(-s * s);
+  const double sqrt_pi_erfs = sqrt(libra::pi) * (1.0 + erf(s));
+  pi = s * exp_s2 + (s * s + 0.5) * sqrt_pi_erfs;
+  chi = exp_s2 + s * sqrt_pi_erfs;
 }
 
 void AirDrag::CalcCnCt(const Vector<3>& velocity_b_m_s) {
   double velocity_norm_m_s = velocity_b_m_s.CalcNorm();
+  const size_t number_of_surfaces = cos_theta_.size();
+  if (cn_.size() != number_of_surfaces) {
+    ct_.assign(number_of_surfaces, 1.0);
+    cn_.assign(number_of_surfaces, 0.0);
+  }
 
   // Re-emitting speed
   double speed =
       sqrt(molecular_weight_g_mol_ * velocity_norm_m_s * velocity_norm_m_s / (2.0 * environment::boltzmann_constant_J_K * wall_temperature_K_));
-  // CalcTheta(vel_b);
-  for (size_t i = 0; i < surfaces_.size(); i++) {
+  // Constant factors of the surfaces
+  const double inv_speed2 = 1.0 / (speed * speed);
+  const double inv_sqrt_pi = 1.0 / sqrt(libra::pi);
+  const double temperature_ratio = sqrt(wall_temperature_K_ / molecular_temperature_K_);
+  for (size_t i = 0; i < number_of_surfaces; i++) {
+    // The surfaces which do not face to the air are masked out in SurfaceForce::CalcTorqueForce
+    if (cos_theta_[i] <= 0.0) {
+      cn_[i] = 0.0;
+      ct_[i] = 0.0;
+      continue;
+    }
     double speed_n = speed * cos_theta_[i];
     double speed_t = speed * sin_theta_[i];
-    double diffuse = 1.0 - surfaces_[i].GetAirSpecularity();
-    cn_[i] = (2.0 - diffuse) / sqrt(libra::pi) * CalcFunctionPi(speed_n) / (speed * speed) +
-             diffuse / 2.0 * CalcFunctionChi(speed_n) / (speed * speed) * sqrt(wall_temperature_K_ / molecular_temperature_K_);
-    ct_[i] = diffuse * speed_t * CalcFunctionChi(speed_n) / (sqrt(libra::pi) * speed * speed);
+    double diffuse = 1.0 - air_specularity_[i];
+    double pi, chi;
+    CalcFunctionPiChi(speed_n, pi, chi);
+    cn_[i] = ((2.0 - diffuse) * inv_sqrt_pi * pi + diffuse / 2.0 * chi * temperature_ratio) * inv_speed2;
+    ct_[i] = diffuse * speed_t * chi * inv_sqrt_pi * inv_speed2;
   }
 }
 
@@ -86,3 +97,8 @@ std::string AirDrag::GetLogValue() const {
 
   return str_tmp;
 }
+
+void AirDrag::PushLogValue(LogValueBuffer& buffer) const {
+  buffer.Push(torque_b_Nm_);
+  buffer.Push(force_b_N_);
+}
@@ -52,6 +52,11 @@ class AirDrag : public SurfaceForce {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn PushLogValue
+   * @brief Override PushLogValue function of ILoggable
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const;
 
  private:
   std::vector<double> cn_;          //!< Coefficients for out-plane force
@@ -76,17 +81,13 @@ class AirDrag : public SurfaceForce {
    */
   void CalcCnCt(const libra::Vector<3>& velocity_b_m_s);
   /**
-   * @fn CalcFunctionPi
-   * @brief Calculate The Pi function in the algorithm
-   * @param [in] s: Independent variable of the Pi function
-   */
-  double CalcFunctionPi(const double s);
-  /**
-   * @fn CalcFunctionChi
-   * @brief Calculate The Chi function in the algorithm
-   * @param [in] s: Independent variable of the Chi function
+   * @fn CalcFunctionPiChi
+   * @brief Calculate The Pi and Chi functions in the algorithm
+   * @param [in] s: Independent variable of the Pi and Chi functions
+   * @param [out] pi: Pi function
+   * @param [out] chi: Chi function
    */
-  double CalcFunctionChi(const double s);
+  void CalcFunctionPiChi(const double s, double& pi, double& chi);
 };
 
 #endif  // S2E_DISTURBANCES_AIR_DRAG_HPP_
@@ -0,0 +1,178 @@
+/**
+ * @file benchmark_surface_force.cpp
+ * @brief Benchmark codes for SurfaceForce class with Google Benchmark
+ * @note Argument: number of surfaces
+ */
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+
+#include "air_drag.hpp"
+#include "solar_radiation_pressure_disturbance.hpp"
+
+namespace {
+const double kWallTemperature_K = 30.0;
+const double kMolecularTemperature_K = 3.0;
+const double kMolecularWeight_g_mol = 18.0;
+const double kAirDensity_kg_m3 = 2.0e-12;
+const double kSolarPressure_N_m2 = 4.56e-6;
+
+/**
+ * @class SolarRadiationPressureForBenchmark
+ * @brief SolarRadiationPressureDisturbance class to access the force calculation
+ */
+class SolarRadiationPressureForBenchmark : public SolarRadiationPressureDisturbance {
+ public:
+  using SolarRadiationPressureDisturbance::SolarRadiationPressureDisturbance;
+  libra::Vector<3> Calc(libra::Vector<3> sun_direction_b, const double pressure_N_m2) { return CalcTorqueForce(sun_direction_b, pressure_N_m2); }
+};
+
+/**
+ * @class AirDragForBenchmark
+ * @brief AirDrag class to access the force calculation
+ */
+class AirDragForBenchmark : public AirDrag {
+ public:
+  using AirDrag::AirDrag;
+  libra::Vector<3> Calc(libra::Vector<3> velocity_b_m_s, const double air_density_kg_m3) {
+    return CalcTorqueForce(velocity_b_m_s, air_density_kg_m3);
+  }
+};
+
+/**
+ * @fn MakeSurfaces
+ * @brief Make surfaces with random positions and normal vectors
+ */
+std::vector<Surface> MakeSurfaces(const size_t number_of_surfaces) {
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  std::vector<Surface> surfaces;
+  for (size_t i = 0; i < number_of_surfaces; i++) {
+    libra::Vector<3> position_b_m, normal_b;
+    for (size_t axis = 0; axis < 3; axis++) {
+      position_b_m[axis] = distribution(generator);
+      normal_b[axis] = distribution(generator);
+    }
+    surfaces.push_back(Surface(position_b_m, normal_b.CalcNormalizedVector(), 0.01, 0.5, 0.5, 0.5));
+  }
+  return surfaces;
+}
+
+/**
+ * @fn MakeDirection
+ * @brief Make the input direction which rotates slowly at each step
+ */
+libra::Vector<3> MakeDirection(const size_t step, const double norm) {
+  libra::Vector<3> direction;
+  direction[0] = norm * cos(0.01 * step);
+  direction[1] = norm * sin(0.01 * step) * 0.8;
+  direction[2] = norm * sin(0.01 * step) * 0.6;
+  return direction;
+}
+
+/**
+ * @fn CalcAirDragReference
+ * @brief Reference implementation of the previous AirDrag::CalcCnCt and SurfaceForce::CalcTorqueForce
+ * @note Each surface is accessed as an object and the in-plane direction is calculated with the outer products.
+ */
+libra::Vector<3> CalcAirDragReference(const std::vector<Surface>& surfaces, const libra::Vector<3>& center_of_gravity_b_m,
+                                      const libra::Vector<3>& velocity_b_m_s, const double air_density_kg_m3, libra::Vector<3>& force_b_N) {
+  const double velocity_norm_m_s = velocity_b_m_s.CalcNorm();
+  const double speed = sqrt(kMolecularWeight_g_mol * velocity_norm_m_s * velocity_norm_m_s /
+                            (2.0 * environment::boltzmann_constant_J_K * kWallTemperature_K));
+  const libra::Vector<3> input_b_normal = velocity_b_m_s.CalcNormalizedVector();
+
+  force_b_N = libra::Vector<3>(0.0);
+  libra::Vector<3> torque_b_Nm(0.0);
+  for (size_t i = 0; i < surfaces.size(); i++) {
+    const double cos_theta = InnerProduct(surfaces[i].GetNormal_b(), input_b_normal);
+    const double sin_theta = sqrt(1.0 - cos_theta * cos_theta);
+    const double speed_n = speed * cos_theta;
+    const double speed_t = speed * sin_theta;
+    const double diffuse = 1.0 - surfaces[i].GetAirSpecularity();
+    const double pi = speed_n * exp(-speed_n * speed_n) + sqrt(libra::pi) * (speed_n * speed_n + 0.5) * (1.0 + erf(speed_n));
+    const double chi = exp(-speed_n * speed_n) + sqrt(libra::pi) * speed_n * (1.0 + erf(speed_n));
+    const double cn = (2.0 - diffuse) / sqrt(libra::pi) * pi / (speed * speed) +
+                      diffuse / 2.0 * chi / (speed * speed) * sqrt(kWallTemperature_K / kMolecularTemperature_K);
+    const double ct = diffuse * speed_t * chi / (sqrt(libra::pi) * speed * speed);
+    const double k = 0.5 * air_density_kg_m3 * velocity_norm_m_s * velocity_norm_m_s * surfaces[i].GetArea_m2();
+    if (cos_theta > 0.0) {
+      libra::Vector<3> normal = surfaces[i].GetNormal_b();
+      libra::Vector<3> ncu_normalized = OuterProduct(input_b_normal, normal).CalcNormalizedVector();
+      libra::Vector<3> in_plane_force_direction = OuterProduct(ncu_normalized, normal);
+      libra::Vector<3> force_per_surface_b_N = -1.0 * k * cn * normal + k * ct * in_plane_force_direction;
+      force_b_N += force_per_surface_b_N;
+      torque_b_Nm += OuterProduct(surfaces[i].GetPosition_b_m() - center_of_gravity_b_m, force_per_surface_b_N);
+    }
+  }
+  return torque_b_Nm;
+}
+}  // namespace
+
+/**
+ * @brief Benchmark of the previous air drag calculation
+ */
+static void BM_AirDragReference(benchmark::State& state) {
+  const std::vector<Surface> surfaces = MakeSurfaces((size_t)state.range(0));
+  const libra::Vector<3> center_of_gravity_b_m(0.01);
+  libra::Vector<3> force_b_N;
+  size_t step = 0;
+  for (auto _ : state) {
+    libra::Vector<3> torque_b_Nm = CalcAirDragReference(surfaces, center_of_gravity_b_m, MakeDirection(step++, 7500.0), kAirDensity_kg_m3, force_b_N);
+    benchmark::DoNotOptimize(torque_b_Nm);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AirDragReference)->RangeMultiplier(4)->Range(8, 8 << 10);
+
+/**
+ * @brief Benchmark of AirDrag
+ */
+static void BM_AirDrag(benchmark::State& state) {
+  const std::vector<Surface> surfaces = MakeSurfaces((size_t)state.range(0));
+  const libra::Vector<3> center_of_gravity_b_m(0.01);
+  AirDragForBenchmark air_drag(surfaces, center_of_gravity_b_m, kWallTemperature_K, kMolecularTemperature_K, kMolecularWeight_g_mol);
+  size_t step = 0;
+  for (auto _ : state) {
+    libra::Vector<3> torque_b_Nm = air_drag.Calc(MakeDirection(step++, 7500.0), kAirDensity_kg_m3);
+    benchmark::DoNotOptimize(torque_b_Nm);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AirDrag)->RangeMultiplier(4)->Range(8, 8 << 10);
+
+/**
+ * @brief Benchmark of SolarRadiationPressureDisturbance
+ */
+static void BM_SolarRadiationPressure(benchmark::State& state) {
+  const std::vector<Surface> surfaces = MakeSurfaces((size_t)state.range(0));
+  const libra::Vector<3> center_of_gravity_b_m(0.01);
+  SolarRadiationPressureForBenchmark srp(surfaces, center_of_gravity_b_m);
+  size_t step = 0;
+  for (auto _ : state) {
+    libra::Vector<3> torque_b_Nm = srp.Calc(MakeDirection(step++, 1.5e11), kSolarPressure_N_m2);
+    benchmark::DoNotOptimize(torque_b_Nm);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SolarRadiationPressure)->RangeMultiplier(4)->Range(8, 8 << 10);
+
+/**
+ * @brief Benchmark of SolarRadiationPressureDisturbance with the self-shadowing
+ * @note The direction repeats every 628 steps, so the lit fractions are read from the cache after the first revolution.
+ */
+static void BM_SolarRadiationPressureWithOcclusion(benchmark::State& state) {
+  const std::vector<Surface> surfaces = MakeSurfaces((size_t)state.range(0));
+  const libra::Vector<3> center_of_gravity_b_m(0.01);
+  SolarRadiationPressureForBenchmark srp(surfaces, center_of_gravity_b_m);
+  srp.EnableOcclusion(1.0 * libra::deg_to_rad, 16);
+  size_t step = 0;
+  for (auto _ : state) {
+    libra::Vector<3> torque_b_Nm = srp.Calc(MakeDirection(step++ % 628, 1.5e11), kSolarPressure_N_m2);
+    benchmark::DoNotOptimize(torque_b_Nm);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["cached_directions"] = (double)srp.GetOcclusion().GetNumberOfCachedDirections();
+}
+BENCHMARK(BM_SolarRadiationPressureWithOcclusion)->RangeMultiplier(4)->Range(8, 8 << 10);
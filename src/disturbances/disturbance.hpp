@@ -8,6 +8,7 @@
 
 #include "../environment/local/local_environment.hpp"
 #include "../library/math/vector.hpp"
+#include "../library/utilities/checkpoint.hpp"
 
 /**
  * @class Disturbance
@@ -82,6 +83,33 @@ class Disturbance : public ILoggable {
    */
   virtual inline bool IsAttitudeDependent() { return is_attitude_dependent_; }
 
+  /**
+   * @fn SaveState
+   * @brief Write the disturbance force, torque, and acceleration to the checkpoint
+   * @note The disturbance is not updated at every step, so the latest values are kept.
+   *       Override this when the disturbance has the other internal state (ex. noise).
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveState(CheckpointWriter& writer) const {
+    writer.BeginSection("Disturbance");
+    writer.Write(force_b_N_);
+    writer.Write(torque_b_Nm_);
+    writer.Write(acceleration_b_m_s2_);
+    writer.Write(acceleration_i_m_s2_);
+  }
+  /**
+   * @fn LoadState
+   * @brief Restore the disturbance force, torque, and acceleration from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadState(CheckpointReader& reader) {
+    reader.BeginSection("Disturbance");
+    reader.Read(force_b_N_);
+    reader.Read(torque_b_Nm_);
+    reader.Read(acceleration_b_m_s2_);
+    reader.Read(acceleration_i_m_s2_);
+  }
+
  protected:
   bool is_calculation_enabled_;           //!< Flag to calculate the disturbance
   bool is_attitude_dependent_;            //!< Flag to show the disturbance depends on attitude information
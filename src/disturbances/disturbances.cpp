@@ -6,6 +6,8 @@
 #include "disturbances.hpp"
 
 #include <library/initialize/initialize_file_access.hpp>
+#include <library/utilities/profiler.hpp>
+#include <typeinfo>
 
 #include "air_drag.hpp"
 #include "geopotential.hpp"
@@ -35,10 +37,12 @@ void Disturbances::Update(const LocalEnvironment& local_environment, const Dynam
   for (auto disturbance : disturbances_list_) {
     if (simulation_time->GetOrbitPropagateFlag()) {
       // Update disturbances that depend only on the position
+      S2E_PROFILE_SCOPE(typeid(*disturbance).name());
       disturbance->UpdateIfEnabled(local_environment, dynamics);
     } else if (simulation_time->GetAttitudePropagateFlag()) {
       // Update disturbances that depend on the attitude (and the position)
       if (disturbance->IsAttitudeDependent() == true) {
+        S2E_PROFILE_SCOPE(typeid(*disturbance).name());
         disturbance->UpdateIfEnabled(local_environment, dynamics);
       }
     }
@@ -55,6 +59,28 @@ void Disturbances::LogSetup(Logger& logger) {
   logger.CopyFileToLogDirectory(initialize_file_name_);
 }
 
+void Disturbances::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("Disturbances");
+  writer.Write((uint64_t)disturbances_list_.size());
+  for (auto disturbance : disturbances_list_) {
+    disturbance->SaveState(writer);
+  }
+  writer.Write(total_torque_b_Nm_);
+  writer.Write(total_force_b_N_);
+  writer.Write(total_acceleration_i_m_s2_);
+}
+
+void Disturbances::LoadState(CheckpointReader& reader) {
+  reader.BeginSection("Disturbances");
+  reader.ReadSizeAndCheck(disturbances_list_.size(), "disturbances");
+  for (auto disturbance : disturbances_list_) {
+    disturbance->LoadState(reader);
+  }
+  reader.Read(total_torque_b_Nm_);
+  reader.Read(total_force_b_N_);
+  reader.Read(total_acceleration_i_m_s2_);
+}
+
 void Disturbances::InitializeInstances(const SimulationConfiguration* simulation_configuration, const int spacecraft_id, const Structure* structure,
                                        const GlobalEnvironment* global_environment) {
   IniAccess ini_access = IniAccess(simulation_configuration->spacecraft_file_list_[spacecraft_id]);
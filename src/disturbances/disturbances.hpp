@@ -50,6 +50,18 @@ class Disturbances {
    * @param [in] logger: Logger
    */
   void LogSetup(Logger& logger);
+  /**
+   * @fn SaveState
+   * @brief Write the states of all disturbances to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the states of all disturbances from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
 
   /**
    * @fn GetTorque
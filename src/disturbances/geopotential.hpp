@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "../library/gravity/gravity_potential.hpp"
 #include "../library/logger/loggable.hpp"
 #include "../library/math/matrix.hpp"
 #include "../library/math/matrix_vector.hpp"
@@ -48,49 +49,29 @@ class Geopotential : public Disturbance {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn PushLogValue
+   * @brief Override PushLogValue function of ILoggable
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const;
 
  private:
   int degree_;                          //!< Maximum degree setting to calculate the geo-potential
-  int n_ = 0, m_ = 0;                   //!< Degree and order (FIXME: follow naming rule)
   std::vector<std::vector<double>> c_;  //!< Cosine coefficients
   std::vector<std::vector<double>> s_;  //!< Sine coefficients
+  GravityPotential gravity_potential_;  //!< Gravity potential calculation engine
   Vector<3> acceleration_ecef_m_s2_;    //!< Calculated acceleration in the ECEF frame [m/s2]
 
-  // calculation
-  double radius_m_ = 0.0;                                    //!< Radius [m]
-  double ecef_x_m_ = 0.0, ecef_y_m_ = 0.0, ecef_z_m_ = 0.0;  //!< Spacecraft position in ECEF frame [m]
-
   // debug
   libra::Vector<3> debug_pos_ecef_m_;  //!< Spacecraft position in ECEF frame [m]
   double time_ms_ = 0.0;               //!< Calculation time [ms]
 
-  /**
-   * @fn CalcAccelerationEcef
-   * @brief Calculate the high-order earth gravity in the ECEF frame
-   * @param [in] position_ecef_m: Position of the spacecraft in the ECEF fram [m]
-   */
-  void CalcAccelerationEcef(const Vector<3> &position_ecef_m);
-
   /**
    * @fn ReadCoefficientsEgm96
    * @brief Read the geo-potential coefficients for the EGM96 model
    * @param [in] file_name: Coefficient file name
    */
   bool ReadCoefficientsEgm96(std::string file_name);
-
-  /**
-   * @fn v_w_nn_update
-   * @brief Calculate V and W function for n = m
-   * @note FIXME: fix function name
-   */
-  void v_w_nn_update(double *v_nn, double *w_nn, const double v_prev, const double w_prev);
-
-  /**
-   * @fn v_w_nm_update
-   * @brief Calculate V and W function for n not equal m
-   * @note FIXME: fix function name
-   */
-  void v_w_nm_update(double *v_nm, double *w_nm, const double v_prev, const double w_prev, const double v_prev2, const double w_prev2);
 };
 
 #endif  // S2E_DISTURBANCES_GEOPOTENTIAL_HPP_
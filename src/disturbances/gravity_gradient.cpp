@@ -48,3 +48,7 @@ std::string GravityGradient::GetLogValue() const {
 
   return str_tmp;
 }
+
+void GravityGradient::PushLogValue(LogValueBuffer& buffer) const {
+  buffer.Push(torque_b_Nm_);
+}
@@ -54,6 +54,11 @@ class GravityGradient : public Disturbance {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn PushLogValue
+   * @brief Override PushLogValue function of ILoggable
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const;
 
  private:
   double gravity_constant_m3_s2_;  //!< Gravitational constant [m3/s2]
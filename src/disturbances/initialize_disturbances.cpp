@@ -5,11 +5,29 @@
 
 #include "initialize_disturbances.hpp"
 
+#include <algorithm>
 #include <library/initialize/initialize_file_access.hpp>
+#include <library/math/constants.hpp>
 
 #define CALC_LABEL "calculation"
 #define LOG_LABEL "logging"
 
+namespace {
+/**
+ * @fn InitSurfaceOcclusion
+ * @brief Enable the self-shadowing of the surface force when it is enabled in the initialize file
+ * @param [in] conf: Initialize file access
+ * @param [in] section: Section name
+ * @param [out] surface_force: Surface force disturbance
+ */
+void InitSurfaceOcclusion(IniAccess& conf, const char* section, SurfaceForce& surface_force) {
+  if (!conf.ReadEnable(section, "is_occlusion_enabled")) return;
+  const double angular_resolution_rad = conf.ReadDouble(section, "occlusion_angular_resolution_deg") * libra::deg_to_rad;
+  const int number_of_samples = conf.ReadInt(section, "occlusion_number_of_samples");
+  surface_force.EnableOcclusion(angular_resolution_rad, (size_t)std::max(number_of_samples, 1));
+}
+}  // namespace
+
 AirDrag InitAirDrag(const std::string initialize_file_path, const std::vector<Surface>& surfaces, const Vector<3>& center_of_gravity_b_m) {
   auto conf = IniAccess(initialize_file_path);
   const char* section = "AIR_DRAG";
@@ -23,6 +41,7 @@ AirDrag InitAirDrag(const std::string initialize_file_path, const std::vector<Su
 
   AirDrag air_drag(surfaces, center_of_gravity_b_m, wall_temperature_K, molecular_temperature_K, molecular_weight_g_mol, is_calc_enable);
   air_drag.is_log_enabled_ = is_log_enable;
+  InitSurfaceOcclusion(conf, section, air_drag);
 
   return air_drag;
 }
@@ -37,6 +56,7 @@ SolarRadiationPressureDisturbance InitSolarRadiationPressureDisturbance(const st
 
   SolarRadiationPressureDisturbance srp_disturbance(surfaces, center_of_gravity_b_m, is_calc_enable);
   srp_disturbance.is_log_enabled_ = is_log_enable;
+  InitSurfaceOcclusion(conf, section, srp_disturbance);
 
   return srp_disturbance;
 }
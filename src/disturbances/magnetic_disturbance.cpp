@@ -9,11 +9,13 @@
 
 #include "../library/logger/log_utility.hpp"
 #include "../library/randomization/global_randomization.hpp"
-#include "../library/randomization/normal_randomization.hpp"
-#include "../library/randomization/random_walk.hpp"
 
 MagneticDisturbance::MagneticDisturbance(const ResidualMagneticMoment& rmm_params, const bool is_calculation_enabled)
-    : Disturbance(is_calculation_enabled, true), residual_magnetic_moment_(rmm_params) {
+    : Disturbance(is_calculation_enabled, true),
+      residual_magnetic_moment_(rmm_params),
+      random_walk_(0.1, libra::Vector<3>(rmm_params.GetRandomWalkStandardDeviation_Am2()),
+                   libra::Vector<3>(rmm_params.GetRandomWalkLimit_Am2())),  // [FIXME] step width is constant
+      white_noise_(0.0, rmm_params.GetRandomNoiseStandardDeviation_Am2(), global_randomization.MakeSeed()) {
   rmm_b_Am2_ = residual_magnetic_moment_.GetConstantValue_b_Am2();
 }
 
@@ -30,16 +32,27 @@ void MagneticDisturbance::Update(const LocalEnvironment& local_environment, cons
 }
 
 void MagneticDisturbance::CalcRMM() {
-  static libra::Vector<3> random_walk_std_dev(residual_magnetic_moment_.GetRandomWalkStandardDeviation_Am2());
-  static libra::Vector<3> random_walk_limit(residual_magnetic_moment_.GetRandomWalkLimit_Am2());
-  static RandomWalk<3> random_walk(0.1, random_walk_std_dev, random_walk_limit);  // [FIXME] step width is constant
-  static libra::NormalRand normal_random(0.0, residual_magnetic_moment_.GetRandomNoiseStandardDeviation_Am2(), global_randomization.MakeSeed());
-
   rmm_b_Am2_ = residual_magnetic_moment_.GetConstantValue_b_Am2();
   for (int i = 0; i < 3; ++i) {
-    rmm_b_Am2_[i] += random_walk[i] + normal_random;
+    rmm_b_Am2_[i] += random_walk_[i] + white_noise_;
   }
-  ++random_walk;  // Update random walk
+  ++random_walk_;  // Update random walk
+}
+
+void MagneticDisturbance::SaveState(CheckpointWriter& writer) const {
+  Disturbance::SaveState(writer);
+  writer.BeginSection("MagneticDisturbance");
+  writer.Write(rmm_b_Am2_);
+  random_walk_.SaveState(writer);
+  white_noise_.SaveState(writer);
+}
+
+void MagneticDisturbance::LoadState(CheckpointReader& reader) {
+  Disturbance::LoadState(reader);
+  reader.BeginSection("MagneticDisturbance");
+  reader.Read(rmm_b_Am2_);
+  random_walk_.LoadState(reader);
+  white_noise_.LoadState(reader);
 }
 
 std::string MagneticDisturbance::GetLogHeader() const {
@@ -59,3 +72,8 @@ std::string MagneticDisturbance::GetLogValue() const {
 
   return str_tmp;
 }
+
+void MagneticDisturbance::PushLogValue(LogValueBuffer& buffer) const {
+  buffer.Push(rmm_b_Am2_);
+  buffer.Push(torque_b_Nm_);
+}
@@ -10,6 +10,8 @@
 
 #include "../library/logger/loggable.hpp"
 #include "../library/math/vector.hpp"
+#include "../library/randomization/normal_randomization.hpp"
+#include "../library/randomization/random_walk.hpp"
 #include "../simulation/spacecraft/structure/residual_magnetic_moment.hpp"
 #include "disturbance.hpp"
 
@@ -35,6 +37,19 @@ class MagneticDisturbance : public Disturbance {
    */
   virtual void Update(const LocalEnvironment& local_environment, const Dynamics& dynamics);
 
+  /**
+   * @fn SaveState
+   * @brief Write the disturbance torque, the RMM, and the state of the RMM noise to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the disturbance torque, the RMM, and the state of the RMM noise from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -46,12 +61,19 @@ class MagneticDisturbance : public Disturbance {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn PushLogValue
+   * @brief Override PushLogValue function of ILoggable
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const;
 
  private:
   const double kMagUnit_ = 1.0e-9;  //!< Constant value to change the unit [nT] -> [T]
 
   libra::Vector<3> rmm_b_Am2_;                              //!< True RMM of the spacecraft in the body frame [Am2]
   const ResidualMagneticMoment& residual_magnetic_moment_;  //!< RMM parameters
+  RandomWalk<3> random_walk_;                               //!< Random walk of RMM
+  libra::NormalRand white_noise_;                           //!< White noise of RMM
 
   /**
    * @fn CalcRMM
@@ -23,13 +23,15 @@ void SolarRadiationPressureDisturbance::Update(const LocalEnvironment& local_env
 void SolarRadiationPressureDisturbance::CalcCoefficients(const libra::Vector<3>& input_direction_b, const double item) {
   UNUSED(input_direction_b);
 
-  for (size_t i = 0; i < surfaces_.size(); i++) {  // Calculate for each surface
-    double area = surfaces_[i].GetArea_m2();
-    double reflectivity = surfaces_[i].GetReflectivity();
-    double specularity = surfaces_[i].GetSpecularity();
+  const size_t number_of_surfaces = cos_theta_.size();
+  for (size_t i = 0; i < number_of_surfaces; i++) {  // Calculate for each surface
+    const double area_item = area_m2_[i] * item;
+    const double reflectivity = reflectivity_[i];
+    const double specularity = specularity_[i];
+    const double cos_theta = cos_theta_[i];
     normal_coefficients_[i] =
-        area * item * ((1.0 + reflectivity * specularity) * pow(cos_theta_[i], 2.0) + 2.0 / 3.0 * reflectivity * (1.0 - specularity) * cos_theta_[i]);
-    tangential_coefficients_[i] = area * item * (1.0 - reflectivity * specularity) * cos_theta_[i] * sin_theta_[i];
+        area_item * ((1.0 + reflectivity * specularity) * cos_theta * cos_theta + 2.0 / 3.0 * reflectivity * (1.0 - specularity) * cos_theta);
+    tangential_coefficients_[i] = area_item * (1.0 - reflectivity * specularity) * cos_theta * sin_theta_[i];
   }
 }
 
@@ -50,3 +52,8 @@ std::string SolarRadiationPressureDisturbance::GetLogValue() const {
 
   return str_tmp;
 }
+
+void SolarRadiationPressureDisturbance::PushLogValue(LogValueBuffer& buffer) const {
+  buffer.Push(torque_b_Nm_);
+  buffer.Push(force_b_N_);
+}
@@ -47,6 +47,11 @@ class SolarRadiationPressureDisturbance : public SurfaceForce {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn PushLogValue
+   * @brief Override PushLogValue function of ILoggable
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const;
 
  private:
   /**
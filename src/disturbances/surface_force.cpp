@@ -5,50 +5,148 @@
 
 #include "surface_force.hpp"
 
+#include <cmath>
+
 #include "../library/math/vector.hpp"
 
 SurfaceForce::SurfaceForce(const std::vector<Surface>& surfaces, const libra::Vector<3>& center_of_gravity_b_m, const bool is_calculation_enabled)
-    : Disturbance(is_calculation_enabled, true), surfaces_(surfaces), center_of_gravity_b_m_(center_of_gravity_b_m) {
+    : Disturbance(is_calculation_enabled, true),
+      surfaces_(surfaces),
+      center_of_gravity_b_m_(center_of_gravity_b_m),
+      surface_modification_count_(0),
+      is_occlusion_enabled_(false) {
   // Initialize vectors
-  int num = surfaces_.size();
-  normal_coefficients_.assign(num, 0.0);
-  tangential_coefficients_.assign(num, 0.0);
-  cos_theta_.assign(num, 0.0);
-  sin_theta_.assign(num, 0.0);
+  CopySurfaceArrays();
 }
 
 libra::Vector<3> SurfaceForce::CalcTorqueForce(libra::Vector<3>& input_direction_b, double item) {
-  CalcTheta(input_direction_b);
+  UpdateSurfaceArrays();
+  const libra::Vector<3> input_direction_normalized_b = input_direction_b.CalcNormalizedVector();
+  CalcTheta(input_direction_normalized_b);
   CalcCoefficients(input_direction_b, item);
+  if (is_occlusion_enabled_) ApplyOcclusion(input_direction_normalized_b);
 
-  libra::Vector<3> force_b_N(0.0);
-  libra::Vector<3> torque_b_Nm(0.0);
-  libra::Vector<3> input_b_normal = input_direction_b.CalcNormalizedVector();
-
-  for (size_t i = 0; i < surfaces_.size(); i++) {
-    if (cos_theta_[i] > 0.0) {  // if the surface faces to the disturbance source (sun or air)
-      // calc direction of in-plane force
-      libra::Vector<3> normal = surfaces_[i].GetNormal_b();
-      libra::Vector<3> ncu = OuterProduct(input_b_normal, normal);
-      libra::Vector<3> ncu_normalized = ncu.CalcNormalizedVector();
-      libra::Vector<3> in_plane_force_direction = OuterProduct(ncu_normalized, normal);
-      // calc force
-      libra::Vector<3> force_per_surface_b_N = -1.0 * normal_coefficients_[i] * normal + tangential_coefficients_[i] * in_plane_force_direction;
-      force_b_N += force_per_surface_b_N;
-      // calc torque
-      torque_b_Nm += OuterProduct(surfaces_[i].GetPosition_b_m() - center_of_gravity_b_m_, force_per_surface_b_N);
-    }
+  // The force of each surface is -Cn * n + Ct * (cos(theta) * n - d) / sin(theta) = a * n + b * d,
+  // where n is the normal vector and d is the input direction. The torque around the center of gravity c is
+  // sum(a * (p x n)) - c x sum(a * n) + (sum(b * p) - sum(b) * c) x d, where p is the position of the surface.
+  const double* normal_x = normal_b_[0].data();
+  const double* normal_y = normal_b_[1].data();
+  const double* normal_z = normal_b_[2].data();
+  const double* position_x = position_b_m_[0].data();
+  const double* position_y = position_b_m_[1].data();
+  const double* position_z = position_b_m_[2].data();
+  double sum_a_normal[3] = {0.0, 0.0, 0.0};
+  double sum_a_normal_moment[3] = {0.0, 0.0, 0.0};
+  double sum_b_position[3] = {0.0, 0.0, 0.0};
+  double sum_b = 0.0;
+  const size_t number_of_surfaces = cos_theta_.size();
+  for (size_t i = 0; i < number_of_surfaces; i++) {
+    // Mask of the surfaces which face to the disturbance source (sun or air)
+    const bool is_facing = cos_theta_[i] > 0.0 && sin_theta_[i] > 0.0;
+    const double tangential_per_sin = is_facing ? tangential_coefficients_[i] / sin_theta_[i] : 0.0;
+    const double a = cos_theta_[i] > 0.0 ? -normal_coefficients_[i] + tangential_per_sin * cos_theta_[i] : 0.0;
+    const double b = -tangential_per_sin;
+    sum_b += b;
+    sum_a_normal[0] += a * normal_x[i];
+    sum_a_normal[1] += a * normal_y[i];
+    sum_a_normal[2] += a * normal_z[i];
+    sum_a_normal_moment[0] += a * (position_y[i] * normal_z[i] - position_z[i] * normal_y[i]);
+    sum_a_normal_moment[1] += a * (position_z[i] * normal_x[i] - position_x[i] * normal_z[i]);
+    sum_a_normal_moment[2] += a * (position_x[i] * normal_y[i] - position_y[i] * normal_x[i]);
+    sum_b_position[0] += b * position_x[i];
+    sum_b_position[1] += b * position_y[i];
+    sum_b_position[2] += b * position_z[i];
   }
+
+  libra::Vector<3> a_normal_b_N;
+  libra::Vector<3> b_lever_arm_b_Nm;
+  libra::Vector<3> force_b_N;
+  libra::Vector<3> torque_b_Nm;
+  for (size_t axis = 0; axis < 3; axis++) {
+    a_normal_b_N[axis] = sum_a_normal[axis];
+    b_lever_arm_b_Nm[axis] = sum_b_position[axis] - sum_b * center_of_gravity_b_m_[axis];
+    force_b_N[axis] = sum_a_normal[axis] + sum_b * input_direction_normalized_b[axis];
+    torque_b_Nm[axis] = sum_a_normal_moment[axis];
+  }
+  torque_b_Nm += -1.0 * OuterProduct(center_of_gravity_b_m_, a_normal_b_N) + OuterProduct(b_lever_arm_b_Nm, input_direction_normalized_b);
+
   force_b_N_ = force_b_N;
   torque_b_Nm_ = torque_b_Nm;
   return torque_b_Nm_;
 }
 
-void SurfaceForce::CalcTheta(libra::Vector<3>& input_direction_b) {
-  libra::Vector<3> input_b_normal = input_direction_b.CalcNormalizedVector();
+void SurfaceForce::EnableOcclusion(const double angular_resolution_rad, const size_t number_of_samples) {
+  occlusion_ = SurfaceOcclusion(angular_resolution_rad, number_of_samples);
+  occlusion_.Build(surfaces_);
+  is_occlusion_enabled_ = true;
+}
+
+void SurfaceForce::ApplyOcclusion(const libra::Vector<3>& input_direction_normalized_b) {
+  const size_t number_of_surfaces = cos_theta_.size();
+  const std::vector<double>& lit_fractions = occlusion_.GetLitFractions(input_direction_normalized_b);
+  for (size_t i = 0; i < number_of_surfaces; i++) {
+    normal_coefficients_[i] *= lit_fractions[i];
+    tangential_coefficients_[i] *= lit_fractions[i];
+  }
+}
+
+void SurfaceForce::CalcTheta(const libra::Vector<3>& input_direction_normalized_b) {
+  const double direction_x = input_direction_normalized_b[0];
+  const double direction_y = input_direction_normalized_b[1];
+  const double direction_z = input_direction_normalized_b[2];
+  const double* normal_x = normal_b_[0].data();
+  const double* normal_y = normal_b_[1].data();
+  const double* normal_z = normal_b_[2].data();
+  double* cos_theta = cos_theta_.data();
+  double* sin_theta = sin_theta_.data();
 
-  for (size_t i = 0; i < surfaces_.size(); i++) {
-    cos_theta_[i] = InnerProduct(surfaces_[i].GetNormal_b(), input_b_normal);
-    sin_theta_[i] = sqrt(1.0 - cos_theta_[i] * cos_theta_[i]);
+  const size_t number_of_surfaces = cos_theta_.size();
+  for (size_t i = 0; i < number_of_surfaces; i++) {
+    cos_theta[i] = normal_x[i] * direction_x + normal_y[i] * direction_y + normal_z[i] * direction_z;
+    sin_theta[i] = sqrt(1.0 - cos_theta[i] * cos_theta[i]);
   }
 }
+
+void SurfaceForce::UpdateSurfaceArrays() {
+  if (surface_modification_count_ == Surface::GetModificationCount() && cos_theta_.size() == surfaces_.size()) return;
+  CopySurfaceArrays();
+}
+
+void SurfaceForce::CopySurfaceArrays() {
+  surface_modification_count_ = Surface::GetModificationCount();
+  const size_t number_of_surfaces = surfaces_.size();
+  bool is_geometry_changed = cos_theta_.size() != number_of_surfaces;
+  if (is_geometry_changed) {
+    for (size_t axis = 0; axis < 3; axis++) {
+      normal_b_[axis].assign(number_of_surfaces, 0.0);
+      position_b_m_[axis].assign(number_of_surfaces, 0.0);
+    }
+    area_m2_.assign(number_of_surfaces, 0.0);
+    reflectivity_.assign(number_of_surfaces, 0.0);
+    specularity_.assign(number_of_surfaces, 0.0);
+    air_specularity_.assign(number_of_surfaces, 0.0);
+    normal_coefficients_.assign(number_of_surfaces, 0.0);
+    tangential_coefficients_.assign(number_of_surfaces, 0.0);
+    cos_theta_.assign(number_of_surfaces, 0.0);
+    sin_theta_.assign(number_of_surfaces, 0.0);
+  }
+
+  for (size_t i = 0; i < number_of_surfaces; i++) {
+    const Surface& surface = surfaces_[i];
+    const libra::Vector<3>& normal_b = surface.GetNormal_b();
+    const libra::Vector<3>& position_b_m = surface.GetPosition_b_m();
+    for (size_t axis = 0; axis < 3; axis++) {
+      is_geometry_changed |= normal_b_[axis][i] != normal_b[axis] || position_b_m_[axis][i] != position_b_m[axis];
+      normal_b_[axis][i] = normal_b[axis];
+      position_b_m_[axis][i] = position_b_m[axis];
+    }
+    is_geometry_changed |= area_m2_[i] != surface.GetArea_m2();
+    area_m2_[i] = surface.GetArea_m2();
+    reflectivity_[i] = surface.GetReflectivity();
+    specularity_[i] = surface.GetSpecularity();
+    air_specularity_[i] = surface.GetAirSpecularity();
+  }
+
+  // The modification count is shared by all the surfaces, so the occlusion is rebuilt only when the own geometry is changed
+  if (is_occlusion_enabled_ && is_geometry_changed) occlusion_.Build(surfaces_);
+}
@@ -14,6 +14,7 @@
 #include "../library/math/vector.hpp"
 #include "../simulation/spacecraft/structure/surface.hpp"
 #include "disturbance.hpp"
+#include "surface_occlusion.hpp"
 
 /**
  * @class ThirdBodyGravity
@@ -35,11 +36,38 @@ class SurfaceForce : public Disturbance {
    */
   virtual ~SurfaceForce() {}
 
+  /**
+   * @fn EnableOcclusion
+   * @brief Enable the self-shadowing of the surfaces. The force of each surface is scaled with the lit fraction.
+   * @note The bounding volume hierarchy is built with the current surfaces. It is rebuilt only when the number of the surfaces changes.
+   * @param [in] angular_resolution_rad: Angular resolution of the direction bins of the cache [rad]
+   * @param [in] number_of_samples: Number of the sample points on each surface
+   */
+  void EnableOcclusion(const double angular_resolution_rad, const size_t number_of_samples);
+  /**
+   * @fn GetOcclusion
+   * @brief Return the self-shadowing calculation
+   */
+  inline const SurfaceOcclusion& GetOcclusion() const { return occlusion_; }
+
  protected:
   // Spacecraft Structure parameters
   const std::vector<Surface>& surfaces_;           //!< List of surfaces
   const libra::Vector<3>& center_of_gravity_b_m_;  //!< Position vector of the center of mass_kg at body frame [m]
 
+  // Surface parameters as contiguous arrays (structure of arrays) copied from surfaces_ when the surfaces are changed
+  uint64_t surface_modification_count_;  //!< Modification count of the surfaces when the arrays are updated
+  std::vector<double> normal_b_[3];      //!< Components of the normal unit vector of each surface at the body frame
+  std::vector<double> position_b_m_[3];  //!< Components of the position vector of each surface at the body frame [m]
+  std::vector<double> area_m2_;          //!< Area of each surface [m2]
+  std::vector<double> reflectivity_;     //!< Reflectivity of each surface
+  std::vector<double> specularity_;      //!< Specularity of each surface
+  std::vector<double> air_specularity_;  //!< Air specularity of each surface
+
+  // Self-shadowing
+  bool is_occlusion_enabled_;   //!< Flag of the self-shadowing calculation
+  SurfaceOcclusion occlusion_;  //!< Self-shadowing calculation of the surfaces
+
   // Internal calculated variables
   std::vector<double> normal_coefficients_;      //!< coefficients for out-plane force for each surface
   std::vector<double> tangential_coefficients_;  //!< coefficients for in-plane force for each surface
@@ -50,6 +78,7 @@ class SurfaceForce : public Disturbance {
   /**
    * @fn CalcTorqueForce
    * @brief Calculate the torque and force
+   * @note The surfaces which do not face to the disturbance source (cos(theta) <= 0) are masked out.
    * @param [in] input_direction_b: Direction of disturbance source at the body frame
    * @param [in] item: Parameter which decide the magnitude of the disturbances (e.g., Solar flux, air density)
    * @return Calculated disturbance torque in body frame [Nm]
@@ -58,9 +87,28 @@ class SurfaceForce : public Disturbance {
   /**
    * @fn CalcTheta
    * @brief Calculate cosX and sinX
-   * @param [in] input_direction_b: Direction of disturbance source at the body frame
+   * @param [in] input_direction_normalized_b: Normalized direction of disturbance source at the body frame
+   */
+  void CalcTheta(const libra::Vector<3>& input_direction_normalized_b);
+  /**
+   * @fn ApplyOcclusion
+   * @brief Scale the coefficients of the surfaces with the lit fractions
+   * @param [in] input_direction_normalized_b: Normalized direction of disturbance source at the body frame
+   */
+  void ApplyOcclusion(const libra::Vector<3>& input_direction_normalized_b);
+  /**
+   * @fn UpdateSurfaceArrays
+   * @brief Copy the surface parameters to the contiguous arrays
+   * @note The surfaces can be changed by components during the simulation, so the arrays are updated when the modification count of the
+   *       surfaces or the number of the surfaces changes.
+   */
+  void UpdateSurfaceArrays();
+  /**
+   * @fn CopySurfaceArrays
+   * @brief Copy the surface parameters to the contiguous arrays without checking the modification count
+   * @note The occlusion is rebuilt when it is enabled and the position, normal, area, or number of the surfaces is changed.
    */
-  void CalcTheta(libra::Vector<3>& input_direction_b);
+  void CopySurfaceArrays();
 
   /**
    * @fn CalcCoefficients
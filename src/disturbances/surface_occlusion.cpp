@@ -0,0 +1,222 @@
+/**
+ * @file surface_occlusion.cpp
+ * @brief Class to calculate the self-shadowing of the spacecraft surfaces with ray casting
+ */
+
+#include "surface_occlusion.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+const size_t kMaxDisksInLeaf = 4;                              //!< Maximum number of the disks in a leaf node
+const size_t kMaxNumberOfCachedValues = (size_t)1 << 24;       //!< Maximum number of the lit fractions in the cache
+const double kRelativeMinimumRayLength = 1.0e-9;               //!< Minimum distance of the hit relative to the size of the spacecraft
+const double kGoldenAngle_rad = libra::pi * (3.0 - sqrt(5.0));  //!< Golden angle to distribute the sample points [rad]
+}  // namespace
+
+SurfaceOcclusion::SurfaceOcclusion(const double angular_resolution_rad, const size_t number_of_samples)
+    : angular_resolution_rad_(angular_resolution_rad), number_of_samples_(std::max(number_of_samples, (size_t)1)), minimum_ray_length_m_(0.0) {
+  if (!(angular_resolution_rad_ > 0.0)) {
+    std::cerr << "WARNING: surface occlusion: the angular resolution should be positive. 1 deg is used." << std::endl;
+    angular_resolution_rad_ = 1.0 * libra::deg_to_rad;
+  }
+  number_of_azimuth_bins_ = (size_t)std::ceil(libra::tau / angular_resolution_rad_);
+
+  // Sample points with the same area on the unit disk (sunflower pattern)
+  for (size_t i = 0; i < number_of_samples_; i++) {
+    const double radius = sqrt((i + 0.5) / number_of_samples_);
+    const double angle_rad = kGoldenAngle_rad * i;
+    sample_u_.push_back(radius * cos(angle_rad));
+    sample_v_.push_back(radius * sin(angle_rad));
+  }
+}
+
+void SurfaceOcclusion::Build(const std::vector<Surface>& surfaces) {
+  Clear();
+  disks_.clear();
+  nodes_.clear();
+  disk_indices_.clear();
+
+  double size_m = 0.0;
+  for (const auto& surface : surfaces) {
+    Disk disk;
+    const libra::Vector<3> normal_b = surface.GetNormal_b().CalcNormalizedVector();
+    // Tangential vectors with the axis which is the most perpendicular to the normal vector
+    libra::Vector<3> axis_b(0.0);
+    const size_t min_axis = std::abs(normal_b[0]) < std::abs(normal_b[1]) ? (std::abs(normal_b[0]) < std::abs(normal_b[2]) ? 0 : 2)
+                                                                          : (std::abs(normal_b[1]) < std::abs(normal_b[2]) ? 1 : 2);
+    axis_b[min_axis] = 1.0;
+    const libra::Vector<3> tangent_u_b = OuterProduct(normal_b, axis_b).CalcNormalizedVector();
+    const libra::Vector<3> tangent_v_b = OuterProduct(normal_b, tangent_u_b);
+    for (size_t axis = 0; axis < 3; axis++) {
+      disk.center_b_m[axis] = surface.GetPosition_b_m()[axis];
+      disk.normal_b[axis] = normal_b[axis];
+      disk.tangent_u_b[axis] = tangent_u_b[axis];
+      disk.tangent_v_b[axis] = tangent_v_b[axis];
+    }
+    disk.radius_m = sqrt(surface.GetArea_m2() / libra::pi);
+    size_m = std::max(size_m, surface.GetPosition_b_m().CalcNorm() + disk.radius_m);
+    disks_.push_back(disk);
+    disk_indices_.push_back(disks_.size() - 1);
+  }
+  minimum_ray_length_m_ = kRelativeMinimumRayLength * std::max(size_m, 1.0);
+
+  if (!disks_.empty()) BuildNode(0, disks_.size());
+}
+
+const std::vector<double>& SurfaceOcclusion::GetLitFractions(const libra::Vector<3>& direction_b) {
+  const libra::Vector<3> direction_normalized_b = direction_b.CalcNormalizedVector();
+  const double elevation_rad = asin(std::min(std::max(direction_normalized_b[2], -1.0), 1.0));
+  const double azimuth_rad = atan2(direction_normalized_b[1], direction_normalized_b[0]);
+
+  const size_t number_of_elevation_bins = (size_t)std::ceil(libra::pi / angular_resolution_rad_);
+  const size_t elevation_index = std::min((size_t)std::floor((elevation_rad + libra::pi_2) / angular_resolution_rad_), number_of_elevation_bins - 1);
+  const size_t azimuth_index = std::min((size_t)std::floor((azimuth_rad + libra::pi) / angular_resolution_rad_), number_of_azimuth_bins_ - 1);
+  const uint64_t key = (uint64_t)elevation_index * number_of_azimuth_bins_ + azimuth_index;
+
+  auto lit_fractions = lit_fractions_.find(key);
+  if (lit_fractions == lit_fractions_.end()) {
+    if ((lit_fractions_.size() + 1) * disks_.size() > kMaxNumberOfCachedValues) Clear();
+    // Center direction of the bin
+    const double center_elevation_rad = std::min((elevation_index + 0.5) * angular_resolution_rad_ - libra::pi_2, libra::pi_2);
+    const double center_azimuth_rad = (azimuth_index + 0.5) * angular_resolution_rad_ - libra::pi;
+    libra::Vector<3> center_direction_b;
+    center_direction_b[0] = cos(center_elevation_rad) * cos(center_azimuth_rad);
+    center_direction_b[1] = cos(center_elevation_rad) * sin(center_azimuth_rad);
+    center_direction_b[2] = sin(center_elevation_rad);
+    lit_fractions = lit_fractions_.emplace(key, CalcLitFractions(center_direction_b)).first;
+  }
+  return lit_fractions->second;
+}
+
+std::vector<double> SurfaceOcclusion::CalcLitFractions(const libra::Vector<3>& direction_b) const {
+  const libra::Vector<3> direction_normalized_b = direction_b.CalcNormalizedVector();
+  const double direction[3] = {direction_normalized_b[0], direction_normalized_b[1], direction_normalized_b[2]};
+
+  std::vector<double> lit_fractions(disks_.size(), 0.0);
+  for (size_t i = 0; i < disks_.size(); i++) {
+    const Disk& disk = disks_[i];
+    const double cos_theta = disk.normal_b[0] * direction[0] + disk.normal_b[1] * direction[1] + disk.normal_b[2] * direction[2];
+    if (cos_theta <= 0.0) continue;  // Back side
+
+    size_t number_of_lit_samples = 0;
+    for (size_t sample = 0; sample < number_of_samples_; sample++) {
+      const double u_m = disk.radius_m * sample_u_[sample];
+      const double v_m = disk.radius_m * sample_v_[sample];
+      double origin_b_m[3];
+      for (size_t axis = 0; axis < 3; axis++) origin_b_m[axis] = disk.center_b_m[axis] + u_m * disk.tangent_u_b[axis] + v_m * disk.tangent_v_b[axis];
+      if (!IsOccluded(origin_b_m, direction, i)) number_of_lit_samples++;
+    }
+    lit_fractions[i] = (double)number_of_lit_samples / number_of_samples_;
+  }
+  return lit_fractions;
+}
+
+void SurfaceOcclusion::Clear() { lit_fractions_.clear(); }
+
+void SurfaceOcclusion::BuildNode(const size_t first, const size_t count) {
+  const size_t node_index = nodes_.size();
+  nodes_.push_back(Node());
+
+  // Bounding box of the disks
+  double min_b_m[3] = {INFINITY, INFINITY, INFINITY};
+  double max_b_m[3] = {-INFINITY, -INFINITY, -INFINITY};
+  double centroid_min_b_m[3] = {INFINITY, INFINITY, INFINITY};
+  double centroid_max_b_m[3] = {-INFINITY, -INFINITY, -INFINITY};
+  for (size_t i = first; i < first + count; i++) {
+    const Disk& disk = disks_[disk_indices_[i]];
+    for (size_t axis = 0; axis < 3; axis++) {
+      const double extent_m = disk.radius_m * sqrt(std::max(1.0 - disk.normal_b[axis] * disk.normal_b[axis], 0.0));
+      min_b_m[axis] = std::min(min_b_m[axis], disk.center_b_m[axis] - extent_m);
+      max_b_m[axis] = std::max(max_b_m[axis], disk.center_b_m[axis] + extent_m);
+      centroid_min_b_m[axis] = std::min(centroid_min_b_m[axis], disk.center_b_m[axis]);
+      centroid_max_b_m[axis] = std::max(centroid_max_b_m[axis], disk.center_b_m[axis]);
+    }
+  }
+  for (size_t axis = 0; axis < 3; axis++) {
+    nodes_[node_index].min_b_m[axis] = min_b_m[axis];
+    nodes_[node_index].max_b_m[axis] = max_b_m[axis];
+  }
+
+  if (count <= kMaxDisksInLeaf) {
+    nodes_[node_index].first = first;
+    nodes_[node_index].count = count;
+    nodes_[node_index].right_child = 0;
+    return;
+  }
+
+  // Split at the median of the centers along the longest axis
+  size_t split_axis = 0;
+  for (size_t axis = 1; axis < 3; axis++) {
+    if (centroid_max_b_m[axis] - centroid_min_b_m[axis] > centroid_max_b_m[split_axis] - centroid_min_b_m[split_axis]) split_axis = axis;
+  }
+  const size_t half = count / 2;
+  std::nth_element(disk_indices_.begin() + first, disk_indices_.begin() + first + half, disk_indices_.begin() + first + count,
+                   [&](const size_t a, const size_t b) { return disks_[a].center_b_m[split_axis] < disks_[b].center_b_m[split_axis]; });
+
+  nodes_[node_index].first = first;
+  nodes_[node_index].count = 0;
+  BuildNode(first, half);
+  nodes_[node_index].right_child = nodes_.size();
+  BuildNode(first + half, count - half);
+}
+
+bool SurfaceOcclusion::IsOccluded(const double origin_b_m[3], const double direction_b[3], const size_t origin_disk) const {
+  if (nodes_.empty()) return false;
+  const Disk& origin = disks_[origin_disk];
+
+  double inverse_direction[3];
+  for (size_t axis = 0; axis < 3; axis++) inverse_direction[axis] = 1.0 / direction_b[axis];
+
+  size_t stack[64];
+  size_t stack_size = 0;
+  stack[stack_size++] = 0;
+  while (stack_size > 0) {
+    const Node& node = nodes_[stack[--stack_size]];
+
+    // Slab test of the bounding box
+    double t_min = minimum_ray_length_m_;
+    double t_max = INFINITY;
+    for (size_t axis = 0; axis < 3; axis++) {
+      double t_0 = (node.min_b_m[axis] - origin_b_m[axis]) * inverse_direction[axis];
+      double t_1 = (node.max_b_m[axis] - origin_b_m[axis]) * inverse_direction[axis];
+      if (t_0 > t_1) std::swap(t_0, t_1);
+      // NaN appears when the origin is on the slab of a parallel ray, and it is treated as inside
+      if (t_0 > t_min) t_min = t_0;
+      if (t_1 < t_max) t_max = t_1;
+    }
+    if (t_min > t_max) continue;
+
+    if (node.count == 0) {
+      const size_t node_index = &node - nodes_.data();
+      stack[stack_size++] = node.right_child;
+      stack[stack_size++] = node_index + 1;
+      continue;
+    }
+
+    for (size_t i = node.first; i < node.first + node.count; i++) {
+      const size_t disk_index = disk_indices_[i];
+      if (disk_index == origin_disk) continue;
+      const Disk& disk = disks_[disk_index];
+      // The disks whose center is not in front of the origin disk are ignored, so that the adjacent surfaces of a convex body do not shadow
+      double front_distance_m = 0.0;
+      for (size_t axis = 0; axis < 3; axis++) front_distance_m += origin.normal_b[axis] * (disk.center_b_m[axis] - origin.center_b_m[axis]);
+      if (front_distance_m <= 0.0) continue;
+      const double denominator = disk.normal_b[0] * direction_b[0] + disk.normal_b[1] * direction_b[1] + disk.normal_b[2] * direction_b[2];
+      if (denominator == 0.0) continue;  // The ray is parallel to the disk
+      double difference_m[3];
+      for (size_t axis = 0; axis < 3; axis++) difference_m[axis] = disk.center_b_m[axis] - origin_b_m[axis];
+      const double t = (disk.normal_b[0] * difference_m[0] + disk.normal_b[1] * difference_m[1] + disk.normal_b[2] * difference_m[2]) / denominator;
+      if (t <= minimum_ray_length_m_) continue;
+      double distance2_m2 = 0.0;
+      for (size_t axis = 0; axis < 3; axis++) {
+        const double hit_m = origin_b_m[axis] + t * direction_b[axis] - disk.center_b_m[axis];
+        distance2_m2 += hit_m * hit_m;
+      }
+      if (distance2_m2 <= disk.radius_m * disk.radius_m) return true;
+    }
+  }
+  return false;
+}
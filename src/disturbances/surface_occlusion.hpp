@@ -0,0 +1,130 @@
+/**
+ * @file surface_occlusion.hpp
+ * @brief Class to calculate the self-shadowing of the spacecraft surfaces with ray casting
+ */
+
+#ifndef S2E_DISTURBANCES_SURFACE_OCCLUSION_HPP_
+#define S2E_DISTURBANCES_SURFACE_OCCLUSION_HPP_
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "../library/math/constants.hpp"
+#include "../library/math/vector.hpp"
+#include "../simulation/spacecraft/structure/surface.hpp"
+
+/**
+ * @class SurfaceOcclusion
+ * @brief Class to calculate the self-shadowing of the spacecraft surfaces with ray casting
+ * @details Each surface is modeled as a disk with the same area around the position of the surface. The rays are cast from the sample points
+ *          on the disk to the direction of the disturbance source (sun or air flow), and the lit fraction is the ratio of the rays which do not
+ *          hit the other disks. The disks whose center is not in front of the surface are not treated as occluders, so the surfaces of a
+ *          convex body do not shadow each other even though the disks extend over the edges. A bounding volume hierarchy (BVH) over the disks
+ *          is built once. The lit fractions are cached in the bins of the azimuth and the elevation of the direction in the body frame, and
+ *          they are evaluated at the center direction of the bin.
+ */
+class SurfaceOcclusion {
+ public:
+  /**
+   * @fn SurfaceOcclusion
+   * @brief Constructor
+   * @param [in] angular_resolution_rad: Angular resolution of the direction bins of the cache [rad]
+   * @param [in] number_of_samples: Number of the sample points on each surface
+   */
+  SurfaceOcclusion(const double angular_resolution_rad = 1.0 * libra::deg_to_rad, const size_t number_of_samples = 16);
+
+  /**
+   * @fn Build
+   * @brief Build the bounding volume hierarchy of the surfaces and clear the cache
+   * @param [in] surfaces: Surface information of the spacecraft
+   */
+  void Build(const std::vector<Surface>& surfaces);
+  /**
+   * @fn GetLitFractions
+   * @brief Return the lit fractions of the surfaces from the cache. The fractions are calculated when the direction bin is not in the cache.
+   * @param [in] direction_b: Direction of the disturbance source at the body frame
+   * @return Lit fractions of the surfaces (0: fully shadowed or back side, 1: fully lit)
+   */
+  const std::vector<double>& GetLitFractions(const libra::Vector<3>& direction_b);
+  /**
+   * @fn CalcLitFractions
+   * @brief Calculate the lit fractions of the surfaces without the cache
+   * @param [in] direction_b: Direction of the disturbance source at the body frame
+   * @return Lit fractions of the surfaces (0: fully shadowed or back side, 1: fully lit)
+   */
+  std::vector<double> CalcLitFractions(const libra::Vector<3>& direction_b) const;
+  /**
+   * @fn Clear
+   * @brief Clear the cache
+   */
+  void Clear();
+
+  // Getters
+  /**
+   * @fn GetNumberOfSurfaces
+   * @brief Return number of the surfaces in the bounding volume hierarchy
+   */
+  inline size_t GetNumberOfSurfaces() const { return disks_.size(); }
+  /**
+   * @fn GetNumberOfCachedDirections
+   * @brief Return number of the direction bins in the cache
+   */
+  inline size_t GetNumberOfCachedDirections() const { return lit_fractions_.size(); }
+
+ private:
+  /**
+   * @struct Disk
+   * @brief Disk model of a surface
+   */
+  struct Disk {
+    double center_b_m[3];   //!< Center position [m]
+    double normal_b[3];     //!< Normal unit vector
+    double tangent_u_b[3];  //!< First tangential unit vector
+    double tangent_v_b[3];  //!< Second tangential unit vector
+    double radius_m;        //!< Radius [m]
+  };
+  /**
+   * @struct Node
+   * @brief Node of the bounding volume hierarchy
+   * @note The left child is the next node of the parent node
+   */
+  struct Node {
+    double min_b_m[3];   //!< Minimum corner of the bounding box [m]
+    double max_b_m[3];   //!< Maximum corner of the bounding box [m]
+    size_t first;        //!< First index of the disks in the leaf node
+    size_t count;        //!< Number of the disks in the leaf node (0: internal node)
+    size_t right_child;  //!< Index of the right child node
+  };
+
+  double angular_resolution_rad_;  //!< Angular resolution of the direction bins of the cache [rad]
+  size_t number_of_azimuth_bins_;  //!< Number of the azimuth bins
+  size_t number_of_samples_;       //!< Number of the sample points on each surface
+  std::vector<double> sample_u_;   //!< First coordinates of the sample points on the unit disk
+  std::vector<double> sample_v_;   //!< Second coordinates of the sample points on the unit disk
+
+  std::vector<Disk> disks_;           //!< Disk models of the surfaces
+  std::vector<size_t> disk_indices_;  //!< Indices of the disks ordered by the leaf nodes
+  std::vector<Node> nodes_;           //!< Nodes of the bounding volume hierarchy
+  double minimum_ray_length_m_;       //!< Minimum distance of the hit to avoid the hit to the surface itself [m]
+
+  std::unordered_map<uint64_t, std::vector<double>> lit_fractions_;  //!< Cache of the lit fractions for each direction bin
+
+  /**
+   * @fn BuildNode
+   * @brief Build the node of the bounding volume hierarchy recursively
+   * @param [in] first: First index of the disks in disk_indices_
+   * @param [in] count: Number of the disks
+   */
+  void BuildNode(const size_t first, const size_t count);
+  /**
+   * @fn IsOccluded
+   * @brief Judge the ray hits a disk other than the origin disk
+   * @param [in] origin_b_m: Origin of the ray [m]
+   * @param [in] direction_b: Direction unit vector of the ray
+   * @param [in] origin_disk: Index of the disk which has the origin of the ray
+   */
+  bool IsOccluded(const double origin_b_m[3], const double direction_b[3], const size_t origin_disk) const;
+};
+
+#endif  // S2E_DISTURBANCES_SURFACE_OCCLUSION_HPP_
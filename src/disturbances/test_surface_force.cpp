@@ -0,0 +1,270 @@
+/**
+ * @file test_surface_force.cpp
+ * @brief Test codes for SurfaceForce class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include "air_drag.hpp"
+#include "solar_radiation_pressure_disturbance.hpp"
+
+namespace {
+const double kWallTemperature_K = 30.0;
+const double kMolecularTemperature_K = 3.0;
+const double kMolecularWeight_g_mol = 18.0;
+
+/**
+ * @fn MakeVector
+ * @brief Make a vector from the components
+ */
+libra::Vector<3> MakeVector(const double x, const double y, const double z) {
+  libra::Vector<3> vector;
+  vector[0] = x;
+  vector[1] = y;
+  vector[2] = z;
+  return vector;
+}
+
+/**
+ * @class SolarRadiationPressureForTest
+ * @brief SolarRadiationPressureDisturbance class to access the force calculation
+ */
+class SolarRadiationPressureForTest : public SolarRadiationPressureDisturbance {
+ public:
+  using SolarRadiationPressureDisturbance::SolarRadiationPressureDisturbance;
+  libra::Vector<3> Calc(libra::Vector<3> sun_direction_b, const double pressure_N_m2) { return CalcTorqueForce(sun_direction_b, pressure_N_m2); }
+};
+
+/**
+ * @class AirDragForTest
+ * @brief AirDrag class to access the force calculation
+ */
+class AirDragForTest : public AirDrag {
+ public:
+  using AirDrag::AirDrag;
+  libra::Vector<3> Calc(libra::Vector<3> velocity_b_m_s, const double air_density_kg_m3) {
+    return CalcTorqueForce(velocity_b_m_s, air_density_kg_m3);
+  }
+};
+
+/**
+ * @fn MakeSurfaces
+ * @brief Make random surfaces and the surfaces which are parallel and anti-parallel to the input direction
+ */
+std::vector<Surface> MakeSurfaces(const size_t number_of_surfaces, const libra::Vector<3>& input_direction_b) {
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  std::vector<Surface> surfaces;
+  for (size_t i = 0; i < number_of_surfaces; i++) {
+    libra::Vector<3> position_b_m, normal_b;
+    for (size_t axis = 0; axis < 3; axis++) {
+      position_b_m[axis] = distribution(generator);
+      normal_b[axis] = distribution(generator);
+    }
+    const double area_m2 = 0.5 + 0.5 * distribution(generator);
+    const double reflectivity = 0.5 + 0.4 * distribution(generator);
+    const double specularity = 0.5 + 0.4 * distribution(generator);
+    const double air_specularity = 0.5 + 0.4 * distribution(generator);
+    surfaces.push_back(Surface(position_b_m, normal_b.CalcNormalizedVector(), area_m2, reflectivity, specularity, air_specularity));
+  }
+  const libra::Vector<3> input_direction_normalized_b = input_direction_b.CalcNormalizedVector();
+  surfaces.push_back(Surface(libra::Vector<3>(0.3), input_direction_normalized_b, 1.0, 0.5, 0.5, 0.5));
+  surfaces.push_back(Surface(libra::Vector<3>(-0.3), -1.0 * input_direction_normalized_b, 1.0, 0.5, 0.5, 0.5));
+  return surfaces;
+}
+
+/**
+ * @fn CalcTorqueForceReference
+ * @brief Reference implementation of the previous SurfaceForce::CalcTorqueForce with the coefficients of each surface
+ */
+void CalcTorqueForceReference(const std::vector<Surface>& surfaces, const libra::Vector<3>& center_of_gravity_b_m,
+                              const libra::Vector<3>& input_direction_b, const std::vector<double>& normal_coefficients,
+                              const std::vector<double>& tangential_coefficients, libra::Vector<3>& force_b_N, libra::Vector<3>& torque_b_Nm) {
+  force_b_N = libra::Vector<3>(0.0);
+  torque_b_Nm = libra::Vector<3>(0.0);
+  const libra::Vector<3> input_b_normal = input_direction_b.CalcNormalizedVector();
+  for (size_t i = 0; i < surfaces.size(); i++) {
+    const libra::Vector<3> normal = surfaces[i].GetNormal_b();
+    if (InnerProduct(normal, input_b_normal) <= 0.0) continue;
+    const libra::Vector<3> ncu_normalized = OuterProduct(input_b_normal, normal).CalcNormalizedVector();
+    const libra::Vector<3> in_plane_force_direction = OuterProduct(ncu_normalized, normal);
+    const libra::Vector<3> force_per_surface_b_N = -1.0 * normal_coefficients[i] * normal + tangential_coefficients[i] * in_plane_force_direction;
+    force_b_N += force_per_surface_b_N;
+    torque_b_Nm += OuterProduct(surfaces[i].GetPosition_b_m() - center_of_gravity_b_m, force_per_surface_b_N);
+  }
+}
+
+/**
+ * @fn CalcTheta
+ * @brief Calculate cos(theta) and sin(theta) of the surface
+ */
+void CalcTheta(const Surface& surface, const libra::Vector<3>& input_direction_b, double& cos_theta, double& sin_theta) {
+  cos_theta = InnerProduct(surface.GetNormal_b(), input_direction_b.CalcNormalizedVector());
+  sin_theta = sqrt(1.0 - cos_theta * cos_theta);
+}
+
+/**
+ * @fn ExpectNearVector
+ * @brief Compare vectors with the tolerance relative to the norm of the reference
+ */
+void ExpectNearVector(const libra::Vector<3>& reference, const libra::Vector<3>& value) {
+  const double tolerance = reference.CalcNorm() * 1.0e-10;
+  for (size_t axis = 0; axis < 3; axis++) EXPECT_NEAR(reference[axis], value[axis], tolerance);
+}
+}  // namespace
+
+/**
+ * @brief Test that the solar radiation pressure is the same as the previous calculation of each surface
+ */
+TEST(SurfaceForce, SolarRadiationPressure) {
+  const libra::Vector<3> sun_direction_b = MakeVector(0.3, -0.5, 0.8);
+  const double pressure_N_m2 = 4.56e-6;
+  const std::vector<Surface> surfaces = MakeSurfaces(500, sun_direction_b);
+  const libra::Vector<3> center_of_gravity_b_m = MakeVector(0.01, 0.02, -0.03);
+  SolarRadiationPressureForTest srp(surfaces, center_of_gravity_b_m);
+  const libra::Vector<3> torque_b_Nm = srp.Calc(sun_direction_b, pressure_N_m2);
+
+  std::vector<double> normal_coefficients, tangential_coefficients;
+  for (const auto& surface : surfaces) {
+    double cos_theta, sin_theta;
+    CalcTheta(surface, sun_direction_b, cos_theta, sin_theta);
+    const double area = surface.GetArea_m2();
+    const double reflectivity = surface.GetReflectivity();
+    const double specularity = surface.GetSpecularity();
+    const double normal_factor =
+        (1.0 + reflectivity * specularity) * pow(cos_theta, 2.0) + 2.0 / 3.0 * reflectivity * (1.0 - specularity) * cos_theta;
+    normal_coefficients.push_back(area * pressure_N_m2 * normal_factor);
+    tangential_coefficients.push_back(area * pressure_N_m2 * (1.0 - reflectivity * specularity) * cos_theta * sin_theta);
+  }
+  libra::Vector<3> reference_force_b_N, reference_torque_b_Nm;
+  CalcTorqueForceReference(surfaces, center_of_gravity_b_m, sun_direction_b, normal_coefficients, tangential_coefficients, reference_force_b_N,
+                           reference_torque_b_Nm);
+
+  ExpectNearVector(reference_force_b_N, srp.GetForce_b_N());
+  ExpectNearVector(reference_torque_b_Nm, torque_b_Nm);
+}
+
+/**
+ * @brief Test that the air drag is the same as the previous calculation of each surface
+ */
+TEST(SurfaceForce, AirDrag) {
+  const libra::Vector<3> velocity_b_m_s = MakeVector(-5000.0, 4000.0, 3500.0);
+  const double air_density_kg_m3 = 2.0e-12;
+  const std::vector<Surface> surfaces = MakeSurfaces(500, velocity_b_m_s);
+  const libra::Vector<3> center_of_gravity_b_m = MakeVector(-0.02, 0.01, 0.05);
+  AirDragForTest air_drag(surfaces, center_of_gravity_b_m, kWallTemperature_K, kMolecularTemperature_K, kMolecularWeight_g_mol);
+  const libra::Vector<3> torque_b_Nm = air_drag.Calc(velocity_b_m_s, air_density_kg_m3);
+
+  const double velocity_norm_m_s = velocity_b_m_s.CalcNorm();
+  const double speed = sqrt(kMolecularWeight_g_mol * velocity_norm_m_s * velocity_norm_m_s /
+                            (2.0 * environment::boltzmann_constant_J_K * kWallTemperature_K));
+  std::vector<double> normal_coefficients, tangential_coefficients;
+  for (const auto& surface : surfaces) {
+    double cos_theta, sin_theta;
+    CalcTheta(surface, velocity_b_m_s, cos_theta, sin_theta);
+    const double speed_n = speed * cos_theta;
+    const double speed_t = speed * sin_theta;
+    const double diffuse = 1.0 - surface.GetAirSpecularity();
+    const double pi = speed_n * exp(-speed_n * speed_n) + sqrt(libra::pi) * (speed_n * speed_n + 0.5) * (1.0 + erf(speed_n));
+    const double chi = exp(-speed_n * speed_n) + sqrt(libra::pi) * speed_n * (1.0 + erf(speed_n));
+    const double cn = (2.0 - diffuse) / sqrt(libra::pi) * pi / (speed * speed) +
+                      diffuse / 2.0 * chi / (speed * speed) * sqrt(kWallTemperature_K / kMolecularTemperature_K);
+    const double ct = diffuse * speed_t * chi / (sqrt(libra::pi) * speed * speed);
+    const double k = 0.5 * air_density_kg_m3 * velocity_norm_m_s * velocity_norm_m_s * surface.GetArea_m2();
+    normal_coefficients.push_back(k * cn);
+    tangential_coefficients.push_back(k * ct);
+  }
+  libra::Vector<3> reference_force_b_N, reference_torque_b_Nm;
+  CalcTorqueForceReference(surfaces, center_of_gravity_b_m, velocity_b_m_s, normal_coefficients, tangential_coefficients, reference_force_b_N,
+                           reference_torque_b_Nm);
+
+  ExpectNearVector(reference_force_b_N, air_drag.GetForce_b_N());
+  ExpectNearVector(reference_torque_b_Nm, torque_b_Nm);
+}
+
+/**
+ * @brief Test that the changes of the surfaces and the center of gravity during the simulation are reflected
+ */
+TEST(SurfaceForce, ChangeStructure) {
+  const libra::Vector<3> sun_direction_b = MakeVector(0.0, 0.0, 1.0);
+  std::vector<Surface> surfaces;
+  surfaces.push_back(Surface(MakeVector(1.0, 0.0, 0.0), MakeVector(0.0, 0.0, 1.0), 1.0, 0.0, 0.0, 0.0));
+  libra::Vector<3> center_of_gravity_b_m(0.0);
+  SolarRadiationPressureForTest srp(surfaces, center_of_gravity_b_m);
+
+  // Absorbed light: F = -P * A * n, T = r x F
+  libra::Vector<3> torque_b_Nm = srp.Calc(sun_direction_b, 1.0);
+  EXPECT_DOUBLE_EQ(-1.0, srp.GetForce_b_N()[2]);
+  EXPECT_DOUBLE_EQ(1.0, torque_b_Nm[1]);
+
+  surfaces[0].SetArea_m2(0.5);
+  center_of_gravity_b_m[0] = 0.5;
+  torque_b_Nm = srp.Calc(sun_direction_b, 1.0);
+  EXPECT_DOUBLE_EQ(-0.5, srp.GetForce_b_N()[2]);
+  EXPECT_DOUBLE_EQ(0.25, torque_b_Nm[1]);
+
+  // Replacement of the surface
+  surfaces[0] = Surface(MakeVector(0.5, 0.0, 0.0), MakeVector(0.0, 0.0, 1.0), 2.0, 0.0, 0.0, 0.0);
+  torque_b_Nm = srp.Calc(sun_direction_b, 1.0);
+  EXPECT_DOUBLE_EQ(-2.0, srp.GetForce_b_N()[2]);
+  EXPECT_DOUBLE_EQ(0.0, torque_b_Nm[1]);
+
+  // Back side
+  torque_b_Nm = srp.Calc(-1.0 * sun_direction_b, 1.0);
+  EXPECT_DOUBLE_EQ(0.0, srp.GetForce_b_N().CalcNorm());
+  EXPECT_DOUBLE_EQ(0.0, torque_b_Nm.CalcNorm());
+}
+
+/**
+ * @brief Test that the shadowed surfaces do not generate the force when the occlusion is enabled
+ */
+TEST(SurfaceForce, Occlusion) {
+  const libra::Vector<3> sun_direction_b = MakeVector(0.0, 0.0, 1.0);
+  std::vector<Surface> surfaces;
+  surfaces.push_back(Surface(MakeVector(0.0, 0.0, 0.5), MakeVector(0.0, 0.0, 1.0), 1.0, 0.0, 0.0, 0.0));
+  surfaces.push_back(Surface(MakeVector(0.0, 0.0, 1.0), MakeVector(0.0, 0.0, 1.0), 2.0, 0.0, 0.0, 0.0));
+  const libra::Vector<3> center_of_gravity_b_m(0.0);
+  SolarRadiationPressureForTest srp(surfaces, center_of_gravity_b_m);
+
+  srp.Calc(sun_direction_b, 1.0);
+  EXPECT_DOUBLE_EQ(-3.0, srp.GetForce_b_N()[2]);
+
+  // The lower surface is in the shadow of the upper surface
+  srp.EnableOcclusion(1.0 * libra::deg_to_rad, 16);
+  srp.Calc(sun_direction_b, 1.0);
+  EXPECT_DOUBLE_EQ(-2.0, srp.GetForce_b_N()[2]);
+  EXPECT_EQ(1u, srp.GetOcclusion().GetNumberOfCachedDirections());
+}
+
+/**
+ * @brief Test that the occlusion is rebuilt when the surfaces are moved
+ */
+TEST(SurfaceForce, OcclusionChangeStructure) {
+  const libra::Vector<3> sun_direction_b = MakeVector(0.0, 0.0, 1.0);
+  std::vector<Surface> surfaces;
+  surfaces.push_back(Surface(MakeVector(0.0, 0.0, 0.5), MakeVector(0.0, 0.0, 1.0), 1.0, 0.0, 0.0, 0.0));
+  surfaces.push_back(Surface(MakeVector(0.0, 0.0, 1.0), MakeVector(0.0, 0.0, 1.0), 2.0, 0.0, 0.0, 0.0));
+  const libra::Vector<3> center_of_gravity_b_m(0.0);
+  SolarRadiationPressureForTest srp(surfaces, center_of_gravity_b_m);
+  srp.EnableOcclusion(1.0 * libra::deg_to_rad, 16);
+
+  srp.Calc(sun_direction_b, 1.0);
+  EXPECT_DOUBLE_EQ(-2.0, srp.GetForce_b_N()[2]);
+
+  // The upper surface is moved aside, so the lower surface is lit with the same direction bin
+  surfaces[1].SetPosition_b_m(MakeVector(10.0, 0.0, 1.0));
+  srp.Calc(sun_direction_b, 1.0);
+  EXPECT_DOUBLE_EQ(-3.0, srp.GetForce_b_N()[2]);
+
+  // The change of the optical parameters keeps the cache
+  surfaces[0].SetReflectivity(0.0);
+  srp.Calc(sun_direction_b, 1.0);
+  EXPECT_EQ(1u, srp.GetOcclusion().GetNumberOfCachedDirections());
+
+  // The upper surface is moved back
+  surfaces[1].SetPosition_b_m(MakeVector(0.0, 0.0, 1.0));
+  srp.Calc(sun_direction_b, 1.0);
+  EXPECT_DOUBLE_EQ(-2.0, srp.GetForce_b_N()[2]);
+}
@@ -0,0 +1,105 @@
+/**
+ * @file test_surface_occlusion.cpp
+ * @brief Test codes for SurfaceOcclusion class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "surface_occlusion.hpp"
+
+namespace {
+/**
+ * @fn MakeVector
+ * @brief Make a vector from the components
+ */
+libra::Vector<3> MakeVector(const double x, const double y, const double z) {
+  libra::Vector<3> vector;
+  vector[0] = x;
+  vector[1] = y;
+  vector[2] = z;
+  return vector;
+}
+
+/**
+ * @fn MakeBoxWithPanel
+ * @brief Make the six surfaces of 1 m cube (-X, +X, -Y, +Y, -Z, +Z) and a panel of 2 m^2 above the +Z surface
+ */
+std::vector<Surface> MakeBoxWithPanel(const double panel_height_m) {
+  std::vector<Surface> surfaces;
+  for (size_t axis = 0; axis < 3; axis++) {
+    for (int sign = -1; sign <= 1; sign += 2) {
+      libra::Vector<3> normal_b(0.0);
+      normal_b[axis] = sign;
+      surfaces.push_back(Surface(0.5 * normal_b, normal_b, 1.0, 0.5, 0.5, 0.5));
+    }
+  }
+  surfaces.push_back(Surface(MakeVector(0.0, 0.0, panel_height_m), MakeVector(0.0, 0.0, 1.0), 2.0, 0.5, 0.5, 0.5));
+  return surfaces;
+}
+}  // namespace
+
+/**
+ * @brief Test that the surfaces of a convex box are not shadowed
+ */
+TEST(SurfaceOcclusion, ConvexBox) {
+  std::vector<Surface> surfaces = MakeBoxWithPanel(0.0);
+  surfaces.pop_back();
+  SurfaceOcclusion occlusion(1.0 * libra::deg_to_rad, 64);
+  occlusion.Build(surfaces);
+
+  const libra::Vector<3> directions_b[3] = {MakeVector(1.0, 1.0, 0.0), MakeVector(1.0, -0.3, 0.9), MakeVector(-0.2, 0.1, -1.0)};
+  for (size_t i = 0; i < 3; i++) {
+    const libra::Vector<3> direction_b = directions_b[i].CalcNormalizedVector();
+    const std::vector<double> lit_fractions = occlusion.CalcLitFractions(direction_b);
+    for (size_t surface = 0; surface < surfaces.size(); surface++) {
+      const double cos_theta = InnerProduct(surfaces[surface].GetNormal_b(), direction_b);
+      EXPECT_DOUBLE_EQ(cos_theta > 0.0 ? 1.0 : 0.0, lit_fractions[surface]);
+    }
+  }
+}
+
+/**
+ * @brief Test the shadow of the panel on the +Z surface of the box
+ */
+TEST(SurfaceOcclusion, Panel) {
+  const std::vector<Surface> surfaces = MakeBoxWithPanel(1.0);
+  SurfaceOcclusion occlusion(1.0 * libra::deg_to_rad, 64);
+  occlusion.Build(surfaces);
+  EXPECT_EQ(7u, occlusion.GetNumberOfSurfaces());
+
+  // The panel is larger than the +Z surface, so the surface is fully shadowed from the +Z direction
+  std::vector<double> lit_fractions = occlusion.CalcLitFractions(MakeVector(0.0, 0.0, 1.0));
+  EXPECT_DOUBLE_EQ(0.0, lit_fractions[5]);
+  EXPECT_DOUBLE_EQ(1.0, lit_fractions[6]);
+
+  // The shadow moves away from the surface for the low elevation
+  lit_fractions = occlusion.CalcLitFractions(MakeVector(1.0, 0.0, 0.2));
+  EXPECT_DOUBLE_EQ(1.0, lit_fractions[5]);
+  EXPECT_DOUBLE_EQ(1.0, lit_fractions[1]);
+
+  // Partially shadowed. The shadow of the panel is shifted by 0.5 m in +X direction on the +Z surface.
+  lit_fractions = occlusion.CalcLitFractions(MakeVector(-1.0, 0.0, 1.0));
+  EXPECT_GT(lit_fractions[5], 0.0);
+  EXPECT_LT(lit_fractions[5], 0.5);
+}
+
+/**
+ * @brief Test the cache of the lit fractions
+ */
+TEST(SurfaceOcclusion, Cache) {
+  const std::vector<Surface> surfaces = MakeBoxWithPanel(1.0);
+  SurfaceOcclusion occlusion(5.0 * libra::deg_to_rad, 16);
+  occlusion.Build(surfaces);
+
+  const std::vector<double> lit_fractions = occlusion.GetLitFractions(MakeVector(-1.0, 0.0, 1.0));
+  EXPECT_EQ(1u, occlusion.GetNumberOfCachedDirections());
+  // The same bin
+  const std::vector<double>& cached_lit_fractions = occlusion.GetLitFractions(MakeVector(-1.0, 0.01, 1.01));
+  EXPECT_EQ(1u, occlusion.GetNumberOfCachedDirections());
+  for (size_t i = 0; i < surfaces.size(); i++) EXPECT_DOUBLE_EQ(lit_fractions[i], cached_lit_fractions[i]);
+  // Another bin
+  occlusion.GetLitFractions(MakeVector(0.0, 0.0, 1.0));
+  EXPECT_EQ(2u, occlusion.GetNumberOfCachedDirections());
+
+  occlusion.Clear();
+  EXPECT_EQ(0u, occlusion.GetNumberOfCachedDirections());
+}
@@ -53,3 +53,7 @@ std::string ThirdBodyGravity::GetLogValue() const {
 
   return str_tmp;
 }
+
+void ThirdBodyGravity::PushLogValue(LogValueBuffer& buffer) const {
+  buffer.Push(acceleration_i_m_s2_);
+}
@@ -56,6 +56,11 @@ class ThirdBodyGravity : public Disturbance {
    * @brief Override function of GetLogValue
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn PushLogValue
+   * @brief Override PushLogValue function of ILoggable
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const;
 
   /**
    * @fn CalcAcceleration_i_m_s2
@@ -43,10 +43,46 @@ std::string Attitude::GetLogValue() const {
   return str_tmp;
 }
 
+void Attitude::PushLogValue(LogValueBuffer& buffer) const {
+  buffer.Push(angular_velocity_b_rad_s_);
+  buffer.Push(quaternion_i2b_);
+  buffer.Push(torque_b_Nm_);
+  buffer.Push(angular_momentum_total_Nms_);
+  buffer.Push(kinetic_energy_J_);
+}
+
 void Attitude::SetParameters(const MonteCarloSimulationExecutor& mc_simulator) {
   GetInitializedMonteCarloParameterQuaternion(mc_simulator, "quaternion_i2b", quaternion_i2b_);
 }
 
+std::vector<std::string> Attitude::GetInitialStateParameterNames() const { return {"quaternion_i2b"}; }
+
+void Attitude::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("Attitude");
+  writer.Write(angular_velocity_b_rad_s_);
+  writer.Write(quaternion_i2b_);
+  writer.Write(torque_b_Nm_);
+  writer.Write(angular_momentum_spacecraft_b_Nms_);
+  writer.Write(angular_momentum_reaction_wheel_b_Nms_);
+  writer.Write(angular_momentum_total_b_Nms_);
+  writer.Write(angular_momentum_total_i_Nms_);
+  writer.Write(angular_momentum_total_Nms_);
+  writer.Write(kinetic_energy_J_);
+}
+
+void Attitude::LoadState(CheckpointReader& reader) {
+  reader.BeginSection("Attitude");
+  reader.Read(angular_velocity_b_rad_s_);
+  reader.Read(quaternion_i2b_);
+  reader.Read(torque_b_Nm_);
+  reader.Read(angular_momentum_spacecraft_b_Nms_);
+  reader.Read(angular_momentum_reaction_wheel_b_Nms_);
+  reader.Read(angular_momentum_total_b_Nms_);
+  reader.Read(angular_momentum_total_i_Nms_);
+  reader.Read(angular_momentum_total_Nms_);
+  reader.Read(kinetic_energy_J_);
+}
+
 void Attitude::CalcAngularMomentum(void) {
   angular_momentum_spacecraft_b_Nms_ = inertia_tensor_kgm2_ * angular_velocity_b_rad_s_;
   angular_momentum_total_b_Nms_ = angular_momentum_reaction_wheel_b_Nms_ + angular_momentum_spacecraft_b_Nms_;
@@ -9,6 +9,7 @@
 #include <library/logger/loggable.hpp>
 #include <library/math/matrix_vector.hpp>
 #include <library/math/quaternion.hpp>
+#include <library/utilities/checkpoint.hpp>
 #include <simulation/monte_carlo_simulation/simulation_object.hpp>
 #include <string>
 
@@ -98,6 +99,19 @@ class Attitude : public ILoggable, public SimulationObject {
    */
   virtual void Propagate(const double end_time_s) = 0;
 
+  /**
+   * @fn SaveState
+   * @brief Write the attitude state to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the attitude state from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -109,9 +123,15 @@ class Attitude : public ILoggable, public SimulationObject {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn PushLogValue
+   * @brief Override PushLogValue function of ILoggable
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const;
 
   // SimulationObject for McSim
   virtual void SetParameters(const MonteCarloSimulationExecutor& mc_simulator);
+  virtual std::vector<std::string> GetInitialStateParameterNames() const;
 
  protected:
   bool is_calc_enabled_ = true;                //!< Calculation flag
@@ -30,12 +30,33 @@ void AttitudeRk4::SetParameters(const MonteCarloSimulationExecutor& mc_simulator
   Attitude::SetParameters(mc_simulator);
   GetInitializedMonteCarloParameterVector(mc_simulator, "angular_velocity_b_rad_s", angular_velocity_b_rad_s_);
 
-  // TODO: Consider the following calculation is needed here?
-  current_propagation_time_s_ = 0.0;
-  angular_momentum_reaction_wheel_b_Nms_ = libra::Vector<3>(0.0);  //!< Consider how to handle this variable
+  // The propagation time and the angular momentum of the reaction wheels are kept so that the parameters can be applied at the branch time of
+  // the Monte-Carlo simulation
   CalcAngularMomentum();
 }
 
+std::vector<std::string> AttitudeRk4::GetInitialStateParameterNames() const {
+  std::vector<std::string> names = Attitude::GetInitialStateParameterNames();
+  names.push_back("angular_velocity_b_rad_s");
+  return names;
+}
+
+void AttitudeRk4::SaveState(CheckpointWriter& writer) const {
+  Attitude::SaveState(writer);
+  writer.BeginSection("AttitudeRk4");
+  writer.Write(current_propagation_time_s_);
+  writer.Write(previous_inertia_tensor_kgm2_);
+  writer.Write(torque_inertia_tensor_change_b_Nm_);
+}
+
+void AttitudeRk4::LoadState(CheckpointReader& reader) {
+  Attitude::LoadState(reader);
+  reader.BeginSection("AttitudeRk4");
+  reader.Read(current_propagation_time_s_);
+  reader.Read(previous_inertia_tensor_kgm2_);
+  reader.Read(torque_inertia_tensor_change_b_Nm_);
+}
+
 void AttitudeRk4::Propagate(const double end_time_s) {
   if (!is_calc_enabled_) return;
 
@@ -40,12 +40,30 @@ class AttitudeRk4 : public Attitude {
    */
   virtual void Propagate(const double end_time_s);
 
+  /**
+   * @fn SaveState
+   * @brief Write the attitude state and the state of the integrator to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the attitude state and the state of the integrator from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
   /**
    * @fn SetParameters
    * @brief Set parameters for Monte-Carlo simulation
    * @param [in] mc_simulator: Monte-Carlo simulation executor
    */
   virtual void SetParameters(const MonteCarloSimulationExecutor& mc_simulator);
+  /**
+   * @fn GetInitialStateParameterNames
+   * @brief Return the names of the Monte-Carlo parameters which overwrite the attitude state
+   */
+  virtual std::vector<std::string> GetInitialStateParameterNames() const;
 
  private:
   double current_propagation_time_s_;                   //!< current time [sec]
@@ -0,0 +1,49 @@
+/**
+ * @file benchmark_attitude_rk4.cpp
+ * @brief Benchmark codes for AttitudeRk4 class with Google Benchmark
+ */
+#include <benchmark/benchmark.h>
+
+#include "attitude_rk4.hpp"
+
+namespace {
+
+const double kSimulationStep_s = 0.1;  //!< Propagation period of the attitude in the sample case
+
+/**
+ * @fn MakeInertiaTensor
+ * @brief Return an inertia tensor of a small satellite with the products of inertia
+ */
+libra::Matrix<3, 3> MakeInertiaTensor_kgm2() {
+  libra::Matrix<3, 3> inertia_tensor_kgm2;
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 3; j++) inertia_tensor_kgm2[i][j] = (i == j) ? 0.1 + 0.01 * (double)i : 0.001;
+  }
+  return inertia_tensor_kgm2;
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmark of the attitude propagation for one simulation step
+ * @note Argument: propagation step of the RK4 [ms]
+ */
+static void BM_AttitudeRk4(benchmark::State& state) {
+  const double propagation_step_s = (double)state.range(0) * 1.0e-3;
+  libra::Vector<3> angular_velocity_b_rad_s(0.0);
+  angular_velocity_b_rad_s[0] = 0.01;
+  angular_velocity_b_rad_s[2] = 0.05;
+  libra::Vector<3> torque_b_Nm(0.0);
+  torque_b_Nm[1] = 1.0e-6;
+  const libra::Matrix<3, 3> inertia_tensor_kgm2 = MakeInertiaTensor_kgm2();  // The attitude refers to the inertia tensor
+  AttitudeRk4 attitude(angular_velocity_b_rad_s, libra::Quaternion(0.0, 0.0, 0.0, 1.0), inertia_tensor_kgm2, torque_b_Nm, propagation_step_s);
+
+  double elapsed_time_s = 0.0;
+  for (auto _ : state) {
+    elapsed_time_s += kSimulationStep_s;
+    attitude.Propagate(elapsed_time_s);
+    benchmark::DoNotOptimize(attitude.GetQuaternion_i2b());
+  }
+  state.counters["simulated_s_per_wall_s"] = benchmark::Counter(elapsed_time_s, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_AttitudeRk4)->Arg(1)->Arg(10)->Unit(benchmark::kMicrosecond);
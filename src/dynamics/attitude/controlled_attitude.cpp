@@ -53,6 +53,30 @@ void ControlledAttitude::Initialize(void) {
   return;
 }
 
+void ControlledAttitude::SaveState(CheckpointWriter& writer) const {
+  Attitude::SaveState(writer);
+  writer.BeginSection("ControlledAttitude");
+  writer.Write(main_mode_);
+  writer.Write(sub_mode_);
+  writer.Write(main_target_direction_b_);
+  writer.Write(sub_target_direction_b_);
+  writer.Write(previous_calc_time_s_);
+  writer.Write(previous_quaternion_i2b_);
+  writer.Write(previous_omega_b_rad_s_);
+}
+
+void ControlledAttitude::LoadState(CheckpointReader& reader) {
+  Attitude::LoadState(reader);
+  reader.BeginSection("ControlledAttitude");
+  reader.Read(main_mode_);
+  reader.Read(sub_mode_);
+  reader.Read(main_target_direction_b_);
+  reader.Read(sub_target_direction_b_);
+  reader.Read(previous_calc_time_s_);
+  reader.Read(previous_quaternion_i2b_);
+  reader.Read(previous_omega_b_rad_s_);
+}
+
 void ControlledAttitude::Propagate(const double end_time_s) {
   libra::Vector<3> main_direction_i, sub_direction_i;
   if (!is_calc_enabled_) return;
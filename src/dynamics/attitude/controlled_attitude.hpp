@@ -97,6 +97,19 @@ class ControlledAttitude : public Attitude {
    */
   virtual void Propagate(const double end_time_s);
 
+  /**
+   * @fn SaveState
+   * @brief Write the attitude state and the control targets to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the attitude state and the control targets from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
  private:
   AttitudeControlMode main_mode_;              //!< Main control mode
   AttitudeControlMode sub_mode_;               //!< Sub control mode
@@ -45,6 +45,7 @@ Attitude* InitAttitude(std::string file_name, const Orbit* orbit, const LocalCel
                                                      inertia_tensor_kgm2, local_celestial_information, orbit, mc_name_temp);
     attitude_temp->Propagate(step_width_s);
     quaternion_i2b = attitude_temp->GetQuaternion_i2b();
+    delete attitude_temp;  // The name of the simulation object is released for the next case
     libra::Vector<3> omega_b = libra::Vector<3>(0.0);
     libra::Vector<3> torque_b = libra::Vector<3>(0.0);
 
@@ -5,6 +5,9 @@
 
 #include "dynamics.hpp"
 
+#include <library/utilities/profiler.hpp>
+#include <typeinfo>
+
 #include "../simulation/multiple_spacecraft/relative_information.hpp"
 
 Dynamics::Dynamics(const SimulationConfiguration* simulation_configuration, const SimulationTime* simulation_time,
@@ -37,12 +40,17 @@ void Dynamics::Initialize(const SimulationConfiguration* simulation_configuratio
 }
 
 void Dynamics::Update(const SimulationTime* simulation_time, const LocalCelestialInformation* local_celestial_information) {
+  S2E_PROFILE_SCOPE("Dynamics::Update");
   // Attitude propagation
   if (simulation_time->GetAttitudePropagateFlag()) {
+    MultiRateScheduler::ScopedTaskTimer timer(simulation_time->GetScheduler(), (size_t)SimulationTask::kAttitude);
+    S2E_PROFILE_SCOPE(typeid(*attitude_).name());
     attitude_->Propagate(simulation_time->GetElapsedTime_s());
   }
   // Orbit Propagation
   if (simulation_time->GetOrbitPropagateFlag()) {
+    MultiRateScheduler::ScopedTaskTimer timer(simulation_time->GetScheduler(), (size_t)SimulationTask::kOrbit);
+    S2E_PROFILE_SCOPE(typeid(*orbit_).name());
     orbit_->Propagate(simulation_time->GetElapsedTime_s(), simulation_time->GetCurrentTime_jd());
   }
   // Attitude dependent update
@@ -50,6 +58,8 @@ void Dynamics::Update(const SimulationTime* simulation_time, const LocalCelestia
 
   // Thermal
   if (simulation_time->GetThermalPropagateFlag()) {
+    MultiRateScheduler::ScopedTaskTimer timer(simulation_time->GetScheduler(), (size_t)SimulationTask::kThermal);
+    S2E_PROFILE_SCOPE(typeid(*temperature_).name());
     std::string sun_str = "SUN";
     char* c_sun = new char[sun_str.size() + 1];
     std::char_traits<char>::copy(c_sun, sun_str.c_str(), sun_str.size() + 1);  // string -> char*
@@ -64,6 +74,20 @@ void Dynamics::ClearForceTorque(void) {
   orbit_->SetAcceleration_i_m_s2(zero);
 }
 
+void Dynamics::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("Dynamics");
+  attitude_->SaveState(writer);
+  orbit_->SaveState(writer);
+  temperature_->SaveState(writer);
+}
+
+void Dynamics::LoadState(CheckpointReader& reader) {
+  reader.BeginSection("Dynamics");
+  attitude_->LoadState(reader);
+  orbit_->LoadState(reader);
+  temperature_->LoadState(reader);
+}
+
 void Dynamics::LogSetup(Logger& logger) {
   logger.AddLogList(attitude_);
   logger.AddLogList(orbit_);
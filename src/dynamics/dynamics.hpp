@@ -52,6 +52,19 @@ class Dynamics {
    */
   void Update(const SimulationTime* simulation_time, const LocalCelestialInformation* local_celestial_information);
 
+  /**
+   * @fn SaveState
+   * @brief Write the states of the attitude, the orbit, and the temperature to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the states of the attitude, the orbit, and the temperature from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
+
   /**
    * @fn LogSetup
    * @brief Log setup for dynamics calculation
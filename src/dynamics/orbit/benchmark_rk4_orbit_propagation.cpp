@@ -0,0 +1,99 @@
+/**
+ * @file benchmark_rk4_orbit_propagation.cpp
+ * @brief Benchmark codes for Rk4OrbitPropagation class with Google Benchmark
+ * @note The celestial information for the frame conversion is initialized with the initialize file.
+ *       The path of the file is set by the environment variable S2E_BENCHMARK_INI_FILE, and the sample file is used by default.
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <environment/global/initialize_global_environment.hpp>
+#include <filesystem>
+#include <library/initialize/initialize_file_access.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "rk4_orbit_propagation.hpp"
+
+namespace {
+
+const char* kDefaultIniFile = "../../data/sample/initialize_files/sample_simulation_base.ini";
+const double kStartTime_jd = 2458849.5;                //!< 2020/01/01 00:00:00 UTC
+const double kGravityConstant_m3_s2 = 3.986004418e14;  //!< Earth gravity constant
+const double kSimulationStep_s = 0.1;                  //!< Propagation period of the orbit in the sample case
+
+/**
+ * @fn GetIniFile
+ * @brief Return the initialize file of the benchmark
+ */
+std::string GetIniFile() {
+  const char* ini_file_env = getenv("S2E_BENCHMARK_INI_FILE");
+  return ini_file_env != nullptr ? ini_file_env : kDefaultIniFile;
+}
+
+/**
+ * @fn IsIniFileAvailable
+ * @brief Return true when the initialize file and the SPICE kernels exist
+ */
+bool IsIniFileAvailable() {
+  static int is_available = -1;
+  if (is_available >= 0) return is_available == 1;
+
+  is_available = 0;
+  if (!std::filesystem::exists(GetIniFile())) return false;
+  try {
+    IniAccess ini_file(GetIniFile());
+    const char* keywords[] = {"tls", "tpc1", "tpc2", "tpc3", "bsp"};
+    for (size_t i = 0; i < 5; i++) {
+      if (!std::filesystem::exists(ini_file.ReadString("CSPICE_KERNELS", keywords[i]))) return false;
+    }
+  } catch (const std::runtime_error&) {
+    return false;
+  }
+  is_available = 1;
+  return true;
+}
+
+/**
+ * @fn GetCelestialInformation
+ * @brief Return the celestial information updated at the start time. The information is initialized only once.
+ */
+const CelestialInformation* GetCelestialInformation() {
+  static std::unique_ptr<CelestialInformation> celestial_information;
+  if (celestial_information == nullptr) {
+    celestial_information.reset(InitCelestialInformation(GetIniFile()));
+    celestial_information->UpdateAllObjectsInformation(kStartTime_jd);
+  }
+  return celestial_information.get();
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmark of the orbit propagation in a LEO for one simulation step
+ * @note Argument: propagation step of the RK4 [ms]
+ */
+static void BM_Rk4OrbitPropagation(benchmark::State& state) {
+  if (!IsIniFileAvailable()) {
+    state.SkipWithError("Initialize files are not available");
+    return;
+  }
+  const double propagation_step_s = (double)state.range(0) * 1.0e-3;
+  libra::Vector<3> position_i_m(0.0);
+  position_i_m[0] = 6878137.0;
+  libra::Vector<3> velocity_i_m_s(0.0);
+  velocity_i_m_s[1] = 5365.0;
+  velocity_i_m_s[2] = 5365.0;
+  Rk4OrbitPropagation orbit(GetCelestialInformation(), kGravityConstant_m3_s2, propagation_step_s, position_i_m, velocity_i_m_s);
+  orbit.SetIsCalcEnabled(true);
+
+  double elapsed_time_s = 0.0;
+  for (auto _ : state) {
+    elapsed_time_s += kSimulationStep_s;
+    orbit.Propagate(elapsed_time_s, kStartTime_jd + elapsed_time_s / 86400.0);
+    benchmark::DoNotOptimize(orbit.GetPosition_i_m());
+  }
+  state.counters["simulated_s_per_wall_s"] = benchmark::Counter(elapsed_time_s, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_Rk4OrbitPropagation)->Arg(10)->Arg(100)->Unit(benchmark::kMicrosecond);
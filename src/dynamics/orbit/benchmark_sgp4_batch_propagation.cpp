@@ -0,0 +1,120 @@
+/**
+ * @file benchmark_sgp4_batch_propagation.cpp
+ * @brief Benchmark codes for Sgp4BatchPropagation class with Google Benchmark
+ * @note The catalog is made of synthetic near earth objects. The maximum position difference from the scalar sgp4() is reported as a counter.
+ */
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "sgp4_batch_propagation.hpp"
+
+namespace {
+
+const double kElapsedTime_day = 0.5;  //!< Propagation time from the epoch
+
+/**
+ * @struct Tle
+ * @brief Two line element set
+ */
+struct Tle {
+  std::string line1;  //!< The first line
+  std::string line2;  //!< The second line
+};
+
+/**
+ * @fn MakeCatalog
+ * @brief Make the synthetic catalog of the near earth objects
+ */
+std::vector<Tle> MakeCatalog(const size_t number_of_objects) {
+  std::mt19937 engine(1);
+  std::uniform_real_distribution<double> angle_deg(0.0, 360.0);
+  std::uniform_real_distribution<double> inclination_deg(0.0, 110.0);
+  std::uniform_real_distribution<double> mean_motion_rev_day(11.0, 16.0);
+  std::uniform_int_distribution<int> eccentricity_1e7(0, 200000);
+
+  std::vector<Tle> catalog(number_of_objects);
+  char line[80];
+  for (size_t i = 0; i < number_of_objects; i++) {
+    const int satellite_number = (int)(i % 100000);
+    snprintf(line, sizeof(line), "1 %05dU 98067A   20076.51604214  .00001000  00000-0  10000-3 0  9990", satellite_number);
+    catalog[i].line1 = line;
+    snprintf(line, sizeof(line), "2 %05d %8.4f %8.4f %07d %8.4f %8.4f %11.8f%5d%1d", satellite_number, inclination_deg(engine), angle_deg(engine),
+             eccentricity_1e7(engine), angle_deg(engine), angle_deg(engine), mean_motion_rev_day(engine), 1, 0);
+    catalog[i].line2 = line;
+  }
+  return catalog;
+}
+
+/**
+ * @fn InitializeScalarSgp4
+ * @brief Initialize the structure data for the scalar sgp4()
+ */
+elsetrec InitializeScalarSgp4(const Tle& tle) {
+  char line1[130] = {}, line2[130] = {};
+  strncpy(line1, tle.line1.c_str(), 129);
+  strncpy(line2, tle.line2.c_str(), 129);
+  elsetrec sgp4_data;
+  double start_mfe, stop_mfe, delta_min;
+  twoline2rv(line1, line2, 'c', 0, wgs72, start_mfe, stop_mfe, delta_min, sgp4_data);
+  return sgp4_data;
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmark of the scalar sgp4() for each object like Sgp4OrbitPropagation
+ * @note Argument: number of objects
+ */
+static void BM_Sgp4Scalar(benchmark::State& state) {
+  const std::vector<Tle> catalog = MakeCatalog((size_t)state.range(0));
+  std::vector<elsetrec> sgp4_data;
+  for (const auto& tle : catalog) sgp4_data.push_back(InitializeScalarSgp4(tle));
+  std::vector<double> positions_i_km(3 * catalog.size()), velocities_i_km_s(3 * catalog.size());
+  const double current_time_jd = sgp4_data[0].jdsatepoch + kElapsedTime_day;
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < sgp4_data.size(); i++) {
+      const double elapsed_time_min = (current_time_jd - sgp4_data[i].jdsatepoch) * (24.0 * 60.0);
+      sgp4(wgs72, sgp4_data[i], elapsed_time_min, &positions_i_km[3 * i], &velocities_i_km_s[3 * i]);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * catalog.size());
+}
+BENCHMARK(BM_Sgp4Scalar)->Arg(1000)->Arg(20000)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Benchmark of Sgp4BatchPropagation
+ * @note Arguments: number of objects, number of threads (0: number of hardware threads)
+ */
+static void BM_Sgp4Batch(benchmark::State& state) {
+  const std::vector<Tle> catalog = MakeCatalog((size_t)state.range(0));
+  Sgp4BatchPropagation batch_propagation(1, (size_t)state.range(1));
+  for (const auto& tle : catalog) batch_propagation.AddTle(tle.line1, tle.line2);
+  const double current_time_jd = InitializeScalarSgp4(catalog[0]).jdsatepoch + kElapsedTime_day;
+
+  for (auto _ : state) {
+    batch_propagation.Propagate(current_time_jd);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * catalog.size());
+
+  // Validation with the scalar sgp4()
+  double max_difference_m = 0.0;
+  for (size_t i = 0; i < catalog.size(); i++) {
+    elsetrec sgp4_data = InitializeScalarSgp4(catalog[i]);
+    double position_i_km[3], velocity_i_km_s[3];
+    if (sgp4(wgs72, sgp4_data, (current_time_jd - sgp4_data.jdsatepoch) * (24.0 * 60.0), position_i_km, velocity_i_km_s) != 0) continue;
+    for (size_t k = 0; k < 3; k++) {
+      max_difference_m = std::max(max_difference_m, std::abs(position_i_km[k] * 1000.0 - batch_propagation.GetPositions_i_m(k)[i]));
+    }
+  }
+  state.counters["max_difference_m"] = max_difference_m;
+}
+BENCHMARK(BM_Sgp4Batch)->ArgsProduct({{1000, 20000}, {1, 0}})->Unit(benchmark::kMillisecond)->UseRealTime();
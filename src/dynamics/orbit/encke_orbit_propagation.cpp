@@ -15,9 +15,7 @@ EnckeOrbitPropagation::EnckeOrbitPropagation(const CelestialInformation* celesti
     : Orbit(celestial_information),
       libra::OrdinaryDifferentialEquation<6>(propagation_step_s),
       gravity_constant_m3_s2_(gravity_constant_m3_s2),
-      error_tolerance_(error_tolerance),
-      propagation_step_s_(propagation_step_s) {
-  propagation_time_s_ = 0.0;
+      error_tolerance_(error_tolerance) {
   Initialize(current_time_jd, position_i_m, velocity_i_m_s);
 }
 
@@ -40,14 +38,7 @@ void EnckeOrbitPropagation::Propagate(const double end_time_s, const double curr
   reference_velocity_i_m_s_ = reference_kepler_orbit.GetVelocity_i_m_s();
 
   // Propagate difference orbit
-  SetStepWidth(propagation_step_s_);  // Re-set propagation Δt
-  while (end_time_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
-    Update();  // Propagation methods of the OrdinaryDifferentialEquation class
-    propagation_time_s_ += propagation_step_s_;
-  }
-  SetStepWidth(end_time_s - propagation_time_s_);  // Adjust the last propagation Δt
-  Update();
-  propagation_time_s_ = end_time_s;
+  Integrate(end_time_s);  // Propagation methods of the OrdinaryDifferentialEquation class
 
   difference_position_i_m_[0] = GetState()[0];
   difference_position_i_m_[1] = GetState()[1];
@@ -59,6 +50,38 @@ void EnckeOrbitPropagation::Propagate(const double end_time_s, const double curr
   UpdateSatOrbit();
 }
 
+void EnckeOrbitPropagation::SaveState(CheckpointWriter& writer) const {
+  Orbit::SaveState(writer);
+  libra::OrdinaryDifferentialEquation<6>::SaveState(writer);
+  writer.BeginSection("EnckeOrbitPropagation");
+  writer.Write(reference_position_i_m_);
+  writer.Write(reference_velocity_i_m_s_);
+  const OrbitalElements& oe_ref = reference_kepler_orbit.GetOrbitalElements();
+  writer.Write(oe_ref.GetEpoch_jday());
+  writer.Write(oe_ref.GetSemiMajorAxis_m());
+  writer.Write(oe_ref.GetEccentricity());
+  writer.Write(oe_ref.GetInclination_rad());
+  writer.Write(oe_ref.GetRaan_rad());
+  writer.Write(oe_ref.GetArgPerigee_rad());
+  writer.Write(difference_position_i_m_);
+  writer.Write(difference_velocity_i_m_s_);
+}
+
+void EnckeOrbitPropagation::LoadState(CheckpointReader& reader) {
+  Orbit::LoadState(reader);
+  libra::OrdinaryDifferentialEquation<6>::LoadState(reader);
+  reader.BeginSection("EnckeOrbitPropagation");
+  reader.Read(reference_position_i_m_);
+  reader.Read(reference_velocity_i_m_s_);
+  double oe_ref[6] = {};  // Epoch, semi major axis, eccentricity, inclination, RAAN, and argument of perigee
+  for (size_t i = 0; i < 6; i++) reader.Read(oe_ref[i]);
+  if (reader.IsValid()) {
+    reference_kepler_orbit = KeplerOrbit(gravity_constant_m3_s2_, OrbitalElements(oe_ref[0], oe_ref[1], oe_ref[2], oe_ref[3], oe_ref[4], oe_ref[5]));
+  }
+  reader.Read(difference_position_i_m_);
+  reader.Read(difference_velocity_i_m_s_);
+}
+
 // Functions for OrdinaryDifferentialEquation
 void EnckeOrbitPropagation::DerivativeFunction(double t, const libra::Vector<6>& state, libra::Vector<6>& rhs) {
   UNUSED(t);
@@ -98,7 +121,7 @@ void EnckeOrbitPropagation::Initialize(double current_time_jd, libra::Vector<3>
   difference_velocity_i_m_s_.FillUp(0.0);
 
   libra::Vector<6> zero(0.0f);
-  Setup(0.0, zero);
+  Setup(GetIndependentVariable(), zero);  // The independent variable is kept as the simulation elapsed time
 
   UpdateSatOrbit();
 }
@@ -44,6 +44,24 @@ class EnckeOrbitPropagation : public Orbit, public libra::OrdinaryDifferentialEq
    * @param [in] current_time_jd: Current Julian day [day]
    */
   virtual void Propagate(const double end_time_s, const double current_time_jd);
+  /**
+   * @fn GetNumberOfDerivativeEvaluations
+   * @brief Return total number of the derivative function evaluations in the numerical integration
+   */
+  virtual size_t GetNumberOfDerivativeEvaluations() const { return libra::OrdinaryDifferentialEquation<6>::GetNumberOfDerivativeEvaluations(); }
+
+  /**
+   * @fn SaveState
+   * @brief Write the orbit state, the state of the integrator and the reference orbit to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the orbit state, the state of the integrator and the reference orbit from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadState(CheckpointReader& reader);
 
   // Override OrdinaryDifferentialEquation
   /**
@@ -59,8 +77,6 @@ class EnckeOrbitPropagation : public Orbit, public libra::OrdinaryDifferentialEq
   // General
   const double gravity_constant_m3_s2_;  //!< Gravity constant of the center body [m3/s2]
   const double error_tolerance_;         //!< Error tolerance ratio
-  double propagation_step_s_;            //!< Propagation step width for RK4
-  double propagation_time_s_;            //!< Simulation current time for numerical integration by RK4
 
   // reference orbit
   libra::Vector<3> reference_position_i_m_;    //!< Reference orbit position in the inertial frame [m]
@@ -12,6 +12,38 @@
 #include "rk4_orbit_propagation.hpp"
 #include "sgp4_orbit_propagation.hpp"
 
+/**
+ * @fn InitNumericalIntegration
+ * @brief Set numerical integration method and tolerances of the orbit propagator
+ * @param [in] conf: Initialize file access
+ * @param [in] section: Section name
+ * @param [out] ode: Orbit propagator with the ordinary differential equation
+ */
+void InitNumericalIntegration(IniAccess& conf, const char* section, libra::OrdinaryDifferentialEquation<6>& ode) {
+  std::string method = conf.ReadString(section, "integration_method");
+  if (method == "RK4") {
+    ode.SetIntegrationMethod(libra::NumericalIntegrationMethod::kRk4);
+    return;
+  } else if (method == "DP54") {
+    ode.SetIntegrationMethod(libra::NumericalIntegrationMethod::kDormandPrince5);
+  } else if (method == "DOP853") {
+    ode.SetIntegrationMethod(libra::NumericalIntegrationMethod::kDop853);
+  } else {
+    std::cerr << "WARNING: orbit integration method: " << method << " is not defined!" << std::endl;
+    std::cerr << "The integration method is automatically set as RK4" << std::endl;
+    ode.SetIntegrationMethod(libra::NumericalIntegrationMethod::kRk4);
+    return;
+  }
+
+  double relative_tolerance = conf.ReadDouble(section, "integration_relative_tolerance");
+  double absolute_tolerance = conf.ReadDouble(section, "integration_absolute_tolerance");
+  if (relative_tolerance <= 0.0 || absolute_tolerance <= 0.0) {
+    std::cerr << "WARNING: orbit integration tolerances should be positive. The default values are used." << std::endl;
+    return;
+  }
+  ode.SetTolerance(relative_tolerance, absolute_tolerance);
+}
+
 Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string initialize_file, double step_width_s, double current_time_jd,
                  double gravity_constant_m3_s2, std::string section, RelativeInformation* relative_information) {
   auto conf = IniAccess(initialize_file);
@@ -33,7 +65,10 @@ Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string
       position_i_m[i] = pos_vel[i];
       velocity_i_m_s[i] = pos_vel[i + 3];
     }
-    orbit = new Rk4OrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, position_i_m, velocity_i_m_s);
+    Rk4OrbitPropagation* rk4_orbit =
+        new Rk4OrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, position_i_m, velocity_i_m_s);
+    InitNumericalIntegration(conf, section_, *rk4_orbit);
+    orbit = rk4_orbit;
   } else if (propagate_mode == "SGP4") {
     // Initialize SGP4 orbit propagator
     int wgs_setting = conf.ReadInt(section_, "wgs_setting");
@@ -58,8 +93,11 @@ Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string
     // the orbit of the reference sat is initialized, create temporary initial orbit of the reference sat
     int reference_spacecraft_id = conf.ReadInt(section_, "reference_satellite_id");
 
-    orbit = new RelativeOrbit(celestial_information, gravity_constant_m3_s2, step_width_s, reference_spacecraft_id, init_relative_position_lvlh,
-                              init_relative_velocity_lvlh, update_method, relative_dynamics_model_type, stm_model_type, relative_information);
+    RelativeOrbit* relative_orbit =
+        new RelativeOrbit(celestial_information, gravity_constant_m3_s2, step_width_s, reference_spacecraft_id, init_relative_position_lvlh,
+                          init_relative_velocity_lvlh, update_method, relative_dynamics_model_type, stm_model_type, relative_information);
+    InitNumericalIntegration(conf, section_, *relative_orbit);
+    orbit = relative_orbit;
   } else if (propagate_mode == "KEPLER") {
     // initialize orbit for Kepler propagation
     OrbitalElements oe;
@@ -94,8 +132,10 @@ Orbit* InitOrbit(const CelestialInformation* celestial_information, std::string
     }
 
     double error_tolerance = conf.ReadDouble(section_, "error_tolerance");
-    orbit = new EnckeOrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, current_time_jd, position_i_m, velocity_i_m_s,
-                                      error_tolerance);
+    EnckeOrbitPropagation* encke_orbit = new EnckeOrbitPropagation(celestial_information, gravity_constant_m3_s2, step_width_s, current_time_jd,
+                                                                   position_i_m, velocity_i_m_s, error_tolerance);
+    InitNumericalIntegration(conf, section_, *encke_orbit);
+    orbit = encke_orbit;
   } else {
     std::cerr << "ERROR: orbit propagation mode: " << propagate_mode << " is not defined!" << std::endl;
     std::cerr << "The orbit mode is automatically set as RK4" << std::endl;
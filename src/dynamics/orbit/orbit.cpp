@@ -42,6 +42,30 @@ void Orbit::TransformEciToEcef(void) {
 
 void Orbit::TransformEcefToGeodetic(void) { spacecraft_geodetic_position_.UpdateFromEcef(spacecraft_position_ecef_m_); }
 
+void Orbit::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("Orbit");
+  writer.Write(is_calc_enabled_);
+  writer.Write(spacecraft_position_i_m_);
+  writer.Write(spacecraft_position_ecef_m_);
+  writer.Write(spacecraft_geodetic_position_);
+  writer.Write(spacecraft_velocity_i_m_s_);
+  writer.Write(spacecraft_velocity_b_m_s_);
+  writer.Write(spacecraft_velocity_ecef_m_s_);
+  writer.Write(spacecraft_acceleration_i_m_s2_);
+}
+
+void Orbit::LoadState(CheckpointReader& reader) {
+  reader.BeginSection("Orbit");
+  reader.Read(is_calc_enabled_);
+  reader.Read(spacecraft_position_i_m_);
+  reader.Read(spacecraft_position_ecef_m_);
+  reader.Read(spacecraft_geodetic_position_);
+  reader.Read(spacecraft_velocity_i_m_s_);
+  reader.Read(spacecraft_velocity_b_m_s_);
+  reader.Read(spacecraft_velocity_ecef_m_s_);
+  reader.Read(spacecraft_acceleration_i_m_s2_);
+}
+
 OrbitInitializeMode SetOrbitInitializeMode(const std::string initialize_mode) {
   if (initialize_mode == "DEFAULT") {
     return OrbitInitializeMode::kDefault;
@@ -64,6 +88,7 @@ std::string Orbit::GetLogHeader() const {
   str_tmp += WriteScalar("spacecraft_latitude", "rad");
   str_tmp += WriteScalar("spacecraft_longitude", "rad");
   str_tmp += WriteScalar("spacecraft_altitude", "m");
+  str_tmp += WriteScalar("orbit_derivative_evaluations", "");
 
   return str_tmp;
 }
@@ -78,6 +103,18 @@ std::string Orbit::GetLogValue() const {
   str_tmp += WriteScalar(spacecraft_geodetic_position_.GetLatitude_rad());
   str_tmp += WriteScalar(spacecraft_geodetic_position_.GetLongitude_rad());
   str_tmp += WriteScalar(spacecraft_geodetic_position_.GetAltitude_m());
+  str_tmp += WriteScalar(GetNumberOfDerivativeEvaluations());
 
   return str_tmp;
 }
+
+void Orbit::PushLogValue(LogValueBuffer& buffer) const {
+  buffer.Push(spacecraft_position_i_m_);
+  buffer.Push(spacecraft_velocity_i_m_s_);
+  buffer.Push(spacecraft_velocity_b_m_s_);
+  buffer.Push(spacecraft_acceleration_i_m_s2_);
+  buffer.Push(spacecraft_geodetic_position_.GetLatitude_rad());
+  buffer.Push(spacecraft_geodetic_position_.GetLongitude_rad());
+  buffer.Push(spacecraft_geodetic_position_.GetAltitude_m());
+  buffer.Push((double)GetNumberOfDerivativeEvaluations());
+}
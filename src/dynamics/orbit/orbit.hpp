@@ -15,6 +15,7 @@
 #include <library/math/matrix_vector.hpp>
 #include <library/math/quaternion.hpp>
 #include <library/math/vector.hpp>
+#include <library/utilities/checkpoint.hpp>
 
 /**
  * @enum OrbitPropagateMode
@@ -114,6 +115,12 @@ class Orbit : public ILoggable {
    * @brief Return spacecraft position in the geodetic frame [m]
    */
   inline GeodeticPosition GetGeodeticPosition() const { return spacecraft_geodetic_position_; }
+  /**
+   * @fn GetNumberOfDerivativeEvaluations
+   * @brief Return total number of the derivative function evaluations in the numerical integration
+   * @note The analytical propagators return zero
+   */
+  virtual size_t GetNumberOfDerivativeEvaluations() const { return 0; }
 
   // TODO delete the following functions
   inline double GetLatitude_rad() const { return spacecraft_geodetic_position_.GetLatitude_rad(); }
@@ -172,6 +179,19 @@ class Orbit : public ILoggable {
    */
   libra::Quaternion CalcQuaternion_i2lvlh() const;
 
+  /**
+   * @fn SaveState
+   * @brief Write the orbit state to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the orbit state from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -183,6 +203,11 @@ class Orbit : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn PushLogValue
+   * @brief Override PushLogValue function of ILoggable
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const;
 
  protected:
   const CelestialInformation* celestial_information_;  //!< Celestial information
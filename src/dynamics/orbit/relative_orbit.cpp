@@ -22,9 +22,6 @@ RelativeOrbit::RelativeOrbit(const CelestialInformation* celestial_information,
       relative_information_(relative_information) {
   propagate_mode_ = OrbitPropagateMode::kRelativeOrbit;
 
-  propagation_time_s_ = 0.0;
-  propagation_step_s_ = time_step_s;
-
   InitializeState(relative_position_lvlh_m, relative_velocity_lvlh_m_s, gravity_constant_m3_s2);
 }
 
@@ -67,6 +64,24 @@ void RelativeOrbit::InitializeState(libra::Vector<3> relative_position_lvlh_m, l
   TransformEcefToGeodetic();
 }
 
+void RelativeOrbit::SaveState(CheckpointWriter& writer) const {
+  Orbit::SaveState(writer);
+  libra::OrdinaryDifferentialEquation<6>::SaveState(writer);
+  writer.BeginSection("RelativeOrbit");
+  writer.Write(stm_);
+  writer.Write(relative_position_lvlh_m_);
+  writer.Write(relative_velocity_lvlh_m_s_);
+}
+
+void RelativeOrbit::LoadState(CheckpointReader& reader) {
+  Orbit::LoadState(reader);
+  libra::OrdinaryDifferentialEquation<6>::LoadState(reader);
+  reader.BeginSection("RelativeOrbit");
+  reader.Read(stm_);
+  reader.Read(relative_position_lvlh_m_);
+  reader.Read(relative_velocity_lvlh_m_s_);
+}
+
 void RelativeOrbit::CalculateSystemMatrix(RelativeOrbitModel relative_dynamics_model_type, const Orbit* reference_sat_orbit,
                                           double gravity_constant_m3_s2) {
   switch (relative_dynamics_model_type) {
@@ -121,14 +136,7 @@ void RelativeOrbit::Propagate(const double end_time_s, const double current_time
 }
 
 void RelativeOrbit::PropagateRk4(double elapsed_sec) {
-  SetStepWidth(propagation_step_s_);  // Re-set propagation dt
-  while (elapsed_sec - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
-    Update();  // Propagation methods of the OrdinaryDifferentialEquation class
-    propagation_time_s_ += propagation_step_s_;
-  }
-  SetStepWidth(elapsed_sec - propagation_time_s_);  // Adjust the last propagation dt
-  Update();
-  propagation_time_s_ = elapsed_sec;
+  Integrate(elapsed_sec);  // Propagation methods of the OrdinaryDifferentialEquation class
 
   relative_position_lvlh_m_[0] = GetState()[0];
   relative_position_lvlh_m_[1] = GetState()[1];
@@ -56,6 +56,24 @@ class RelativeOrbit : public Orbit, public libra::OrdinaryDifferentialEquation<6
    * @param [in] current_time_jd: Current Julian day [day]
    */
   virtual void Propagate(const double end_time_s, const double current_time_jd);
+  /**
+   * @fn GetNumberOfDerivativeEvaluations
+   * @brief Return total number of the derivative function evaluations in the numerical integration
+   */
+  virtual size_t GetNumberOfDerivativeEvaluations() const { return libra::OrdinaryDifferentialEquation<6>::GetNumberOfDerivativeEvaluations(); }
+
+  /**
+   * @fn SaveState
+   * @brief Write the orbit state, the state of the integrator and the relative orbit to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the orbit state, the state of the integrator and the relative orbit from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadState(CheckpointReader& reader);
 
   // Override OrdinaryDifferentialEquation
   /**
@@ -70,8 +88,6 @@ class RelativeOrbit : public Orbit, public libra::OrdinaryDifferentialEquation<6
  private:
   double gravity_constant_m3_s2_;         //!< Gravity constant of the center body [m3/s2]
   unsigned int reference_spacecraft_id_;  //!< Reference satellite ID
-  double propagation_time_s_;             //!< Simulation current time for numerical integration by RK4 [sec]
-  double propagation_step_s_;             //!< Step width for RK4 [sec]
 
   libra::Matrix<6, 6> system_matrix_;  //!< System matrix
   libra::Matrix<6, 6> stm_;            //!< State transition matrix
@@ -13,8 +13,6 @@ Rk4OrbitPropagation::Rk4OrbitPropagation(const CelestialInformation* celestial_i
     : Orbit(celestial_information), OrdinaryDifferentialEquation<6>(time_step_s), gravity_constant_m3_s2_(gravity_constant_m3_s2) {
   propagate_mode_ = OrbitPropagateMode::kRk4;
 
-  propagation_time_s_ = 0.0;
-  propagation_step_s_ = time_step_s;
   spacecraft_acceleration_i_m_s2_ *= 0;
 
   Initialize(position_i_m, velocity_i_m_s, initial_time_s);
@@ -62,19 +60,22 @@ void Rk4OrbitPropagation::Initialize(libra::Vector<3> position_i_m, libra::Vecto
   TransformEcefToGeodetic();
 }
 
+void Rk4OrbitPropagation::SaveState(CheckpointWriter& writer) const {
+  Orbit::SaveState(writer);
+  libra::OrdinaryDifferentialEquation<6>::SaveState(writer);
+}
+
+void Rk4OrbitPropagation::LoadState(CheckpointReader& reader) {
+  Orbit::LoadState(reader);
+  libra::OrdinaryDifferentialEquation<6>::LoadState(reader);
+}
+
 void Rk4OrbitPropagation::Propagate(const double end_time_s, const double current_time_jd) {
   UNUSED(current_time_jd);
 
   if (!is_calc_enabled_) return;
 
-  SetStepWidth(propagation_step_s_);  // Re-set propagation Δt
-  while (end_time_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
-    Update();  // Propagation methods of the OrdinaryDifferentialEquation class
-    propagation_time_s_ += propagation_step_s_;
-  }
-  SetStepWidth(end_time_s - propagation_time_s_);  // Adjust the last propagation Δt
-  Update();
-  propagation_time_s_ = end_time_s;
+  Integrate(end_time_s);  // Propagation methods of the OrdinaryDifferentialEquation class
 
   spacecraft_position_i_m_[0] = GetState()[0];
   spacecraft_position_i_m_[1] = GetState()[1];
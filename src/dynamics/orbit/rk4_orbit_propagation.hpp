@@ -53,11 +53,27 @@ class Rk4OrbitPropagation : public Orbit, public libra::OrdinaryDifferentialEqua
    * @param [in] current_time_jd: Current Julian day [day]
    */
   virtual void Propagate(const double end_time_s, const double current_time_jd);
+  /**
+   * @fn GetNumberOfDerivativeEvaluations
+   * @brief Return total number of the derivative function evaluations in the numerical integration
+   */
+  virtual size_t GetNumberOfDerivativeEvaluations() const { return OrdinaryDifferentialEquation<6>::GetNumberOfDerivativeEvaluations(); }
+
+  /**
+   * @fn SaveState
+   * @brief Write the orbit state and the state of the integrator to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the orbit state and the state of the integrator from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadState(CheckpointReader& reader);
 
  private:
   double gravity_constant_m3_s2_;  //!< Gravity constant [m3/s2]
-  double propagation_time_s_;      //!< Simulation current time for numerical integration by RK4 [sec]
-  double propagation_step_s_;      //!< Step width for RK4 [sec]
 
   /**
    * @fn Initialize
@@ -0,0 +1,321 @@
+/**
+ * @file sgp4_batch_propagation.cpp
+ * @brief Class to propagate many objects with SGP4 method with TLE at once
+ */
+
+#include "sgp4_batch_propagation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <library/math/constants.hpp>
+
+namespace {
+const size_t kTleBufferSize = 130;  //!< Buffer size of a TLE line for twoline2rv
+const size_t kTleLineLength = 69;   //!< Length of a TLE line
+
+/**
+ * @fn IsTleLine
+ * @brief Return true when the line is the line_number-th line of TLE
+ */
+bool IsTleLine(const std::string& line, const char line_number) { return line.size() >= kTleLineLength && line[0] == line_number && line[1] == ' '; }
+
+/**
+ * @fn RemoveCarriageReturn
+ * @brief Remove CR at the end of the line written in CRLF
+ */
+void RemoveCarriageReturn(std::string& line) {
+  if (!line.empty() && line.back() == '\r') line.pop_back();
+}
+}  // namespace
+
+Sgp4BatchPropagation::Sgp4BatchPropagation(const int wgs_setting, const size_t number_of_threads) : thread_pool_(number_of_threads) {
+  if (wgs_setting == 0) {
+    gravity_constant_setting_ = wgs72old;
+  } else if (wgs_setting == 1) {
+    gravity_constant_setting_ = wgs72;
+  } else {
+    gravity_constant_setting_ = wgs84;
+  }
+
+  double tumin, mu, j3, j4, j3oj2;
+  getgravconst(gravity_constant_setting_, tumin, mu, radius_earth_km_, xke_, j2_, j3, j4, j3oj2);
+  velocity_unit_km_s_ = radius_earth_km_ * xke_ / 60.0;
+}
+
+int Sgp4BatchPropagation::ReadTleFile(const std::string& file_name) {
+  std::ifstream ifs(file_name);
+  if (!ifs.is_open()) {
+    std::cerr << "file open error(" << file_name << ")" << std::endl;
+    return -1;
+  }
+
+  int number_of_read_tle = 0;
+  std::string name, line, previous_line;
+  while (std::getline(ifs, line)) {
+    RemoveCarriageReturn(line);
+    if (IsTleLine(line, '2') && IsTleLine(previous_line, '1')) {
+      if (AddTle(previous_line, line, name) >= 0) number_of_read_tle++;
+      name.clear();
+    } else if (!line.empty() && !IsTleLine(line, '1')) {
+      // Name line of the three line element set
+      name = line.substr(line.compare(0, 2, "0 ") == 0 ? 2 : 0);
+      name.erase(name.find_last_not_of(' ') + 1);
+    }
+    previous_line = line;
+  }
+  return number_of_read_tle;
+}
+
+int Sgp4BatchPropagation::AddTle(const std::string& tle1, const std::string& tle2, const std::string& name) {
+  if (!IsTleLine(tle1, '1') || !IsTleLine(tle2, '2')) return -1;
+
+  // twoline2rv modifies the lines, and reads the fixed columns
+  char tle1_buffer[kTleBufferSize], tle2_buffer[kTleBufferSize];
+  memset(tle1_buffer, ' ', kTleBufferSize - 1);
+  memset(tle2_buffer, ' ', kTleBufferSize - 1);
+  tle1_buffer[kTleBufferSize - 1] = '\0';
+  tle2_buffer[kTleBufferSize - 1] = '\0';
+  memcpy(tle1_buffer, tle1.c_str(), std::min(tle1.size(), kTleBufferSize - 1));
+  memcpy(tle2_buffer, tle2.c_str(), std::min(tle2.size(), kTleBufferSize - 1));
+
+  elsetrec sgp4_data;
+  memset(&sgp4_data, 0, sizeof(sgp4_data));
+  char type_run = 'c', type_input = 0;
+  double start_mfe, stop_mfe, delta_min;
+  twoline2rv(tle1_buffer, tle2_buffer, type_run, type_input, gravity_constant_setting_, start_mfe, stop_mfe, delta_min, sgp4_data);
+
+  const size_t object_index = names_.size();
+  if (sgp4_data.method == 'd') {
+    deep_space_records_.push_back(sgp4_data);
+    deep_space_object_index_.push_back(object_index);
+  } else {
+    NearEarthElements& e = near_earth_;
+    e.object_index.push_back(object_index);
+    e.isimp.push_back(sgp4_data.isimp);
+    e.jdsatepoch.push_back(sgp4_data.jdsatepoch);
+    e.mo.push_back(sgp4_data.mo);
+    e.mdot.push_back(sgp4_data.mdot);
+    e.argpo.push_back(sgp4_data.argpo);
+    e.argpdot.push_back(sgp4_data.argpdot);
+    e.nodeo.push_back(sgp4_data.nodeo);
+    e.nodedot.push_back(sgp4_data.nodedot);
+    e.nodecf.push_back(sgp4_data.nodecf);
+    e.cc1.push_back(sgp4_data.cc1);
+    e.cc4.push_back(sgp4_data.cc4);
+    e.cc5.push_back(sgp4_data.cc5);
+    e.bstar.push_back(sgp4_data.bstar);
+    e.t2cof.push_back(sgp4_data.t2cof);
+    e.t3cof.push_back(sgp4_data.t3cof);
+    e.t4cof.push_back(sgp4_data.t4cof);
+    e.t5cof.push_back(sgp4_data.t5cof);
+    e.omgcof.push_back(sgp4_data.omgcof);
+    e.xmcof.push_back(sgp4_data.xmcof);
+    e.eta.push_back(sgp4_data.eta);
+    e.delmo.push_back(sgp4_data.delmo);
+    e.d2.push_back(sgp4_data.d2);
+    e.d3.push_back(sgp4_data.d3);
+    e.d4.push_back(sgp4_data.d4);
+    e.sinmao.push_back(sgp4_data.sinmao);
+    e.no.push_back(sgp4_data.no);
+    e.ecco.push_back(sgp4_data.ecco);
+    e.inclo.push_back(sgp4_data.inclo);
+    e.aycof.push_back(sgp4_data.aycof);
+    e.xlcof.push_back(sgp4_data.xlcof);
+    e.con41.push_back(sgp4_data.con41);
+    e.x1mth2.push_back(sgp4_data.x1mth2);
+    e.x7thm1.push_back(sgp4_data.x7thm1);
+  }
+
+  names_.push_back(name);
+  satellite_numbers_.push_back(sgp4_data.satnum);
+  for (size_t i = 0; i < 3; i++) {
+    positions_i_m_[i].resize(names_.size(), 0.0);
+    velocities_i_m_s_[i].resize(names_.size(), 0.0);
+  }
+  error_codes_.push_back(sgp4_data.error);
+  return (int)object_index;
+}
+
+void Sgp4BatchPropagation::Propagate(const double current_time_jd) {
+  const size_t number_of_near_earth_objects = near_earth_.object_index.size();
+  const size_t number_of_chunks = (number_of_near_earth_objects + kChunkSize - 1) / kChunkSize;
+  const size_t number_of_deep_space_objects = deep_space_records_.size();
+
+  // Each task writes the different elements of the output arrays
+  thread_pool_.ParallelFor(number_of_chunks + number_of_deep_space_objects, [&](const size_t task_index) {
+    if (task_index < number_of_chunks) {
+      const size_t begin = task_index * kChunkSize;
+      PropagateNearEarth(begin, std::min(begin + kChunkSize, number_of_near_earth_objects), current_time_jd);
+    } else {
+      PropagateDeepSpace(task_index - number_of_chunks, current_time_jd);
+    }
+  });
+}
+
+libra::Vector<3> Sgp4BatchPropagation::GetPosition_i_m(const size_t index) const {
+  libra::Vector<3> position_i_m;
+  for (size_t i = 0; i < 3; i++) position_i_m[i] = positions_i_m_[i][index];
+  return position_i_m;
+}
+
+libra::Vector<3> Sgp4BatchPropagation::GetVelocity_i_m_s(const size_t index) const {
+  libra::Vector<3> velocity_i_m_s;
+  for (size_t i = 0; i < 3; i++) velocity_i_m_s[i] = velocities_i_m_s_[i][index];
+  return velocity_i_m_s;
+}
+
+void Sgp4BatchPropagation::PropagateNearEarth(const size_t begin, const size_t end, const double current_time_jd) {
+  const NearEarthElements& e = near_earth_;
+  const double x2o3 = 2.0 / 3.0;
+
+  // The same calculation as sgp4() without the deep space terms
+  for (size_t k = begin; k < end; k++) {
+    const double t = (current_time_jd - e.jdsatepoch[k]) * (24.0 * 60.0);
+    int error = 0;
+
+    // Update for secular gravity and atmospheric drag
+    const double xmdf = e.mo[k] + e.mdot[k] * t;
+    const double argpdf = e.argpo[k] + e.argpdot[k] * t;
+    const double nodedf = e.nodeo[k] + e.nodedot[k] * t;
+    double argpm = argpdf;
+    double mm = xmdf;
+    const double t2 = t * t;
+    double nodem = nodedf + e.nodecf[k] * t2;
+    double tempa = 1.0 - e.cc1[k] * t;
+    double tempe = e.bstar[k] * e.cc4[k] * t;
+    double templ = e.t2cof[k] * t2;
+    if (e.isimp[k] != 1) {
+      const double delomg = e.omgcof[k] * t;
+      const double delm = e.xmcof[k] * (pow((1.0 + e.eta[k] * cos(xmdf)), 3) - e.delmo[k]);
+      const double temp = delomg + delm;
+      mm = xmdf + temp;
+      argpm = argpdf - temp;
+      const double t3 = t2 * t;
+      const double t4 = t3 * t;
+      tempa = tempa - e.d2[k] * t2 - e.d3[k] * t3 - e.d4[k] * t4;
+      tempe = tempe + e.bstar[k] * e.cc5[k] * (sin(mm) - e.sinmao[k]);
+      templ = templ + e.t3cof[k] * t3 + t4 * (e.t4cof[k] + t * e.t5cof[k]);
+    }
+
+    double nm = e.no[k];
+    double em = e.ecco[k];
+    if (nm <= 0.0) error = 2;
+    const double am = pow((xke_ / nm), x2o3) * tempa * tempa;
+    nm = xke_ / pow(am, 1.5);
+    em = em - tempe;
+    if ((em >= 1.0) || (em < -0.001) || (am < 0.95)) error = 1;
+    if (em < 0.0) em = 1.0e-6;
+    mm = mm + e.no[k] * templ;
+    double xlm = mm + argpm + nodem;
+
+    nodem = fmod(nodem, libra::tau);
+    argpm = fmod(argpm, libra::tau);
+    xlm = fmod(xlm, libra::tau);
+    mm = fmod(xlm - argpm - nodem, libra::tau);
+
+    // Long period periodics
+    const double sinip = sin(e.inclo[k]);
+    const double cosip = cos(e.inclo[k]);
+    const double axnl = em * cos(argpm);
+    double temp = 1.0 / (am * (1.0 - em * em));
+    const double aynl = em * sin(argpm) + temp * e.aycof[k];
+    const double xl = mm + argpm + nodem + temp * e.xlcof[k] * axnl;
+
+    // Solve Kepler's equation
+    const double u = fmod(xl - nodem, libra::tau);
+    double eo1 = u;
+    double tem5 = 9999.9;
+    double sineo1 = sin(eo1);
+    double coseo1 = cos(eo1);
+    for (int ktr = 1; fabs(tem5) >= 1.0e-12 && ktr <= 10; ktr++) {
+      sineo1 = sin(eo1);
+      coseo1 = cos(eo1);
+      tem5 = 1.0 - coseo1 * axnl - sineo1 * aynl;
+      tem5 = (u - aynl * coseo1 + axnl * sineo1 - eo1) / tem5;
+      if (fabs(tem5) >= 0.95) tem5 = tem5 > 0.0 ? 0.95 : -0.95;
+      eo1 = eo1 + tem5;
+    }
+
+    // Short period preliminary quantities
+    const double ecose = axnl * coseo1 + aynl * sineo1;
+    const double esine = axnl * sineo1 - aynl * coseo1;
+    const double el2 = axnl * axnl + aynl * aynl;
+    const double pl = am * (1.0 - el2);
+    double mrt = 0.0;
+    const size_t object_index = e.object_index[k];
+    if (pl < 0.0) {
+      error = 4;
+    } else {
+      const double rl = am * (1.0 - ecose);
+      const double rdotl = sqrt(am) * esine / rl;
+      const double rvdotl = sqrt(pl) / rl;
+      const double betal = sqrt(1.0 - el2);
+      temp = esine / (1.0 + betal);
+      const double sinu = am / rl * (sineo1 - aynl - axnl * temp);
+      const double cosu = am / rl * (coseo1 - axnl + aynl * temp);
+      double su = atan2(sinu, cosu);
+      const double sin2u = (cosu + cosu) * sinu;
+      const double cos2u = 1.0 - 2.0 * sinu * sinu;
+      temp = 1.0 / pl;
+      const double temp1 = 0.5 * j2_ * temp;
+      const double temp2 = temp1 * temp;
+
+      // Update for short period periodics
+      mrt = rl * (1.0 - 1.5 * temp2 * betal * e.con41[k]) + 0.5 * temp1 * e.x1mth2[k] * cos2u;
+      su = su - 0.25 * temp2 * e.x7thm1[k] * sin2u;
+      const double xnode = nodem + 1.5 * temp2 * cosip * sin2u;
+      const double xinc = e.inclo[k] + 1.5 * temp2 * cosip * sinip * cos2u;
+      const double mvt = rdotl - nm * temp1 * e.x1mth2[k] * sin2u / xke_;
+      const double rvdot = rvdotl + nm * temp1 * (e.x1mth2[k] * cos2u + 1.5 * e.con41[k]) / xke_;
+
+      // Orientation vectors
+      const double sinsu = sin(su);
+      const double cossu = cos(su);
+      const double snod = sin(xnode);
+      const double cnod = cos(xnode);
+      const double sini = sin(xinc);
+      const double cosi = cos(xinc);
+      const double xmx = -snod * cosi;
+      const double xmy = cnod * cosi;
+      const double ux = xmx * sinsu + cnod * cossu;
+      const double uy = xmy * sinsu + snod * cossu;
+      const double uz = sini * sinsu;
+      const double vx = xmx * cossu - cnod * sinsu;
+      const double vy = xmy * cossu - snod * sinsu;
+      const double vz = sini * cossu;
+
+      positions_i_m_[0][object_index] = (mrt * ux) * radius_earth_km_ * 1000.0;
+      positions_i_m_[1][object_index] = (mrt * uy) * radius_earth_km_ * 1000.0;
+      positions_i_m_[2][object_index] = (mrt * uz) * radius_earth_km_ * 1000.0;
+      velocities_i_m_s_[0][object_index] = (mvt * ux + rvdot * vx) * velocity_unit_km_s_ * 1000.0;
+      velocities_i_m_s_[1][object_index] = (mvt * uy + rvdot * vy) * velocity_unit_km_s_ * 1000.0;
+      velocities_i_m_s_[2][object_index] = (mvt * uz + rvdot * vz) * velocity_unit_km_s_ * 1000.0;
+    }
+
+    // Decayed object
+    if (mrt < 1.0) error = 6;
+    error_codes_[object_index] = error;
+  }
+}
+
+void Sgp4BatchPropagation::PropagateDeepSpace(const size_t deep_space_index, const double current_time_jd) {
+  elsetrec& sgp4_data = deep_space_records_[deep_space_index];
+  const size_t object_index = deep_space_object_index_[deep_space_index];
+  const double elapse_time_min = (current_time_jd - sgp4_data.jdsatepoch) * (24.0 * 60.0);
+
+  // sgp4() does not update the position and the velocity when the orbit is not valid
+  double position_i_km[3];
+  double velocity_i_km_s[3];
+  for (size_t i = 0; i < 3; i++) {
+    position_i_km[i] = positions_i_m_[i][object_index] / 1000.0;
+    velocity_i_km_s[i] = velocities_i_m_s_[i][object_index] / 1000.0;
+  }
+  error_codes_[object_index] = sgp4(gravity_constant_setting_, sgp4_data, elapse_time_min, position_i_km, velocity_i_km_s);
+  for (size_t i = 0; i < 3; i++) {
+    positions_i_m_[i][object_index] = position_i_km[i] * 1000.0;
+    velocities_i_m_s_[i][object_index] = velocity_i_km_s[i] * 1000.0;
+  }
+}
@@ -0,0 +1,156 @@
+/**
+ * @file sgp4_batch_propagation.hpp
+ * @brief Class to propagate many objects with SGP4 method with TLE at once
+ */
+
+#ifndef S2E_DYNAMICS_ORBIT_SGP4_BATCH_PROPAGATION_HPP_
+#define S2E_DYNAMICS_ORBIT_SGP4_BATCH_PROPAGATION_HPP_
+
+#include <library/external/sgp4/sgp4io.h>
+#include <library/external/sgp4/sgp4unit.h>
+
+#include <library/math/vector.hpp>
+#include <library/utilities/thread_pool.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @class Sgp4BatchPropagation
+ * @brief Class to propagate many objects with SGP4 method with TLE at once
+ * @details The near earth objects (orbital period < 225 min) are stored in the structure-of-arrays layout and propagated with a loop
+ *          over the arrays, which is split into chunks for the threads. The calculation is the same as sgp4() in sgp4unit.cpp.
+ *          The deep space objects are propagated with sgp4() for each object since their resonance integration has internal states.
+ *          The positions and the velocities of all objects are stored in the contiguous x, y, and z arrays in the order of the registration.
+ */
+class Sgp4BatchPropagation {
+ public:
+  /**
+   * @fn Sgp4BatchPropagation
+   * @brief Constructor
+   * @param [in] wgs_setting: Wold Geodetic System (0: WGS72 old, 1: WGS72, 2: WGS84)
+   * @param [in] number_of_threads: Number of threads for the propagation. 0 means the number of hardware threads.
+   */
+  Sgp4BatchPropagation(const int wgs_setting, const size_t number_of_threads = 1);
+
+  /**
+   * @fn ReadTleFile
+   * @brief Read all TLEs in the file. The file can contain the name line before each TLE (three line element set).
+   * @param [in] file_name: Path to the TLE file
+   * @return Number of read TLEs, or -1 when the file is not opened
+   */
+  int ReadTleFile(const std::string& file_name);
+  /**
+   * @fn AddTle
+   * @brief Add an object with TLE
+   * @param [in] tle1: The first line of TLE
+   * @param [in] tle2: The second line of TLE
+   * @param [in] name: Name of the object
+   * @return Index of the added object, or -1 when the TLE is not valid
+   */
+  int AddTle(const std::string& tle1, const std::string& tle2, const std::string& name = "");
+
+  /**
+   * @fn Propagate
+   * @brief Calculate the positions and the velocities of all objects
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  void Propagate(const double current_time_jd);
+
+  // Getters
+  /**
+   * @fn GetNumberOfObjects
+   * @brief Return number of objects
+   */
+  inline size_t GetNumberOfObjects() const { return names_.size(); }
+  /**
+   * @fn GetPositions_i_m
+   * @brief Return one axis of the positions of all objects in the inertial (TEME) frame [m] in the order of the objects
+   * @param [in] axis: Axis of the position (0: x, 1: y, 2: z)
+   */
+  inline const std::vector<double>& GetPositions_i_m(const size_t axis) const { return positions_i_m_[axis]; }
+  /**
+   * @fn GetVelocities_i_m_s
+   * @brief Return one axis of the velocities of all objects in the inertial (TEME) frame [m/s] in the order of the objects
+   * @param [in] axis: Axis of the velocity (0: x, 1: y, 2: z)
+   */
+  inline const std::vector<double>& GetVelocities_i_m_s(const size_t axis) const { return velocities_i_m_s_[axis]; }
+  /**
+   * @fn GetPosition_i_m
+   * @brief Return position of the object in the inertial (TEME) frame [m]
+   * @param [in] index: Index of the object
+   */
+  libra::Vector<3> GetPosition_i_m(const size_t index) const;
+  /**
+   * @fn GetVelocity_i_m_s
+   * @brief Return velocity of the object in the inertial (TEME) frame [m/s]
+   * @param [in] index: Index of the object
+   */
+  libra::Vector<3> GetVelocity_i_m_s(const size_t index) const;
+  /**
+   * @fn GetErrorCode
+   * @brief Return error code of sgp4() at the last propagation (0: no error)
+   * @param [in] index: Index of the object
+   */
+  inline int GetErrorCode(const size_t index) const { return error_codes_[index]; }
+  /**
+   * @fn GetName
+   * @brief Return name of the object
+   * @param [in] index: Index of the object
+   */
+  inline const std::string& GetName(const size_t index) const { return names_[index]; }
+  /**
+   * @fn GetSatelliteNumber
+   * @brief Return satellite catalog number of the object
+   * @param [in] index: Index of the object
+   */
+  inline long GetSatelliteNumber(const size_t index) const { return satellite_numbers_[index]; }
+
+ private:
+  static const size_t kChunkSize = 256;  //!< Number of objects in a chunk assigned to a thread
+
+  gravconsttype gravity_constant_setting_;  //!< Gravity constant value type
+  double xke_;                              //!< sqrt(GM) in earth radii^1.5 / min
+  double j2_;                               //!< J2 coefficient
+  double radius_earth_km_;                  //!< Earth radius [km]
+  double velocity_unit_km_s_;               //!< Velocity unit (earth radii / min) in [km/s]
+
+  /**
+   * @struct NearEarthElements
+   * @brief Elements and coefficients of the near earth objects in the structure-of-arrays layout
+   * @note The names are the same as elsetrec
+   */
+  struct NearEarthElements {
+    std::vector<size_t> object_index;  //!< Index of the object
+    std::vector<int> isimp;
+    std::vector<double> jdsatepoch, mo, mdot, argpo, argpdot, nodeo, nodedot, nodecf, cc1, cc4, cc5, bstar, t2cof, t3cof, t4cof, t5cof, omgcof,
+        xmcof, eta, delmo, d2, d3, d4, sinmao, no, ecco, inclo, aycof, xlcof, con41, x1mth2, x7thm1;
+  } near_earth_;                                 //!< Near earth objects
+  std::vector<elsetrec> deep_space_records_;     //!< Structure data of the deep space objects for SGP4 library
+  std::vector<size_t> deep_space_object_index_;  //!< Index of the deep space objects
+
+  std::vector<std::string> names_;           //!< Names of the objects
+  std::vector<long> satellite_numbers_;      //!< Satellite catalog numbers of the objects
+  std::vector<double> positions_i_m_[3];     //!< x, y, and z arrays of the positions of the objects [m]
+  std::vector<double> velocities_i_m_s_[3];  //!< x, y, and z arrays of the velocities of the objects [m/s]
+  std::vector<int> error_codes_;             //!< Error codes of the objects
+
+  ThreadPool thread_pool_;  //!< Thread pool for the propagation
+
+  /**
+   * @fn PropagateNearEarth
+   * @brief Propagate the near earth objects in the range
+   * @param [in] begin: First index in the near earth objects
+   * @param [in] end: Last index + 1 in the near earth objects
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  void PropagateNearEarth(const size_t begin, const size_t end, const double current_time_jd);
+  /**
+   * @fn PropagateDeepSpace
+   * @brief Propagate the deep space object with sgp4()
+   * @param [in] deep_space_index: Index in the deep space objects
+   * @param [in] current_time_jd: Current Julian day [day]
+   */
+  void PropagateDeepSpace(const size_t deep_space_index, const double current_time_jd);
+};
+
+#endif  // S2E_DYNAMICS_ORBIT_SGP4_BATCH_PROPAGATION_HPP_
@@ -0,0 +1,132 @@
+/**
+ * @file test_sgp4_batch_propagation.cpp
+ * @brief Test codes for Sgp4BatchPropagation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "sgp4_batch_propagation.hpp"
+
+namespace {
+// Near earth, near earth with the simplified drag, deep space (12 hour resonance), and deep space (geostationary) objects
+const char* kTles[][2] = {
+    {"1 25544U 98067A   20076.51604214  .00016717  00000-0  10270-3 0  9005",
+     "2 25544  51.6412  86.9962 0006063  30.9353 329.2153 15.49228202 17647"},
+    {"1 00005U 58002B   00179.78495062  .00000023  00000-0  28098-4 0  4753",
+     "2 00005  34.2682 348.7242 1859667 331.7664  19.3264 10.82419157413667"},
+    {"1 28350U 04020A   06167.21788666  .16154492  76267-5  18678-3 0  8894",
+     "2 28350  64.9977 345.6130 0024870 260.7578  99.9590 16.47856722116490"},
+    {"1 08195U 75081A   06176.33215444  .00000099  00000-0  11873-3 0   813",
+     "2 08195  64.1586 279.0717 6877146 264.7651  20.2257  2.00491383225656"},
+    {"1 28626U 05008A   06176.46683397 -.00000205  00000-0  10000-3 0  2190",
+     "2 28626   0.0019 286.9433 0000335  13.7918  55.6504  1.00270176  4891"},
+};
+const size_t kNumberOfTles = sizeof(kTles) / sizeof(kTles[0]);
+
+/**
+ * @fn InitializeScalarSgp4
+ * @brief Initialize the structure data for the scalar sgp4()
+ */
+elsetrec InitializeScalarSgp4(const char* tle1, const char* tle2) {
+  char tle1_buffer[130] = {}, tle2_buffer[130] = {};
+  strncpy(tle1_buffer, tle1, 129);
+  strncpy(tle2_buffer, tle2, 129);
+  elsetrec sgp4_data;
+  double start_mfe, stop_mfe, delta_min;
+  twoline2rv(tle1_buffer, tle2_buffer, 'c', 0, wgs72, start_mfe, stop_mfe, delta_min, sgp4_data);
+  return sgp4_data;
+}
+
+/**
+ * @fn GetEpochJd
+ * @brief Return epoch of the TLE [Julian day]
+ */
+double GetEpochJd(const char* tle1, const char* tle2) { return InitializeScalarSgp4(tle1, tle2).jdsatepoch; }
+
+/**
+ * @fn CalcScalarSgp4
+ * @brief Calculate the position and the velocity with the scalar sgp4() like Sgp4OrbitPropagation
+ */
+int CalcScalarSgp4(const char* tle1, const char* tle2, const double current_time_jd, double position_i_m[3], double velocity_i_m_s[3]) {
+  elsetrec sgp4_data = InitializeScalarSgp4(tle1, tle2);
+  double position_i_km[3], velocity_i_km_s[3];
+  const int error = sgp4(wgs72, sgp4_data, (current_time_jd - sgp4_data.jdsatepoch) * (24.0 * 60.0), position_i_km, velocity_i_km_s);
+  for (size_t i = 0; i < 3; i++) {
+    position_i_m[i] = position_i_km[i] * 1000.0;
+    velocity_i_m_s[i] = velocity_i_km_s[i] * 1000.0;
+  }
+  return error;
+}
+}  // namespace
+
+/**
+ * @brief Test that the batch propagation gives the same results as the scalar sgp4()
+ */
+TEST(Sgp4BatchPropagation, CompareWithScalarSgp4) {
+  const size_t number_of_threads[2] = {1, 4};
+  for (size_t n = 0; n < 2; n++) {
+    Sgp4BatchPropagation batch_propagation(1, number_of_threads[n]);
+    // Repeat the objects so that the near earth objects are split into multiple chunks
+    for (size_t repeat = 0; repeat < 200; repeat++) {
+      for (size_t i = 0; i < kNumberOfTles; i++) EXPECT_GE(batch_propagation.AddTle(kTles[i][0], kTles[i][1]), 0);
+    }
+    ASSERT_EQ(200 * kNumberOfTles, batch_propagation.GetNumberOfObjects());
+    EXPECT_EQ(25544, batch_propagation.GetSatelliteNumber(0));
+
+    // The deep space objects are integrated from their epochs, so the time is set near their epochs
+    const double reference_epoch_jd = GetEpochJd(kTles[3][0], kTles[3][1]);
+    const double elapsed_times_day[5] = {0.0, 0.37, -1.5, 3.2, -8.9};
+    for (size_t t = 0; t < 5; t++) {
+      const double current_time_jd = reference_epoch_jd + elapsed_times_day[t];
+      batch_propagation.Propagate(current_time_jd);
+
+      for (size_t i = 0; i < kNumberOfTles; i++) {
+        double position_i_m[3], velocity_i_m_s[3];
+        const int error = CalcScalarSgp4(kTles[i][0], kTles[i][1], current_time_jd, position_i_m, velocity_i_m_s);
+        for (size_t repeat = 0; repeat < 200; repeat += 37) {
+          const size_t index = repeat * kNumberOfTles + i;
+          EXPECT_EQ(error, batch_propagation.GetErrorCode(index));
+          if (error != 0) continue;
+          const libra::Vector<3> position = batch_propagation.GetPosition_i_m(index);
+          const libra::Vector<3> velocity = batch_propagation.GetVelocity_i_m_s(index);
+          for (size_t k = 0; k < 3; k++) {
+            EXPECT_NEAR(position_i_m[k], position[k], 1.0e-6);
+            EXPECT_NEAR(velocity_i_m_s[k], velocity[k], 1.0e-9);
+            EXPECT_EQ(position[k], batch_propagation.GetPositions_i_m(k)[index]);
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test reading of the TLE file with and without the name lines
+ */
+TEST(Sgp4BatchPropagation, ReadTleFile) {
+  const std::string file_name = "test_sgp4_batch_propagation.tle";
+  {
+    std::ofstream ofs(file_name);
+    ofs << "ISS (ZARYA)\r\n" << kTles[0][0] << "\r\n" << kTles[0][1] << "\r\n";
+    ofs << kTles[1][0] << "\n" << kTles[1][1] << "\n";
+    ofs << "0 MOLNIYA 2-9\n" << kTles[3][0] << "\n" << kTles[3][1] << "\n";
+    ofs << "\n";
+  }
+
+  Sgp4BatchPropagation batch_propagation(2);
+  EXPECT_EQ(3, batch_propagation.ReadTleFile(file_name));
+  ASSERT_EQ(3u, batch_propagation.GetNumberOfObjects());
+  EXPECT_EQ("ISS (ZARYA)", batch_propagation.GetName(0));
+  EXPECT_EQ("", batch_propagation.GetName(1));
+  EXPECT_EQ("MOLNIYA 2-9", batch_propagation.GetName(2));
+  EXPECT_EQ(8195, batch_propagation.GetSatelliteNumber(2));
+  std::remove(file_name.c_str());
+
+  EXPECT_EQ(-1, batch_propagation.ReadTleFile("not_existing_file.tle"));
+  EXPECT_EQ(-1, batch_propagation.AddTle("1 25544U", "2 25544"));
+}
@@ -0,0 +1,144 @@
+/**
+ * @file benchmark_thermal_network.cpp
+ * @brief Benchmark codes for the propagation of ThermalNetwork class with Google Benchmark
+ */
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <environment/global/physical_constants.hpp>
+#include <random>
+#include <vector>
+
+#include "thermal_network.hpp"
+
+namespace {
+
+const size_t kCouplingsPerNode = 6;
+const double kRk4Step_s = 0.1;
+const double kSimulationTime_s = 10.0;
+
+/**
+ * @struct NetworkData
+ * @brief Sparse random network stored as the dense matrices
+ */
+struct NetworkData {
+  std::vector<std::vector<double>> conductance_matrix_W_K;
+  std::vector<std::vector<double>> radiation_matrix_m2;
+  std::vector<double> capacities_J_K;
+  std::vector<bool> is_diffusive;
+  std::vector<double> temperatures_K;
+  std::vector<double> heatloads_W;
+};
+
+/**
+ * @fn MakeNetworkData
+ * @brief Return the random network with the number of nodes
+ */
+NetworkData MakeNetworkData(const size_t number_of_nodes) {
+  NetworkData data;
+  std::mt19937 engine(1);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  std::uniform_int_distribution<size_t> node(0, number_of_nodes - 1);
+
+  data.conductance_matrix_W_K.assign(number_of_nodes, std::vector<double>(number_of_nodes, 0.0));
+  data.radiation_matrix_m2.assign(number_of_nodes, std::vector<double>(number_of_nodes, 0.0));
+  for (size_t i = 0; i < number_of_nodes; i++) {
+    for (size_t k = 0; k < kCouplingsPerNode / 2; k++) {
+      const size_t j = node(engine);
+      if (i == j) continue;
+      const double conductance_W_K = uniform(engine);
+      const double radiation_m2 = 0.01 * uniform(engine);
+      data.conductance_matrix_W_K[i][j] = data.conductance_matrix_W_K[j][i] = conductance_W_K;
+      data.radiation_matrix_m2[i][j] = data.radiation_matrix_m2[j][i] = radiation_m2;
+    }
+    data.capacities_J_K.push_back(100.0 + 1000.0 * uniform(engine));
+    data.is_diffusive.push_back(i != 0);
+    data.temperatures_K.push_back(250.0 + 100.0 * uniform(engine));
+    data.heatloads_W.push_back(uniform(engine));
+  }
+  data.temperatures_K[0] = 3.0;
+  return data;
+}
+
+/**
+ * @fn CalcDenseDifferentials
+ * @brief Calculate the differentials with the dense loops of the previous implementation of Temperature class
+ */
+void CalcDenseDifferentials(const NetworkData& data, const std::vector<double>& temperatures_K, std::vector<double>& differentials_K_s) {
+  const size_t number_of_nodes = data.capacities_J_K.size();
+  for (size_t i = 0; i < number_of_nodes; i++) {
+    if (!data.is_diffusive[i]) {
+      differentials_K_s[i] = 0.0;
+      continue;
+    }
+    double heat_input_W = data.heatloads_W[i];
+    for (size_t j = 0; j < number_of_nodes; j++) {
+      heat_input_W += data.conductance_matrix_W_K[i][j] * (temperatures_K[j] - temperatures_K[i]);
+      heat_input_W += environment::stefan_boltzmann_constant_W_m2K4 * data.radiation_matrix_m2[i][j] *
+                      (pow(temperatures_K[j], 4) - pow(temperatures_K[i], 4));
+    }
+    differentials_K_s[i] = heat_input_W / data.capacities_J_K[i];
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmark of the RK4 propagation with the dense loops and the vectors allocated for each step
+ * @note Argument: number of nodes
+ */
+static void BM_ThermalDenseRk4(benchmark::State& state) {
+  const NetworkData data = MakeNetworkData((size_t)state.range(0));
+  const size_t number_of_nodes = data.capacities_J_K.size();
+  for (auto _ : state) {
+    std::vector<double> temperatures_K = data.temperatures_K;
+    for (double t_s = 0.0; t_s < kSimulationTime_s; t_s += kRk4Step_s) {
+      std::vector<double> k1(number_of_nodes), k2(number_of_nodes), k3(number_of_nodes), k4(number_of_nodes), x(number_of_nodes);
+      CalcDenseDifferentials(data, temperatures_K, k1);
+      for (size_t i = 0; i < number_of_nodes; i++) x[i] = temperatures_K[i] + kRk4Step_s / 2.0 * k1[i];
+      CalcDenseDifferentials(data, x, k2);
+      for (size_t i = 0; i < number_of_nodes; i++) x[i] = temperatures_K[i] + kRk4Step_s / 2.0 * k2[i];
+      CalcDenseDifferentials(data, x, k3);
+      for (size_t i = 0; i < number_of_nodes; i++) x[i] = temperatures_K[i] + kRk4Step_s * k3[i];
+      CalcDenseDifferentials(data, x, k4);
+      for (size_t i = 0; i < number_of_nodes; i++) temperatures_K[i] += kRk4Step_s / 6.0 * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+    }
+    benchmark::DoNotOptimize(temperatures_K.data());
+  }
+}
+BENCHMARK(BM_ThermalDenseRk4)->Arg(30)->Arg(300)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Benchmark of the RK4 propagation with the sparse network
+ * @note Argument: number of nodes
+ */
+static void BM_ThermalNetworkRk4(benchmark::State& state) {
+  const NetworkData data = MakeNetworkData((size_t)state.range(0));
+  ThermalNetwork network(data.conductance_matrix_W_K, data.radiation_matrix_m2, data.capacities_J_K, data.is_diffusive);
+  for (auto _ : state) {
+    std::vector<double> temperatures_K = data.temperatures_K;
+    for (double t_s = 0.0; t_s < kSimulationTime_s; t_s += kRk4Step_s) {
+      network.PropagateRk4(kRk4Step_s, data.heatloads_W, data.heatloads_W, data.heatloads_W, temperatures_K);
+    }
+    benchmark::DoNotOptimize(temperatures_K.data());
+  }
+}
+BENCHMARK(BM_ThermalNetworkRk4)->Arg(30)->Arg(300)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Benchmark of the backward Euler propagation with the sparse network
+ * @note Arguments: number of nodes, ratio of the time step to the RK4 step
+ */
+static void BM_ThermalNetworkBackwardEuler(benchmark::State& state) {
+  const NetworkData data = MakeNetworkData((size_t)state.range(0));
+  const double step_s = kRk4Step_s * (double)state.range(1);
+  ThermalNetwork network(data.conductance_matrix_W_K, data.radiation_matrix_m2, data.capacities_J_K, data.is_diffusive);
+  for (auto _ : state) {
+    std::vector<double> temperatures_K = data.temperatures_K;
+    for (double t_s = 0.0; t_s < kSimulationTime_s; t_s += step_s) {
+      network.PropagateBackwardEuler(step_s, data.heatloads_W, temperatures_K);
+    }
+    benchmark::DoNotOptimize(temperatures_K.data());
+  }
+}
+BENCHMARK(BM_ThermalNetworkBackwardEuler)->ArgsProduct({{30, 300}, {1, 100}})->Unit(benchmark::kMillisecond);
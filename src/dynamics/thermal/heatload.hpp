@@ -77,6 +77,11 @@ class Heatload {
    * @brief Return Total Heatload
    */
   inline double GetTotalHeatload_W(void) const { return total_heatload_W_; }
+  /**
+   * @fn GetElapsedTime_s
+   * @brief Return Elapsed Time [s]
+   */
+  inline double GetElapsedTime_s(void) const { return elapsed_time_s_; }
 
   // Setter
   /**
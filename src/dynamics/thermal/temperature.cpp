@@ -5,17 +5,15 @@
 
 #include "temperature.hpp"
 
-#include <cmath>
-#include <environment/global/physical_constants.hpp>
 #include <iostream>
-#include <library/utilities/macros.hpp>
 #include <vector>
 
 using namespace std;
 
 Temperature::Temperature(const vector<vector<double>> conductance_matrix_W_K, const vector<vector<double>> radiation_matrix_m2, vector<Node> nodes,
                          vector<Heatload> heatloads, vector<Heater> heaters, vector<HeaterController> heater_controllers, const int node_num,
-                         const double propagation_step_s, const bool is_calc_enabled, const SolarCalcSetting solar_calc_setting, const bool debug)
+                         const double propagation_step_s, const bool is_calc_enabled, const SolarCalcSetting solar_calc_setting, const bool debug,
+                         const ThermalIntegrationMethod integration_method)
     : conductance_matrix_W_K_(conductance_matrix_W_K),
       radiation_matrix_m2_(radiation_matrix_m2),
       nodes_(nodes),
@@ -26,8 +24,22 @@ Temperature::Temperature(const vector<vector<double>> conductance_matrix_W_K, co
       propagation_step_s_(propagation_step_s),  // ルンゲクッタ積分時間刻み幅
       is_calc_enabled_(is_calc_enabled),
       solar_calc_setting_(solar_calc_setting),
-      debug_(debug) {
+      debug_(debug),
+      integration_method_(integration_method) {
   propagation_time_s_ = 0;
+
+  // Sparse network and buffers for the propagation
+  vector<double> capacities_J_K(node_num_);
+  vector<bool> is_diffusive(node_num_);
+  for (int i = 0; i < node_num_; i++) {
+    capacities_J_K[i] = nodes_[i].GetCapacity_J_K();
+    is_diffusive[i] = nodes_[i].GetNodeType() == NodeType::kDiffusive;
+  }
+  network_ = ThermalNetwork(conductance_matrix_W_K_, radiation_matrix_m2_, capacities_J_K, is_diffusive);
+  temperatures_K_.assign(node_num_, 0.0);
+  heatloads_begin_W_.assign(node_num_, 0.0);
+  heatloads_middle_W_.assign(node_num_, 0.0);
+  heatloads_end_W_.assign(node_num_, 0.0);
   if (debug_) {
     PrintParams();
   }
@@ -40,6 +52,7 @@ Temperature::Temperature() {
   solar_calc_setting_ = SolarCalcSetting::kDisable;
   is_calc_enabled_ = false;
   debug_ = false;
+  integration_method_ = ThermalIntegrationMethod::kRk4;
 }
 
 Temperature::~Temperature() {}
@@ -47,10 +60,18 @@ Temperature::~Temperature() {}
 void Temperature::Propagate(libra::Vector<3> sun_direction_b, const double time_end_s) {
   if (!is_calc_enabled_) return;
   while (time_end_s - propagation_time_s_ - propagation_step_s_ > 1.0e-6) {
-    CalcRungeOneStep(propagation_time_s_, propagation_step_s_, sun_direction_b, node_num_);
+    if (integration_method_ == ThermalIntegrationMethod::kBackwardEuler) {
+      CalcBackwardEulerOneStep(propagation_time_s_, propagation_step_s_, sun_direction_b);
+    } else {
+      CalcRungeOneStep(propagation_time_s_, propagation_step_s_, sun_direction_b, node_num_);
+    }
     propagation_time_s_ += propagation_step_s_;
   }
-  CalcRungeOneStep(propagation_time_s_, time_end_s - propagation_time_s_, sun_direction_b, node_num_);
+  if (integration_method_ == ThermalIntegrationMethod::kBackwardEuler) {
+    CalcBackwardEulerOneStep(propagation_time_s_, time_end_s - propagation_time_s_, sun_direction_b);
+  } else {
+    CalcRungeOneStep(propagation_time_s_, time_end_s - propagation_time_s_, sun_direction_b, node_num_);
+  }
   propagation_time_s_ = time_end_s;
   UpdateHeaterStatus();
 
@@ -78,73 +99,68 @@ void Temperature::Propagate(libra::Vector<3> sun_direction_b, const double time_
 }
 
 void Temperature::CalcRungeOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, int node_num) {
-  vector<double> temperatures_now_K(node_num);
   for (int i = 0; i < node_num; i++) {
-    temperatures_now_K[i] = nodes_[i].GetTemperature_K();
+    temperatures_K_[i] = nodes_[i].GetTemperature_K();
   }
 
-  vector<double> k1(node_num), k2(node_num), k3(node_num), k4(node_num);
-  vector<double> xk2(node_num), xk3(node_num), xk4(node_num);
-
-  k1 = CalcTemperatureDifferentials(temperatures_now_K, time_now_s, sun_direction_b, node_num);
-  for (int i = 0; i < node_num; i++) {
-    xk2[i] = temperatures_now_K[i] + (time_step_s / 2.0) * k1[i];
-  }
+  // The heatloads are evaluated at the beginning, the middle, and the end of the step, and shared by the stages
+  CalcHeatloads(time_now_s, sun_direction_b, heatloads_begin_W_);
+  CalcHeatloads(time_now_s + time_step_s / 2.0, sun_direction_b, heatloads_middle_W_);
+  CalcHeatloads(time_now_s + time_step_s, sun_direction_b, heatloads_end_W_);
+  network_.PropagateRk4(time_step_s, heatloads_begin_W_, heatloads_middle_W_, heatloads_end_W_, temperatures_K_);
 
-  k2 = CalcTemperatureDifferentials(xk2, (time_now_s + time_step_s / 2.0), sun_direction_b, node_num);
   for (int i = 0; i < node_num; i++) {
-    xk3[i] = temperatures_now_K[i] + (time_step_s / 2.0) * k2[i];
+    nodes_[i].SetTemperature_K(temperatures_K_[i]);
   }
+}
 
-  k3 = CalcTemperatureDifferentials(xk3, (time_now_s + time_step_s / 2.0), sun_direction_b, node_num);
-  for (int i = 0; i < node_num; i++) {
-    xk4[i] = temperatures_now_K[i] + time_step_s * k3[i];
+void Temperature::CalcBackwardEulerOneStep(double time_now_s, double time_step_s, const libra::Vector<3> sun_direction_b) {
+  static const int kMaxDivisionDepth = 8;
+  for (int i = 0; i < node_num_; i++) {
+    temperatures_K_[i] = nodes_[i].GetTemperature_K();
   }
 
-  k4 = CalcTemperatureDifferentials(xk4, (time_now_s + time_step_s), sun_direction_b, node_num);
-
-  vector<double> temperatures_next_K(node_num);
-  for (int i = 0; i < node_num; i++) {
-    temperatures_next_K[i] = temperatures_now_K[i] + (time_step_s / 6.0) * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]);
+  // Divide the step when the Newton iteration does not converge
+  const int number_of_substeps_max = 1 << kMaxDivisionDepth;
+  int number_of_substeps = 1;
+  int substep_id = 0;
+  while (substep_id < number_of_substeps) {
+    const double substep_s = time_step_s / number_of_substeps;
+    CalcHeatloads(time_now_s + substep_s * (substep_id + 1), sun_direction_b, heatloads_end_W_);
+    if (network_.PropagateBackwardEuler(substep_s, heatloads_end_W_, temperatures_K_)) {
+      substep_id++;
+    } else if (number_of_substeps >= number_of_substeps_max) {
+      std::cerr << "WARNING: thermal backward Euler step does not converge. RK4 is used for the step." << std::endl;
+      network_.PropagateRk4(substep_s, heatloads_end_W_, heatloads_end_W_, heatloads_end_W_, temperatures_K_);
+      substep_id++;
+    } else {
+      number_of_substeps *= 2;
+      substep_id *= 2;
+    }
   }
 
-  for (int i = 0; i < node_num; i++) {
-    nodes_[i].SetTemperature_K(temperatures_next_K[i]);
+  for (int i = 0; i < node_num_; i++) {
+    nodes_[i].SetTemperature_K(temperatures_K_[i]);
   }
 }
 
-vector<double> Temperature::CalcTemperatureDifferentials(vector<double> temperatures_K, double t, libra::Vector<3> sun_direction, int node_num) {
-  // TODO: consider the following unused arguments are really needed
-  UNUSED(temperatures_K);
-
-  vector<double> differentials_K_s(node_num);
-  for (int i = 0; i < node_num; i++) {
-    heatloads_[i].SetElapsedTime_s(t);
+void Temperature::CalcHeatloads(double time_s, const libra::Vector<3> sun_direction_b, vector<double>& heatloads_W) {
+  for (int i = 0; i < node_num_; i++) {
+    heatloads_[i].SetElapsedTime_s(time_s);
     if (nodes_[i].GetNodeType() == NodeType::kDiffusive) {
       if (solar_calc_setting_ == SolarCalcSetting::kEnable) {
-        double solar_radiation_W = nodes_[i].CalcSolarRadiation_W(sun_direction);
+        double solar_radiation_W = nodes_[i].CalcSolarRadiation_W(sun_direction_b);
         heatloads_[i].SetSolarHeatload_W(solar_radiation_W);
       }
       double heater_power_W = GetHeaterPower_W(i);
       heatloads_[i].SetHeaterHeatload_W(heater_power_W);
       heatloads_[i].CalcInternalHeatload();
       heatloads_[i].UpdateTotalHeatload();
-      double total_heatload_W = heatloads_[i].GetTotalHeatload_W();  // Total heatload (solar + internal + heater)[W]
-
-      double conductive_heat_input_W = 0;
-      double radiative_heat_input_W = 0;
-      for (int j = 0; j < node_num; j++) {
-        conductive_heat_input_W += conductance_matrix_W_K_[i][j] * (nodes_[j].GetTemperature_K() - nodes_[i].GetTemperature_K());
-        radiative_heat_input_W += environment::stefan_boltzmann_constant_W_m2K4 * radiation_matrix_m2_[i][j] *
-                                  (pow(nodes_[j].GetTemperature_K(), 4) - pow(nodes_[i].GetTemperature_K(), 4));
-      }
-      double total_heat_input_W = conductive_heat_input_W + radiative_heat_input_W + total_heatload_W;
-      differentials_K_s[i] = total_heat_input_W / nodes_[i].GetCapacity_J_K();
-    } else if (nodes_[i].GetNodeType() == NodeType::kBoundary) {
-      differentials_K_s[i] = 0;
+      heatloads_W[i] = heatloads_[i].GetTotalHeatload_W();  // Total heatload (solar + internal + heater)[W]
+    } else {
+      heatloads_W[i] = 0.0;
     }
   }
-  return differentials_K_s;
 }
 
 double Temperature::GetHeaterPower_W(int node_id) {
@@ -204,6 +220,67 @@ string Temperature::GetLogValue() const {
   return str_tmp;
 }
 
+void Temperature::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("Temperature");
+  writer.Write(is_calc_enabled_);
+  writer.Write(propagation_time_s_);
+  writer.Write((uint64_t)nodes_.size());
+  for (const auto& node : nodes_) {
+    writer.Write(node.GetTemperature_K());
+  }
+  writer.Write((uint64_t)heaters_.size());
+  for (const auto& heater : heaters_) {
+    writer.Write(heater.GetHeaterStatus());
+  }
+  writer.Write((uint64_t)heatloads_.size());
+  for (const auto& heatload : heatloads_) {
+    writer.Write(heatload.GetElapsedTime_s());
+    writer.Write(heatload.GetSolarHeatload_W());
+    writer.Write(heatload.GetInternalHeatload_W());
+    writer.Write(heatload.GetHeaterHeatload_W());
+  }
+  writer.Write(temperatures_K_);
+  writer.Write(heatloads_begin_W_);
+  writer.Write(heatloads_middle_W_);
+  writer.Write(heatloads_end_W_);
+}
+
+void Temperature::LoadState(CheckpointReader& reader) {
+  reader.BeginSection("Temperature");
+  reader.Read(is_calc_enabled_);
+  reader.Read(propagation_time_s_);
+  reader.ReadSizeAndCheck(nodes_.size(), "thermal nodes");
+  for (auto& node : nodes_) {
+    double temperature_K = node.GetTemperature_K();
+    reader.Read(temperature_K);
+    node.SetTemperature_K(temperature_K);
+  }
+  reader.ReadSizeAndCheck(heaters_.size(), "heaters");
+  for (auto& heater : heaters_) {
+    HeaterStatus heater_status = heater.GetHeaterStatus();
+    reader.Read(heater_status);
+    heater.SetHeaterStatus(heater_status);
+  }
+  reader.ReadSizeAndCheck(heatloads_.size(), "heatloads");
+  for (auto& heatload : heatloads_) {
+    double elapsed_time_s = 0.0, solar_heatload_W = 0.0, internal_heatload_W = 0.0, heater_heatload_W = 0.0;
+    reader.Read(elapsed_time_s);
+    reader.Read(solar_heatload_W);
+    reader.Read(internal_heatload_W);
+    reader.Read(heater_heatload_W);
+    if (!reader.IsValid()) return;
+    heatload.SetElapsedTime_s(elapsed_time_s);
+    heatload.SetSolarHeatload_W(solar_heatload_W);
+    heatload.SetInternalHeatload_W(internal_heatload_W);
+    heatload.SetHeaterHeatload_W(heater_heatload_W);
+    heatload.UpdateTotalHeatload();
+  }
+  reader.Read(temperatures_K_);
+  reader.Read(heatloads_begin_W_);
+  reader.Read(heatloads_middle_W_);
+  reader.Read(heatloads_end_W_);
+}
+
 void Temperature::PrintParams(void) {
   cout << "< Print Thermal Parameters >" << endl;
   cout << "IsCalcEnabled: " << is_calc_enabled_ << endl;
@@ -7,6 +7,7 @@
 #define S2E_DYNAMICS_THERMAL_TEMPERATURE_HPP_
 
 #include <library/logger/loggable.hpp>
+#include <library/utilities/checkpoint.hpp>
 #include <string>
 #include <vector>
 
@@ -14,6 +15,7 @@
 #include "heater_controller.hpp"
 #include "heatload.hpp"
 #include "node.hpp"
+#include "thermal_network.hpp"
 
 /**
  * @enum SolarCalcSetting
@@ -38,10 +40,16 @@ class Temperature : public ILoggable {
   std::vector<HeaterController> heater_controllers_;         // vector of heater controllers
   int node_num_;                                             // number of nodes
   double propagation_step_s_;                                // propagation step [s]
-  double propagation_time_s_;            // Incremented time inside class Temperature [s], finish propagation when reaching end_time
-  bool is_calc_enabled_;                 // Whether temperature calculation is enabled
-  SolarCalcSetting solar_calc_setting_;  // setting for solar calculation
-  bool debug_;                           // Activate debug output or not
+  double propagation_time_s_;                    // Incremented time inside class Temperature [s], finish propagation when reaching end_time
+  bool is_calc_enabled_;                         // Whether temperature calculation is enabled
+  SolarCalcSetting solar_calc_setting_;          // setting for solar calculation
+  bool debug_;                                   // Activate debug output or not
+  ThermalIntegrationMethod integration_method_;  // Numerical integration method
+  ThermalNetwork network_;                       // Sparse thermal network made from the conductance and radiation matrices
+  std::vector<double> temperatures_K_;           // Temperatures of nodes used in the propagation [K]
+  std::vector<double> heatloads_begin_W_;        // Heatloads at the beginning of the propagation step [W]
+  std::vector<double> heatloads_middle_W_;       // Heatloads at the middle of the propagation step [W]
+  std::vector<double> heatloads_end_W_;          // Heatloads at the end of the propagation step [W]
 
   /**
    * @fn CalcRungeOneStep
@@ -54,17 +62,24 @@ class Temperature : public ILoggable {
    */
   void CalcRungeOneStep(double time_now_s, double time_step_s, libra::Vector<3> sun_direction_b, int node_num);
   /**
-   * @fn CalcTemperatureDifferentials
-   * @brief Calculate differential of thermal equilibrium equation
+   * @fn CalcBackwardEulerOneStep
+   * @brief Calculate one step of the backward Euler method for thermal equilibrium equation and update temperatures of nodes
+   * @note The step is divided when the Newton iteration does not converge.
    *
-   * @param temperatures_K: [UNUSED] Temperatures of each node [K]
-   * @param time_now_s: Current elapsed time [s]
+   * @param[in] time_now_s: Current elapsed time [s]
+   * @param[in] time_step_s: Time step [s]
+   * @param[in] sun_direction_b: Sun direction in body frame
+   */
+  void CalcBackwardEulerOneStep(double time_now_s, double time_step_s, const libra::Vector<3> sun_direction_b);
+  /**
+   * @fn CalcHeatloads
+   * @brief Calculate heatloads of all nodes (solar + internal + heater)
+   *
+   * @param time_s: Elapsed time [s]
    * @param sun_direction_b: Sun direction in body frame
-   * @param node_num: Number of nodes
-   * @return std::vector<double>: Differential of thermal equilibrium equation at time now
+   * @param heatloads_W: Heatloads of each node [W]
    */
-  std::vector<double> CalcTemperatureDifferentials(std::vector<double> temperatures_K, double time_now_s, const libra::Vector<3> sun_direction_b,
-                                                   int node_num);
+  void CalcHeatloads(double time_s, const libra::Vector<3> sun_direction_b, std::vector<double>& heatloads_W);
 
  public:
   /**
@@ -82,11 +97,12 @@ class Temperature : public ILoggable {
    * @param is_calc_enabled: Whether calculation is enabled
    * @param solar_calc_setting: Solar calculation settings
    * @param debug: Whether debug is enabled
+   * @param integration_method: Numerical integration method
    */
   Temperature(const std::vector<std::vector<double>> conductance_matrix_W_K, const std::vector<std::vector<double>> radiation_matrix_m2,
               std::vector<Node> nodes, std::vector<Heatload> heatloads, std::vector<Heater> heaters, std::vector<HeaterController> heater_controllers,
               const int node_num, const double propagation_step_s, const bool is_calc_enabled, const SolarCalcSetting solar_calc_setting,
-              const bool debug);
+              const bool debug, const ThermalIntegrationMethod integration_method = ThermalIntegrationMethod::kRk4);
   /**
    * @fn Temperature
    * @brief Construct a new Temperature object, used when thermal calculation is disabled.
@@ -135,6 +151,19 @@ class Temperature : public ILoggable {
    */
   std::string GetLogValue() const;
 
+  /**
+   * @fn SaveState
+   * @brief Write the temperatures, the heater status, and the heatloads to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the temperatures, the heater status, and the heatloads from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
+
   /**
    * @fn UpdateHeaterStatus
    * @brief Update all heater status based on heater controller and temperature
@@ -0,0 +1,130 @@
+/**
+ * @file test_thermal_network.cpp
+ * @brief Test codes for ThermalNetwork class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <environment/global/physical_constants.hpp>
+#include <random>
+#include <vector>
+
+#include "thermal_network.hpp"
+
+namespace {
+/**
+ * @fn MakeTwoNodeNetwork
+ * @brief Return the network of two diffusive nodes connected by the conductance
+ */
+ThermalNetwork MakeTwoNodeNetwork(const double conductance_W_K, const double capacity_J_K) {
+  std::vector<std::vector<double>> conductance_matrix_W_K = {{0.0, conductance_W_K}, {conductance_W_K, 0.0}};
+  std::vector<std::vector<double>> radiation_matrix_m2 = {{0.0, 0.0}, {0.0, 0.0}};
+  return ThermalNetwork(conductance_matrix_W_K, radiation_matrix_m2, {capacity_J_K, capacity_J_K}, {true, true});
+}
+}  // namespace
+
+/**
+ * @brief Test of the differentials compared with the dense calculation
+ */
+TEST(ThermalNetwork, Differentials) {
+  const size_t number_of_nodes = 20;
+  std::mt19937 engine(1);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+  std::vector<std::vector<double>> conductance_matrix_W_K(number_of_nodes, std::vector<double>(number_of_nodes, 0.0));
+  std::vector<std::vector<double>> radiation_matrix_m2(number_of_nodes, std::vector<double>(number_of_nodes, 0.0));
+  std::vector<double> capacities_J_K(number_of_nodes), temperatures_K(number_of_nodes), heatloads_W(number_of_nodes);
+  std::vector<bool> is_diffusive(number_of_nodes);
+  for (size_t i = 0; i < number_of_nodes; i++) {
+    for (size_t j = 0; j < number_of_nodes; j++) {
+      if (uniform(engine) < 0.2) conductance_matrix_W_K[i][j] = uniform(engine);
+      if (uniform(engine) < 0.2) radiation_matrix_m2[i][j] = uniform(engine) * 0.01;
+    }
+    capacities_J_K[i] = 10.0 + 100.0 * uniform(engine);
+    temperatures_K[i] = 250.0 + 100.0 * uniform(engine);
+    heatloads_W[i] = uniform(engine);
+    is_diffusive[i] = i % 5 != 0;
+  }
+
+  ThermalNetwork network(conductance_matrix_W_K, radiation_matrix_m2, capacities_J_K, is_diffusive);
+  EXPECT_EQ(number_of_nodes, network.GetNumberOfNodes());
+  std::vector<double> differentials_K_s(number_of_nodes);
+  network.CalcDifferentials(temperatures_K, heatloads_W, differentials_K_s);
+
+  for (size_t i = 0; i < number_of_nodes; i++) {
+    double expected_K_s = 0.0;
+    if (is_diffusive[i]) {
+      double heat_input_W = heatloads_W[i];
+      for (size_t j = 0; j < number_of_nodes; j++) {
+        heat_input_W += conductance_matrix_W_K[i][j] * (temperatures_K[j] - temperatures_K[i]);
+        heat_input_W += environment::stefan_boltzmann_constant_W_m2K4 * radiation_matrix_m2[i][j] *
+                        (pow(temperatures_K[j], 4) - pow(temperatures_K[i], 4));
+      }
+      expected_K_s = heat_input_W / capacities_J_K[i];
+    }
+    EXPECT_NEAR(expected_K_s, differentials_K_s[i], 1e-12);
+  }
+}
+
+/**
+ * @brief Test of the conduction between two nodes compared with the analytical solution
+ */
+TEST(ThermalNetwork, TwoNodeConduction) {
+  const double conductance_W_K = 0.5;
+  const double capacity_J_K = 10.0;
+  const double time_constant_s = capacity_J_K / (2.0 * conductance_W_K);
+  const double step_s = 0.1;
+  const size_t number_of_steps = 100;
+  const std::vector<double> heatloads_W = {0.0, 0.0};
+  ThermalNetwork network = MakeTwoNodeNetwork(conductance_W_K, capacity_J_K);
+
+  std::vector<double> rk4_temperatures_K = {300.0, 200.0};
+  std::vector<double> backward_euler_temperatures_K = {300.0, 200.0};
+  for (size_t i = 0; i < number_of_steps; i++) {
+    network.PropagateRk4(step_s, heatloads_W, heatloads_W, heatloads_W, rk4_temperatures_K);
+    EXPECT_TRUE(network.PropagateBackwardEuler(step_s, heatloads_W, backward_euler_temperatures_K));
+  }
+
+  const double difference_K = 100.0 * exp(-(double)number_of_steps * step_s / time_constant_s);
+  EXPECT_NEAR(250.0 + difference_K / 2.0, rk4_temperatures_K[0], 1e-8);
+  EXPECT_NEAR(250.0 - difference_K / 2.0, rk4_temperatures_K[1], 1e-8);
+  // First order method
+  EXPECT_NEAR(250.0 + difference_K / 2.0, backward_euler_temperatures_K[0], 0.2);
+  EXPECT_NEAR(250.0 - difference_K / 2.0, backward_euler_temperatures_K[1], 0.2);
+  EXPECT_NEAR(500.0, backward_euler_temperatures_K[0] + backward_euler_temperatures_K[1], 1e-8);
+}
+
+/**
+ * @brief Test that the backward Euler method is stable for a stiff network with a large time step and converges to the steady state
+ */
+TEST(ThermalNetwork, StiffSteadyState) {
+  // Node 0 is a boundary node, and the nodes 1 and 2 are a light component on a heavy panel
+  std::vector<std::vector<double>> conductance_matrix_W_K = {{0.0, 0.0, 1.0}, {0.0, 0.0, 100.0}, {1.0, 100.0, 0.0}};
+  std::vector<std::vector<double>> radiation_matrix_m2 = {{0.0, 0.0, 0.1}, {0.0, 0.0, 0.0}, {0.1, 0.0, 0.0}};
+  ThermalNetwork network(conductance_matrix_W_K, radiation_matrix_m2, {1.0, 0.1, 1000.0}, {false, true, true});
+  const std::vector<double> heatloads_W = {0.0, 10.0, 0.0};
+
+  std::vector<double> temperatures_K = {3.0, 300.0, 300.0};
+  for (size_t i = 0; i < 1000; i++) {
+    ASSERT_TRUE(network.PropagateBackwardEuler(1000.0, heatloads_W, temperatures_K));
+  }
+
+  // Steady state: all heat is released to the boundary node
+  EXPECT_DOUBLE_EQ(3.0, temperatures_K[0]);
+  EXPECT_NEAR(10.0, 100.0 * (temperatures_K[1] - temperatures_K[2]), 1e-6);
+  const double released_heat_W = 1.0 * (temperatures_K[2] - temperatures_K[0]) +
+                                 environment::stefan_boltzmann_constant_W_m2K4 * 0.1 * (pow(temperatures_K[2], 4) - pow(temperatures_K[0], 4));
+  EXPECT_NEAR(10.0, released_heat_W, 1e-6);
+
+  // The implicit result with a step 10000 times larger than the stable explicit step agrees with the explicit result
+  std::vector<double> rk4_temperatures_K = {3.0, 300.0, 300.0};
+  for (size_t i = 0; i < 1000000; i++) {
+    network.PropagateRk4(0.0005, heatloads_W, heatloads_W, heatloads_W, rk4_temperatures_K);
+  }
+  std::vector<double> backward_euler_temperatures_K = {3.0, 300.0, 300.0};
+  for (size_t i = 0; i < 100; i++) {
+    EXPECT_TRUE(network.PropagateBackwardEuler(5.0, heatloads_W, backward_euler_temperatures_K));
+  }
+  EXPECT_NEAR(rk4_temperatures_K[2], backward_euler_temperatures_K[2], 1.0);
+  EXPECT_NEAR(rk4_temperatures_K[1], backward_euler_temperatures_K[1], 1.0);
+}
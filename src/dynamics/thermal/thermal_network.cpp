@@ -0,0 +1,214 @@
+/**
+ * @file thermal_network.cpp
+ * @brief Thermal network with sparse conductive and radiative couplings
+ */
+
+#include "thermal_network.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <environment/global/physical_constants.hpp>
+
+namespace {
+/**
+ * @fn Dot
+ * @brief Return the inner product of the vectors
+ */
+double Dot(const std::vector<double>& a, const std::vector<double>& b) {
+  double result = 0.0;
+  for (size_t i = 0; i < a.size(); i++) result += a[i] * b[i];
+  return result;
+}
+}  // namespace
+
+ThermalNetwork::ThermalNetwork(const std::vector<std::vector<double>>& conductance_matrix_W_K,
+                               const std::vector<std::vector<double>>& radiation_matrix_m2, const std::vector<double>& capacities_J_K,
+                               const std::vector<bool>& is_diffusive)
+    : capacities_J_K_(capacities_J_K) {
+  const size_t number_of_nodes = capacities_J_K.size();
+  is_diffusive_.assign(number_of_nodes, 0);
+  for (size_t i = 0; i < number_of_nodes && i < is_diffusive.size(); i++) is_diffusive_[i] = is_diffusive[i] ? 1 : 0;
+
+  // The diagonal elements do not contribute to the heat flow, so they are not stored
+  row_offsets_.push_back(0);
+  for (size_t i = 0; i < number_of_nodes; i++) {
+    for (size_t j = 0; j < number_of_nodes; j++) {
+      if (i == j) continue;
+      const double conductance_W_K = (i < conductance_matrix_W_K.size() && j < conductance_matrix_W_K[i].size()) ? conductance_matrix_W_K[i][j] : 0.0;
+      const double radiation_m2 = (i < radiation_matrix_m2.size() && j < radiation_matrix_m2[i].size()) ? radiation_matrix_m2[i][j] : 0.0;
+      if (conductance_W_K == 0.0 && radiation_m2 == 0.0) continue;
+      column_indices_.push_back(j);
+      conductances_W_K_.push_back(conductance_W_K);
+      radiation_couplings_W_K4_.push_back(environment::stefan_boltzmann_constant_W_m2K4 * radiation_m2);
+    }
+    row_offsets_.push_back(column_indices_.size());
+  }
+
+  temperatures4_K4_.assign(number_of_nodes, 0.0);
+  stage_temperatures_K_.assign(number_of_nodes, 0.0);
+  k1_K_s_.assign(number_of_nodes, 0.0);
+  k2_K_s_.assign(number_of_nodes, 0.0);
+  k3_K_s_.assign(number_of_nodes, 0.0);
+  k4_K_s_.assign(number_of_nodes, 0.0);
+  previous_temperatures_K_.assign(number_of_nodes, 0.0);
+  jacobian_diagonal_.assign(number_of_nodes, 0.0);
+  jacobian_off_diagonal_.assign(column_indices_.size(), 0.0);
+  residual_.assign(number_of_nodes, 0.0);
+  delta_K_.assign(number_of_nodes, 0.0);
+  for (auto vector : {&r_, &r_hat_, &p_, &v_, &s_, &t_, &y_, &z_}) vector->assign(number_of_nodes, 0.0);
+}
+
+void ThermalNetwork::CalcDifferentials(const std::vector<double>& temperatures_K, const std::vector<double>& heatloads_W,
+                                       std::vector<double>& differentials_K_s) {
+  CalcHeatInputs(temperatures_K, differentials_K_s);
+  for (size_t i = 0; i < capacities_J_K_.size(); i++) {
+    if (is_diffusive_[i]) {
+      differentials_K_s[i] = (differentials_K_s[i] + heatloads_W[i]) / capacities_J_K_[i];
+    } else {
+      differentials_K_s[i] = 0.0;
+    }
+  }
+}
+
+void ThermalNetwork::PropagateRk4(const double time_step_s, const std::vector<double>& heatloads_begin_W,
+                                  const std::vector<double>& heatloads_middle_W, const std::vector<double>& heatloads_end_W,
+                                  std::vector<double>& temperatures_K) {
+  const size_t number_of_nodes = capacities_J_K_.size();
+
+  CalcDifferentials(temperatures_K, heatloads_begin_W, k1_K_s_);
+  for (size_t i = 0; i < number_of_nodes; i++) stage_temperatures_K_[i] = temperatures_K[i] + (time_step_s / 2.0) * k1_K_s_[i];
+
+  CalcDifferentials(stage_temperatures_K_, heatloads_middle_W, k2_K_s_);
+  for (size_t i = 0; i < number_of_nodes; i++) stage_temperatures_K_[i] = temperatures_K[i] + (time_step_s / 2.0) * k2_K_s_[i];
+
+  CalcDifferentials(stage_temperatures_K_, heatloads_middle_W, k3_K_s_);
+  for (size_t i = 0; i < number_of_nodes; i++) stage_temperatures_K_[i] = temperatures_K[i] + time_step_s * k3_K_s_[i];
+
+  CalcDifferentials(stage_temperatures_K_, heatloads_end_W, k4_K_s_);
+  for (size_t i = 0; i < number_of_nodes; i++) {
+    temperatures_K[i] += (time_step_s / 6.0) * (k1_K_s_[i] + 2.0 * k2_K_s_[i] + 2.0 * k3_K_s_[i] + k4_K_s_[i]);
+  }
+}
+
+bool ThermalNetwork::PropagateBackwardEuler(const double time_step_s, const std::vector<double>& heatloads_end_W,
+                                            std::vector<double>& temperatures_K) {
+  const size_t number_of_nodes = capacities_J_K_.size();
+  if (time_step_s <= 0.0) return true;
+  previous_temperatures_K_ = temperatures_K;
+
+  for (size_t iteration = 0; iteration < kMaxNewtonIterations; iteration++) {
+    // Residual: C (T - T_prev) / h - Q(T) - L = 0
+    CalcHeatInputs(temperatures_K, residual_);
+    for (size_t i = 0; i < number_of_nodes; i++) {
+      if (is_diffusive_[i]) {
+        residual_[i] = heatloads_end_W[i] + residual_[i] - capacities_J_K_[i] * (temperatures_K[i] - previous_temperatures_K_[i]) / time_step_s;
+      } else {
+        residual_[i] = 0.0;
+      }
+    }
+
+    // Newton matrix: C / h - dQ/dT
+    for (size_t i = 0; i < number_of_nodes; i++) {
+      if (!is_diffusive_[i]) {
+        jacobian_diagonal_[i] = 1.0;
+        for (size_t k = row_offsets_[i]; k < row_offsets_[i + 1]; k++) jacobian_off_diagonal_[k] = 0.0;
+        continue;
+      }
+      const double temperature3_i_K3 = temperatures_K[i] * temperatures_K[i] * temperatures_K[i];
+      double diagonal = capacities_J_K_[i] / time_step_s;
+      for (size_t k = row_offsets_[i]; k < row_offsets_[i + 1]; k++) {
+        const double temperature_j_K = temperatures_K[column_indices_[k]];
+        const double temperature3_j_K3 = temperature_j_K * temperature_j_K * temperature_j_K;
+        diagonal += conductances_W_K_[k] + 4.0 * radiation_couplings_W_K4_[k] * temperature3_i_K3;
+        jacobian_off_diagonal_[k] = -(conductances_W_K_[k] + 4.0 * radiation_couplings_W_K4_[k] * temperature3_j_K3);
+      }
+      jacobian_diagonal_[i] = diagonal;
+    }
+
+    if (!SolveNewtonMatrix(residual_, delta_K_)) break;
+
+    double max_delta_K = 0.0;
+    for (size_t i = 0; i < number_of_nodes; i++) {
+      temperatures_K[i] += delta_K_[i];
+      max_delta_K = std::max(max_delta_K, std::abs(delta_K_[i]));
+    }
+    if (max_delta_K < kNewtonTolerance_K) return true;
+  }
+
+  temperatures_K = previous_temperatures_K_;
+  return false;
+}
+
+void ThermalNetwork::CalcHeatInputs(const std::vector<double>& temperatures_K, std::vector<double>& heat_inputs_W) {
+  const size_t number_of_nodes = capacities_J_K_.size();
+  for (size_t i = 0; i < number_of_nodes; i++) {
+    const double temperature2_K2 = temperatures_K[i] * temperatures_K[i];
+    temperatures4_K4_[i] = temperature2_K2 * temperature2_K2;
+  }
+
+  for (size_t i = 0; i < number_of_nodes; i++) {
+    double heat_input_W = 0.0;
+    for (size_t k = row_offsets_[i]; k < row_offsets_[i + 1]; k++) {
+      const size_t j = column_indices_[k];
+      heat_input_W += conductances_W_K_[k] * (temperatures_K[j] - temperatures_K[i]) +
+                      radiation_couplings_W_K4_[k] * (temperatures4_K4_[j] - temperatures4_K4_[i]);
+    }
+    heat_inputs_W[i] = heat_input_W;
+  }
+}
+
+void ThermalNetwork::MultiplyNewtonMatrix(const std::vector<double>& x, std::vector<double>& y) const {
+  for (size_t i = 0; i < capacities_J_K_.size(); i++) {
+    double result = jacobian_diagonal_[i] * x[i];
+    for (size_t k = row_offsets_[i]; k < row_offsets_[i + 1]; k++) result += jacobian_off_diagonal_[k] * x[column_indices_[k]];
+    y[i] = result;
+  }
+}
+
+bool ThermalNetwork::SolveNewtonMatrix(const std::vector<double>& b, std::vector<double>& x) {
+  const size_t number_of_nodes = capacities_J_K_.size();
+  std::fill(x.begin(), x.end(), 0.0);
+  const double b_norm = std::sqrt(Dot(b, b));
+  if (b_norm == 0.0) return true;
+  const double tolerance = kLinearSolverTolerance * b_norm;
+
+  r_ = b;
+  r_hat_ = b;
+  std::fill(p_.begin(), p_.end(), 0.0);
+  std::fill(v_.begin(), v_.end(), 0.0);
+  double rho = 1.0, alpha = 1.0, omega = 1.0;
+  const size_t max_iterations = std::max<size_t>(100, 2 * number_of_nodes);
+  for (size_t iteration = 0; iteration < max_iterations; iteration++) {
+    const double rho_new = Dot(r_hat_, r_);
+    if (rho_new == 0.0) return false;
+    const double beta = (rho_new / rho) * (alpha / omega);
+    for (size_t i = 0; i < number_of_nodes; i++) {
+      p_[i] = r_[i] + beta * (p_[i] - omega * v_[i]);
+      y_[i] = p_[i] / jacobian_diagonal_[i];
+    }
+    MultiplyNewtonMatrix(y_, v_);
+    const double r_hat_v = Dot(r_hat_, v_);
+    if (r_hat_v == 0.0) return false;
+    alpha = rho_new / r_hat_v;
+
+    for (size_t i = 0; i < number_of_nodes; i++) s_[i] = r_[i] - alpha * v_[i];
+    if (std::sqrt(Dot(s_, s_)) < tolerance) {
+      for (size_t i = 0; i < number_of_nodes; i++) x[i] += alpha * y_[i];
+      return true;
+    }
+
+    for (size_t i = 0; i < number_of_nodes; i++) z_[i] = s_[i] / jacobian_diagonal_[i];
+    MultiplyNewtonMatrix(z_, t_);
+    const double t_t = Dot(t_, t_);
+    if (t_t == 0.0) return false;
+    omega = Dot(t_, s_) / t_t;
+    for (size_t i = 0; i < number_of_nodes; i++) {
+      x[i] += alpha * y_[i] + omega * z_[i];
+      r_[i] = s_[i] - omega * t_[i];
+    }
+    if (std::sqrt(Dot(r_, r_)) < tolerance) return true;
+    if (omega == 0.0) return false;
+    rho = rho_new;
+  }
+  return false;
+}
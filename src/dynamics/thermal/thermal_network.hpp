@@ -0,0 +1,134 @@
+/**
+ * @file thermal_network.hpp
+ * @brief Thermal network with sparse conductive and radiative couplings
+ */
+
+#ifndef S2E_DYNAMICS_THERMAL_THERMAL_NETWORK_HPP_
+#define S2E_DYNAMICS_THERMAL_THERMAL_NETWORK_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @enum ThermalIntegrationMethod
+ * @brief Numerical integration method of the thermal network
+ */
+enum class ThermalIntegrationMethod {
+  kRk4 = 0,        //!< Classical 4th order Runge-Kutta method
+  kBackwardEuler,  //!< Backward Euler method with Newton iterations for stiff networks
+};
+
+/**
+ * @class ThermalNetwork
+ * @brief Thermal network with sparse conductive and radiative couplings
+ * @details The couplings are stored in the CSR (compressed sparse row) format, and the fourth power of the temperatures is calculated
+ *          once per evaluation. All work buffers are allocated at the construction, so the propagation does not allocate memory.
+ *          The backward Euler method solves the Newton steps with the Jacobi preconditioned BiCGSTAB method on the same sparse pattern.
+ *          The temperatures of the non-diffusive nodes (boundary and arithmetic nodes) are kept constant.
+ */
+class ThermalNetwork {
+ public:
+  /**
+   * @fn ThermalNetwork
+   * @brief Default constructor for the network without nodes
+   */
+  ThermalNetwork() {}
+  /**
+   * @fn ThermalNetwork
+   * @brief Constructor
+   * @param [in] conductance_matrix_W_K: (N x N) matrix of the heat conductance between the nodes [W/K]
+   * @param [in] radiation_matrix_m2: (N x N) matrix of the radiative coupling between the nodes [m2]
+   * @param [in] capacities_J_K: Heat capacities of the nodes [J/K]
+   * @param [in] is_diffusive: Whether the temperature of the node is propagated or not
+   */
+  ThermalNetwork(const std::vector<std::vector<double>>& conductance_matrix_W_K, const std::vector<std::vector<double>>& radiation_matrix_m2,
+                 const std::vector<double>& capacities_J_K, const std::vector<bool>& is_diffusive);
+
+  /**
+   * @fn CalcDifferentials
+   * @brief Calculate the time derivatives of the temperatures
+   * @param [in] temperatures_K: Temperatures of the nodes [K]
+   * @param [in] heatloads_W: External heat loads of the nodes [W]
+   * @param [out] differentials_K_s: Time derivatives of the temperatures [K/s]
+   */
+  void CalcDifferentials(const std::vector<double>& temperatures_K, const std::vector<double>& heatloads_W, std::vector<double>& differentials_K_s);
+  /**
+   * @fn PropagateRk4
+   * @brief Propagate the temperatures with one step of the classical 4th order Runge-Kutta method
+   * @param [in] time_step_s: Time step [s]
+   * @param [in] heatloads_begin_W: Heat loads at the beginning of the step [W]
+   * @param [in] heatloads_middle_W: Heat loads at the middle of the step [W]
+   * @param [in] heatloads_end_W: Heat loads at the end of the step [W]
+   * @param [in/out] temperatures_K: Temperatures of the nodes [K]
+   */
+  void PropagateRk4(const double time_step_s, const std::vector<double>& heatloads_begin_W, const std::vector<double>& heatloads_middle_W,
+                    const std::vector<double>& heatloads_end_W, std::vector<double>& temperatures_K);
+  /**
+   * @fn PropagateBackwardEuler
+   * @brief Propagate the temperatures with one step of the backward Euler method
+   * @param [in] time_step_s: Time step [s]
+   * @param [in] heatloads_end_W: Heat loads at the end of the step [W]
+   * @param [in/out] temperatures_K: Temperatures of the nodes [K]. The input values are kept when the iteration does not converge.
+   * @return True when the Newton iteration converges
+   */
+  bool PropagateBackwardEuler(const double time_step_s, const std::vector<double>& heatloads_end_W, std::vector<double>& temperatures_K);
+
+  // Getters
+  /**
+   * @fn GetNumberOfNodes
+   * @brief Return number of nodes
+   */
+  inline size_t GetNumberOfNodes() const { return capacities_J_K_.size(); }
+  /**
+   * @fn GetNumberOfCouplings
+   * @brief Return number of nonzero couplings between different nodes
+   */
+  inline size_t GetNumberOfCouplings() const { return column_indices_.size(); }
+
+  static const size_t kMaxNewtonIterations = 20;  //!< Maximum number of the Newton iterations of the backward Euler method
+  static constexpr double kNewtonTolerance_K = 1.0e-8;       //!< Convergence tolerance of the Newton iterations [K]
+  static constexpr double kLinearSolverTolerance = 1.0e-12;  //!< Relative tolerance of the residual of the linear solver
+
+ private:
+  // Sparse couplings (CSR format without the diagonal elements)
+  std::vector<size_t> row_offsets_;                //!< Offsets of each row in the coupling arrays (N + 1 elements)
+  std::vector<size_t> column_indices_;             //!< Column indices of the couplings
+  std::vector<double> conductances_W_K_;           //!< Heat conductance [W/K]
+  std::vector<double> radiation_couplings_W_K4_;   //!< Radiative coupling multiplied by the Stefan-Boltzmann constant [W/K4]
+  std::vector<double> capacities_J_K_;             //!< Heat capacities [J/K]
+  std::vector<char> is_diffusive_;                 //!< Whether the temperature of the node is propagated or not
+
+  // Work buffers
+  std::vector<double> temperatures4_K4_;                          //!< Fourth power of the temperatures [K4]
+  std::vector<double> stage_temperatures_K_;                      //!< Temperatures of the intermediate stage [K]
+  std::vector<double> k1_K_s_, k2_K_s_, k3_K_s_, k4_K_s_;         //!< Stage derivatives of the Runge-Kutta method [K/s]
+  std::vector<double> previous_temperatures_K_;                   //!< Temperatures at the beginning of the implicit step [K]
+  std::vector<double> jacobian_diagonal_, jacobian_off_diagonal_;  //!< Newton matrix in the same sparse pattern
+  std::vector<double> residual_, delta_K_;                        //!< Residual and correction of the Newton iteration
+  std::vector<double> r_, r_hat_, p_, v_, s_, t_, y_, z_;          //!< Work vectors of the BiCGSTAB method
+
+  /**
+   * @fn CalcHeatInputs
+   * @brief Calculate the conductive and radiative heat input to the nodes
+   * @param [in] temperatures_K: Temperatures of the nodes [K]
+   * @param [out] heat_inputs_W: Heat input [W]
+   */
+  void CalcHeatInputs(const std::vector<double>& temperatures_K, std::vector<double>& heat_inputs_W);
+  /**
+   * @fn MultiplyNewtonMatrix
+   * @brief Multiply the Newton matrix and the vector
+   * @param [in] x: Input vector
+   * @param [out] y: Output vector
+   */
+  void MultiplyNewtonMatrix(const std::vector<double>& x, std::vector<double>& y) const;
+  /**
+   * @fn SolveNewtonMatrix
+   * @brief Solve the linear equation of the Newton matrix with the Jacobi preconditioned BiCGSTAB method
+   * @param [in] b: Right hand side
+   * @param [out] x: Solution
+   * @return True when the residual converges
+   */
+  bool SolveNewtonMatrix(const std::vector<double>& b, std::vector<double>& x);
+};
+
+#endif  // S2E_DYNAMICS_THERMAL_THERMAL_NETWORK_HPP_
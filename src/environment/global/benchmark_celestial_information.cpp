@@ -0,0 +1,90 @@
+/**
+ * @file benchmark_celestial_information.cpp
+ * @brief Benchmark codes for CelestialInformation class with Google Benchmark
+ * @note The celestial information is initialized with the [CELESTIAL_INFORMATION] and [CSPICE_KERNELS] sections of the initialize file.
+ *       The path of the file is set by the environment variable S2E_BENCHMARK_INI_FILE, and the sample file is used by default.
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <library/initialize/initialize_file_access.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "celestial_information.hpp"
+#include "initialize_global_environment.hpp"
+
+namespace {
+
+const char* kDefaultIniFile = "../../data/sample/initialize_files/sample_simulation_base.ini";
+const double kStartTime_jd = 2458849.5;  //!< 2020/01/01 00:00:00 UTC
+const double kDuration_s = 30.0 * 86400.0;
+
+/**
+ * @fn GetIniFile
+ * @brief Return the initialize file of the benchmark
+ */
+std::string GetIniFile() {
+  const char* ini_file_env = getenv("S2E_BENCHMARK_INI_FILE");
+  return ini_file_env != nullptr ? ini_file_env : kDefaultIniFile;
+}
+
+/**
+ * @fn IsIniFileAvailable
+ * @brief Return true when the initialize file and the SPICE kernels exist
+ */
+bool IsIniFileAvailable() {
+  static int is_available = -1;
+  if (is_available >= 0) return is_available == 1;
+
+  is_available = 0;
+  if (!std::filesystem::exists(GetIniFile())) return false;
+  try {
+    IniAccess ini_file(GetIniFile());
+    const char* keywords[] = {"tls", "tpc1", "tpc2", "tpc3", "bsp"};
+    for (size_t i = 0; i < 5; i++) {
+      if (!std::filesystem::exists(ini_file.ReadString("CSPICE_KERNELS", keywords[i]))) return false;
+    }
+  } catch (const std::runtime_error&) {
+    return false;
+  }
+  is_available = 1;
+  return true;
+}
+
+/**
+ * @fn GetCelestialInformation
+ * @brief Return the celestial information. The information is initialized only once.
+ */
+CelestialInformation& GetCelestialInformation() {
+  static std::unique_ptr<CelestialInformation> celestial_information(InitCelestialInformation(GetIniFile()));
+  return *celestial_information;
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmark of the update of all the selected bodies and the Earth rotation for one simulation step
+ * @note Argument: simulation step [s]
+ */
+static void BM_CelestialInformationUpdate(benchmark::State& state) {
+  if (!IsIniFileAvailable()) {
+    state.SkipWithError("Initialize files are not available");
+    return;
+  }
+  CelestialInformation& celestial_information = GetCelestialInformation();
+  const double step_s = (double)state.range(0);
+
+  double elapsed_time_s = 0.0;
+  for (auto _ : state) {
+    celestial_information.UpdateAllObjectsInformation(kStartTime_jd + elapsed_time_s / 86400.0);
+    benchmark::DoNotOptimize(celestial_information.GetPositionFromCenter_i_m(0u));
+    elapsed_time_s += step_s;
+    if (elapsed_time_s >= kDuration_s) elapsed_time_s = 0.0;
+  }
+  state.counters["bodies"] = (double)celestial_information.GetNumberOfSelectedBodies();
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CelestialInformationUpdate)->Arg(1)->Arg(60)->Unit(benchmark::kMicrosecond);
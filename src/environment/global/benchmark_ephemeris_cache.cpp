@@ -0,0 +1,148 @@
+/**
+ * @file benchmark_ephemeris_cache.cpp
+ * @brief Benchmark codes for EphemerisCache class with Google Benchmark
+ * @note The SPICE kernels are loaded with the [CSPICE_KERNELS] section of the initialize file.
+ *       The path of the file is set by the environment variable S2E_BENCHMARK_INI_FILE, and the sample file is used by default.
+ */
+#include <SpiceUsr.h>
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <library/initialize/initialize_file_access.hpp>
+
+#include "ephemeris_cache.hpp"
+#include "spice_ephemeris.hpp"
+
+namespace {
+
+const char* kDefaultIniFile = "../../data/sample/initialize_files/sample_simulation_base.ini";
+const int kBodyIds[] = {10, 301, 499};  //!< SUN, MOON, MARS
+const size_t kNumberOfBodies = 3;
+const double kDuration_s = 30.0 * 86400.0;
+const double kToleranceM = 1.0;
+
+/**
+ * @fn LoadSpiceKernels
+ * @brief Load SPICE kernels only once
+ * @return True when the kernels are loaded
+ */
+bool LoadSpiceKernels() {
+  static int is_loaded = -1;
+  if (is_loaded >= 0) return is_loaded == 1;
+
+  // Return with the error flag instead of aborting the benchmark
+  char action[] = "RETURN";
+  erract_c("SET", 0, action);
+
+  const char* ini_file_env = getenv("S2E_BENCHMARK_INI_FILE");
+  try {
+    IniAccess ini_file(ini_file_env != nullptr ? ini_file_env : kDefaultIniFile);
+    const char* keywords[] = {"tls", "tpc1", "tpc2", "tpc3", "bsp"};
+    for (size_t i = 0; i < 5; i++) {
+      std::string file_name = ini_file.ReadString("CSPICE_KERNELS", keywords[i]);
+      furnsh_c(file_name.c_str());
+    }
+  } catch (const std::runtime_error&) {
+    is_loaded = 0;
+    return false;
+  }
+  is_loaded = failed_c() ? 0 : 1;
+  reset_c();
+  return is_loaded == 1;
+}
+
+/**
+ * @fn GetStartEphemerisTime_s
+ * @brief Return the start ephemeris time of the benchmark
+ */
+double GetStartEphemerisTime_s() {
+  SpiceDouble ephemeris_time_s;
+  str2et_c("2020/01/01 00:00:00 UTC", &ephemeris_time_s);
+  return ephemeris_time_s;
+}
+
+/**
+ * @fn CalcMaxPositionError_m
+ * @brief Calculate the maximum position error of the cache against the direct SPICE call over the 30 days
+ */
+double CalcMaxPositionError_m(const EphemerisInterpolationMethod method, const double step_s) {
+  SpiceEphemeris spice_ephemeris("J2000", "NONE", "EARTH", kNumberOfBodies, kBodyIds);
+  EphemerisCache ephemeris_cache(&spice_ephemeris, kNumberOfBodies, method, 86400.0, kToleranceM);
+  const double start_time_s = GetStartEphemerisTime_s();
+
+  double max_error_m = 0.0;
+  for (double elapsed_time_s = 0.0; elapsed_time_s < kDuration_s; elapsed_time_s += step_s) {
+    for (size_t body = 0; body < kNumberOfBodies; body++) {
+      double reference_km[6], result_km[6];
+      spice_ephemeris.GetState_km(body, start_time_s + elapsed_time_s, reference_km);
+      ephemeris_cache.GetState_km(body, start_time_s + elapsed_time_s, result_km);
+      double error_squared_km2 = 0.0;
+      for (size_t i = 0; i < 3; i++) error_squared_km2 += pow(reference_km[i] - result_km[i], 2.0);
+      max_error_m = std::max(max_error_m, sqrt(error_squared_km2) * 1000.0);
+    }
+  }
+  return max_error_m;
+}
+
+/**
+ * @fn RunSteps
+ * @brief Query all the bodies at each step of the 30 days run
+ */
+void RunSteps(benchmark::State& state, IEphemerisSource& ephemeris, const double step_s) {
+  const double start_time_s = GetStartEphemerisTime_s();
+  double elapsed_time_s = 0.0;
+  double state_km[6];
+  for (auto _ : state) {
+    for (size_t body = 0; body < kNumberOfBodies; body++) {
+      ephemeris.GetState_km(body, start_time_s + elapsed_time_s, state_km);
+      benchmark::DoNotOptimize(state_km);
+    }
+    elapsed_time_s += step_s;
+    if (elapsed_time_s >= kDuration_s) elapsed_time_s = 0.0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmark of the step throughput with the direct SPICE calls
+ */
+static void BM_EphemerisDirect(benchmark::State& state) {
+  if (!LoadSpiceKernels()) {
+    state.SkipWithError("SPICE kernels are not loaded");
+    return;
+  }
+  SpiceEphemeris spice_ephemeris("J2000", "NONE", "EARTH", kNumberOfBodies, kBodyIds);
+  RunSteps(state, spice_ephemeris, (double)state.range(0));
+}
+BENCHMARK(BM_EphemerisDirect)->Arg(1)->Arg(60);
+
+/**
+ * @brief Benchmark of the step throughput with the ephemeris cache and the maximum position error over the 30 days
+ * @note Arguments: interpolation method (0: Chebyshev, 1: Hermite), step [s]
+ */
+static void BM_EphemerisCache(benchmark::State& state) {
+  if (!LoadSpiceKernels()) {
+    state.SkipWithError("SPICE kernels are not loaded");
+    return;
+  }
+  const EphemerisInterpolationMethod method = (EphemerisInterpolationMethod)state.range(0);
+  const double step_s = (double)state.range(1);
+
+  const double max_error_m = CalcMaxPositionError_m(method, std::max(step_s, 60.0));
+  if (max_error_m > kToleranceM) {
+    state.SkipWithError("Position error exceeds the tolerance");
+    return;
+  }
+
+  SpiceEphemeris spice_ephemeris("J2000", "NONE", "EARTH", kNumberOfBodies, kBodyIds);
+  EphemerisCache ephemeris_cache(&spice_ephemeris, kNumberOfBodies, method, 86400.0, kToleranceM);
+  RunSteps(state, ephemeris_cache, step_s);
+  state.counters["max_position_error_m"] = max_error_m;
+  state.counters["spice_calls_per_step"] = (double)ephemeris_cache.GetNumberOfSourceCalls() / (double)state.iterations();
+}
+BENCHMARK(BM_EphemerisCache)->Args({0, 1})->Args({0, 60})->Args({1, 1})->Args({1, 60});
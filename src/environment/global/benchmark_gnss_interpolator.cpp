@@ -0,0 +1,146 @@
+/**
+ * @file benchmark_gnss_interpolator.cpp
+ * @brief Benchmark codes for the GNSS satellite ephemeris interpolation with Google Benchmark
+ * @note The SP3 data of all constellations (GPS, GLONASS, Galileo, BeiDou, and QZSS) are generated with circular orbits.
+ */
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "gnss_interpolator.hpp"
+#include "gnss_satellites.hpp"
+
+namespace {
+
+const double kNodeInterval_s = 900.0;
+const size_t kNumberOfEpochs = 96 * 2;  //!< Two days with 15 minutes interval
+const int kInterpolationNumber = 9;     //!< Same with the sample initialize file
+const double kDuration_s = 86400.0;
+
+/**
+ * @fn GetSatelliteIds
+ * @brief Return SP3 satellite IDs of all constellations
+ */
+std::vector<std::string> GetSatelliteIds() {
+  const char systems[] = {'G', 'R', 'E', 'C', 'J'};
+  const int numbers[] = {32, 26, 36, 16, 7};
+  std::vector<std::string> ids;
+  for (size_t i = 0; i < 5; i++) {
+    for (int number = 1; number <= numbers[i]; number++) {
+      char id[16];
+      snprintf(id, sizeof(id), "%c%02d", systems[i], number);
+      ids.push_back(id);
+    }
+  }
+  return ids;
+}
+
+/**
+ * @fn MakeSp3File
+ * @brief Make SP3 file lines of all constellations on the circular orbits
+ * @param [out] start_unix_time: Unix time of the first epoch
+ */
+std::vector<std::vector<std::string>> MakeSp3File(double& start_unix_time) {
+  const std::vector<std::string> ids = GetSatelliteIds();
+  tm start_tm = {};
+  start_tm.tm_year = 2020 - 1900;
+  start_tm.tm_mday = 1;
+  tm start_tm_copy = start_tm;
+  start_unix_time = (double)mktime(&start_tm_copy);
+
+  std::vector<std::string> lines;
+  char buffer[256];
+  snprintf(buffer, sizeof(buffer), "#cP2020  1  1  0  0  0.00000000 %7zu ORBIT IGS14 HLM  IGS", kNumberOfEpochs);
+  lines.push_back(buffer);
+  snprintf(buffer, sizeof(buffer), "## 2086 259200.00000000 %14.8f 58849 0.0000000000000", kNodeInterval_s);
+  lines.push_back(buffer);
+  snprintf(buffer, sizeof(buffer), "+  %3zu", ids.size());
+  lines.push_back(buffer);
+  for (size_t epoch = 0; epoch < kNumberOfEpochs; epoch++) {
+    tm epoch_tm = start_tm;
+    epoch_tm.tm_sec = (int)(kNodeInterval_s * (double)epoch);
+    mktime(&epoch_tm);
+    snprintf(buffer, sizeof(buffer), "*  %4d %2d %2d %2d %2d %11.8f", epoch_tm.tm_year + 1900, epoch_tm.tm_mon + 1, epoch_tm.tm_mday,
+             epoch_tm.tm_hour, epoch_tm.tm_min, (double)epoch_tm.tm_sec);
+    lines.push_back(buffer);
+    for (size_t s = 0; s < ids.size(); s++) {
+      const double angle_rad = 1.4584e-4 * kNodeInterval_s * (double)epoch + 0.05 * (double)s;
+      snprintf(buffer, sizeof(buffer), "P%s %13.6f %13.6f %13.6f %13.6f", ids[s].c_str(), 26560.0 * cos(angle_rad), 13280.0 * sin(angle_rad),
+               21248.0 * sin(angle_rad), 100.0 + 1.0e-3 * (double)epoch);
+      lines.push_back(buffer);
+    }
+  }
+  return std::vector<std::vector<std::string>>(1, lines);
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmark of the position and clock update of all constellations
+ * @note Argument: step [s]
+ */
+static void BM_GnssSatelliteUpdate(benchmark::State& state) {
+  const double step_s = (double)state.range(0);
+  double start_unix_time;
+  std::vector<std::vector<std::string>> file = MakeSp3File(start_unix_time);
+  GnssSat_Info info;
+  info.Init(file, 1, kInterpolationNumber, kNotUse, file, ".sp3", 3, kNotUse);
+  info.SetUp(start_unix_time + 43200.0, step_s);
+
+  double elapsed_time_s = 0.0;
+  for (auto _ : state) {
+    elapsed_time_s += step_s;
+    if (elapsed_time_s >= kDuration_s) {
+      elapsed_time_s = 0.0;
+      state.PauseTiming();
+      info.SetUp(start_unix_time + 43200.0, step_s);
+      state.ResumeTiming();
+    }
+    info.Update(start_unix_time + 43200.0 + elapsed_time_s);
+    benchmark::DoNotOptimize(info.GetSatellitePositionEci(0));
+  }
+
+  int number_of_valid_satellites = 0;
+  for (int i = 0; i < info.GetNumOfSatellites(); i++) number_of_valid_satellites += info.GetWhetherValid(i) ? 1 : 0;
+  state.counters["valid_satellites"] = number_of_valid_satellites;
+  state.SetItemsProcessed(state.iterations() * info.GetNumOfSatellites());
+}
+BENCHMARK(BM_GnssSatelliteUpdate)->Arg(1)->Arg(10);
+
+/**
+ * @brief Benchmark of the interpolation of all constellations with fixed windows
+ * @note Argument: interpolation method (0: Lagrange, 1: Trigonometric)
+ */
+static void BM_GnssInterpolator(benchmark::State& state) {
+  const GnssInterpolationMethod method = (GnssInterpolationMethod)state.range(0);
+  const size_t number_of_satellites = GetSatelliteIds().size();
+  const size_t number_of_values = 6;
+  GnssInterpolator interpolator;
+  interpolator.Initialize(method, number_of_satellites, kInterpolationNumber, number_of_values);
+
+  std::vector<size_t> targets;
+  for (size_t s = 0; s < number_of_satellites; s++) {
+    std::vector<double> times, values;
+    for (int k = 0; k < kInterpolationNumber; k++) {
+      times.push_back(kNodeInterval_s * (double)k);
+      for (size_t i = 0; i < number_of_values; i++) values.push_back(2.656e7 * sin(1.4584e-4 * times.back() + 0.05 * (double)(s + i)));
+    }
+    interpolator.SetWindow(s, &times[0], &values[0]);
+    targets.push_back(s);
+  }
+
+  std::vector<double> result(number_of_satellites * number_of_values);
+  double time_s = 3.0 * kNodeInterval_s;
+  for (auto _ : state) {
+    interpolator.Interpolate(time_s, targets, &result[0]);
+    benchmark::DoNotOptimize(result.data());
+    time_s += 1.0;
+    if (time_s > 5.0 * kNodeInterval_s) time_s = 3.0 * kNodeInterval_s;
+  }
+  state.SetItemsProcessed(state.iterations() * number_of_satellites);
+}
+BENCHMARK(BM_GnssInterpolator)->Arg(0)->Arg(1);
@@ -0,0 +1,95 @@
+/**
+ * @file benchmark_sky_index.cpp
+ * @brief Benchmark codes for the field of view query of SkyIndex class with Google Benchmark
+ */
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "library/math/constants.hpp"
+#include "sky_index.hpp"
+
+namespace {
+
+const size_t kNumberOfStars = 120000;  // Similar to the Hipparcos catalogue
+const double kHalfAngle_rad = 1.0 * libra::deg_to_rad;
+
+/**
+ * @fn MakeCatalogue
+ * @brief Return right ascension and declination of random stars [rad]
+ */
+std::vector<std::pair<double, double>> MakeCatalogue() {
+  std::mt19937 engine(1);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  std::vector<std::pair<double, double>> catalogue(kNumberOfStars);
+  for (auto& star : catalogue) star = {libra::pi * (uniform(engine) + 1.0), asin(uniform(engine))};
+  return catalogue;
+}
+
+/**
+ * @fn MakeCenters
+ * @brief Return random centers of the queries
+ */
+std::vector<libra::Vector<3>> MakeCenters() {
+  std::mt19937 engine(2);
+  std::normal_distribution<double> normal(0.0, 1.0);
+  std::vector<libra::Vector<3>> centers(64);
+  for (auto& center : centers) {
+    for (size_t k = 0; k < 3; k++) center[k] = normal(engine);
+    center = center.CalcNormalizedVector();
+  }
+  return centers;
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmark of the linear search with the conversion of the right ascension and the declination of every star
+ */
+static void BM_LinearConeSearch(benchmark::State& state) {
+  const std::vector<std::pair<double, double>> catalogue = MakeCatalogue();
+  const std::vector<libra::Vector<3>> centers = MakeCenters();
+  const double cos_half_angle = cos(kHalfAngle_rad);
+  size_t query = 0;
+  std::vector<size_t> indices;
+  for (auto _ : state) {
+    const libra::Vector<3>& center = centers[query++ % centers.size()];
+    indices.clear();
+    for (size_t i = 0; i < catalogue.size(); i++) {
+      libra::Vector<3> direction;
+      direction[0] = cos(catalogue[i].first) * cos(catalogue[i].second);
+      direction[1] = sin(catalogue[i].first) * cos(catalogue[i].second);
+      direction[2] = sin(catalogue[i].second);
+      if (libra::InnerProduct(direction, center) >= cos_half_angle) indices.push_back(i);
+    }
+    benchmark::DoNotOptimize(indices.data());
+  }
+}
+BENCHMARK(BM_LinearConeSearch)->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief Benchmark of the cone query with the sky index
+ * @note Argument: depth of the quadtree
+ */
+static void BM_SkyIndexConeSearch(benchmark::State& state) {
+  const std::vector<std::pair<double, double>> catalogue = MakeCatalogue();
+  std::vector<libra::Vector<3>> directions(catalogue.size());
+  for (size_t i = 0; i < catalogue.size(); i++) {
+    directions[i][0] = cos(catalogue[i].first) * cos(catalogue[i].second);
+    directions[i][1] = sin(catalogue[i].first) * cos(catalogue[i].second);
+    directions[i][2] = sin(catalogue[i].second);
+  }
+  SkyIndex sky_index((size_t)state.range(0));
+  sky_index.Build(directions);
+
+  const std::vector<libra::Vector<3>> centers = MakeCenters();
+  size_t query = 0;
+  std::vector<size_t> indices;
+  for (auto _ : state) {
+    sky_index.FindInCone(centers[query++ % centers.size()], kHalfAngle_rad, indices);
+    benchmark::DoNotOptimize(indices.data());
+  }
+}
+BENCHMARK(BM_SkyIndexConeSearch)->Arg(3)->Arg(5)->Arg(7)->Unit(benchmark::kMicrosecond);
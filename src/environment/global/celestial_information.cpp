@@ -63,6 +63,10 @@ CelestialInformation::CelestialInformation(const std::string inertial_frame_name
 
   // Initialize rotation
   earth_rotation_ = new CelestialRotation(rotation_mode_, center_body_name_);
+
+  // Initialize ephemeris
+  spice_ephemeris_ = new SpiceEphemeris(inertial_frame_name_, aberration_correction_setting_, center_body_name_, number_of_selected_bodies_,
+                                        selected_body_ids_);
 }
 
 CelestialInformation::CelestialInformation(const CelestialInformation& obj)
@@ -89,6 +93,12 @@ CelestialInformation::CelestialInformation(const CelestialInformation& obj)
   memcpy(celestial_body_gravity_constant_m3_s2_, obj.celestial_body_gravity_constant_m3_s2_, size_d * number_of_selected_bodies_);
   memcpy(celestial_body_mean_radius_m_, obj.celestial_body_mean_radius_m_, size_d * number_of_selected_bodies_);
   memcpy(celestial_body_planetographic_radii_m_, obj.celestial_body_planetographic_radii_m_, size_d * num_of_state);
+
+  spice_ephemeris_ = new SpiceEphemeris(inertial_frame_name_, aberration_correction_setting_, center_body_name_, number_of_selected_bodies_,
+                                        selected_body_ids_);
+  if (obj.ephemeris_cache_ != nullptr) {
+    EnableEphemerisCache(obj.ephemeris_cache_->GetMethod(), obj.ephemeris_cache_->GetInitialSegmentLength_s(), obj.ephemeris_cache_->GetTolerance_m());
+  }
 }
 
 CelestialInformation::~CelestialInformation() {
@@ -99,27 +109,21 @@ CelestialInformation::~CelestialInformation() {
   delete[] celestial_body_planetographic_radii_m_;
   delete[] selected_body_ids_;
   delete earth_rotation_;
+  delete ephemeris_cache_;
+  delete spice_ephemeris_;
 }
 
 void CelestialInformation::UpdateAllObjectsInformation(const double current_time_jd) {
   // Convert time
-  SpiceDouble ephemeris_time;
-  std::string julian_date = "jd " + std::to_string(current_time_jd);
-  str2et_c(julian_date.c_str(), &ephemeris_time);
+  const double ephemeris_time_s = SpiceEphemeris::ConvertJulianDateToEphemerisTime_s(current_time_jd);
 
   // Update celestial body orbit
+  IEphemerisSource* ephemeris = spice_ephemeris_;
+  if (ephemeris_cache_ != nullptr) ephemeris = ephemeris_cache_;
   for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
-    SpiceInt planet_id = selected_body_ids_[i];
-
-    // Acquisition of body name from id
-    SpiceBoolean found;
-    const int kMaxNameLength = 100;
-    char name_buffer[kMaxNameLength];
-    bodc2n_c(planet_id, kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
-
     // Acquisition of position and velocity
-    SpiceDouble orbit_buffer_km[6];
-    GetPlanetOrbit(name_buffer, ephemeris_time, (SpiceDouble*)orbit_buffer_km);
+    double orbit_buffer_km[6];
+    ephemeris->GetState_km(i, ephemeris_time_s, orbit_buffer_km);
     // Convert unit [km], [km/s] to [m], [m/s]
     for (int j = 0; j < 3; j++) {
       celestial_body_position_from_center_i_m_[i * 3 + j] = orbit_buffer_km[j] * 1000.0;
@@ -131,6 +135,11 @@ void CelestialInformation::UpdateAllObjectsInformation(const double current_time
   earth_rotation_->Update(current_time_jd);
 }
 
+void CelestialInformation::EnableEphemerisCache(const EphemerisInterpolationMethod method, const double segment_length_s, const double tolerance_m) {
+  delete ephemeris_cache_;
+  ephemeris_cache_ = new EphemerisCache(spice_ephemeris_, number_of_selected_bodies_, method, segment_length_s, tolerance_m);
+}
+
 int CelestialInformation::CalcBodyIdFromName(const char* body_name) const {
   int index = 0;
   SpiceInt planet_id;
@@ -183,18 +192,13 @@ std::string CelestialInformation::GetLogValue() const {
   return str_tmp;
 }
 
-void CelestialInformation::GetPlanetOrbit(const char* planet_name, const double et, double orbit[6]) {
-  // Add `BARYCENTER` if needed
-  std::string planet_name_string = planet_name;
-  if (strcmp(planet_name, "MARS") == 0 || strcmp(planet_name, "JUPITER") == 0 || strcmp(planet_name, "SATURN") == 0 ||
-      strcmp(planet_name, "URANUS") == 0 || strcmp(planet_name, "NEPTUNE") == 0 || strcmp(planet_name, "PLUTO") == 0) {
-    planet_name_string += "_BARYCENTER";
+void CelestialInformation::PushLogValue(LogValueBuffer& buffer) const {
+  for (unsigned int i = 0; i < number_of_selected_bodies_; i++) {
+    for (int j = 0; j < 3; j++) {
+      buffer.Push(celestial_body_position_from_center_i_m_[i * 3 + j]);
+    }
+    for (int j = 0; j < 3; j++) {
+      buffer.Push(celestial_body_velocity_from_center_i_m_s_[i * 3 + j]);
+    }
   }
-
-  // Get orbit
-  SpiceDouble lt;
-  spkezr_c((ConstSpiceChar*)planet_name_string.c_str(), (SpiceDouble)et, (ConstSpiceChar*)inertial_frame_name_.c_str(),
-           (ConstSpiceChar*)aberration_correction_setting_.c_str(), (ConstSpiceChar*)center_body_name_.c_str(), (SpiceDouble*)orbit,
-           (SpiceDouble*)&lt);
-  return;
 }
@@ -10,6 +10,7 @@
 #include "celestial_rotation.hpp"
 #include "library/logger/loggable.hpp"
 #include "library/math/vector.hpp"
+#include "spice_ephemeris.hpp"
 
 /**
  * @class CelestialInformation
@@ -52,6 +53,11 @@ class CelestialInformation : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn PushLogValue
+   * @brief Override PushLogValue function of ILoggable
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const;
 
   /**
    * @fn UpdateAllObjectsInformation
@@ -60,6 +66,15 @@ class CelestialInformation : public ILoggable {
    */
   void UpdateAllObjectsInformation(const double current_time_jd);
 
+  /**
+   * @fn EnableEphemerisCache
+   * @brief Answer the orbit of the bodies by the interpolation of the cached SPICE samples instead of the direct SPICE calls
+   * @param [in] method: Interpolation method
+   * @param [in] segment_length_s: Initial length of the interpolation segment [s]
+   * @param [in] tolerance_m: Tolerance of the position interpolation error [m]
+   */
+  void EnableEphemerisCache(const EphemerisInterpolationMethod method, const double segment_length_s, const double tolerance_m);
+
   // Getters
   // Orbit information
   /**
@@ -212,15 +227,9 @@ class CelestialInformation : public ILoggable {
   CelestialRotation* earth_rotation_;  //!< Instance of Earth rotation
   RotationMode rotation_mode_;         //!< Designation of rotation model
 
-  /**
-   * @fn GetPlanetOrbit
-   * @brief Get position/velocity of planet.
-   * @note This is an override function of SPICE's spkezr_c (https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/spkezr_c.html)
-   * @param [in] planet_name: Nama of planet defined by SPICE
-   * @param [in] et: Ephemeris time
-   * @param [out] orbit: Cartesian state vector representing the position and velocity of the target body relative to the specified observer.
-   */
-  void GetPlanetOrbit(const char* planet_name, const double et, double orbit[6]);
+  // Ephemeris
+  SpiceEphemeris* spice_ephemeris_;            //!< Direct SPICE ephemeris
+  EphemerisCache* ephemeris_cache_ = nullptr;  //!< Ephemeris cache in front of SPICE (nullptr when it is disabled)
 };
 
 #endif  // S2E_ENVIRONMENT_GLOBAL_CELESTIAL_INFORMATION_HPP_
@@ -35,6 +35,25 @@ void ClockGenerator::TickToComponents() {
 
 void ClockGenerator::UpdateComponents(const SimulationTime* simulation_time) {
   if (simulation_time->GetCompoUpdateFlag()) {
+    MultiRateScheduler::ScopedTaskTimer timer(simulation_time->GetScheduler(), (size_t)SimulationTask::kComponent);
     TickToComponents();
   }
 }
+
+void ClockGenerator::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("ClockGenerator");
+  writer.Write(timer_count_);
+  writer.Write((uint64_t)components_.size());
+  for (auto itr = components_.begin(); itr != components_.end(); ++itr) {
+    (*itr)->SaveState(writer);
+  }
+}
+
+void ClockGenerator::LoadState(CheckpointReader& reader) {
+  reader.BeginSection("ClockGenerator");
+  reader.Read(timer_count_);
+  reader.ReadSizeAndCheck(components_.size(), "components");
+  for (auto itr = components_.begin(); itr != components_.end() && reader.IsValid(); ++itr) {
+    (*itr)->LoadState(reader);
+  }
+}
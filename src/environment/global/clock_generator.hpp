@@ -52,6 +52,20 @@ class ClockGenerator {
    */
   inline void ClearTimerCount(void) { timer_count_ = 0; }
 
+  /**
+   * @fn SaveState
+   * @brief Write the timer count and the states of the registered components to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the timer count and the states of the registered components from the checkpoint
+   * @note The components should be registered in the same order as the checkpointed simulation.
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
+
  private:
   std::vector<ITickable*> components_;  //!< Component list fot tick
   unsigned int timer_count_;            //!< Timer count TODO: change to long?
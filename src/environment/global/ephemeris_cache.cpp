@@ -0,0 +1,166 @@
+/**
+ * @file ephemeris_cache.cpp
+ * @brief Cache of celestial body ephemeris with piecewise polynomial interpolation
+ */
+
+#include "ephemeris_cache.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <library/math/constants.hpp>
+
+namespace {
+const size_t kChebyshevNodes = 12;          //!< Number of Chebyshev nodes (polynomial degree + 1)
+const size_t kHermiteNodes = 25;            //!< Number of Hermite nodes including the both ends
+const size_t kMaxRefinements = 10;          //!< Maximum number of the segment halving
+const double kMetersPerKilometer = 1000.0;  //!< Unit conversion
+}  // namespace
+
+EphemerisCache::EphemerisCache(IEphemerisSource* source, const size_t number_of_bodies, const EphemerisInterpolationMethod method,
+                               const double segment_length_s, const double tolerance_m)
+    : source_(source), method_(method), initial_segment_length_s_(segment_length_s), tolerance_m_(tolerance_m) {
+  number_of_nodes_ = (method_ == EphemerisInterpolationMethod::kChebyshev) ? kChebyshevNodes : kHermiteNodes;
+  node_states_km_.assign(number_of_nodes_ * 6, 0.0);
+
+  segments_.resize(number_of_bodies);
+  for (size_t i = 0; i < number_of_bodies; i++) {
+    segments_[i].length_s = segment_length_s;
+    segments_[i].coefficients.assign(number_of_nodes_ * 6, 0.0);
+  }
+  if (segment_length_s <= 0.0 || tolerance_m <= 0.0) {
+    std::cerr << "WARNING: ephemeris cache: segment length and tolerance should be positive. The direct ephemeris is used." << std::endl;
+    for (size_t i = 0; i < number_of_bodies; i++) segments_[i].is_fallback = true;
+  }
+
+  if (method_ == EphemerisInterpolationMethod::kChebyshev) {
+    chebyshev_cos_table_.assign(number_of_nodes_ * number_of_nodes_, 0.0);
+    for (size_t j = 0; j < number_of_nodes_; j++) {
+      for (size_t k = 0; k < number_of_nodes_; k++) {
+        chebyshev_cos_table_[j * number_of_nodes_ + k] = cos(libra::pi * (double)j * ((double)k + 0.5) / (double)number_of_nodes_);
+      }
+    }
+  }
+}
+
+void EphemerisCache::GetState_km(const size_t body_index, const double ephemeris_time_s, double state_km[6]) {
+  const Segment& segment = segments_[body_index];
+  if (!segment.is_fallback) {
+    if (!segment.is_valid || ephemeris_time_s < segment.start_time_s || ephemeris_time_s >= segment.start_time_s + segment.length_s) {
+      UpdateSegment(body_index, ephemeris_time_s);
+    }
+  }
+
+  if (segment.is_fallback) {
+    CallSource(body_index, ephemeris_time_s, state_km);
+  } else {
+    Interpolate(segment, ephemeris_time_s, state_km);
+  }
+}
+
+void EphemerisCache::UpdateSegment(const size_t body_index, const double ephemeris_time_s) {
+  Segment& segment = segments_[body_index];
+  // Every segment is refined from the initial length and aligned to the multiple of the length to make the result independent of the
+  // query history
+  segment.length_s = initial_segment_length_s_;
+  for (size_t i = 0; i <= kMaxRefinements; i++) {
+    segment.start_time_s = floor(ephemeris_time_s / segment.length_s) * segment.length_s;
+    FitSegment(body_index, segment);
+    if (CalcMaxCheckError_km(body_index, segment) * kMetersPerKilometer <= tolerance_m_) {
+      segment.is_valid = true;
+      return;
+    }
+    segment.length_s *= 0.5;
+  }
+
+  std::cerr << "WARNING: ephemeris cache: the tolerance " << tolerance_m_ << " m is not satisfied for the body index " << body_index
+            << ". The direct ephemeris is used for the body." << std::endl;
+  segment.is_valid = false;
+  segment.is_fallback = true;
+}
+
+void EphemerisCache::FitSegment(const size_t body_index, Segment& segment) {
+  const size_t n = number_of_nodes_;
+  if (method_ == EphemerisInterpolationMethod::kChebyshev) {
+    const double half_length_s = 0.5 * segment.length_s;
+    const double center_time_s = segment.start_time_s + half_length_s;
+    for (size_t k = 0; k < n; k++) {
+      // The row j = 1 of the cos table is the Chebyshev nodes
+      const double node = chebyshev_cos_table_[n + k];
+      CallSource(body_index, center_time_s + half_length_s * node, &node_states_km_[k * 6]);
+    }
+    for (size_t j = 0; j < n; j++) {
+      const double* cos_table = &chebyshev_cos_table_[j * n];
+      for (size_t i = 0; i < 6; i++) {
+        double sum = 0.0;
+        for (size_t k = 0; k < n; k++) sum += node_states_km_[k * 6 + i] * cos_table[k];
+        segment.coefficients[j * 6 + i] = (j == 0 ? 1.0 : 2.0) * sum / (double)n;
+      }
+    }
+  } else {
+    const double step_s = segment.length_s / (double)(n - 1);
+    for (size_t k = 0; k < n; k++) {
+      CallSource(body_index, segment.start_time_s + step_s * (double)k, &segment.coefficients[k * 6]);
+    }
+  }
+}
+
+double EphemerisCache::CalcMaxCheckError_km(const size_t body_index, const Segment& segment) {
+  // Chebyshev interpolation has the largest error around the ends, and Hermite interpolation around the middle of the intervals
+  double check_times_s[2];
+  if (method_ == EphemerisInterpolationMethod::kChebyshev) {
+    check_times_s[0] = segment.start_time_s;
+    check_times_s[1] = segment.start_time_s + segment.length_s;
+  } else {
+    const double half_step_s = 0.5 * segment.length_s / (double)(number_of_nodes_ - 1);
+    check_times_s[0] = segment.start_time_s + half_step_s;
+    check_times_s[1] = segment.start_time_s + segment.length_s - half_step_s;
+  }
+
+  double max_error_km = 0.0;
+  for (size_t c = 0; c < 2; c++) {
+    double reference_km[6], interpolated_km[6];
+    CallSource(body_index, check_times_s[c], reference_km);
+    Interpolate(segment, check_times_s[c], interpolated_km);
+    double error_squared_km2 = 0.0;
+    for (size_t i = 0; i < 3; i++) error_squared_km2 += pow(reference_km[i] - interpolated_km[i], 2.0);
+    max_error_km = std::max(max_error_km, sqrt(error_squared_km2));
+  }
+  return max_error_km;
+}
+
+void EphemerisCache::Interpolate(const Segment& segment, const double ephemeris_time_s, double state_km[6]) const {
+  const double* c = &segment.coefficients[0];
+  if (method_ == EphemerisInterpolationMethod::kChebyshev) {
+    // Clenshaw recurrence
+    double tau = 2.0 * (ephemeris_time_s - segment.start_time_s) / segment.length_s - 1.0;
+    tau = std::max(-1.0, std::min(1.0, tau));
+    double b1[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    double b2[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    for (size_t j = number_of_nodes_ - 1; j >= 1; j--) {
+      for (size_t i = 0; i < 6; i++) {
+        const double b0 = 2.0 * tau * b1[i] - b2[i] + c[j * 6 + i];
+        b2[i] = b1[i];
+        b1[i] = b0;
+      }
+    }
+    for (size_t i = 0; i < 6; i++) state_km[i] = tau * b1[i] - b2[i] + c[i];
+  } else {
+    const double step_s = segment.length_s / (double)(number_of_nodes_ - 1);
+    const double s = std::max(0.0, (ephemeris_time_s - segment.start_time_s) / step_s);
+    const size_t k = std::min((size_t)s, number_of_nodes_ - 2);
+    const double u = s - (double)k;
+    const double u2 = u * u;
+    const double u3 = u2 * u;
+    const double* p0 = &c[k * 6];
+    const double* p1 = &c[(k + 1) * 6];
+
+    // Cubic Hermite basis and derivatives
+    const double h00 = 2.0 * u3 - 3.0 * u2 + 1.0, h10 = u3 - 2.0 * u2 + u, h01 = -2.0 * u3 + 3.0 * u2, h11 = u3 - u2;
+    const double d00 = 6.0 * u2 - 6.0 * u, d10 = 3.0 * u2 - 4.0 * u + 1.0, d01 = -6.0 * u2 + 6.0 * u, d11 = 3.0 * u2 - 2.0 * u;
+    for (size_t i = 0; i < 3; i++) {
+      state_km[i] = h00 * p0[i] + h10 * step_s * p0[i + 3] + h01 * p1[i] + h11 * step_s * p1[i + 3];
+      state_km[i + 3] = (d00 * p0[i] + d01 * p1[i]) / step_s + d10 * p0[i + 3] + d11 * p1[i + 3];
+    }
+  }
+}
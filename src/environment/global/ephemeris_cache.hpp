@@ -0,0 +1,170 @@
+/**
+ * @file ephemeris_cache.hpp
+ * @brief Cache of celestial body ephemeris with piecewise polynomial interpolation
+ */
+
+#ifndef S2E_ENVIRONMENT_GLOBAL_EPHEMERIS_CACHE_HPP_
+#define S2E_ENVIRONMENT_GLOBAL_EPHEMERIS_CACHE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class IEphemerisSource
+ * @brief Interface of the ephemeris source which provides the state of the selected bodies
+ */
+class IEphemerisSource {
+ public:
+  /**
+   * @fn ~IEphemerisSource
+   * @brief Destructor
+   */
+  virtual ~IEphemerisSource() {}
+
+  /**
+   * @fn GetState_km
+   * @brief Calculate the position and velocity of the body
+   * @param [in] body_index: Index of the body in the selected body list
+   * @param [in] ephemeris_time_s: Ephemeris time (TDB seconds past J2000) [s]
+   * @param [out] state_km: Position [km] and velocity [km/s]
+   */
+  virtual void GetState_km(const size_t body_index, const double ephemeris_time_s, double state_km[6]) = 0;
+};
+
+/**
+ * @enum EphemerisInterpolationMethod
+ * @brief Interpolation method of the ephemeris cache
+ */
+enum class EphemerisInterpolationMethod {
+  kChebyshev = 0,  //!< Chebyshev polynomial fitted at the Chebyshev nodes of each segment
+  kHermite,        //!< Piecewise cubic Hermite interpolation with the position and velocity at equally spaced nodes
+};
+
+/**
+ * @class EphemerisCache
+ * @brief Cache of celestial body ephemeris with piecewise polynomial interpolation
+ * @details The source is sampled once per segment and the queries in the segment are answered by polynomial evaluation.
+ *          The interpolation error of each segment is checked with additional samples. When the error exceeds the tolerance, the segment
+ *          is halved. Each new segment starts from the initial length, so the result does not depend on the query history. When the tolerance cannot be satisfied, the body falls back to the direct source call.
+ */
+class EphemerisCache : public IEphemerisSource {
+ public:
+  /**
+   * @fn EphemerisCache
+   * @brief Constructor
+   * @param [in] source: Ephemeris source to be sampled (The instance is not owned)
+   * @param [in] number_of_bodies: Number of bodies
+   * @param [in] method: Interpolation method
+   * @param [in] segment_length_s: Initial length of the interpolation segment [s]
+   * @param [in] tolerance_m: Tolerance of the position interpolation error [m]
+   */
+  EphemerisCache(IEphemerisSource* source, const size_t number_of_bodies, const EphemerisInterpolationMethod method, const double segment_length_s,
+                 const double tolerance_m);
+
+  /**
+   * @fn GetState_km
+   * @brief Calculate the position and velocity of the body with the cached segment
+   * @param [in] body_index: Index of the body in the selected body list
+   * @param [in] ephemeris_time_s: Ephemeris time (TDB seconds past J2000) [s]
+   * @param [out] state_km: Position [km] and velocity [km/s]
+   */
+  void GetState_km(const size_t body_index, const double ephemeris_time_s, double state_km[6]) override;
+
+  // Getters
+  /**
+   * @fn GetMethod
+   * @brief Return interpolation method
+   */
+  inline EphemerisInterpolationMethod GetMethod() const { return method_; }
+  /**
+   * @fn GetInitialSegmentLength_s
+   * @brief Return initial length of the interpolation segment [s]
+   */
+  inline double GetInitialSegmentLength_s() const { return initial_segment_length_s_; }
+  /**
+   * @fn GetTolerance_m
+   * @brief Return tolerance of the position interpolation error [m]
+   */
+  inline double GetTolerance_m() const { return tolerance_m_; }
+  /**
+   * @fn GetSegmentLength_s
+   * @brief Return current length of the interpolation segment of the body [s]
+   * @param [in] body_index: Index of the body in the selected body list
+   */
+  inline double GetSegmentLength_s(const size_t body_index) const { return segments_[body_index].length_s; }
+  /**
+   * @fn IsFallback
+   * @brief Return true when the body falls back to the direct source call
+   * @param [in] body_index: Index of the body in the selected body list
+   */
+  inline bool IsFallback(const size_t body_index) const { return segments_[body_index].is_fallback; }
+  /**
+   * @fn GetNumberOfSourceCalls
+   * @brief Return number of the source calls including the fitting and the fallback
+   */
+  inline size_t GetNumberOfSourceCalls() const { return number_of_source_calls_; }
+
+ private:
+  /**
+   * @struct Segment
+   * @brief Interpolation segment of a body
+   */
+  struct Segment {
+    double start_time_s = 0.0;         //!< Start ephemeris time of the segment [s]
+    double length_s = 0.0;             //!< Length of the segment [s]
+    bool is_valid = false;             //!< Whether the coefficients are available or not
+    bool is_fallback = false;          //!< Whether the body falls back to the direct source call or not
+    std::vector<double> coefficients;  //!< Chebyshev coefficients or Hermite node states aligned by node with 6 elements
+  };
+
+  IEphemerisSource* source_;                 //!< Ephemeris source
+  EphemerisInterpolationMethod method_;      //!< Interpolation method
+  double initial_segment_length_s_;          //!< Initial length of the interpolation segment [s]
+  double tolerance_m_;                       //!< Tolerance of the position interpolation error [m]
+  size_t number_of_nodes_;                   //!< Number of sampling nodes in a segment
+  std::vector<Segment> segments_;            //!< Interpolation segments of the bodies
+  std::vector<double> node_states_km_;       //!< Scratch memory for the sampled states
+  std::vector<double> chebyshev_cos_table_;  //!< Table of cos(pi * j * (k + 0.5) / N) for the Chebyshev fitting
+  size_t number_of_source_calls_ = 0;        //!< Number of the source calls
+
+  /**
+   * @fn UpdateSegment
+   * @brief Fit the segment including the ephemeris time and check the interpolation error
+   * @param [in] body_index: Index of the body in the selected body list
+   * @param [in] ephemeris_time_s: Ephemeris time (TDB seconds past J2000) [s]
+   */
+  void UpdateSegment(const size_t body_index, const double ephemeris_time_s);
+  /**
+   * @fn FitSegment
+   * @brief Sample the source and calculate the coefficients of the segment
+   * @param [in] body_index: Index of the body in the selected body list
+   * @param [in/out] segment: Segment whose start time and length are set
+   */
+  void FitSegment(const size_t body_index, Segment& segment);
+  /**
+   * @fn CalcMaxCheckError_km
+   * @brief Calculate the maximum position interpolation error at the check points of the segment
+   * @param [in] body_index: Index of the body in the selected body list
+   * @param [in] segment: Fitted segment
+   * @return Maximum position error [km]
+   */
+  double CalcMaxCheckError_km(const size_t body_index, const Segment& segment);
+  /**
+   * @fn Interpolate
+   * @brief Evaluate the interpolation polynomial of the segment
+   * @param [in] segment: Fitted segment
+   * @param [in] ephemeris_time_s: Ephemeris time (TDB seconds past J2000) [s]
+   * @param [out] state_km: Position [km] and velocity [km/s]
+   */
+  void Interpolate(const Segment& segment, const double ephemeris_time_s, double state_km[6]) const;
+  /**
+   * @fn CallSource
+   * @brief Call the source with counting
+   */
+  inline void CallSource(const size_t body_index, const double ephemeris_time_s, double state_km[6]) {
+    number_of_source_calls_++;
+    source_->GetState_km(body_index, ephemeris_time_s, state_km);
+  }
+};
+
+#endif  // S2E_ENVIRONMENT_GLOBAL_EPHEMERIS_CACHE_HPP_
@@ -8,6 +8,7 @@
 #include "initialize_global_environment.hpp"
 #include "initialize_gnss_satellites.hpp"
 #include "library/initialize/initialize_file_access.hpp"
+#include "library/utilities/profiler.hpp"
 
 GlobalEnvironment::GlobalEnvironment(const SimulationConfiguration* simulation_configuration) { Initialize(simulation_configuration); }
 
@@ -35,6 +36,7 @@ void GlobalEnvironment::Initialize(const SimulationConfiguration* simulation_con
 }
 
 void GlobalEnvironment::Update() {
+  S2E_PROFILE_SCOPE("GlobalEnvironment::Update");
   simulation_time_->UpdateTime();
   celestial_information_->UpdateAllObjectsInformation(simulation_time_->GetCurrentTime_jd());
   gnss_satellites_->Update(simulation_time_);
@@ -46,3 +48,16 @@ void GlobalEnvironment::LogSetup(Logger& logger) {
 }
 
 void GlobalEnvironment::Reset(void) { simulation_time_->ResetClock(); }
+
+void GlobalEnvironment::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("GlobalEnvironment");
+  simulation_time_->SaveState(writer);
+}
+
+void GlobalEnvironment::LoadState(CheckpointReader& reader) {
+  reader.BeginSection("GlobalEnvironment");
+  simulation_time_->LoadState(reader);
+  if (!reader.IsValid()) return;
+  celestial_information_->UpdateAllObjectsInformation(simulation_time_->GetCurrentTime_jd());
+  gnss_satellites_->Update(simulation_time_);
+}
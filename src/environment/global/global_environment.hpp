@@ -10,6 +10,7 @@
 #include "gnss_satellites.hpp"
 #include "hipparcos_catalogue.hpp"
 #include "library/logger/logger.hpp"
+#include "library/utilities/checkpoint.hpp"
 #include "simulation/simulation_configuration.hpp"
 #include "simulation_time.hpp"
 
@@ -53,6 +54,19 @@ class GlobalEnvironment {
    */
   void Reset(void);
 
+  /**
+   * @fn SaveState
+   * @brief Write the state of the global environment to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the state of the global environment from the checkpoint. The celestial information is recalculated at the restored time.
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
+
   // Getter
   /**
    * @fn GetSimulationTime
@@ -0,0 +1,115 @@
+/**
+ * @file gnss_interpolator.cpp
+ * @brief Batched barycentric interpolation of GNSS satellite ephemeris
+ */
+
+#include "gnss_interpolator.hpp"
+
+#include <cmath>
+#include <library/math/constants.hpp>
+
+const double GnssInterpolator::kTrigonometricAngularVelocity_rad_s = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;
+
+void GnssInterpolator::Initialize(const GnssInterpolationMethod method, const size_t number_of_satellites, const size_t number_of_nodes,
+                                  const size_t number_of_values) {
+  method_ = method;
+  number_of_nodes_ = number_of_nodes;
+  number_of_values_ = number_of_values;
+
+  is_window_set_.assign(number_of_satellites, false);
+  reference_time_s_.assign(number_of_satellites, 0.0);
+  node_sin_.assign(number_of_satellites * number_of_nodes, 0.0);
+  node_cos_.assign(number_of_satellites * number_of_nodes, 0.0);
+  barycentric_weight_.assign(number_of_satellites * number_of_nodes, 0.0);
+  node_values_.assign(number_of_satellites * number_of_nodes * number_of_values, 0.0);
+}
+
+void GnssInterpolator::SetWindow(const size_t satellite_id, const double* node_times_s, const double* node_values) {
+  const size_t n = number_of_nodes_;
+  double* a = &node_cos_[satellite_id * n];
+  double* b = &node_sin_[satellite_id * n];
+  double* w = &barycentric_weight_[satellite_id * n];
+
+  // Node times are expressed from the first node to keep the precision of the unix time
+  reference_time_s_[satellite_id] = node_times_s[0];
+  for (size_t k = 0; k < n; k++) {
+    const double offset_s = node_times_s[k] - node_times_s[0];
+    if (method_ == GnssInterpolationMethod::kTrigonometric) {
+      const double half_angle_rad = 0.5 * kTrigonometricAngularVelocity_rad_s * offset_s;
+      a[k] = cos(half_angle_rad);
+      b[k] = sin(half_angle_rad);
+    } else {
+      a[k] = 1.0;
+      b[k] = offset_s;
+    }
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    double denominator = 1.0;
+    for (size_t j = 0; j < n; j++) {
+      if (i == j) continue;
+      const double difference_s = node_times_s[i] - node_times_s[j];
+      if (method_ == GnssInterpolationMethod::kTrigonometric) {
+        denominator *= sin(0.5 * kTrigonometricAngularVelocity_rad_s * difference_s);
+      } else {
+        denominator *= difference_s;
+      }
+    }
+    w[i] = 1.0 / denominator;
+  }
+
+  const size_t window_size = n * number_of_values_;
+  double* values = &node_values_[satellite_id * window_size];
+  for (size_t i = 0; i < window_size; i++) values[i] = node_values[i];
+
+  is_window_set_[satellite_id] = true;
+}
+
+void GnssInterpolator::Interpolate(const size_t satellite_id, const double time_s, double* values) const {
+  const size_t n = number_of_nodes_;
+  const size_t m = number_of_values_;
+  const double* a = &node_cos_[satellite_id * n];
+  const double* b = &node_sin_[satellite_id * n];
+  const double* w = &barycentric_weight_[satellite_id * n];
+  const double* y = &node_values_[satellite_id * n * m];
+
+  double p, q;
+  CalcQueryCoefficients(time_s - reference_time_s_[satellite_id], p, q);
+
+  double node_polynomial = 1.0;
+  for (size_t k = 0; k < n; k++) node_polynomial *= p * a[k] - q * b[k];
+
+  if (node_polynomial == 0.0) {
+    // The query time is exactly on a node
+    for (size_t k = 0; k < n; k++) {
+      if (p * a[k] - q * b[k] != 0.0) continue;
+      for (size_t j = 0; j < m; j++) values[j] = y[k * m + j];
+      return;
+    }
+  }
+
+  for (size_t j = 0; j < m; j++) values[j] = 0.0;
+  for (size_t k = 0; k < n; k++) {
+    const double coefficient = w[k] / (p * a[k] - q * b[k]);
+    for (size_t j = 0; j < m; j++) values[j] += coefficient * y[k * m + j];
+  }
+  for (size_t j = 0; j < m; j++) values[j] *= node_polynomial;
+}
+
+void GnssInterpolator::Interpolate(const double time_s, const std::vector<size_t>& satellite_ids, double* values) const {
+  for (const size_t satellite_id : satellite_ids) {
+    Interpolate(satellite_id, time_s, &values[satellite_id * number_of_values_]);
+  }
+}
+
+void GnssInterpolator::CalcQueryCoefficients(const double elapsed_time_s, double& p, double& q) const {
+  if (method_ == GnssInterpolationMethod::kTrigonometric) {
+    // sin(theta - theta_k) = sin(theta) * cos(theta_k) - cos(theta) * sin(theta_k)
+    const double half_angle_rad = 0.5 * kTrigonometricAngularVelocity_rad_s * elapsed_time_s;
+    p = sin(half_angle_rad);
+    q = cos(half_angle_rad);
+  } else {
+    p = elapsed_time_s;
+    q = 1.0;
+  }
+}
@@ -0,0 +1,129 @@
+/**
+ * @file gnss_interpolator.hpp
+ * @brief Batched barycentric interpolation of GNSS satellite ephemeris
+ */
+
+#ifndef S2E_ENVIRONMENT_GLOBAL_GNSS_INTERPOLATOR_HPP_
+#define S2E_ENVIRONMENT_GLOBAL_GNSS_INTERPOLATOR_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @enum GnssInterpolationMethod
+ * @brief Interpolation method of the GNSS satellite ephemeris
+ */
+enum class GnssInterpolationMethod {
+  kLagrange = 0,   //!< Lagrange polynomial interpolation
+  kTrigonometric,  //!< Trigonometric interpolation (Ref: http://acc.igs.org/orbits/orbit-interp_gpssoln03.pdf)
+};
+
+/**
+ * @class GnssInterpolator
+ * @brief Batched barycentric interpolation of GNSS satellite ephemeris
+ * @details Each satellite has an interpolation window of the fixed number of nodes. The barycentric weights of the window are calculated once when
+ *          the window is set, and a query is evaluated in O(n) with the first form of the barycentric formula,
+ *          f(t) = l(t) * sum_k w_k * y_k / d_k(t) with l(t) = prod_k d_k(t),
+ *          where d_k(t) = t - t_k for Lagrange and d_k(t) = sin(omega * (t - t_k) / 2) for Trigonometric interpolation.
+ *          The trigonometric node distances are calculated with the angle addition theorem, so a query needs only one sin and cos evaluation.
+ *          The node data of all satellites are stored in flat arrays aligned by satellite.
+ */
+class GnssInterpolator {
+ public:
+  /**
+   * @fn GnssInterpolator
+   * @brief Default constructor
+   */
+  GnssInterpolator() {}
+
+  /**
+   * @fn Initialize
+   * @brief Allocate the windows of all satellites and invalidate them
+   * @param [in] method: Interpolation method
+   * @param [in] number_of_satellites: Number of satellites
+   * @param [in] number_of_nodes: Number of nodes in a window
+   * @param [in] number_of_values: Number of interpolated values per node (ex. 3 for a position)
+   */
+  void Initialize(const GnssInterpolationMethod method, const size_t number_of_satellites, const size_t number_of_nodes,
+                  const size_t number_of_values);
+
+  /**
+   * @fn SetWindow
+   * @brief Set the window of the satellite and precompute the barycentric weights
+   * @param [in] satellite_id: Satellite index
+   * @param [in] node_times_s: Times of the nodes [s] (number_of_nodes elements, without duplication)
+   * @param [in] node_values: Values of the nodes aligned by node (number_of_nodes * number_of_values elements)
+   */
+  void SetWindow(const size_t satellite_id, const double* node_times_s, const double* node_values);
+  /**
+   * @fn InvalidateWindow
+   * @brief Invalidate the window of the satellite
+   * @param [in] satellite_id: Satellite index
+   */
+  inline void InvalidateWindow(const size_t satellite_id) { is_window_set_[satellite_id] = false; }
+
+  /**
+   * @fn Interpolate
+   * @brief Interpolate the values of a satellite
+   * @param [in] satellite_id: Satellite index whose window is set
+   * @param [in] time_s: Query time [s]
+   * @param [out] values: Interpolated values (number_of_values elements)
+   */
+  void Interpolate(const size_t satellite_id, const double time_s, double* values) const;
+  /**
+   * @fn Interpolate
+   * @brief Interpolate the values of the listed satellites at the same time
+   * @param [in] time_s: Query time [s]
+   * @param [in] satellite_ids: Satellite indices whose windows are set
+   * @param [out] values: Interpolated values aligned by satellite index. The values of the satellite i are stored from values[i * number_of_values].
+   */
+  void Interpolate(const double time_s, const std::vector<size_t>& satellite_ids, double* values) const;
+
+  // Getters
+  /**
+   * @fn IsWindowSet
+   * @brief Return true when the window of the satellite is set
+   * @param [in] satellite_id: Satellite index
+   */
+  inline bool IsWindowSet(const size_t satellite_id) const { return is_window_set_[satellite_id]; }
+  /**
+   * @fn GetMethod
+   * @brief Return interpolation method
+   */
+  inline GnssInterpolationMethod GetMethod() const { return method_; }
+  /**
+   * @fn GetNumberOfNodes
+   * @brief Return number of nodes in a window
+   */
+  inline size_t GetNumberOfNodes() const { return number_of_nodes_; }
+  /**
+   * @fn GetNumberOfValues
+   * @brief Return number of interpolated values per node
+   */
+  inline size_t GetNumberOfValues() const { return number_of_values_; }
+
+  static const double kTrigonometricAngularVelocity_rad_s;  //!< Angular velocity of the trigonometric basis (a little faster than a day) [rad/s]
+
+ private:
+  GnssInterpolationMethod method_ = GnssInterpolationMethod::kTrigonometric;  //!< Interpolation method
+  size_t number_of_nodes_ = 0;                                                //!< Number of nodes in a window
+  size_t number_of_values_ = 0;                                               //!< Number of interpolated values per node
+
+  std::vector<bool> is_window_set_;         //!< Whether the window is set or not for each satellite
+  std::vector<double> reference_time_s_;    //!< Reference time of the window (time of the first node) for each satellite [s]
+  std::vector<double> node_sin_;            //!< Node coefficient b_k of the distance d_k = p * a_k - q * b_k aligned by satellite
+  std::vector<double> node_cos_;            //!< Node coefficient a_k of the distance d_k = p * a_k - q * b_k aligned by satellite
+  std::vector<double> barycentric_weight_;  //!< Barycentric weights aligned by satellite
+  std::vector<double> node_values_;         //!< Node values aligned by satellite and node
+
+  /**
+   * @fn CalcQueryCoefficients
+   * @brief Calculate the query coefficients p and q of the node distance d_k = p * a_k - q * b_k
+   * @param [in] elapsed_time_s: Query time from the reference time of the window [s]
+   * @param [out] p: Query coefficient p
+   * @param [out] q: Query coefficient q
+   */
+  void CalcQueryCoefficients(const double elapsed_time_s, double& p, double& q) const;
+};
+
+#endif  // S2E_ENVIRONMENT_GLOBAL_GNSS_INTERPOLATOR_HPP_
@@ -0,0 +1,128 @@
+/**
+ * @file gnss_product_cache.cpp
+ * @brief Binary cache of parsed GNSS product files (SP3 and clock)
+ */
+
+#include "gnss_product_cache.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <system_error>
+
+namespace {
+const char kMagic[8] = {'S', '2', 'E', 'G', 'N', 'S', 'S', '\0'};  //!< Magic number of the cache file
+const size_t kAlignment = 8;                                       //!< Alignment of the blocks [byte]
+
+/**
+ * @fn PaddedSize
+ * @brief Return the size rounded up to the alignment
+ */
+size_t PaddedSize(const size_t size) { return (size + kAlignment - 1) / kAlignment * kAlignment; }
+}  // namespace
+
+bool GnssProductCache::Open(const std::string& file_path, const std::string& signature) {
+  header_ = nullptr;
+  if (!file_.Open(file_path)) return false;
+
+  const unsigned char* data = file_.GetData();
+  const size_t file_size = file_.GetSize();
+  if (file_size < sizeof(Header)) return false;
+  const Header* header = reinterpret_cast<const Header*>(data);
+  if (memcmp(header->magic, kMagic, sizeof(kMagic)) != 0 || header->version != kFormatVersion) return false;
+
+  // Signature
+  size_t position = sizeof(Header);
+  if (header->signature_length != signature.size() || position + PaddedSize(signature.size()) > file_size) return false;
+  if (memcmp(data + position, signature.data(), signature.size()) != 0) return false;
+  position += PaddedSize(signature.size());
+
+  // Index and tables
+  const size_t index_size = (size_t)header->number_of_satellites * 2 * sizeof(uint64_t);
+  if (position + index_size > file_size) return false;
+  const uint64_t* index = reinterpret_cast<const uint64_t*>(data + position);
+  position += index_size;
+  uint64_t number_of_epochs = 0;
+  for (size_t i = 0; i < header->number_of_satellites; i++) {
+    if (index[i * 2] != number_of_epochs) return false;
+    number_of_epochs += index[i * 2 + 1];
+  }
+  const size_t table_size = (size_t)number_of_epochs * (1 + header->number_of_values) * sizeof(double);
+  if (position + table_size != file_size) return false;
+
+  header_ = header;
+  index_ = index;
+  unix_times_ = reinterpret_cast<const double*>(data + position);
+  values_ = unix_times_ + number_of_epochs;
+  return true;
+}
+
+bool GnssProductCache::Write(const std::string& file_path, const std::string& signature, const size_t number_of_values, const double time_interval_s,
+                             const std::pair<double, double> unix_time_period, const std::vector<std::vector<double>>& unix_times,
+                             const std::vector<std::vector<double>>& values) {
+  Header header;
+  memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kFormatVersion;
+  header.number_of_values = (uint32_t)number_of_values;
+  header.number_of_satellites = (uint32_t)unix_times.size();
+  header.signature_length = (uint32_t)signature.size();
+  header.time_interval_s = time_interval_s;
+  header.start_unix_time_s = unix_time_period.first;
+  header.end_unix_time_s = unix_time_period.second;
+
+  std::vector<uint64_t> index;
+  uint64_t number_of_epochs = 0;
+  for (size_t i = 0; i < unix_times.size(); i++) {
+    if (values[i].size() != unix_times[i].size() * number_of_values) return false;
+    index.push_back(number_of_epochs);
+    index.push_back(unix_times[i].size());
+    number_of_epochs += unix_times[i].size();
+  }
+
+  // Write to a temporary file and rename it, so that the other processes never read a partially written file
+  std::error_code error;
+  std::filesystem::path path(file_path);
+  if (path.has_parent_path()) std::filesystem::create_directories(path.parent_path(), error);
+  const std::string temporary_path = file_path + ".tmp" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+  {
+    std::ofstream file(temporary_path, std::ios::binary);
+    if (!file.is_open()) return false;
+    const char padding[kAlignment] = {};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    file.write(signature.data(), signature.size());
+    file.write(padding, PaddedSize(signature.size()) - signature.size());
+    file.write(reinterpret_cast<const char*>(index.data()), index.size() * sizeof(uint64_t));
+    for (const auto& satellite_unix_times : unix_times) {
+      file.write(reinterpret_cast<const char*>(satellite_unix_times.data()), satellite_unix_times.size() * sizeof(double));
+    }
+    for (const auto& satellite_values : values) {
+      file.write(reinterpret_cast<const char*>(satellite_values.data()), satellite_values.size() * sizeof(double));
+    }
+    if (!file) {
+      file.close();
+      std::filesystem::remove(temporary_path, error);
+      return false;
+    }
+  }
+  std::filesystem::rename(temporary_path, file_path, error);
+  if (error) {
+    std::filesystem::remove(temporary_path, error);
+    return false;
+  }
+  return true;
+}
+
+std::string GnssProductCache::MakeSourceSignature(const std::vector<std::string>& file_paths) {
+  std::ostringstream signature;
+  for (const auto& file_path : file_paths) {
+    std::error_code error;
+    const auto file_size = std::filesystem::file_size(file_path, error);
+    if (error) return "";
+    const auto write_time = std::filesystem::last_write_time(file_path, error);
+    if (error) return "";
+    signature << file_path << '|' << file_size << '|' << write_time.time_since_epoch().count() << '\n';
+  }
+  return signature.str();
+}
@@ -0,0 +1,134 @@
+/**
+ * @file gnss_product_cache.hpp
+ * @brief Binary cache of parsed GNSS product files (SP3 and clock)
+ */
+
+#ifndef S2E_ENVIRONMENT_GLOBAL_GNSS_PRODUCT_CACHE_HPP_
+#define S2E_ENVIRONMENT_GLOBAL_GNSS_PRODUCT_CACHE_HPP_
+
+#include <cstdint>
+#include <library/utilities/memory_mapped_file.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @class GnssProductCache
+ * @brief Binary cache of parsed GNSS product files (SP3 and clock)
+ * @details The cache file is memory mapped and the tables are read without parsing.
+ *          File layout (native byte order, every block is aligned to 8 bytes)
+ *          - Header: magic "S2EGNSS" + '\0' (8 bytes), version (uint32), number of values per epoch (uint32), number of satellites (uint32),
+ *                    signature length (uint32), time interval [s] (float64), start and end unix time of the product [s] (float64 x 2)
+ *          - Signature: char array without '\0', padded to 8 bytes
+ *          - Index: for each satellite, offset of the first epoch in the tables (uint64) and number of epochs (uint64)
+ *          - Tables: unix times of all epochs (float64), then values of all epochs aligned by epoch (float64)
+ *          The signature consists of the path, size, and modification time of the source files and the parse options,
+ *          so the cache is regarded as stale when the source files are changed.
+ */
+class GnssProductCache {
+ public:
+  /**
+   * @fn GnssProductCache
+   * @brief Default constructor
+   */
+  GnssProductCache() {}
+
+  /**
+   * @fn Open
+   * @brief Map the cache file and check the signature
+   * @param [in] file_path: Path to the cache file
+   * @param [in] signature: Expected signature
+   * @return True when the cache file is available and matches the signature
+   */
+  bool Open(const std::string& file_path, const std::string& signature);
+
+  /**
+   * @fn Write
+   * @brief Write the parsed tables to the cache file
+   * @param [in] file_path: Path to the cache file
+   * @param [in] signature: Signature of the source files and the parse options
+   * @param [in] number_of_values: Number of values per epoch
+   * @param [in] time_interval_s: Time interval of the product [s]
+   * @param [in] unix_time_period: Start and end unix time of the product [s]
+   * @param [in] unix_times: Unix times of the epochs for each satellite [s]
+   * @param [in] values: Values aligned by epoch for each satellite
+   * @return True when the file is written
+   */
+  static bool Write(const std::string& file_path, const std::string& signature, const size_t number_of_values, const double time_interval_s,
+                    const std::pair<double, double> unix_time_period, const std::vector<std::vector<double>>& unix_times,
+                    const std::vector<std::vector<double>>& values);
+
+  /**
+   * @fn MakeSourceSignature
+   * @brief Make the signature of the source files with the path, size, and modification time
+   * @param [in] file_paths: Paths to the source files
+   * @return Signature. An empty string is returned when a file is not found.
+   */
+  static std::string MakeSourceSignature(const std::vector<std::string>& file_paths);
+
+  // Getters
+  /**
+   * @fn GetNumberOfSatellites
+   * @brief Return number of satellites
+   */
+  inline size_t GetNumberOfSatellites() const { return header_->number_of_satellites; }
+  /**
+   * @fn GetNumberOfValues
+   * @brief Return number of values per epoch
+   */
+  inline size_t GetNumberOfValues() const { return header_->number_of_values; }
+  /**
+   * @fn GetTimeInterval_s
+   * @brief Return time interval of the product [s]
+   */
+  inline double GetTimeInterval_s() const { return header_->time_interval_s; }
+  /**
+   * @fn GetUnixTimePeriod
+   * @brief Return start and end unix time of the product [s]
+   */
+  inline std::pair<double, double> GetUnixTimePeriod() const { return std::make_pair(header_->start_unix_time_s, header_->end_unix_time_s); }
+  /**
+   * @fn GetNumberOfEpochs
+   * @brief Return number of epochs of the satellite
+   * @param [in] satellite_id: Satellite index
+   */
+  inline size_t GetNumberOfEpochs(const size_t satellite_id) const { return (size_t)index_[satellite_id * 2 + 1]; }
+  /**
+   * @fn GetUnixTimes
+   * @brief Return head address of the unix times of the satellite [s]
+   * @param [in] satellite_id: Satellite index
+   */
+  inline const double* GetUnixTimes(const size_t satellite_id) const { return unix_times_ + index_[satellite_id * 2]; }
+  /**
+   * @fn GetValues
+   * @brief Return head address of the values of the satellite
+   * @param [in] satellite_id: Satellite index
+   */
+  inline const double* GetValues(const size_t satellite_id) const { return values_ + index_[satellite_id * 2] * header_->number_of_values; }
+
+  static const uint32_t kFormatVersion = 1;  //!< Version of the file format
+
+ private:
+  /**
+   * @struct Header
+   * @brief File header
+   */
+  struct Header {
+    char magic[8];                  //!< Magic number
+    uint32_t version;               //!< Version of the file format
+    uint32_t number_of_values;      //!< Number of values per epoch
+    uint32_t number_of_satellites;  //!< Number of satellites
+    uint32_t signature_length;      //!< Length of the signature
+    double time_interval_s;         //!< Time interval of the product [s]
+    double start_unix_time_s;       //!< Start unix time of the product [s]
+    double end_unix_time_s;         //!< End unix time of the product [s]
+  };
+
+  MemoryMappedFile file_;               //!< Mapped cache file
+  const Header* header_ = nullptr;      //!< File header
+  const uint64_t* index_ = nullptr;     //!< Index of the satellites
+  const double* unix_times_ = nullptr;  //!< Unix times of all epochs [s]
+  const double* values_ = nullptr;      //!< Values of all epochs
+};
+
+#endif  // S2E_ENVIRONMENT_GLOBAL_GNSS_PRODUCT_CACHE_HPP_
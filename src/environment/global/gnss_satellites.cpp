@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "environment/global/physical_constants.hpp"
+#include "gnss_product_cache.hpp"
 #include "library/external/sgp4/sgp4ext.h"   //for jday()
 #include "library/external/sgp4/sgp4unit.h"  //for gstime()
 #include "library/logger/log_utility.hpp"
@@ -81,79 +82,6 @@ double get_unixtime_from_timestamp_line(std::vector<string>& s) {
   return unix_time;
 }
 
-template <size_t N>
-libra::Vector<N> GnssSat_coordinate::TrigonometricInterpolation(const vector<double>& time_vector, const vector<libra::Vector<N>>& values,
-                                                                double time) const {
-  int n = time_vector.size();
-  double w = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;  // coefficient of a day long
-  libra::Vector<N> res(0.0);
-
-  for (int i = 0; i < n; ++i) {
-    double t_k = 1.0;
-    for (int j = 0; j < n; ++j) {
-      if (i == j) continue;
-      t_k *= sin(w * (time - time_vector.at(j)) / 2.0) / sin(w * (time_vector.at(i) - time_vector.at(j)) / 2.0);
-    }
-    for (int j = 0; j < (int)N; ++j) {
-      res(j) += t_k * values.at(i)(j);
-    }
-  }
-
-  return res;
-}
-
-double GnssSat_coordinate::TrigonometricInterpolation(const vector<double>& time_vector, const vector<double>& values, double time) const {
-  int n = time_vector.size();
-  double w = libra::tau / (24.0 * 60.0 * 60.0) * 1.03;  // coefficient of a day long
-  double res = 0.0;
-
-  for (int i = 0; i < n; ++i) {
-    double t_k = 1.0;
-    for (int j = 0; j < n; ++j) {
-      if (i == j) continue;
-      t_k *= sin(w * (time - time_vector.at(j)) / 2.0) / sin(w * (time_vector.at(i) - time_vector.at(j)) / 2.0);
-    }
-    res += t_k * values.at(i);
-  }
-
-  return res;
-}
-
-template <size_t N>
-libra::Vector<N> GnssSat_coordinate::LagrangeInterpolation(const vector<double>& time_vector, const vector<libra::Vector<N>>& values,
-                                                           double time) const {
-  int n = time_vector.size();
-  libra::Vector<N> res(0.0);
-
-  for (int i = 0; i < n; ++i) {
-    double l_i = 1.0;
-    for (int j = 0; j < n; ++j) {
-      if (i == j) continue;
-      l_i *= (time - time_vector.at(j)) / (time_vector.at(i) - time_vector.at(j));
-    }
-    for (int j = 0; j < N; ++j) {
-      res(j) += l_i * values.at(i)(j);
-    }
-  }
-
-  return res;
-}
-
-double GnssSat_coordinate::LagrangeInterpolation(const vector<double>& time_vector, const vector<double>& values, double time) const {
-  int n = time_vector.size();
-  double res = 0.0;
-  for (int i = 0; i < n; ++i) {
-    double l_i = 1.0;
-    for (int j = 0; j < n; ++j) {
-      if (i == j) continue;
-      l_i *= (time - time_vector.at(j)) / (time_vector.at(i) - time_vector.at(j));
-    }
-    res += values.at(i) * l_i;
-  }
-
-  return res;
-}
-
 int GnssSat_coordinate::GetIndexFromID(string sat_num) const {
   if (sat_num.front() == 'P') {
     switch (sat_num.at(1)) {
@@ -224,15 +152,143 @@ bool GnssSat_coordinate::GetWhetherValid(int gnss_satellite_id) const {
   return validate_.at(gnss_satellite_id);
 }
 
+void GnssSat_coordinate::SetUpInterpolation(const double start_unix_time, const GnssInterpolationMethod method, const int allowed_missing_epochs) {
+  allowed_missing_epochs_ = allowed_missing_epochs;
+  interpolator_.Initialize(method, all_sat_num_, interpolation_number_ > 0 ? interpolation_number_ : 0, number_of_values_);
+  current_values_.assign(all_sat_num_ * number_of_values_, 0.0);
+  validate_.assign(all_sat_num_, false);
+  nearest_index_.assign(all_sat_num_, 0);
+  interpolation_targets_.clear();
+  interpolation_targets_.reserve(all_sat_num_);
+
+  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+    const vector<double>& unixtime_vector = unixtime_vector_.at(gnss_satellite_id);
+    if (unixtime_vector.empty()) continue;
+
+    int index = lower_bound(unixtime_vector.begin(), unixtime_vector.end(), start_unix_time) - unixtime_vector.begin();
+    if (index == (int)unixtime_vector.size()) {
+      nearest_index_[gnss_satellite_id] = index;
+      continue;
+    }
+
+    double nearest_unixtime = unixtime_vector[index];
+    if (interpolation_number_ % 2 && index != 0) {
+      double pre_time = unixtime_vector[index - 1];
+      if (std::abs(start_unix_time - pre_time) < std::abs(start_unix_time - nearest_unixtime)) --index;
+    }
+    nearest_index_[gnss_satellite_id] = index;
+    nearest_unixtime = unixtime_vector[index];
+    if (std::abs(start_unix_time - nearest_unixtime) > time_interval_) continue;
+
+    SetWindow(gnss_satellite_id, index);
+  }
+
+  CalcCurrentValues(start_unix_time);
+}
+
+void GnssSat_coordinate::UpdateInterpolation(const double now_unix_time) {
+  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+    const vector<double>& unixtime_vector = unixtime_vector_[gnss_satellite_id];
+    const int index = nearest_index_[gnss_satellite_id];
+    if (index + 1 >= (int)unixtime_vector.size()) continue;
+
+    double pre_unix = unixtime_vector[index];
+    double post_unix = unixtime_vector[index + 1];
+    if (std::abs(now_unix_time - post_unix) < std::abs(now_unix_time - pre_unix)) {
+      nearest_index_[gnss_satellite_id] = index + 1;
+      SetWindow(gnss_satellite_id, index + 1);
+    }
+  }
+
+  CalcCurrentValues(now_unix_time);
+}
+
+bool GnssSat_coordinate::LoadCache(const GnssBinaryCacheFile& cache_file, pair<double, double>& unix_time_period) {
+  if (cache_file.path.empty()) return false;
+  GnssProductCache cache;
+  if (!cache.Open(cache_file.path, cache_file.signature)) return false;
+  if ((int)cache.GetNumberOfSatellites() != all_sat_num_ || cache.GetNumberOfValues() != number_of_values_) return false;
+
+  time_interval_ = cache.GetTimeInterval_s();
+  unix_time_period = cache.GetUnixTimePeriod();
+  unixtime_vector_.resize(all_sat_num_);
+  value_table_.resize(all_sat_num_);
+  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+    const size_t number_of_epochs = cache.GetNumberOfEpochs(gnss_satellite_id);
+    const double* unix_times = cache.GetUnixTimes(gnss_satellite_id);
+    const double* values = cache.GetValues(gnss_satellite_id);
+    unixtime_vector_[gnss_satellite_id].assign(unix_times, unix_times + number_of_epochs);
+    value_table_[gnss_satellite_id].assign(values, values + number_of_epochs * number_of_values_);
+  }
+  return true;
+}
+
+void GnssSat_coordinate::SaveCache(const GnssBinaryCacheFile& cache_file, const pair<double, double> unix_time_period) const {
+  if (cache_file.path.empty()) return;
+  if (!GnssProductCache::Write(cache_file.path, cache_file.signature, number_of_values_, time_interval_, unix_time_period, unixtime_vector_,
+                               value_table_)) {
+    cerr << "WARNING: GNSS satellites: the binary cache file " << cache_file.path << " cannot be written." << endl;
+  }
+}
+
+void GnssSat_coordinate::SetWindow(const int gnss_satellite_id, const int index) {
+  const vector<double>& unixtime_vector = unixtime_vector_[gnss_satellite_id];
+
+  // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
+  const int start_index = index - interpolation_number_ / 2;
+  const int end_index = index + (interpolation_number_ + 1) / 2;
+  if (interpolation_number_ <= 0 || start_index < 0 || end_index > (int)unixtime_vector.size()) {
+    interpolator_.InvalidateWindow(gnss_satellite_id);
+    return;
+  }
+
+  double time_period_length = unixtime_vector[end_index - 1] - unixtime_vector[start_index];
+  if (time_period_length > time_interval_ * (interpolation_number_ - 1 + allowed_missing_epochs_) + 1e-4) {
+    interpolator_.InvalidateWindow(gnss_satellite_id);
+    return;
+  }
+
+  interpolator_.SetWindow(gnss_satellite_id, &unixtime_vector[start_index], &value_table_[gnss_satellite_id][start_index * number_of_values_]);
+}
+
+void GnssSat_coordinate::CalcCurrentValues(const double unix_time) {
+  interpolation_targets_.clear();
+  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
+    validate_[gnss_satellite_id] = false;
+
+    const vector<double>& unixtime_vector = unixtime_vector_[gnss_satellite_id];
+    const int index = nearest_index_[gnss_satellite_id];
+    if (index >= (int)unixtime_vector.size()) continue;
+    if (!interpolator_.IsWindowSet(gnss_satellite_id)) continue;
+
+    double nearest_unix_time = unixtime_vector[index];
+    if (std::abs(unix_time - nearest_unix_time) > time_interval_) continue;
+    validate_[gnss_satellite_id] = true;
+
+    if (std::abs(unix_time - nearest_unix_time) < 1e-4) {  // for the numerical error, plus 1e-4
+      const double* epoch_values = &value_table_[gnss_satellite_id][index * number_of_values_];
+      for (size_t i = 0; i < number_of_values_; ++i) current_values_[gnss_satellite_id * number_of_values_ + i] = epoch_values[i];
+    } else {
+      interpolation_targets_.push_back(gnss_satellite_id);
+    }
+  }
+
+  // Satellites are interpolated in a batch after the window management
+  interpolator_.Interpolate(unix_time, interpolation_targets_, &current_values_[0]);
+}
+
 pair<double, double> GnssSat_position::Init(vector<vector<string>>& file, int interpolation_method, int interpolation_number,
-                                            UltraRapidMode ur_flag) {
+                                            UltraRapidMode ur_flag, const GnssBinaryCacheFile& cache_file) {
   UNUSED(interpolation_method);
 
   interpolation_number_ = interpolation_number;
+  number_of_values_ = 6;  // Positions in the ECEF and ECI frames
+
+  pair<double, double> unix_time_period;
+  if (LoadCache(cache_file, unix_time_period)) return unix_time_period;
 
   // Expansion
-  gnss_sat_table_ecef_.resize(all_sat_num_);  // first vector size is the sat num
-  gnss_sat_table_eci_.resize(all_sat_num_);
+  value_table_.resize(all_sat_num_);  // first vector size is the sat num
   unixtime_vector_.resize(all_sat_num_);
 
   // for using min and max, set the sup & inf before
@@ -341,175 +397,53 @@ pair<double, double> GnssSat_position::Init(vector<vector<string>>& file, int in
         eci_position(1) = sin_ * x + cos_ * y;
         eci_position(2) = z;
 
+        vector<double>& value_table = value_table_.at(gnss_satellite_id);
         if (!unixtime_vector_.at(gnss_satellite_id).empty() && std::abs(unix_time - unixtime_vector_.at(gnss_satellite_id).back()) < 1.0) {
           unixtime_vector_.at(gnss_satellite_id).back() = unix_time;
-          gnss_sat_table_ecef_.at(gnss_satellite_id).back() = ecef_position_m;
-          gnss_sat_table_eci_.at(gnss_satellite_id).back() = eci_position;
+          value_table.resize(value_table.size() - number_of_values_);
         } else {
           unixtime_vector_.at(gnss_satellite_id).emplace_back(unix_time);
-          gnss_sat_table_ecef_.at(gnss_satellite_id).emplace_back(ecef_position_m);
-          gnss_sat_table_eci_.at(gnss_satellite_id).emplace_back(eci_position);
         }
+        for (int j = 0; j < 3; ++j) value_table.push_back(ecef_position_m(j));
+        for (int j = 0; j < 3; ++j) value_table.push_back(eci_position(j));
       }
     }
   }
 
-  return make_pair(start_unix_time, end_unix_time);
+  unix_time_period = make_pair(start_unix_time, end_unix_time);
+  SaveCache(cache_file, unix_time_period);
+  return unix_time_period;
 }
 
 void GnssSat_position::SetUp(const double start_unix_time, const double step_sec) {
   step_sec_ = step_sec;
-
-  gnss_sat_ecef_.assign(all_sat_num_, libra::Vector<3>(0.0));
-  gnss_sat_eci_.assign(all_sat_num_, libra::Vector<3>(0.0));
-  validate_.assign(all_sat_num_, false);
-
-  nearest_index_.resize(all_sat_num_);
-  time_period_.resize(all_sat_num_);
-
-  ecef_.resize(all_sat_num_);
-  eci_.resize(all_sat_num_);
-
-  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
-    if (unixtime_vector_.at(gnss_satellite_id).empty()) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    int index = lower_bound(unixtime_vector_.at(gnss_satellite_id).begin(), unixtime_vector_.at(gnss_satellite_id).end(), start_unix_time) -
-                unixtime_vector_.at(gnss_satellite_id).begin();
-    if (index == (int)unixtime_vector_.at(gnss_satellite_id).size()) {
-      nearest_index_.at(gnss_satellite_id) = index;
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    double nearest_unixtime = unixtime_vector_.at(gnss_satellite_id).at(index);
-    if (interpolation_number_ % 2 && index != 0) {
-      double pre_time = unixtime_vector_.at(gnss_satellite_id).at(index - 1);
-      if (std::abs(start_unix_time - pre_time) < std::abs(start_unix_time - nearest_unixtime)) --index;
-    }
-    nearest_index_.at(gnss_satellite_id) = index;
-    nearest_unixtime = unixtime_vector_.at(gnss_satellite_id).at(index);
-    if (std::abs(start_unix_time - nearest_unixtime) > time_interval_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-    for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-      int now_index = index + j;
-      if (now_index < 0 || now_index >= (int)unixtime_vector_.at(gnss_satellite_id).size()) continue;
-
-      time_period_.at(gnss_satellite_id).push_back(unixtime_vector_.at(gnss_satellite_id).at(now_index));
-      ecef_.at(gnss_satellite_id).push_back(gnss_sat_table_ecef_.at(gnss_satellite_id).at(now_index));
-      eci_.at(gnss_satellite_id).push_back(gnss_sat_table_eci_.at(gnss_satellite_id).at(now_index));
-    }
-    if ((int)time_period_.at(gnss_satellite_id).size() != interpolation_number_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    double time_period_length = time_period_.at(gnss_satellite_id).back() - time_period_.at(gnss_satellite_id).front();
-    if (time_period_length > time_interval_ * (interpolation_number_ - 1 + 3) + 1e-4) {  // allow for 3 missing
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    } else {
-      validate_.at(gnss_satellite_id) = true;
-    }
-
-    if (std::abs(start_unix_time - nearest_unixtime) < 1e-4) {  // for the numerical error, plus 1e-4
-      gnss_sat_ecef_.at(gnss_satellite_id) = gnss_sat_table_ecef_.at(gnss_satellite_id).at(index);
-      gnss_sat_eci_.at(gnss_satellite_id) = gnss_sat_table_eci_.at(gnss_satellite_id).at(index);
-    } else {
-      gnss_sat_ecef_.at(gnss_satellite_id) =
-          TrigonometricInterpolation(time_period_.at(gnss_satellite_id), ecef_.at(gnss_satellite_id), start_unix_time);
-      gnss_sat_eci_.at(gnss_satellite_id) =
-          TrigonometricInterpolation(time_period_.at(gnss_satellite_id), eci_.at(gnss_satellite_id), start_unix_time);
-    }
-  }
+  SetUpInterpolation(start_unix_time, GnssInterpolationMethod::kTrigonometric, 3);  // allow for 3 missing
 }
 
-void GnssSat_position::Update(const double now_unix_time) {
-  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
-    if (unixtime_vector_.at(gnss_satellite_id).empty()) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    int index = nearest_index_.at(gnss_satellite_id);
-    if (index == (int)unixtime_vector_.at(gnss_satellite_id).size()) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    if (index + 1 < (int)unixtime_vector_.at(gnss_satellite_id).size()) {
-      double pre_unix = unixtime_vector_.at(gnss_satellite_id).at(index);
-      double post_unix = unixtime_vector_.at(gnss_satellite_id).at(index + 1);
-
-      if (std::abs(now_unix_time - post_unix) < std::abs(now_unix_time - pre_unix)) {
-        ++index;
-        nearest_index_.at(gnss_satellite_id) = index;
-
-        time_period_.at(gnss_satellite_id).clear();
-        ecef_.at(gnss_satellite_id).clear();
-        eci_.at(gnss_satellite_id).clear();
-
-        // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-        for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-          int now_index = index + j;
-          if (now_index < 0 || now_index >= (int)unixtime_vector_.at(gnss_satellite_id).size()) continue;
-
-          time_period_.at(gnss_satellite_id).push_back(unixtime_vector_.at(gnss_satellite_id).at(now_index));
-          ecef_.at(gnss_satellite_id).push_back(gnss_sat_table_ecef_.at(gnss_satellite_id).at(now_index));
-          eci_.at(gnss_satellite_id).push_back(gnss_sat_table_eci_.at(gnss_satellite_id).at(now_index));
-        }
-      }
-    }
-    double nearest_unix_time = unixtime_vector_.at(gnss_satellite_id).at(index);
-    if (std::abs(now_unix_time - nearest_unix_time) > time_interval_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    if ((int)time_period_.at(gnss_satellite_id).size() != interpolation_number_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    double time_period_length = time_period_.at(gnss_satellite_id).back() - time_period_.at(gnss_satellite_id).front();
-    if (time_period_length > time_interval_ * (interpolation_number_ - 1 + 3) + 1e-4) {  // allow for 3 missing
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    } else {
-      validate_.at(gnss_satellite_id) = true;
-    }
-
-    if (std::abs(now_unix_time - nearest_unix_time) < 1e-4) {  // for the numerical error, plus 1e-4
-      gnss_sat_ecef_.at(gnss_satellite_id) = gnss_sat_table_ecef_.at(gnss_satellite_id).at(index);
-      gnss_sat_eci_.at(gnss_satellite_id) = gnss_sat_table_eci_.at(gnss_satellite_id).at(index);
-    } else {
-      gnss_sat_ecef_.at(gnss_satellite_id) =
-          TrigonometricInterpolation(time_period_.at(gnss_satellite_id), ecef_.at(gnss_satellite_id), now_unix_time);
-      gnss_sat_eci_.at(gnss_satellite_id) = TrigonometricInterpolation(time_period_.at(gnss_satellite_id), eci_.at(gnss_satellite_id), now_unix_time);
-    }
-  }
-}
+void GnssSat_position::Update(const double now_unix_time) { UpdateInterpolation(now_unix_time); }
 
 libra::Vector<3> GnssSat_position::GetSatEcef(int gnss_satellite_id) const {
-  if (gnss_satellite_id >= all_sat_num_) return libra::Vector<3>(0.0);
-  return gnss_sat_ecef_.at(gnss_satellite_id);
+  libra::Vector<3> position_ecef_m(0.0);
+  if (gnss_satellite_id >= all_sat_num_) return position_ecef_m;
+  for (size_t i = 0; i < 3; ++i) position_ecef_m(i) = current_values_.at(gnss_satellite_id * number_of_values_ + kEcefOffset + i);
+  return position_ecef_m;
 }
 
 libra::Vector<3> GnssSat_position::GetSatEci(int gnss_satellite_id) const {
-  if (gnss_satellite_id >= all_sat_num_) return libra::Vector<3>(0.0);
-  return gnss_sat_eci_.at(gnss_satellite_id);
+  libra::Vector<3> position_eci_m(0.0);
+  if (gnss_satellite_id >= all_sat_num_) return position_eci_m;
+  for (size_t i = 0; i < 3; ++i) position_eci_m(i) = current_values_.at(gnss_satellite_id * number_of_values_ + kEciOffset + i);
+  return position_eci_m;
 }
 
 void GnssSat_clock::Init(vector<vector<string>>& file, string file_extension, int interpolation_number, UltraRapidMode ur_flag,
-                         pair<double, double> unix_time_period) {
+                         pair<double, double> unix_time_period, const GnssBinaryCacheFile& cache_file) {
   interpolation_number_ = interpolation_number;
-  gnss_sat_clock_table_.resize(all_sat_num_);  // first vector size is the sat num
+  number_of_values_ = 1;
+
+  pair<double, double> cached_unix_time_period;
+  if (LoadCache(cache_file, cached_unix_time_period)) return;
+  value_table_.resize(all_sat_num_);  // first vector size is the sat num
   unixtime_vector_.resize(all_sat_num_);
 
   if (file_extension == ".sp3") {
@@ -586,10 +520,10 @@ void GnssSat_clock::Init(vector<vector<string>>& file, string file_extension, in
           clock *= (environment::speed_of_light_m_s * 1e-6);
           if (!unixtime_vector_.at(gnss_satellite_id).empty() && std::abs(unix_time - unixtime_vector_.at(gnss_satellite_id).back()) < 1.0) {
             unixtime_vector_.at(gnss_satellite_id).back() = unix_time;
-            gnss_sat_clock_table_.at(gnss_satellite_id).back() = clock;
+            value_table_.at(gnss_satellite_id).back() = clock;
           } else {
             unixtime_vector_.at(gnss_satellite_id).push_back(unix_time);
-            gnss_sat_clock_table_.at(gnss_satellite_id).emplace_back(clock);
+            value_table_.at(gnss_satellite_id).emplace_back(clock);
           }
         }
       }
@@ -644,159 +578,40 @@ void GnssSat_clock::Init(vector<vector<string>>& file, string file_extension, in
         if (!unixtime_vector_.at(gnss_satellite_id).empty() &&
             std::abs(unix_time - unixtime_vector_.at(gnss_satellite_id).back()) < 1e-4) {  // for the numerical error
           unixtime_vector_.at(gnss_satellite_id).back() = unix_time;
-          gnss_sat_clock_table_.at(gnss_satellite_id).back() = clock_bias;
+          value_table_.at(gnss_satellite_id).back() = clock_bias;
         } else {
           if (!unixtime_vector_.at(gnss_satellite_id).empty())
             time_interval_ = min(time_interval_, unix_time - unixtime_vector_.at(gnss_satellite_id).back());
           unixtime_vector_.at(gnss_satellite_id).emplace_back(unix_time);
-          gnss_sat_clock_table_.at(gnss_satellite_id).emplace_back(clock_bias);
+          value_table_.at(gnss_satellite_id).emplace_back(clock_bias);
         }
       }
     }
   }
+
+  SaveCache(cache_file, unix_time_period);
 }
 
 void GnssSat_clock::SetUp(const double start_unix_time, const double step_sec) {
   step_sec_ = step_sec;
-
-  gnss_sat_clock_.resize(all_sat_num_);
-  validate_.assign(all_sat_num_, false);
-
-  nearest_index_.resize(all_sat_num_);
-  time_period_.resize(all_sat_num_);
-
-  clock_bias_.resize(all_sat_num_);
-
-  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
-    if (unixtime_vector_.at(gnss_satellite_id).empty()) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    int index = lower_bound(unixtime_vector_.at(gnss_satellite_id).begin(), unixtime_vector_.at(gnss_satellite_id).end(), start_unix_time) -
-                unixtime_vector_.at(gnss_satellite_id).begin();
-    if (index == (int)unixtime_vector_.at(gnss_satellite_id).size()) {
-      validate_.at(gnss_satellite_id) = false;
-      nearest_index_.at(gnss_satellite_id) = index;
-      continue;
-    }
-
-    double nearest_unixtime = unixtime_vector_.at(gnss_satellite_id).at(index);
-    if (interpolation_number_ % 2 && index != 0) {
-      double pre_time = unixtime_vector_.at(gnss_satellite_id).at(index - 1);
-      if (std::abs(start_unix_time - pre_time) < std::abs(start_unix_time - nearest_unixtime)) --index;
-    }
-    nearest_index_.at(gnss_satellite_id) = index;
-    nearest_unixtime = unixtime_vector_.at(gnss_satellite_id).at(index);
-    if (std::abs(start_unix_time - nearest_unixtime) > time_interval_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-    for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-      int now_index = index + j;
-      if (now_index < 0 || now_index >= (int)unixtime_vector_.at(gnss_satellite_id).size()) continue;
-
-      time_period_.at(gnss_satellite_id).push_back(unixtime_vector_.at(gnss_satellite_id).at(now_index));
-      clock_bias_.at(gnss_satellite_id).push_back(gnss_sat_clock_table_.at(gnss_satellite_id).at(now_index));
-    }
-
-    if ((int)time_period_.at(gnss_satellite_id).size() != interpolation_number_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-    double time_period_length = time_period_.at(gnss_satellite_id).back() - time_period_.at(gnss_satellite_id).front();
-    if (time_period_length > time_interval_ * (interpolation_number_ - 1) + 1e-4) {  // more strict for clock_bias
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    } else {
-      validate_.at(gnss_satellite_id) = true;
-    }
-
-    if (std::abs(start_unix_time - nearest_unixtime) < 1e-4) {  // for the numerical error
-      gnss_sat_clock_.at(gnss_satellite_id) = gnss_sat_clock_table_.at(gnss_satellite_id).at(index);
-    } else {
-      gnss_sat_clock_.at(gnss_satellite_id) =
-          LagrangeInterpolation(time_period_.at(gnss_satellite_id), clock_bias_.at(gnss_satellite_id), start_unix_time);
-    }
-  }
+  SetUpInterpolation(start_unix_time, GnssInterpolationMethod::kLagrange, 0);  // more strict for clock_bias
 }
 
-void GnssSat_clock::Update(const double now_unix_time) {
-  for (int gnss_satellite_id = 0; gnss_satellite_id < all_sat_num_; ++gnss_satellite_id) {
-    if (unixtime_vector_.at(gnss_satellite_id).empty()) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    int index = nearest_index_.at(gnss_satellite_id);
-    if (index == (int)unixtime_vector_.at(gnss_satellite_id).size()) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    if (index + 1 < (int)unixtime_vector_.at(gnss_satellite_id).size()) {
-      double pre_unix = unixtime_vector_.at(gnss_satellite_id).at(index);
-      double post_unix = unixtime_vector_.at(gnss_satellite_id).at(index + 1);
-
-      if (std::abs(now_unix_time - post_unix) < std::abs(now_unix_time - pre_unix)) {
-        ++index;
-        nearest_index_.at(gnss_satellite_id) = index;
-
-        time_period_.at(gnss_satellite_id).clear();
-        clock_bias_.at(gnss_satellite_id).clear();
-
-        // for both even and odd: 2n+1 -> [-n, n] 2n -> [-n, n)
-        for (int j = -interpolation_number_ / 2; j < (interpolation_number_ + 1) / 2; ++j) {
-          int now_index = index + j;
-          if (now_index < 0 || now_index >= (int)unixtime_vector_.at(gnss_satellite_id).size()) continue;
-
-          time_period_.at(gnss_satellite_id).push_back(unixtime_vector_.at(gnss_satellite_id).at(now_index));
-          clock_bias_.at(gnss_satellite_id).push_back(gnss_sat_clock_table_.at(gnss_satellite_id).at(now_index));
-        }
-      }
-    }
-    if ((int)time_period_.at(gnss_satellite_id).size() != interpolation_number_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    double nearest_unix_time = unixtime_vector_.at(gnss_satellite_id).at(index);
-    if (std::abs(now_unix_time - nearest_unix_time) > time_interval_) {
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    }
-
-    // in clock_bias, more strict.
-    double time_period_length = time_period_.at(gnss_satellite_id).back() - time_period_.at(gnss_satellite_id).front();
-    if (time_period_length > time_interval_ * (interpolation_number_ - 1) + 1e-4) {  // more strict for clock_bias
-      validate_.at(gnss_satellite_id) = false;
-      continue;
-    } else {
-      validate_.at(gnss_satellite_id) = true;
-    }
-
-    if (std::abs(now_unix_time - nearest_unix_time) < 1e-4) {
-      gnss_sat_clock_.at(gnss_satellite_id) = gnss_sat_clock_table_.at(gnss_satellite_id).at(index);
-    } else {
-      gnss_sat_clock_.at(gnss_satellite_id) =
-          LagrangeInterpolation(time_period_.at(gnss_satellite_id), clock_bias_.at(gnss_satellite_id), now_unix_time);
-    }
-  }
-}
+void GnssSat_clock::Update(const double now_unix_time) { UpdateInterpolation(now_unix_time); }
 
 double GnssSat_clock::GetSatClock(int gnss_satellite_id) const {
   if (gnss_satellite_id >= all_sat_num_) return 0.0;
-  return gnss_sat_clock_.at(gnss_satellite_id);
+  return current_values_.at(gnss_satellite_id);
 }
 
 GnssSat_Info::GnssSat_Info() {}
 void GnssSat_Info::Init(vector<vector<string>>& position_file, int position_interpolation_method, int position_interpolation_number,
                         UltraRapidMode position_ur_flag, vector<vector<string>>& clock_file, string clock_file_extension,
-                        int clock_interpolation_number, UltraRapidMode clock_ur_flag) {
-  auto unix_time_period = position_.Init(position_file, position_interpolation_method, position_interpolation_number, position_ur_flag);
-  clock_.Init(clock_file, clock_file_extension, clock_interpolation_number, clock_ur_flag, unix_time_period);
+                        int clock_interpolation_number, UltraRapidMode clock_ur_flag, const GnssBinaryCacheFile& position_cache_file,
+                        const GnssBinaryCacheFile& clock_cache_file) {
+  auto unix_time_period =
+      position_.Init(position_file, position_interpolation_method, position_interpolation_number, position_ur_flag, position_cache_file);
+  clock_.Init(clock_file, clock_file_extension, clock_interpolation_number, clock_ur_flag, unix_time_period, clock_cache_file);
 }
 
 void GnssSat_Info::SetUp(const double start_unix_time, const double step_sec) {
@@ -855,15 +670,20 @@ void GnssSatellites::Init(vector<vector<string>>& true_position_file, int true_p
                           int estimate_position_interpolation_number, UltraRapidMode estimate_position_ur_flag,
 
                           vector<vector<string>>& estimate_clock_file, string estimate_clock_file_extension, int estimate_clock_interpolation_number,
-                          UltraRapidMode estimate_clock_ur_flag) {
+                          UltraRapidMode estimate_clock_ur_flag,
+
+                          const GnssBinaryCacheFile& true_position_cache_file, const GnssBinaryCacheFile& true_clock_cache_file,
+                          const GnssBinaryCacheFile& estimate_position_cache_file, const GnssBinaryCacheFile& estimate_clock_cache_file) {
   true_info_.Init(true_position_file, true_position_interpolation_method, true_position_interpolation_number, true_position_ur_flag,
 
-                  true_clock_file, true_clock_file_extension, true_clock_interpolation_number, true_clock_ur_flag);
+                  true_clock_file, true_clock_file_extension, true_clock_interpolation_number, true_clock_ur_flag, true_position_cache_file,
+                  true_clock_cache_file);
 
   estimate_info_.Init(estimate_position_file, estimate_position_interpolation_method, estimate_position_interpolation_number,
                       estimate_position_ur_flag,
 
-                      estimate_clock_file, estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag);
+                      estimate_clock_file, estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag,
+                      estimate_position_cache_file, estimate_clock_cache_file);
 
   return;
 }
@@ -11,8 +11,11 @@
 #include <fstream>
 #include <iomanip>
 #include <map>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include "gnss_interpolator.hpp"
 #include "library/logger/loggable.hpp"
 #include "library/math/vector.hpp"
 #include "simulation_time.hpp"
@@ -48,6 +51,15 @@ enum UltraRapidMode {
   kUnknown
 };
 
+/**
+ * @struct GnssBinaryCacheFile
+ * @brief Binary cache file of a parsed GNSS product
+ */
+struct GnssBinaryCacheFile {
+  std::string path;       //!< Path to the cache file (The cache is not used when this is empty)
+  std::string signature;  //!< Signature of the source files and the parse options
+};
+
 /**
  * @class GnssSat_coordinate
  * @brief GNSS satellite coordinate?
@@ -80,39 +92,64 @@ class GnssSat_coordinate {
 
  protected:
   /**
-   * @fn TrigonometricInterpolation
-   * @brief Interpolate with Trigonometric method
-   * @note Ref: http://acc.igs.org/orbits/orbit-interp_gpssoln03.pdf
-   *            https://en.wikipedia.org/wiki/Trigonometric_interpolation#
-   * @param [in] time_vector: List of given time
-   * @param [in] values: List of given value
-   * @param [in] time: Time to calculate the interpolated value
-   * @return Interpolated value
-   */
-  template <size_t N>
-  libra::Vector<N> TrigonometricInterpolation(const std::vector<double>& time_vector, const std::vector<libra::Vector<N>>& values, double time) const;
-  double TrigonometricInterpolation(const std::vector<double>& time_vector, const std::vector<double>& values, double time) const;
-
-  /**
-   * @fn LagrangeInterpolation
-   * @brief Interpolate with Lagrange method
-   * @param [in] time_vector: List of given time
-   * @param [in] values: List of given value
-   * @param [in] time: Time to calculate the interpolated value
-   * @return Interpolated value
-   */
-  template <size_t N>
-  libra::Vector<N> LagrangeInterpolation(const std::vector<double>& time_vector, const std::vector<libra::Vector<N>>& values, double time) const;
-  double LagrangeInterpolation(const std::vector<double>& time_vector, const std::vector<double>& values, double time) const;
+   * @fn SetUpInterpolation
+   * @brief Search the nearest epochs, set the interpolation windows, and calculate the values at the start time
+   * @param [in] start_unix_time: Start unix time
+   * @param [in] method: Interpolation method
+   * @param [in] allowed_missing_epochs: Number of missing epochs allowed in an interpolation window
+   */
+  void SetUpInterpolation(const double start_unix_time, const GnssInterpolationMethod method, const int allowed_missing_epochs);
+  /**
+   * @fn UpdateInterpolation
+   * @brief Move the interpolation windows when the nearest epoch changes and calculate the values at the current time
+   * @param [in] now_unix_time: Current unix time
+   */
+  void UpdateInterpolation(const double now_unix_time);
+  /**
+   * @fn LoadCache
+   * @brief Load the time tables from the binary cache file
+   * @param [in] cache_file: Binary cache file
+   * @param [out] unix_time_period: Start and end unix time of the product
+   * @return True when the cache file is available and matches the signature
+   */
+  bool LoadCache(const GnssBinaryCacheFile& cache_file, std::pair<double, double>& unix_time_period);
+  /**
+   * @fn SaveCache
+   * @brief Save the time tables to the binary cache file
+   * @param [in] cache_file: Binary cache file
+   * @param [in] unix_time_period: Start and end unix time of the product
+   */
+  void SaveCache(const GnssBinaryCacheFile& cache_file, const std::pair<double, double> unix_time_period) const;
 
   std::vector<std::vector<double>> unixtime_vector_;  //!< List of unixtime for all sat
-  std::vector<std::vector<double>> time_period_;      //!< List of time period for interpolation
+  std::vector<std::vector<double>> value_table_;      //!< Time series of values aligned by epoch for all sat (number_of_values_ per epoch)
+  std::vector<double> current_values_;                //!< Values at the current time aligned by sat (number_of_values_ per sat)
   std::vector<bool> validate_;                        //!< List of whether the satellite is available at the time
   std::vector<int> nearest_index_;                    //!< Index list for update(in position, time_and_index_list_. in clock_bias, time_table_)
 
   double step_sec_ = 0.0;         //!< Step width [sec]
   double time_interval_ = 0.0;    //!< Time interval
   int interpolation_number_ = 0;  //!< Interpolation number
+  size_t number_of_values_ = 0;   //!< Number of values per epoch
+
+ private:
+  /**
+   * @fn SetWindow
+   * @brief Set the interpolation window around the nearest epoch
+   * @param [in] gnss_satellite_id: Index of GNSS satellite
+   * @param [in] index: Index of the nearest epoch
+   */
+  void SetWindow(const int gnss_satellite_id, const int index);
+  /**
+   * @fn CalcCurrentValues
+   * @brief Judge the availability and calculate the values of all satellites at the time
+   * @param [in] unix_time: Unix time
+   */
+  void CalcCurrentValues(const double unix_time);
+
+  GnssInterpolator interpolator_;              //!< Interpolator of all satellites
+  int allowed_missing_epochs_ = 0;             //!< Number of missing epochs allowed in an interpolation window
+  std::vector<size_t> interpolation_targets_;  //!< List of satellites to be interpolated at the current time
 };
 
 /**
@@ -133,10 +170,11 @@ class GnssSat_position : public GnssSat_coordinate {
    * @param[in] interpolation_method: Interpolation method for position calculation
    * @param[in] interpolation_number: Interpolation number for position calculation
    * @param[in] ur_flag: Ultra Rapid flag for position calculation
+   * @param[in] cache_file: Binary cache file. When the cache is available, the file contents are not used.
    * @return Start unix time and end unix time
    */
   std::pair<double, double> Init(std::vector<std::vector<std::string>>& file, int interpolation_method, int interpolation_number,
-                                 UltraRapidMode ur_flag);
+                                 UltraRapidMode ur_flag, const GnssBinaryCacheFile& cache_file = GnssBinaryCacheFile());
 
   /**
    * @fn Setup
@@ -166,14 +204,8 @@ class GnssSat_position : public GnssSat_coordinate {
   libra::Vector<3> GetSatEci(int gnss_satellite_id) const;
 
  private:
-  std::vector<libra::Vector<3>> gnss_sat_ecef_;  //!< List of GNSS satellite position at specific time in the ECEF frame [m]
-  std::vector<libra::Vector<3>> gnss_sat_eci_;   //!< List of GNSS satellite position at specific time in the ECI frame [m]
-
-  std::vector<std::vector<libra::Vector<3>>> gnss_sat_table_ecef_;  //!< Time series of position of all GNSS satellites in the ECEF frame [m]
-  std::vector<std::vector<libra::Vector<3>>> gnss_sat_table_eci_;   //!< Time series of position of all GNSS satellites in the ECEF frame [m]
-
-  std::vector<std::vector<libra::Vector<3>>> ecef_;  //!< Time series of position of all GNSS satellites in the ECEF frame before interpolation [m]
-  std::vector<std::vector<libra::Vector<3>>> eci_;   //!< Time series of position of all GNSS satellites in the ECEF frame before interpolation [m]
+  static const size_t kEcefOffset = 0;  //!< Offset of the position in the ECEF frame in the values of an epoch
+  static const size_t kEciOffset = 3;   //!< Offset of the position in the ECI frame in the values of an epoch
 };
 
 /**
@@ -194,9 +226,11 @@ class GnssSat_clock : public GnssSat_coordinate {
    * @param[in] file_extension: Extension of the clock file (ex. .sp3, .clk30s)
    * @param[in] interpolation_number: Interpolation number for clock calculation
    * @param[in] ur_flag: Ultra Rapid flag for clock calculation
+   * @param[in] unix_time_period: Start and end unix time of the position product
+   * @param[in] cache_file: Binary cache file. When the cache is available, the file contents are not used.
    */
   void Init(std::vector<std::vector<std::string>>& file, std::string file_extension, int interpolation_number, UltraRapidMode ur_flag,
-            std::pair<double, double> unix_time_period);
+            std::pair<double, double> unix_time_period, const GnssBinaryCacheFile& cache_file = GnssBinaryCacheFile());
   /**
    * @fn SetUp
    * @brief Setup GNSS satellite clock information
@@ -216,11 +250,6 @@ class GnssSat_clock : public GnssSat_coordinate {
    * @param [in] gnss_satellite_id: GNSS satellite ID defined in this class
    */
   double GetSatClock(int gnss_satellite_id) const;
-
- private:
-  std::vector<double> gnss_sat_clock_;                     //!< List of clock bias of all GNSS satellites at specific time expressed in distance [m]
-  std::vector<std::vector<double>> gnss_sat_clock_table_;  //!< Time series of clock bias of all GNSS satellites expressed in distance [m]
-  std::vector<std::vector<double>> clock_bias_;  //!< Time series of clock bias of all GNSS satellites expressed in distance before interpolation [m]
 };
 
 /**
@@ -245,10 +274,13 @@ class GnssSat_Info {
    * @param[in] clock_file_extension: Extension of the clock file (ex. .sp3, .clk30s)
    * @param[in] clock_interpolation_number: Interpolation number for clock calculation
    * @param[in] clock_ur_flag: Ultra Rapid flag for clock calculation
+   * @param[in] position_cache_file: Binary cache file for position
+   * @param[in] clock_cache_file: Binary cache file for clock
    */
   void Init(std::vector<std::vector<std::string>>& position_file, int position_interpolation_method, int position_interpolation_number,
             UltraRapidMode position_ur_flag, std::vector<std::vector<std::string>>& clock_file, std::string clock_file_extension,
-            int clock_interpolation_number, UltraRapidMode clock_ur_flag);
+            int clock_interpolation_number, UltraRapidMode clock_ur_flag, const GnssBinaryCacheFile& position_cache_file = GnssBinaryCacheFile(),
+            const GnssBinaryCacheFile& clock_cache_file = GnssBinaryCacheFile());
   /**
    * @fn SetUp
    * @brief Setup GNSS satellite position and clock information
@@ -330,14 +362,18 @@ class GnssSatellites : public ILoggable {
   /**
    * @fn Init
    * @brief Initialize function
-   * @note Parameters are defined in GNSSSat_Info for true and estimated information
+   * @note Parameters are defined in GNSSSat_Info for true and estimated information. The binary cache files are optional.
    */
   void Init(std::vector<std::vector<std::string>>& true_position_file, int true_position_interpolation_method, int true_position_interpolation_number,
             UltraRapidMode true_position_ur_flag, std::vector<std::vector<std::string>>& true_clock_file, std::string true_clock_file_extension,
             int true_clock_interpolation_number, UltraRapidMode true_clock_ur_flag, std::vector<std::vector<std::string>>& estimate_position_file,
             int estimate_position_interpolation_method, int estimate_position_interpolation_number, UltraRapidMode estimate_position_ur_flag,
             std::vector<std::vector<std::string>>& estimate_clock_file, std::string estimate_clock_file_extension,
-            int estimate_clock_interpolation_number, UltraRapidMode estimate_clock_ur_flag);
+            int estimate_clock_interpolation_number, UltraRapidMode estimate_clock_ur_flag,
+            const GnssBinaryCacheFile& true_position_cache_file = GnssBinaryCacheFile(),
+            const GnssBinaryCacheFile& true_clock_cache_file = GnssBinaryCacheFile(),
+            const GnssBinaryCacheFile& estimate_position_cache_file = GnssBinaryCacheFile(),
+            const GnssBinaryCacheFile& estimate_clock_cache_file = GnssBinaryCacheFile());
   /**
    * @fn IsCalcEnabled
    * @brief Return calculated enabled flag
@@ -41,18 +41,35 @@ bool HipparcosCatalogue::ReadContents(const std::string& file_name, const char d
         hipparcos_data.declination_deg;
 
     if (hipparcos_data.visible_magnitude > max_magnitude_) {
-      return true;
+      break;
     }  // Don't read stars darker than max_magnitude
     hipparcos_catalogue_.push_back(hipparcos_data);
   }
 
+  // Precompute the directions and the sky index for the field of view queries
+  directions_i_.resize(hipparcos_catalogue_.size());
+  for (size_t rank = 0; rank < hipparcos_catalogue_.size(); rank++) {
+    directions_i_[rank] = CalcStarDirection_i(hipparcos_catalogue_[rank]);
+  }
+  sky_index_.Build(directions_i_);
+
   return true;
 }
 
+void HipparcosCatalogue::FindStarsInCone(const libra::Vector<3>& center_direction_i, const double half_angle_rad,
+                                         std::vector<size_t>& ranks) const {
+  sky_index_.FindInCone(center_direction_i, half_angle_rad, ranks);
+}
+
 libra::Vector<3> HipparcosCatalogue::GetStarDirection_i(int rank) const {
+  if ((size_t)rank < directions_i_.size()) return directions_i_[rank];
+  return CalcStarDirection_i(hipparcos_catalogue_[rank]);
+}
+
+libra::Vector<3> HipparcosCatalogue::CalcStarDirection_i(const HipparcosData& hipparcos_data) const {
   libra::Vector<3> direction_i;
-  double ra_rad = GetRightAscension_deg(rank) * libra::deg_to_rad;
-  double de_rad = GetDeclination_deg(rank) * libra::deg_to_rad;
+  double ra_rad = hipparcos_data.right_ascension_deg * libra::deg_to_rad;
+  double de_rad = hipparcos_data.declination_deg * libra::deg_to_rad;
 
   direction_i[0] = cos(ra_rad) * cos(de_rad);
   direction_i[1] = sin(ra_rad) * cos(de_rad);
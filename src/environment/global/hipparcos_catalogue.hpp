@@ -11,6 +11,7 @@
 #include "library/logger/loggable.hpp"
 #include "library/math/quaternion.hpp"
 #include "library/math/vector.hpp"
+#include "sky_index.hpp"
 
 /**
  *@struct HipparcosData
@@ -90,6 +91,14 @@ class HipparcosCatalogue : public ILoggable {
    *@param [in] quaternion_i2b: Quaternion from the inertial frame to the body-fixed frame
    */
   libra::Vector<3> GetStarDirection_b(int rank, libra::Quaternion quaternion_i2b) const;
+  /**
+   *@fn FindStarsInCone
+   *@brief Find stars in the cone with the sky index
+   *@param [in] center_direction_i: Unit vector of the center of the cone in the inertial frame
+   *@param [in] half_angle_rad: Half angle of the cone [rad]
+   *@param [out] ranks: Ranks of the stars in the cone in brightness order
+   */
+  void FindStarsInCone(const libra::Vector<3>& center_direction_i, const double half_angle_rad, std::vector<size_t>& ranks) const;
 
   // Override ILoggable
   /**
@@ -109,6 +118,15 @@ class HipparcosCatalogue : public ILoggable {
   std::vector<HipparcosData> hipparcos_catalogue_;  //!< Data base of the read Hipparcos catalogue
   double max_magnitude_;                            //!< Maximum magnitude in the data base
   std::string catalogue_path_;                      //!< Path to Hipparcos catalog file
+  std::vector<libra::Vector<3>> directions_i_;      //!< Precomputed star directions in the inertial frame
+  SkyIndex sky_index_;                              //!< Sky index of the star directions
+
+  /**
+   *@fn CalcStarDirection_i
+   *@brief Calculate direction vector of a star in the inertial frame from the right ascension and the declination
+   *@param [in] hipparcos_data: Hipparcos data of the star
+   */
+  libra::Vector<3> CalcStarDirection_i(const HipparcosData& hipparcos_data) const;
 };
 
 #endif  // S2E_ENVIRONMENT_GLOBAL_HIPPAROCOS_CATALOGUE_HPP_
@@ -7,6 +7,7 @@
 #include <SpiceUsr.h>
 
 #include <cassert>
+#include <iostream>
 #include <environment/global/simulation_time.hpp>
 #include <library/initialize/initialize_file_access.hpp>
 
@@ -41,6 +42,7 @@ SimulationTime* InitSimulationTime(std::string file_name) {
   SimulationTime* simTime = new SimulationTime(end_sec, step_sec, attitude_update_interval_sec, attitude_rk_step_sec, orbit_update_interval_sec,
                                                orbit_rk_step_sec, thermal_update_interval_sec, thermal_rk_step_sec, compo_propagate_step_sec,
                                                log_output_interval_sec, start_ymdhms.c_str(), sim_speed);
+  simTime->SetSchedulerStatisticsOutput(ini_file.ReadEnable(section, "scheduler_statistics_output"));
 
   return simTime;
 }
@@ -113,6 +115,20 @@ CelestialInformation* InitCelestialInformation(std::string file_name) {
   CelestialInformation* celestial_info;
   celestial_info = new CelestialInformation(inertial_frame, aber_cor, center_obj, rotation_mode, num_of_selected_body, selected_body);
 
+  // Ephemeris cache setting
+  if (ini_file.ReadEnable(section, "ephemeris_cache")) {
+    EphemerisInterpolationMethod method = EphemerisInterpolationMethod::kChebyshev;
+    std::string method_name = ini_file.ReadString(section, "ephemeris_interpolation_method");
+    if (method_name == "HERMITE") {
+      method = EphemerisInterpolationMethod::kHermite;
+    } else if (method_name != "CHEBYSHEV") {
+      std::cerr << "WARNING: ephemeris interpolation method: " << method_name << " is not defined. CHEBYSHEV is used." << std::endl;
+    }
+    const double segment_length_s = ini_file.ReadDouble(section, "ephemeris_cache_segment_length_s");
+    const double tolerance_m = ini_file.ReadDouble(section, "ephemeris_cache_tolerance_m");
+    celestial_info->EnableEphemerisCache(method, segment_length_s, tolerance_m);
+  }
+
   // log setting
   celestial_info->is_log_enabled_ = ini_file.ReadEnable(section, LOG_LABEL);
 
@@ -9,6 +9,8 @@
 #include <library/initialize/initialize_file_access.hpp>
 #include <string>
 
+#include "gnss_product_cache.hpp"
+
 std::string return_dirctory_path(std::string sort) {
   std::string main_directory, sub_directory;
 
@@ -46,12 +48,11 @@ std::string return_dirctory_path(std::string sort) {
   return main_directory + sub_directory;
 }
 
-void get_raw_contents(std::string directory_path, std::string file_name, std::vector<std::string>& storage) {
-  std::string all_file_path = directory_path + file_name;
-  std::ifstream ifs(all_file_path);
+void get_raw_contents(std::string file_path, std::vector<std::string>& storage) {
+  std::ifstream ifs(file_path);
 
   if (!ifs.is_open()) {
-    std::cout << "in " << directory_path << "gnss file: " << file_name << " not found" << std::endl;
+    std::cout << "gnss file: " << file_path << " not found" << std::endl;
     exit(1);
   }
   std::string str;
@@ -64,8 +65,8 @@ void get_raw_contents(std::string directory_path, std::string file_name, std::ve
   return;
 }
 
-void get_sp3_file_contents(std::string directory_path, std::string file_sort, std::string first, std::string last,
-                           std::vector<std::vector<std::string>>& file_contents, UltraRapidMode& ur_flag) {
+void get_sp3_file_paths(std::string directory_path, std::string file_sort, std::string first, std::string last, std::vector<std::string>& file_paths,
+                        UltraRapidMode& ur_flag) {
   std::string all_directory_path = directory_path + return_dirctory_path(file_sort);
   ur_flag = kNotUse;
 
@@ -76,7 +77,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
     int year_last_day = 365 + (year % 4 == 0) - (year % 100 == 0) + (year % 400 == 0);
     int day = stoi(first.substr(file_header.size() + 4, 3));
 
-    file_contents.clear();
+    file_paths.clear();
 
     while (true) {
       if (day > year_last_day) {
@@ -92,9 +93,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
       else
         s_day = "00" + std::to_string(day);
       std::string file_name = file_header + std::to_string(year) + s_day + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      get_raw_contents(all_directory_path, file_name, file_contents.back());
+      file_paths.push_back(all_directory_path + file_name);
 
       if (file_name == last) break;
       ++day;
@@ -117,7 +116,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
       }
     }
 
-    file_contents.clear();
+    file_paths.clear();
 
     while (true) {
       if (hour == 24) {
@@ -133,9 +132,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
         file_name += "0";
       }
       file_name += std::to_string(hour) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      get_raw_contents(all_directory_path, file_name, file_contents.back());
+      file_paths.push_back(all_directory_path + file_name);
 
       if (file_name == last) break;
       hour += 6;
@@ -155,7 +152,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
       }
     }
 
-    file_contents.clear();
+    file_paths.clear();
 
     while (true) {
       if (day == 7) {
@@ -163,9 +160,7 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
         day = 0;
       }
       std::string file_name = file_header + std::to_string(gps_week) + std::to_string(day) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      get_raw_contents(all_directory_path, file_name, file_contents.back());
+      file_paths.push_back(all_directory_path + file_name);
 
       if (file_name == last) break;
       ++day;
@@ -175,8 +170,8 @@ void get_sp3_file_contents(std::string directory_path, std::string file_sort, st
   return;
 }
 
-void get_clk_file_contents(std::string directory_path, std::string extension, std::string file_sort, std::string first, std::string last,
-                           std::vector<std::vector<std::string>>& file_contents) {
+void get_clk_file_paths(std::string directory_path, std::string extension, std::string file_sort, std::string first, std::string last,
+                        std::vector<std::string>& file_paths) {
   std::string all_directory_path = directory_path + return_dirctory_path(file_sort) + extension.substr(1) + '/';
 
   if (file_sort.find("Ultra") != std::string::npos) {
@@ -196,7 +191,7 @@ void get_clk_file_contents(std::string directory_path, std::string extension, st
       }
     }
 
-    file_contents.clear();
+    file_paths.clear();
 
     while (true) {
       if (hour == 24) {
@@ -212,9 +207,7 @@ void get_clk_file_contents(std::string directory_path, std::string extension, st
         file_name += "0";
       }
       file_name += std::to_string(hour) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      get_raw_contents(all_directory_path, file_name, file_contents.back());
+      file_paths.push_back(all_directory_path + file_name);
 
       if (file_name == last) break;
       hour += 6;
@@ -234,7 +227,7 @@ void get_clk_file_contents(std::string directory_path, std::string extension, st
       }
     }
 
-    file_contents.clear();
+    file_paths.clear();
 
     while (true) {
       if (day == 7) {
@@ -242,9 +235,7 @@ void get_clk_file_contents(std::string directory_path, std::string extension, st
         day = 0;
       }
       std::string file_name = file_header + std::to_string(gps_week) + std::to_string(day) + file_footer;
-      file_contents.push_back(std::vector<std::string>());
-
-      get_raw_contents(all_directory_path, file_name, file_contents.back());
+      file_paths.push_back(all_directory_path + file_name);
 
       if (file_name == last) break;
       ++day;
@@ -254,6 +245,38 @@ void get_clk_file_contents(std::string directory_path, std::string extension, st
   return;
 }
 
+/**
+ * @fn prepare_gnss_product
+ * @brief Prepare the binary cache file of a GNSS product, and read the source files when the cache is not available
+ * @param [in] cache_directory: Directory of the cache files (The cache is not used when this is empty)
+ * @param [in] product_name: Name of the product used for the cache file name
+ * @param [in] file_paths: Paths to the source files
+ * @param [in] parse_options: Parse options added to the signature
+ * @param [out] file_contents: Contents of the source files (Empty when the cache is available)
+ * @param [out] source_signature: Signature of the source files
+ * @return Binary cache file
+ */
+GnssBinaryCacheFile prepare_gnss_product(const std::string& cache_directory, const std::string& product_name,
+                                         const std::vector<std::string>& file_paths, const std::string& parse_options,
+                                         std::vector<std::vector<std::string>>& file_contents, std::string& source_signature) {
+  GnssBinaryCacheFile cache_file;
+  file_contents.clear();
+  source_signature = GnssProductCache::MakeSourceSignature(file_paths);
+  if (!cache_directory.empty() && !source_signature.empty()) {
+    cache_file.path = cache_directory + product_name + ".bin";
+    cache_file.signature = source_signature + parse_options;
+    GnssProductCache cache;
+    if (cache.Open(cache_file.path, cache_file.signature)) return cache_file;
+    std::cout << "GNSS binary cache " << cache_file.path << " is created." << std::endl;
+  }
+
+  for (const auto& file_path : file_paths) {
+    file_contents.push_back(std::vector<std::string>());
+    get_raw_contents(file_path, file_contents.back());
+  }
+  return cache_file;
+}
+
 GnssSatellites* InitGnssSatellites(std::string file_name) {
   IniAccess ini_file(file_name);
   char section[] = "GNSS_SATELLIES";
@@ -263,31 +286,52 @@ GnssSatellites* InitGnssSatellites(std::string file_name) {
   }
 
   std::string directory_path = ini_file.ReadString(section, "directory_path");
+  std::string cache_directory = "";
+  if (ini_file.ReadEnable(section, "binary_cache")) {
+    cache_directory = ini_file.ReadString(section, "binary_cache_directory");
+    if (!cache_directory.empty() && cache_directory.back() != '/') cache_directory += '/';
+  }
 
+  std::vector<std::string> file_paths;
   std::vector<std::vector<std::string>> true_position_file;
   UltraRapidMode true_position_ur_flag = kNotUse;
-  get_sp3_file_contents(directory_path, ini_file.ReadString(section, "true_position_file_sort"), ini_file.ReadString(section, "true_position_first"),
-                        ini_file.ReadString(section, "true_position_last"), true_position_file, true_position_ur_flag);
+  std::string true_position_first = ini_file.ReadString(section, "true_position_first");
+  std::string true_position_last = ini_file.ReadString(section, "true_position_last");
+  get_sp3_file_paths(directory_path, ini_file.ReadString(section, "true_position_file_sort"), true_position_first, true_position_last, file_paths,
+                     true_position_ur_flag);
+  std::string true_position_signature;
+  GnssBinaryCacheFile true_position_cache_file =
+      prepare_gnss_product(cache_directory, "true_position_" + true_position_first + "_" + true_position_last, file_paths,
+                           "position ur=" + std::to_string(true_position_ur_flag) + "\n", true_position_file, true_position_signature);
   int true_position_interpolation_method = ini_file.ReadInt(section, "true_position_interpolation_method");
   int true_position_interpolation_number = ini_file.ReadInt(section, "true_position_interpolation_number");
 
   std::vector<std::vector<std::string>> true_clock_file;
   UltraRapidMode true_clock_ur_flag = kNotUse;
   std::string true_clock_file_extension = ini_file.ReadString(section, "true_clock_file_extension");
+  std::string true_clock_first = ini_file.ReadString(section, "true_clock_first");
+  std::string true_clock_last = ini_file.ReadString(section, "true_clock_last");
   if (true_clock_file_extension == ".sp3") {
-    get_sp3_file_contents(directory_path, ini_file.ReadString(section, "true_clock_file_sort"), ini_file.ReadString(section, "true_clock_first"),
-                          ini_file.ReadString(section, "true_clock_last"), true_clock_file, true_clock_ur_flag);
+    get_sp3_file_paths(directory_path, ini_file.ReadString(section, "true_clock_file_sort"), true_clock_first, true_clock_last, file_paths,
+                       true_clock_ur_flag);
   } else {
-    get_clk_file_contents(directory_path, true_clock_file_extension, ini_file.ReadString(section, "true_clock_file_sort"),
-                          ini_file.ReadString(section, "true_clock_first"), ini_file.ReadString(section, "true_clock_last"), true_clock_file);
+    get_clk_file_paths(directory_path, true_clock_file_extension, ini_file.ReadString(section, "true_clock_file_sort"), true_clock_first,
+                       true_clock_last, file_paths);
   }
+  // The clock table depends on the period of the position product
+  std::string true_clock_signature;
+  GnssBinaryCacheFile true_clock_cache_file = prepare_gnss_product(
+      cache_directory, "true_clock_" + true_clock_first + "_" + true_clock_last, file_paths,
+      "clock " + true_clock_file_extension + " ur=" + std::to_string(true_clock_ur_flag) + "\n" + true_position_signature, true_clock_file,
+      true_clock_signature);
   int true_clock_interpolation_number = ini_file.ReadInt(section, "true_clock_interpolation_number");
 
   std::vector<std::vector<std::string>> estimate_position_file;
   UltraRapidMode estimate_position_ur_flag = kNotUse;
-  get_sp3_file_contents(directory_path, ini_file.ReadString(section, "estimate_position_file_sort"),
-                        ini_file.ReadString(section, "estimate_position_first"), ini_file.ReadString(section, "estimate_position_last"),
-                        estimate_position_file, estimate_position_ur_flag);
+  std::string estimate_position_first = ini_file.ReadString(section, "estimate_position_first");
+  std::string estimate_position_last = ini_file.ReadString(section, "estimate_position_last");
+  get_sp3_file_paths(directory_path, ini_file.ReadString(section, "estimate_position_file_sort"), estimate_position_first, estimate_position_last,
+                     file_paths, estimate_position_ur_flag);
   int estimate_position_interpolation_method = ini_file.ReadInt(section, "estimate_position_interpolation_method");
   int estimate_position_interpolation_number = ini_file.ReadInt(section, "estimate_position_interpolation_number");
   if (estimate_position_ur_flag != kNotUse) {
@@ -298,19 +342,28 @@ GnssSatellites* InitGnssSatellites(std::string file_name) {
       estimate_position_ur_flag = (UltraRapidMode)((int)kPredict1 + (ur_flag.back() - '1'));
     }
   }
+  std::string estimate_position_signature;
+  GnssBinaryCacheFile estimate_position_cache_file =
+      prepare_gnss_product(cache_directory, "estimate_position_" + estimate_position_first + "_" + estimate_position_last, file_paths,
+                           "position ur=" + std::to_string(estimate_position_ur_flag) + "\n", estimate_position_file, estimate_position_signature);
 
   std::vector<std::vector<std::string>> estimate_clock_file;
   UltraRapidMode estimate_clock_ur_flag = estimate_position_ur_flag;
   std::string estimate_clock_file_extension = ini_file.ReadString(section, "estimate_clock_file_extension");
+  std::string estimate_clock_first = ini_file.ReadString(section, "estimate_clock_first");
+  std::string estimate_clock_last = ini_file.ReadString(section, "estimate_clock_last");
   if (estimate_clock_file_extension == ".sp3") {
-    get_sp3_file_contents(directory_path, ini_file.ReadString(section, "estimate_clock_file_sort"),
-                          ini_file.ReadString(section, "estimate_clock_first"), ini_file.ReadString(section, "estimate_clock_last"),
-                          estimate_clock_file, estimate_clock_ur_flag);
+    get_sp3_file_paths(directory_path, ini_file.ReadString(section, "estimate_clock_file_sort"), estimate_clock_first, estimate_clock_last,
+                       file_paths, estimate_clock_ur_flag);
   } else {
-    get_clk_file_contents(directory_path, estimate_clock_file_extension, ini_file.ReadString(section, "estimate_clock_file_sort"),
-                          ini_file.ReadString(section, "estimate_clock_first"), ini_file.ReadString(section, "estimate_clock_last"),
-                          estimate_clock_file);
+    get_clk_file_paths(directory_path, estimate_clock_file_extension, ini_file.ReadString(section, "estimate_clock_file_sort"), estimate_clock_first,
+                       estimate_clock_last, file_paths);
   }
+  std::string estimate_clock_signature;
+  GnssBinaryCacheFile estimate_clock_cache_file = prepare_gnss_product(
+      cache_directory, "estimate_clock_" + estimate_clock_first + "_" + estimate_clock_last, file_paths,
+      "clock " + estimate_clock_file_extension + " ur=" + std::to_string(estimate_clock_ur_flag) + "\n" + estimate_position_signature,
+      estimate_clock_file, estimate_clock_signature);
   int estimate_clock_interpolation_number = ini_file.ReadInt(section, "estimate_clock_interpolation_number");
 
   gnss_satellites->Init(true_position_file, true_position_interpolation_method, true_position_interpolation_number, true_position_ur_flag,
@@ -320,7 +373,9 @@ GnssSatellites* InitGnssSatellites(std::string file_name) {
                         estimate_position_file, estimate_position_interpolation_method, estimate_position_interpolation_number,
                         estimate_position_ur_flag,
 
-                        estimate_clock_file, estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag);
+                        estimate_clock_file, estimate_clock_file_extension, estimate_clock_interpolation_number, estimate_clock_ur_flag,
+
+                        true_position_cache_file, true_clock_cache_file, estimate_position_cache_file, estimate_clock_cache_file);
 
   return gnss_satellites;
 }
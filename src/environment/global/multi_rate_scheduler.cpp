@@ -0,0 +1,114 @@
+/**
+ * @file multi_rate_scheduler.cpp
+ * @brief Scheduler of periodic tasks with different update periods
+ */
+
+#include "multi_rate_scheduler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+
+MultiRateScheduler::MultiRateScheduler(const double base_step_s) : base_step_s_(base_step_s) {}
+
+size_t MultiRateScheduler::RegisterTask(const std::string& name, const double period_s) {
+  Task task;
+  task.name = name;
+  task.period_s = period_s;
+  // Small margin to absorb the rounding error of the period which is the integer multiple of the base step
+  const double period_steps = ceil(period_s / base_step_s_ - 1.0e-9);
+  task.period_steps = (period_steps < 1.0) ? 1 : (uint64_t)period_steps;
+  task.next_step = current_step_ + task.period_steps;
+  tasks_.push_back(task);
+  return tasks_.size() - 1;
+}
+
+void MultiRateScheduler::Reset() {
+  current_step_ = 0;
+  number_of_events_ = 0;
+  for (auto& task : tasks_) {
+    task.next_step = task.period_steps;
+    task.is_due = false;
+    task.number_of_executions = 0;
+    task.number_of_measurements = 0;
+    task.total_execution_time_s = 0.0;
+    task.max_execution_time_s = 0.0;
+  }
+}
+
+void MultiRateScheduler::Advance() {
+  uint64_t next_step = std::numeric_limits<uint64_t>::max();
+  for (const auto& task : tasks_) next_step = std::min(next_step, task.next_step);
+  if (tasks_.empty()) next_step = current_step_ + 1;
+
+  current_step_ = next_step;
+  number_of_events_++;
+  for (auto& task : tasks_) {
+    task.is_due = (task.next_step == current_step_);
+    if (task.is_due) {
+      task.next_step += task.period_steps;
+      task.number_of_executions++;
+    }
+  }
+}
+
+void MultiRateScheduler::SkipTo(const double time_s) {
+  const double step = floor(time_s / base_step_s_ + 1.0e-9);
+  if (step <= (double)current_step_) return;
+
+  current_step_ = (uint64_t)step;
+  for (auto& task : tasks_) {
+    if (task.next_step <= current_step_) {
+      task.is_due = true;
+      task.number_of_executions++;
+      task.next_step = (current_step_ / task.period_steps + 1) * task.period_steps;
+    }
+  }
+}
+
+void MultiRateScheduler::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("MultiRateScheduler");
+  writer.Write(current_step_);
+  writer.Write(number_of_events_);
+  writer.Write((uint64_t)tasks_.size());
+  for (const auto& task : tasks_) {
+    writer.Write(task.next_step);
+    writer.Write(task.is_due);
+    writer.Write(task.number_of_executions);
+  }
+}
+
+void MultiRateScheduler::LoadState(CheckpointReader& reader) {
+  reader.BeginSection("MultiRateScheduler");
+  reader.Read(current_step_);
+  reader.Read(number_of_events_);
+  reader.ReadSizeAndCheck(tasks_.size(), "scheduler tasks");
+  if (!reader.IsValid()) return;
+  for (auto& task : tasks_) {
+    reader.Read(task.next_step);
+    reader.Read(task.is_due);
+    reader.Read(task.number_of_executions);
+  }
+}
+
+void MultiRateScheduler::RecordExecutionTime(const size_t task_id, const double execution_time_s) const {
+  std::lock_guard<std::mutex> lock(statistics_mutex_);
+  Task& task = tasks_[task_id];
+  task.number_of_measurements++;
+  task.total_execution_time_s += execution_time_s;
+  task.max_execution_time_s = std::max(task.max_execution_time_s, execution_time_s);
+}
+
+void MultiRateScheduler::PrintStatistics(std::ostream& stream) const {
+  const uint64_t number_of_base_steps = current_step_;
+  stream << "Scheduler statistics: " << number_of_events_ << " events in " << number_of_base_steps << " base steps" << std::endl;
+  stream << std::left << std::setw(12) << "task" << std::right << std::setw(12) << "period[s]" << std::setw(14) << "executions" << std::setw(14)
+         << "total[ms]" << std::setw(14) << "mean[us]" << std::setw(14) << "max[us]" << std::endl;
+  for (const auto& task : tasks_) {
+    const double mean_time_s = (task.number_of_measurements > 0) ? task.total_execution_time_s / (double)task.number_of_measurements : 0.0;
+    stream << std::left << std::setw(12) << task.name << std::right << std::setw(12) << task.period_s << std::setw(14) << task.number_of_executions
+           << std::setw(14) << std::fixed << std::setprecision(3) << task.total_execution_time_s * 1.0e3 << std::setw(14) << mean_time_s * 1.0e6
+           << std::setw(14) << task.max_execution_time_s * 1.0e6 << std::defaultfloat << std::setprecision(6) << std::endl;
+  }
+}
@@ -0,0 +1,183 @@
+/**
+ * @file multi_rate_scheduler.hpp
+ * @brief Scheduler of periodic tasks with different update periods
+ */
+
+#ifndef S2E_ENVIRONMENT_GLOBAL_MULTI_RATE_SCHEDULER_HPP_
+#define S2E_ENVIRONMENT_GLOBAL_MULTI_RATE_SCHEDULER_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "library/utilities/checkpoint.hpp"
+
+/**
+ * @class MultiRateScheduler
+ * @brief Scheduler of periodic tasks with different update periods
+ * @details The periods are expressed as integer multiples of the base step to avoid the accumulation of rounding errors.
+ *          The scheduler jumps directly to the next step when at least one task is due instead of ticking all the base steps.
+ */
+class MultiRateScheduler {
+ public:
+  /**
+   * @struct Task
+   * @brief Periodic task and its statistics
+   */
+  struct Task {
+    std::string name;                     //!< Task name
+    double period_s = 0.0;                //!< Period specified by the user [s]
+    uint64_t period_steps = 1;            //!< Period expressed by the number of the base steps
+    uint64_t next_step = 0;               //!< Next due step
+    bool is_due = false;                  //!< Whether the task is due at the current step or not
+    uint64_t number_of_executions = 0;    //!< Number of the steps when the task was due
+    uint64_t number_of_measurements = 0;  //!< Number of the execution time measurements
+    double total_execution_time_s = 0.0;  //!< Total of the measured execution time [s]
+    double max_execution_time_s = 0.0;    //!< Maximum of the measured execution time [s]
+  };
+
+  /**
+   * @class ScopedTaskTimer
+   * @brief Timer to measure the execution time of a task in the scope
+   */
+  class ScopedTaskTimer {
+   public:
+    /**
+     * @fn ScopedTaskTimer
+     * @brief Constructor to start the measurement
+     * @param [in] scheduler: Scheduler
+     * @param [in] task_id: ID of the measured task
+     */
+    ScopedTaskTimer(const MultiRateScheduler& scheduler, const size_t task_id)
+        : scheduler_(scheduler), task_id_(task_id), start_time_(std::chrono::steady_clock::now()) {}
+    /**
+     * @fn ~ScopedTaskTimer
+     * @brief Destructor to record the measurement
+     */
+    ~ScopedTaskTimer() {
+      std::chrono::duration<double> duration_s = std::chrono::steady_clock::now() - start_time_;
+      scheduler_.RecordExecutionTime(task_id_, duration_s.count());
+    }
+
+   private:
+    const MultiRateScheduler& scheduler_;               //!< Scheduler
+    size_t task_id_;                                    //!< ID of the measured task
+    std::chrono::steady_clock::time_point start_time_;  //!< Start time of the measurement
+  };
+
+  /**
+   * @fn MultiRateScheduler
+   * @brief Constructor
+   * @param [in] base_step_s: Base step width which is the resolution of the scheduling [s]
+   */
+  explicit MultiRateScheduler(const double base_step_s);
+
+  /**
+   * @fn RegisterTask
+   * @brief Register a periodic task
+   * @param [in] name: Task name
+   * @param [in] period_s: Period [s] (Rounded up to the integer multiple of the base step)
+   * @return Task ID
+   */
+  size_t RegisterTask(const std::string& name, const double period_s);
+
+  /**
+   * @fn Reset
+   * @brief Reset the current step to zero and clear the statistics
+   */
+  void Reset();
+
+  /**
+   * @fn Advance
+   * @brief Jump to the next step when at least one task is due and update the due flags
+   */
+  void Advance();
+
+  /**
+   * @fn SkipTo
+   * @brief Jump forward to the specified time. The overdue tasks are executed once at the new step.
+   * @param [in] time_s: Target time [s]
+   */
+  void SkipTo(const double time_s);
+
+  /**
+   * @fn SaveState
+   * @brief Write the scheduling state to the checkpoint. The statistics are not written.
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the scheduling state from the checkpoint. The tasks should be registered in the same order.
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
+
+  /**
+   * @fn RecordExecutionTime
+   * @brief Record the measured execution time of the task
+   * @note The statistics are not a part of the scheduling state, so this function can be called with the const reference.
+   *       This function is thread-safe.
+   * @param [in] task_id: Task ID
+   * @param [in] execution_time_s: Execution time [s]
+   */
+  void RecordExecutionTime(const size_t task_id, const double execution_time_s) const;
+
+  /**
+   * @fn PrintStatistics
+   * @brief Print the statistics of the tasks
+   * @param [in] stream: Output stream
+   */
+  void PrintStatistics(std::ostream& stream) const;
+
+  // Getters
+  /**
+   * @fn IsDue
+   * @brief Return true when the task is due at the current step
+   * @param [in] task_id: Task ID
+   */
+  inline bool IsDue(const size_t task_id) const { return tasks_[task_id].is_due; }
+  /**
+   * @fn GetTime_s
+   * @brief Return current time [s]
+   */
+  inline double GetTime_s() const { return (double)current_step_ * base_step_s_; }
+  /**
+   * @fn GetBaseStep_s
+   * @brief Return base step width [s]
+   */
+  inline double GetBaseStep_s() const { return base_step_s_; }
+  /**
+   * @fn GetCurrentStep
+   * @brief Return current step expressed by the number of the base steps
+   */
+  inline uint64_t GetCurrentStep() const { return current_step_; }
+  /**
+   * @fn GetNumberOfEvents
+   * @brief Return number of the steps actually processed after the reset
+   */
+  inline uint64_t GetNumberOfEvents() const { return number_of_events_; }
+  /**
+   * @fn GetNumberOfTasks
+   * @brief Return number of the registered tasks
+   */
+  inline size_t GetNumberOfTasks() const { return tasks_.size(); }
+  /**
+   * @fn GetTask
+   * @brief Return task information and its statistics
+   * @param [in] task_id: Task ID
+   */
+  inline const Task& GetTask(const size_t task_id) const { return tasks_[task_id]; }
+
+ private:
+  double base_step_s_;                   //!< Base step width [s]
+  uint64_t current_step_ = 0;            //!< Current step expressed by the number of the base steps
+  uint64_t number_of_events_ = 0;        //!< Number of the processed steps
+  mutable std::vector<Task> tasks_;      //!< Registered tasks (mutable for the execution time statistics)
+  mutable std::mutex statistics_mutex_;  //!< Mutex for the statistics recorded by the spacecraft updated in parallel
+};
+
+#endif  // S2E_ENVIRONMENT_GLOBAL_MULTI_RATE_SCHEDULER_HPP_
@@ -20,7 +20,8 @@ using namespace std;
 SimulationTime::SimulationTime(const double end_sec, const double step_sec, const double attitude_update_interval_sec,
                                const double attitude_rk_step_sec, const double orbit_update_interval_sec, const double orbit_rk_step_sec,
                                const double thermal_update_interval_sec, const double thermal_rk_step_sec, const double compo_propagate_step_sec,
-                               const double log_output_interval_sec, const char* start_ymdhms, const double sim_speed) {
+                               const double log_output_interval_sec, const char* start_ymdhms, const double sim_speed)
+    : scheduler_(step_sec) {
   end_sec_ = end_sec;
   step_sec_ = step_sec;
   attitude_update_interval_sec_ = attitude_update_interval_sec;
@@ -33,9 +34,16 @@ SimulationTime::SimulationTime(const double end_sec, const double step_sec, cons
   component_update_interval_sec_ = compo_propagate_step_sec;
   component_propagate_frequency_Hz_ = int(1.0 / component_update_interval_sec_);
   simulation_speed_ = sim_speed;
-  display_period_ = (1.0 * end_sec / step_sec / 100);  // Update every 1%
   time_exceeds_continuously_limit_sec_ = 1.0;
 
+  // The registration order should be same with SimulationTask
+  scheduler_.RegisterTask("attitude", attitude_update_interval_sec_);
+  scheduler_.RegisterTask("orbit", orbit_update_interval_sec_);
+  scheduler_.RegisterTask("thermal", thermal_update_interval_sec_);
+  scheduler_.RegisterTask("component", component_update_interval_sec_);
+  scheduler_.RegisterTask("log", log_output_interval_sec_);
+  scheduler_.RegisterTask("display", end_sec / 100.0);  // Update every 1%
+
   //  sscanf_s(start_ymdhms, "%d/%d/%d %d:%d:%lf", &start_year_, &start_month_, &start_day_, &start_hour_, &start_minute_, &start_sec_);
   sscanf(start_ymdhms, "%d/%d/%d %d:%d:%lf", &start_year_, &start_month_, &start_day_, &start_hour_, &start_minute_, &start_sec_);
   jday(start_year_, start_month_, start_day_, start_hour_, start_minute_, start_sec_, start_jd_);
@@ -66,22 +74,15 @@ void SimulationTime::AssertTimeStepParams() {
 
 void SimulationTime::SetParameters(void) {
   elapsed_time_sec_ = 0.0;
-  attitude_update_counter_ = 1;
-  attitude_update_flag_ = false;
-  orbit_update_counter_ = 1;
-  orbit_update_flag_ = false;
-  thermal_update_counter_ = 1;
-  thermal_update_flag_ = false;
-  component_update_counter_ = 1;
-  component_update_flag_ = false;
-  log_counter_ = 0;
-  display_counter_ = 0;
+  scheduler_.Reset();
   state_.log_output = true;
 }
 
 void SimulationTime::UpdateTime(void) {
   InitializeState();
-  elapsed_time_sec_ += step_sec_;
+  // Jump to the next step when at least one task is due
+  scheduler_.Advance();
+  elapsed_time_sec_ = scheduler_.GetTime_s();
   if (simulation_speed_ > 0) {
     chrono::system_clock clk;
     int toWaitTime = (int)(elapsed_time_sec_ * 1000 -
@@ -96,8 +97,9 @@ void SimulationTime::UpdateTime(void) {
         cout << "Error: the specified step_sec is too small for this computer.\r\n";
 
         // Forcibly set elapsed_tim_sec_ as actual elapsed time Reason: to catch up with real time when resume from a breakpoint
-        elapsed_time_sec_ =
-            (chrono::duration_cast<chrono::duration<double, ratio<1, 1>>>(clk.now() - clock_start_time_millisec_).count() * simulation_speed_);
+        scheduler_.SkipTo(chrono::duration_cast<chrono::duration<double, ratio<1, 1>>>(clk.now() - clock_start_time_millisec_).count() *
+                          simulation_speed_);
+        elapsed_time_sec_ = scheduler_.GetTime_s();
 
         clock_last_time_completed_step_in_time_ = clk.now();
       }
@@ -113,13 +115,6 @@ void SimulationTime::UpdateTime(void) {
     }
   }
 
-  attitude_update_counter_++;
-  orbit_update_counter_++;
-  thermal_update_counter_++;
-  component_update_counter_++;
-  log_counter_++;
-  display_counter_++;
-
   if (elapsed_time_sec_ > end_sec_) {
     state_.finish = true;
   }
@@ -129,45 +124,43 @@ void SimulationTime::UpdateTime(void) {
   JdToDecyear(current_jd_, &current_decyear_);
   ConvJDtoCalendarDay(current_jd_);
 
-  attitude_update_flag_ = false;
-  if (double(attitude_update_counter_) * step_sec_ >= attitude_update_interval_sec_) {
-    attitude_update_counter_ = 0;
-    attitude_update_flag_ = true;
-  }
-
-  orbit_update_flag_ = false;
-  if (double(orbit_update_counter_) * step_sec_ >= orbit_update_interval_sec_) {
-    orbit_update_counter_ = 0;
-    orbit_update_flag_ = true;
-  }
+  state_.log_output = scheduler_.IsDue((size_t)SimulationTask::kLog);
+  state_.disp_output = scheduler_.IsDue((size_t)SimulationTask::kDisplay);
 
-  thermal_update_flag_ = false;
-  if (double(thermal_update_counter_) * step_sec_ >= thermal_update_interval_sec_) {
-    thermal_update_counter_ = 0;
-    thermal_update_flag_ = true;
-  }
+  state_.running = true;
+}
 
-  component_update_flag_ = false;
-  if (double(component_update_counter_) * step_sec_ >= component_update_interval_sec_) {
-    component_update_counter_ = 0;
-    component_update_flag_ = true;
-  }
+void SimulationTime::ResetClock(void) { clock_start_time_millisec_ = chrono::system_clock::now(); }
 
-  if (double(log_counter_) * step_sec_ >= log_output_interval_sec_) {
-    log_counter_ = 0;
-    state_.log_output = true;
-  }
+void SimulationTime::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("SimulationTime");
+  writer.Write(elapsed_time_sec_);
+  writer.Write(current_jd_);
+  writer.Write(current_sidereal_);
+  writer.Write(current_decyear_);
+  writer.Write(current_utc_);
+  writer.Write(state_);
+  scheduler_.SaveState(writer);
+}
 
-  if (display_counter_ >= display_period_) {
-    display_counter_ -= (int)display_period_;
-    state_.disp_output = true;
+void SimulationTime::LoadState(CheckpointReader& reader) {
+  reader.BeginSection("SimulationTime");
+  reader.Read(elapsed_time_sec_);
+  reader.Read(current_jd_);
+  reader.Read(current_sidereal_);
+  reader.Read(current_decyear_);
+  reader.Read(current_utc_);
+  reader.Read(state_);
+  scheduler_.LoadState(reader);
+
+  // Shift the start of the wall clock so that the real time simulation continues from the restored time
+  if (simulation_speed_ > 0) {
+    const chrono::duration<double> elapsed_wall_clock_time_s(elapsed_time_sec_ / simulation_speed_);
+    clock_start_time_millisec_ = chrono::system_clock::now() - chrono::duration_cast<chrono::system_clock::duration>(elapsed_wall_clock_time_s);
   }
-
-  state_.running = true;
+  clock_last_time_completed_step_in_time_ = chrono::system_clock::now();
 }
 
-void SimulationTime::ResetClock(void) { clock_start_time_millisec_ = chrono::system_clock::now(); }
-
 void SimulationTime::PrintStartDateTime(void) const {
   int sec_int = int(start_sec_ + 0.5);
   stringstream s, m, h;
@@ -213,6 +206,11 @@ string SimulationTime::GetLogValue() const {
   return str_tmp;
 }
 
+void SimulationTime::PushLogValue(LogValueBuffer& buffer) const {
+  buffer.Push(elapsed_time_sec_);
+  buffer.PushDateTime(current_utc_.year, current_utc_.month, current_utc_.day, current_utc_.hour, current_utc_.minute, current_utc_.second);
+}
+
 void SimulationTime::InitializeState() {
   state_.disp_output = false;
   state_.finish = false;
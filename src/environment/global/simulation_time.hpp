@@ -18,6 +18,7 @@
 #include "library/external/sgp4/sgp4io.h"
 #include "library/external/sgp4/sgp4unit.h"
 #include "library/logger/loggable.hpp"
+#include "multi_rate_scheduler.hpp"
 
 /**
  *@struct TimeState
@@ -30,6 +31,19 @@ struct TimeState {
   bool disp_output = true;
 };
 
+/**
+ *@enum SimulationTask
+ *@brief Periodic tasks managed by the scheduler of SimulationTime (The values are the task IDs of the scheduler)
+ */
+enum class SimulationTask : size_t {
+  kAttitude = 0,  //!< Attitude propagation
+  kOrbit,         //!< Orbit propagation
+  kThermal,       //!< Thermal propagation
+  kComponent,     //!< Component update
+  kLog,           //!< Log output
+  kDisplay,       //!< Progress display
+};
+
 /**
  *@struct UTC
  *@brief UTC (Coordinated Universal Time) calendar expression
@@ -116,7 +130,7 @@ class SimulationTime : public ILoggable {
    *@fn GetAttitudePropagateFlag
    *@brief Return attitude propagate flag
    */
-  inline bool GetAttitudePropagateFlag(void) const { return attitude_update_flag_; };
+  inline bool GetAttitudePropagateFlag(void) const { return scheduler_.IsDue((size_t)SimulationTask::kAttitude); };
   /**
    *@fn GetAttitudeRkStepTime_s
    *@brief Return attitude Runge-Kutta step time [sec]
@@ -132,7 +146,7 @@ class SimulationTime : public ILoggable {
    *@fn GetOrbitPropagateFlag
    *@brief Return orbit propagate flag
    */
-  inline bool GetOrbitPropagateFlag(void) const { return orbit_update_flag_; };
+  inline bool GetOrbitPropagateFlag(void) const { return scheduler_.IsDue((size_t)SimulationTask::kOrbit); };
   /**
    *@fn GetOrbitRkStepTime_s
    *@brief Return orbit Runge-Kutta step time [sec]
@@ -148,7 +162,7 @@ class SimulationTime : public ILoggable {
    *@fn GetThermalPropagateFlag
    *@brief Return thermal propagate flag
    */
-  inline bool GetThermalPropagateFlag(void) const { return thermal_update_flag_; };
+  inline bool GetThermalPropagateFlag(void) const { return scheduler_.IsDue((size_t)SimulationTask::kThermal); };
   /**
    *@fn GetThermalRkStepTime_s
    *@brief Return thermal Runge-Kutta step time [sec]
@@ -164,7 +178,7 @@ class SimulationTime : public ILoggable {
    *@fn GetCompoUpdateFlag
    *@brief Return component update flag
    */
-  inline bool GetCompoUpdateFlag() const { return component_update_flag_; }
+  inline bool GetCompoUpdateFlag() const { return scheduler_.IsDue((size_t)SimulationTask::kComponent); }
   /**
    *@fn GetComponentPropagateFrequency_Hz
    *@brief Return component propagate frequency [Hz]
@@ -233,6 +247,36 @@ class SimulationTime : public ILoggable {
    *@brief Return start time second [sec]
    */
   inline double GetStartSecond(void) const { return start_sec_; };
+  /**
+   *@fn GetScheduler
+   *@brief Return scheduler of the periodic tasks
+   */
+  inline const MultiRateScheduler& GetScheduler(void) const { return scheduler_; };
+  /**
+   *@fn GetSchedulerStatisticsOutput
+   *@brief Return flag to print the scheduler statistics at the end of the simulation
+   */
+  inline bool GetSchedulerStatisticsOutput(void) const { return scheduler_statistics_output_; };
+
+  // Setter
+  /**
+   *@fn SetSchedulerStatisticsOutput
+   *@brief Set flag to print the scheduler statistics at the end of the simulation
+   */
+  inline void SetSchedulerStatisticsOutput(const bool scheduler_statistics_output) { scheduler_statistics_output_ = scheduler_statistics_output; };
+
+  /**
+   * @fn SaveState
+   * @brief Write the current time and the scheduling state to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the current time and the scheduling state from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
 
   // Override ILoggable
   /**
@@ -245,6 +289,11 @@ class SimulationTime : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn PushLogValue
+   * @brief Override PushLogValue function of ILoggable
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const;
 
   /**
    * @fn PrintStartDateTime
@@ -261,17 +310,9 @@ class SimulationTime : public ILoggable {
   UTC current_utc_;          //!< UTC calendar day
 
   // Timing controller
-  int attitude_update_counter_;   //!< Update counter for attitude calculation
-  bool attitude_update_flag_;     //!< Update flag for attitude calculation
-  int orbit_update_counter_;      //!< Update counter for orbit calculation
-  bool orbit_update_flag_;        //!< Update flag for orbit calculation
-  int thermal_update_counter_;    //!< Update counter for thermal calculation
-  bool thermal_update_flag_;      //!< Update flag for thermal calculation
-  int component_update_counter_;  //!< Update counter for component calculation
-  bool component_update_flag_;    //!< Update flag for component calculation
-  int log_counter_;               //!< Update counter for log output
-  int display_counter_;           //!< Update counter for display output
-  TimeState state_;               //!< State of timing controller
+  MultiRateScheduler scheduler_;              //!< Scheduler of the periodic tasks
+  bool scheduler_statistics_output_ = false;  //!< Flag to print the scheduler statistics at the end of the simulation
+  TimeState state_;                           //!< State of timing controller
 
   // Calculation time measure
   std::chrono::system_clock::time_point clock_start_time_millisec_;  //!< Simulation start time [ms]
@@ -290,7 +331,6 @@ class SimulationTime : public ILoggable {
   double component_update_interval_sec_;  //!< Update intercal for component calculation [sec]
   int component_propagate_frequency_Hz_;  //!< Component propagation frequency [Hz]
   double log_output_interval_sec_;        //!< Log output interval [sec]
-  double display_period_;                 //!< Display output period [sec]
 
   double start_jd_;   //!< Simulation start Julian date [day]
   int start_year_;    //!< Simulation start year
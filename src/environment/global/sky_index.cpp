@@ -0,0 +1,132 @@
+/**
+ * @file sky_index.cpp
+ * @brief Hierarchical spatial index of directions on the celestial sphere
+ */
+
+#include "sky_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "library/math/constants.hpp"
+
+namespace {
+/**
+ * @fn CalcFaceDirection
+ * @brief Return the unit vector of the point on the cube face
+ * @param [in] face: Face ID (2 * axis + (0: positive, 1: negative))
+ * @param [in] u: First coordinate on the face [-1, 1]
+ * @param [in] w: Second coordinate on the face [-1, 1]
+ */
+libra::Vector<3> CalcFaceDirection(const size_t face, const double u, const double w) {
+  const size_t axis = face / 2;
+  libra::Vector<3> direction;
+  direction[axis] = (face % 2 == 0) ? 1.0 : -1.0;
+  direction[(axis + 1) % 3] = u;
+  direction[(axis + 2) % 3] = w;
+  return direction.CalcNormalizedVector();
+}
+}  // namespace
+
+SkyIndex::SkyIndex(const size_t level) : level_(level) {
+  cells_per_side_ = (size_t)1 << level_;
+  nodes_per_face_ = (((size_t)1 << (2 * (level_ + 1))) - 1) / 3;
+
+  // Precompute the center and the radius of the quadtree nodes
+  nodes_.resize(kNumberOfFaces * nodes_per_face_);
+  for (size_t face = 0; face < kNumberOfFaces; face++) {
+    for (size_t level = 0; level <= level_; level++) {
+      const size_t nodes_per_side = (size_t)1 << level;
+      const double width = 2.0 / nodes_per_side;
+      for (size_t i = 0; i < nodes_per_side; i++) {
+        for (size_t j = 0; j < nodes_per_side; j++) {
+          const double u_min = -1.0 + width * i;
+          const double w_min = -1.0 + width * j;
+          Node& node = nodes_[GetNodeId(face, level, i, j)];
+          node.center_direction = CalcFaceDirection(face, u_min + width / 2.0, w_min + width / 2.0);
+
+          // The node is bounded by great circles, so the farthest point from the center is one of the corners
+          double min_cos = 1.0;
+          for (size_t corner = 0; corner < 4; corner++) {
+            const libra::Vector<3> corner_direction = CalcFaceDirection(face, u_min + width * (corner / 2), w_min + width * (corner % 2));
+            min_cos = std::min(min_cos, libra::InnerProduct(node.center_direction, corner_direction));
+          }
+          node.radius_rad = acos(std::max(-1.0, std::min(1.0, min_cos))) + 1.0e-9;  // Margin for the rounding error
+          node.cos_radius = cos(node.radius_rad);
+          node.sin_radius = sin(node.radius_rad);
+        }
+      }
+    }
+  }
+  cell_offsets_.assign(GetNumberOfCells() + 1, 0);
+}
+
+void SkyIndex::Build(const std::vector<libra::Vector<3>>& directions) {
+  // Counting sort by the cell keeps the ascending order of the indices in each cell
+  std::vector<size_t> cell_ids(directions.size());
+  std::fill(cell_offsets_.begin(), cell_offsets_.end(), 0);
+  for (size_t i = 0; i < directions.size(); i++) {
+    cell_ids[i] = GetCellId(directions[i]);
+    cell_offsets_[cell_ids[i] + 1]++;
+  }
+  for (size_t cell = 0; cell < GetNumberOfCells(); cell++) cell_offsets_[cell + 1] += cell_offsets_[cell];
+
+  std::vector<size_t> positions(cell_offsets_.begin(), cell_offsets_.end() - 1);
+  cell_indices_.resize(directions.size());
+  cell_directions_.resize(directions.size());
+  for (size_t i = 0; i < directions.size(); i++) {
+    const size_t position = positions[cell_ids[i]]++;
+    cell_indices_[position] = i;
+    cell_directions_[position] = directions[i];
+  }
+}
+
+void SkyIndex::FindInCone(const libra::Vector<3>& center_direction, const double half_angle_rad, std::vector<size_t>& indices) const {
+  indices.clear();
+  if (half_angle_rad < 0.0) return;
+  const double cos_half_angle = cos(half_angle_rad);
+  const double sin_half_angle = sin(half_angle_rad);
+  for (size_t face = 0; face < kNumberOfFaces; face++) {
+    VisitNode(face, 0, 0, 0, center_direction, half_angle_rad, cos_half_angle, sin_half_angle, indices);
+  }
+  std::sort(indices.begin(), indices.end());
+}
+
+size_t SkyIndex::GetCellId(const libra::Vector<3>& direction) const {
+  size_t axis = 0;
+  for (size_t k = 1; k < 3; k++) {
+    if (std::abs(direction[k]) > std::abs(direction[axis])) axis = k;
+  }
+  const size_t face = 2 * axis + (direction[axis] < 0.0 ? 1 : 0);
+  const double scale = std::abs(direction[axis]);
+  if (scale == 0.0) return 0;
+
+  const double u = direction[(axis + 1) % 3] / scale;
+  const double w = direction[(axis + 2) % 3] / scale;
+  const size_t i = std::min(cells_per_side_ - 1, (size_t)std::max(0.0, (u + 1.0) / 2.0 * cells_per_side_));
+  const size_t j = std::min(cells_per_side_ - 1, (size_t)std::max(0.0, (w + 1.0) / 2.0 * cells_per_side_));
+  return (face * cells_per_side_ + i) * cells_per_side_ + j;
+}
+
+void SkyIndex::VisitNode(const size_t face, const size_t level, const size_t i, const size_t j, const libra::Vector<3>& center_direction,
+                         const double half_angle_rad, const double cos_half_angle, const double sin_half_angle,
+                         std::vector<size_t>& indices) const {
+  // Skip the node when the angle between the centers is larger than the sum of the half angle and the radius
+  const Node& node = nodes_[GetNodeId(face, level, i, j)];
+  if (half_angle_rad + node.radius_rad < libra::pi) {
+    const double cos_limit = cos_half_angle * node.cos_radius - sin_half_angle * node.sin_radius;
+    if (libra::InnerProduct(node.center_direction, center_direction) < cos_limit) return;
+  }
+
+  if (level < level_) {
+    for (size_t child = 0; child < 4; child++) {
+      VisitNode(face, level + 1, 2 * i + child / 2, 2 * j + child % 2, center_direction, half_angle_rad, cos_half_angle, sin_half_angle, indices);
+    }
+    return;
+  }
+
+  const size_t cell = (face * cells_per_side_ + i) * cells_per_side_ + j;
+  for (size_t k = cell_offsets_[cell]; k < cell_offsets_[cell + 1]; k++) {
+    if (libra::InnerProduct(cell_directions_[k], center_direction) >= cos_half_angle) indices.push_back(cell_indices_[k]);
+  }
+}
@@ -0,0 +1,101 @@
+/**
+ * @file sky_index.hpp
+ * @brief Hierarchical spatial index of directions on the celestial sphere
+ */
+
+#ifndef S2E_ENVIRONMENT_GLOBAL_SKY_INDEX_HPP_
+#define S2E_ENVIRONMENT_GLOBAL_SKY_INDEX_HPP_
+
+#include <cstddef>
+#include <vector>
+
+#include "library/math/vector.hpp"
+
+/**
+ * @class SkyIndex
+ * @brief Hierarchical spatial index of directions on the celestial sphere
+ * @details The sphere is divided into the six faces of a cube, and each face is divided by a quadtree in the gnomonic projection. Every
+ *          quadtree node has the precomputed center direction and angular radius, so a cone query visits only the nodes overlapping
+ *          the cone without trigonometric functions. The directions are registered with their indices, and the query returns the
+ *          indices in ascending order. When the indices are the ranks of the magnitude, the result is in brightness order.
+ */
+class SkyIndex {
+ public:
+  /**
+   * @fn SkyIndex
+   * @brief Constructor
+   * @param [in] level: Depth of the quadtree. Each face is divided into (2^level x 2^level) cells.
+   */
+  SkyIndex(const size_t level = 5);
+
+  /**
+   * @fn Build
+   * @brief Build the index of the directions
+   * @param [in] directions: Unit direction vectors. The position in the vector is used as the index.
+   */
+  void Build(const std::vector<libra::Vector<3>>& directions);
+  /**
+   * @fn FindInCone
+   * @brief Find the directions in the cone
+   * @param [in] center_direction: Unit vector of the center of the cone
+   * @param [in] half_angle_rad: Half angle of the cone [rad]
+   * @param [out] indices: Indices of the directions in the cone in ascending order
+   */
+  void FindInCone(const libra::Vector<3>& center_direction, const double half_angle_rad, std::vector<size_t>& indices) const;
+
+  // Getters
+  /**
+   * @fn GetNumberOfDirections
+   * @brief Return number of the registered directions
+   */
+  inline size_t GetNumberOfDirections() const { return cell_indices_.size(); }
+  /**
+   * @fn GetNumberOfCells
+   * @brief Return number of the leaf cells
+   */
+  inline size_t GetNumberOfCells() const { return kNumberOfFaces * cells_per_side_ * cells_per_side_; }
+
+  static const size_t kNumberOfFaces = 6;  //!< Number of the cube faces
+
+ private:
+  /**
+   * @struct Node
+   * @brief Quadtree node
+   */
+  struct Node {
+    libra::Vector<3> center_direction;  //!< Unit vector of the center of the node
+    double radius_rad;                  //!< Maximum angle between the center and the points in the node [rad]
+    double cos_radius;                  //!< Cosine of the radius
+    double sin_radius;                  //!< Sine of the radius
+  };
+
+  size_t level_;                                   //!< Depth of the quadtree
+  size_t cells_per_side_;                          //!< Number of the leaf cells per side of a face
+  size_t nodes_per_face_;                          //!< Number of the quadtree nodes per face
+  std::vector<Node> nodes_;                        //!< Quadtree nodes of all faces
+  std::vector<size_t> cell_offsets_;               //!< Offsets of each leaf cell in the cell arrays
+  std::vector<size_t> cell_indices_;               //!< Indices of the directions sorted by the cell
+  std::vector<libra::Vector<3>> cell_directions_;  //!< Directions sorted by the cell
+
+  /**
+   * @fn GetNodeId
+   * @brief Return the position of the node in nodes_
+   */
+  inline size_t GetNodeId(const size_t face, const size_t level, const size_t i, const size_t j) const {
+    const size_t level_offset = (((size_t)1 << (2 * level)) - 1) / 3;
+    return face * nodes_per_face_ + level_offset + (i << level) + j;
+  }
+  /**
+   * @fn GetCellId
+   * @brief Return the leaf cell which includes the direction
+   */
+  size_t GetCellId(const libra::Vector<3>& direction) const;
+  /**
+   * @fn VisitNode
+   * @brief Visit the node and its children overlapping the cone, and append the directions in the cone
+   */
+  void VisitNode(const size_t face, const size_t level, const size_t i, const size_t j, const libra::Vector<3>& center_direction,
+                 const double half_angle_rad, const double cos_half_angle, const double sin_half_angle, std::vector<size_t>& indices) const;
+};
+
+#endif  // S2E_ENVIRONMENT_GLOBAL_SKY_INDEX_HPP_
@@ -0,0 +1,43 @@
+/**
+ * @file spice_ephemeris.cpp
+ * @brief Ephemeris source with direct SPICE calls
+ */
+
+#include "spice_ephemeris.hpp"
+
+#include <SpiceUsr.h>
+
+SpiceEphemeris::SpiceEphemeris(const std::string inertial_frame_name, const std::string aberration_correction_setting,
+                               const std::string center_body_name, const size_t number_of_bodies, const int* body_ids)
+    : inertial_frame_name_(inertial_frame_name), center_body_name_(center_body_name), aberration_correction_setting_(aberration_correction_setting) {
+  target_names_.resize(number_of_bodies);
+  for (size_t i = 0; i < number_of_bodies; i++) {
+    // Acquisition of body name from id
+    SpiceBoolean found;
+    const int kMaxNameLength = 100;
+    char name_buffer[kMaxNameLength];
+    bodc2n_c((SpiceInt)body_ids[i], kMaxNameLength, name_buffer, (SpiceBoolean*)&found);
+
+    // Add `BARYCENTER` if needed
+    std::string name = name_buffer;
+    if (name == "MARS" || name == "JUPITER" || name == "SATURN" || name == "URANUS" || name == "NEPTUNE" || name == "PLUTO") {
+      name += "_BARYCENTER";
+    }
+    target_names_[i] = name;
+  }
+}
+
+void SpiceEphemeris::GetState_km(const size_t body_index, const double ephemeris_time_s, double state_km[6]) {
+  SpiceDouble lt;
+  spkezr_c((ConstSpiceChar*)target_names_[body_index].c_str(), (SpiceDouble)ephemeris_time_s, (ConstSpiceChar*)inertial_frame_name_.c_str(),
+           (ConstSpiceChar*)aberration_correction_setting_.c_str(), (ConstSpiceChar*)center_body_name_.c_str(), (SpiceDouble*)state_km,
+           (SpiceDouble*)&lt);
+}
+
+double SpiceEphemeris::ConvertJulianDateToEphemerisTime_s(const double julian_date) {
+  // UTC seconds past J2000 and the difference between TDB and UTC including the leap seconds
+  const SpiceDouble utc_s = (julian_date - j2000_c()) * spd_c();
+  SpiceDouble delta_s;
+  deltet_c(utc_s, "UTC", &delta_s);
+  return utc_s + delta_s;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file spice_ephemeris.hpp
+ * @brief Ephemeris source with direct SPICE calls
+ */
+
+#ifndef S2E_ENVIRONMENT_GLOBAL_SPICE_EPHEMERIS_HPP_
+#define S2E_ENVIRONMENT_GLOBAL_SPICE_EPHEMERIS_HPP_
+
+#include <string>
+#include <vector>
+
+#include "ephemeris_cache.hpp"
+
+/**
+ * @class SpiceEphemeris
+ * @brief Ephemeris source with direct SPICE calls
+ * @note The SPICE target names of the bodies are resolved once in the constructor.
+ */
+class SpiceEphemeris : public IEphemerisSource {
+ public:
+  /**
+   * @fn SpiceEphemeris
+   * @brief Constructor
+   * @param [in] inertial_frame_name: Definition of inertial frame
+   * @param [in] aberration_correction_setting: Stellar aberration correction
+   * @param [in] center_body_name: Center object name of inertial frame
+   * @param [in] number_of_bodies: Number of bodies
+   * @param [in] body_ids: SPICE IDs of the bodies
+   */
+  SpiceEphemeris(const std::string inertial_frame_name, const std::string aberration_correction_setting, const std::string center_body_name,
+                 const size_t number_of_bodies, const int* body_ids);
+
+  /**
+   * @fn GetState_km
+   * @brief Calculate the position and velocity of the body with spkezr_c
+   * @param [in] body_index: Index of the body in the selected body list
+   * @param [in] ephemeris_time_s: Ephemeris time (TDB seconds past J2000) [s]
+   * @param [out] state_km: Position [km] and velocity [km/s]
+   */
+  void GetState_km(const size_t body_index, const double ephemeris_time_s, double state_km[6]) override;
+
+  /**
+   * @fn ConvertJulianDateToEphemerisTime_s
+   * @brief Convert UTC Julian date to the ephemeris time without string formatting
+   * @param [in] julian_date: Julian date (UTC)
+   * @return Ephemeris time (TDB seconds past J2000) [s]
+   */
+  static double ConvertJulianDateToEphemerisTime_s(const double julian_date);
+
+ private:
+  std::string inertial_frame_name_;            //!< Definition of inertial frame
+  std::string center_body_name_;               //!< Center object name of inertial frame
+  std::string aberration_correction_setting_;  //!< Stellar aberration correction
+  std::vector<std::string> target_names_;      //!< SPICE target names of the bodies
+};
+
+#endif  // S2E_ENVIRONMENT_GLOBAL_SPICE_EPHEMERIS_HPP_
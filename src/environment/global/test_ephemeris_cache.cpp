@@ -0,0 +1,154 @@
+/**
+ * @file test_ephemeris_cache.cpp
+ * @brief Test codes for EphemerisCache class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <library/math/constants.hpp>
+
+#include "ephemeris_cache.hpp"
+
+namespace {
+
+/**
+ * @class CircularOrbitSource
+ * @brief Analytical ephemeris source of a circular orbit like the Moon
+ */
+class CircularOrbitSource : public IEphemerisSource {
+ public:
+  void GetState_km(const size_t body_index, const double ephemeris_time_s, double state_km[6]) override {
+    const double radius_km = 384400.0 * (double)(body_index + 1);
+    const double angular_velocity_rad_s = 2.66e-6 / (double)(body_index + 1);
+    const double angle_rad = angular_velocity_rad_s * ephemeris_time_s;
+    state_km[0] = radius_km * cos(angle_rad);
+    state_km[1] = radius_km * sin(angle_rad);
+    state_km[2] = 0.1 * radius_km * sin(angle_rad);
+    state_km[3] = -radius_km * angular_velocity_rad_s * sin(angle_rad);
+    state_km[4] = radius_km * angular_velocity_rad_s * cos(angle_rad);
+    state_km[5] = 0.1 * radius_km * angular_velocity_rad_s * cos(angle_rad);
+  }
+};
+
+/**
+ * @class NoisySource
+ * @brief Ephemeris source which cannot be interpolated
+ */
+class NoisySource : public IEphemerisSource {
+ public:
+  void GetState_km(const size_t body_index, const double ephemeris_time_s, double state_km[6]) override {
+    (void)body_index;
+    for (size_t i = 0; i < 6; i++) state_km[i] = 1.0e3 * sin(1.0e6 * ephemeris_time_s + (double)i);
+  }
+};
+
+/**
+ * @class LocalWiggleSource
+ * @brief Ephemeris source of a circular orbit with a fast wiggle only around the wiggle time
+ */
+class LocalWiggleSource : public IEphemerisSource {
+ public:
+  static constexpr double kWiggleTime_s = 6.4e8;  //!< Center time of the wiggle [s]
+
+  void GetState_km(const size_t body_index, const double ephemeris_time_s, double state_km[6]) override {
+    CircularOrbitSource().GetState_km(body_index, ephemeris_time_s, state_km);
+    const double amplitude_km = 100.0;
+    const double angular_velocity_rad_s = 2.0 * libra::pi / 3600.0;
+    const double width_s = 86400.0;
+    const double relative_time_s = ephemeris_time_s - kWiggleTime_s;
+    const double envelope = exp(-pow(relative_time_s / width_s, 2.0));
+    const double envelope_rate_1_s = -2.0 * relative_time_s / (width_s * width_s) * envelope;
+    state_km[0] += amplitude_km * envelope * sin(angular_velocity_rad_s * ephemeris_time_s);
+    state_km[3] += amplitude_km * (envelope_rate_1_s * sin(angular_velocity_rad_s * ephemeris_time_s) +
+                                   envelope * angular_velocity_rad_s * cos(angular_velocity_rad_s * ephemeris_time_s));
+  }
+};
+
+/**
+ * @fn CheckInterpolation
+ * @brief Compare the cached ephemeris with the source over 30 days
+ */
+void CheckInterpolation(const EphemerisInterpolationMethod method) {
+  const double tolerance_m = 1.0;
+  const size_t number_of_bodies = 2;
+  CircularOrbitSource source;
+  EphemerisCache cache(&source, number_of_bodies, method, 86400.0, tolerance_m);
+
+  const double start_time_s = 6.4e8;
+  const double step_s = 60.0;
+  const size_t number_of_steps = 30 * 1440;
+  for (size_t step = 0; step < number_of_steps; step++) {
+    const double ephemeris_time_s = start_time_s + step_s * (double)step;
+    for (size_t body = 0; body < number_of_bodies; body++) {
+      double reference_km[6], interpolated_km[6];
+      source.GetState_km(body, ephemeris_time_s, reference_km);
+      cache.GetState_km(body, ephemeris_time_s, interpolated_km);
+      for (size_t i = 0; i < 3; i++) {
+        EXPECT_NEAR(reference_km[i], interpolated_km[i], tolerance_m * 1.0e-3);
+        EXPECT_NEAR(reference_km[i + 3], interpolated_km[i + 3], 1.0e-6);
+      }
+    }
+  }
+  for (size_t body = 0; body < number_of_bodies; body++) EXPECT_FALSE(cache.IsFallback(body));
+  EXPECT_LT(cache.GetNumberOfSourceCalls(), number_of_steps * number_of_bodies / 50);
+}
+
+/**
+ * @fn CheckHistoryIndependence
+ * @brief Compare the cached ephemeris at the same time after different query histories
+ */
+void CheckHistoryIndependence(const EphemerisInterpolationMethod method) {
+  const double initial_segment_length_s = 86400.0;
+  LocalWiggleSource source;
+  EphemerisCache direct_cache(&source, 1, method, initial_segment_length_s, 1.0);
+  EphemerisCache history_cache(&source, 1, method, initial_segment_length_s, 1.0);
+
+  // The wiggle makes the segment of the history cache shorter
+  double state_km[6];
+  history_cache.GetState_km(0, LocalWiggleSource::kWiggleTime_s, state_km);
+  EXPECT_LT(history_cache.GetSegmentLength_s(0), initial_segment_length_s);
+
+  const double ephemeris_time_s = LocalWiggleSource::kWiggleTime_s + 10.0 * 86400.0 + 1234.5;
+  double direct_km[6], history_km[6];
+  direct_cache.GetState_km(0, ephemeris_time_s, direct_km);
+  history_cache.GetState_km(0, ephemeris_time_s, history_km);
+  EXPECT_FALSE(direct_cache.IsFallback(0));
+  EXPECT_FALSE(history_cache.IsFallback(0));
+  EXPECT_DOUBLE_EQ(direct_cache.GetSegmentLength_s(0), history_cache.GetSegmentLength_s(0));
+  for (size_t i = 0; i < 6; i++) EXPECT_EQ(direct_km[i], history_km[i]);
+}
+
+}  // namespace
+
+/**
+ * @brief Test for the Chebyshev interpolation
+ */
+TEST(EphemerisCache, Chebyshev) { CheckInterpolation(EphemerisInterpolationMethod::kChebyshev); }
+
+/**
+ * @brief Test for the Hermite interpolation
+ */
+TEST(EphemerisCache, Hermite) { CheckInterpolation(EphemerisInterpolationMethod::kHermite); }
+
+/**
+ * @brief Test for the fallback to the direct source call
+ */
+TEST(EphemerisCache, Fallback) {
+  NoisySource source;
+  EphemerisCache cache(&source, 1, EphemerisInterpolationMethod::kChebyshev, 86400.0, 1.0);
+
+  const double ephemeris_time_s = 1000.0;
+  double reference_km[6], result_km[6];
+  source.GetState_km(0, ephemeris_time_s, reference_km);
+  cache.GetState_km(0, ephemeris_time_s, result_km);
+  EXPECT_TRUE(cache.IsFallback(0));
+  for (size_t i = 0; i < 6; i++) EXPECT_DOUBLE_EQ(reference_km[i], result_km[i]);
+}
+
+/**
+ * @brief Test that the result does not depend on the query history
+ */
+TEST(EphemerisCache, HistoryIndependence) {
+  CheckHistoryIndependence(EphemerisInterpolationMethod::kChebyshev);
+  CheckHistoryIndependence(EphemerisInterpolationMethod::kHermite);
+}
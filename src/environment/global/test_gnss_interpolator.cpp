@@ -0,0 +1,289 @@
+/**
+ * @file test_gnss_interpolator.cpp
+ * @brief Test codes for GnssInterpolator class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "gnss_interpolator.hpp"
+#include "gnss_product_cache.hpp"
+#include "gnss_satellites.hpp"
+#include "physical_constants.hpp"
+
+namespace {
+
+const size_t kNumberOfNodes = 9;
+const double kNodeInterval_s = 900.0;
+const double kStartUnixTime_s = 1.6e9;
+
+/**
+ * @fn CalcOrbitPosition_m
+ * @brief Position of a circular orbit like the GNSS satellites [m]
+ */
+double CalcOrbitPosition_m(const size_t axis, const size_t satellite_id, const double time_s) {
+  const double radius_m = 2.656e7;
+  const double angular_velocity_rad_s = 1.4584e-4;
+  const double angle_rad = angular_velocity_rad_s * time_s + 0.1 * (double)satellite_id;
+  if (axis == 0) return radius_m * cos(angle_rad);
+  if (axis == 1) return radius_m * sin(angle_rad) * 0.5;
+  return radius_m * sin(angle_rad) * 0.8;
+}
+
+/**
+ * @fn NaiveInterpolation
+ * @brief Reference O(n^2) interpolation with the product of the basis ratio
+ */
+double NaiveInterpolation(const GnssInterpolationMethod method, const std::vector<double>& times, const std::vector<double>& values,
+                          const double time) {
+  double result = 0.0;
+  for (size_t i = 0; i < times.size(); i++) {
+    double basis = 1.0;
+    for (size_t j = 0; j < times.size(); j++) {
+      if (i == j) continue;
+      if (method == GnssInterpolationMethod::kTrigonometric) {
+        const double w = GnssInterpolator::kTrigonometricAngularVelocity_rad_s;
+        basis *= sin(w * (time - times[j]) / 2.0) / sin(w * (times[i] - times[j]) / 2.0);
+      } else {
+        basis *= (time - times[j]) / (times[i] - times[j]);
+      }
+    }
+    result += basis * values[i];
+  }
+  return result;
+}
+
+/**
+ * @fn CheckMethod
+ * @brief Compare the barycentric interpolation with the naive interpolation
+ */
+void CheckMethod(const GnssInterpolationMethod method) {
+  const size_t number_of_satellites = 4;
+  GnssInterpolator interpolator;
+  interpolator.Initialize(method, number_of_satellites, kNumberOfNodes, 3);
+
+  std::vector<std::vector<double>> times(number_of_satellites), values(number_of_satellites * 3);
+  for (size_t s = 0; s < number_of_satellites; s++) {
+    std::vector<double> node_values;
+    for (size_t k = 0; k < kNumberOfNodes; k++) {
+      // Non uniform nodes like the missing epochs
+      const double time_s = kStartUnixTime_s + kNodeInterval_s * (double)(k + (k > 5 ? 1 : 0)) + 10.0 * (double)s;
+      times[s].push_back(time_s);
+      for (size_t i = 0; i < 3; i++) {
+        node_values.push_back(CalcOrbitPosition_m(i, s, time_s));
+        values[s * 3 + i].push_back(node_values.back());
+      }
+    }
+    interpolator.SetWindow(s, &times[s][0], &node_values[0]);
+    EXPECT_TRUE(interpolator.IsWindowSet(s));
+  }
+
+  std::vector<size_t> targets = {0, 1, 3};
+  std::vector<double> batch_values(number_of_satellites * 3, -1.0);
+  for (double offset_s = 0.0; offset_s <= kNodeInterval_s * 8.0; offset_s += 137.0) {
+    const double time_s = kStartUnixTime_s + offset_s;
+    interpolator.Interpolate(time_s, targets, &batch_values[0]);
+    for (size_t s = 0; s < number_of_satellites; s++) {
+      double single_values[3];
+      interpolator.Interpolate(s, time_s, single_values);
+      for (size_t i = 0; i < 3; i++) {
+        const double reference = NaiveInterpolation(method, times[s], values[s * 3 + i], time_s);
+        EXPECT_NEAR(reference, single_values[i], 1.0e-6);
+        if (s == 2) {
+          EXPECT_DOUBLE_EQ(-1.0, batch_values[s * 3 + i]);
+        } else {
+          EXPECT_DOUBLE_EQ(single_values[i], batch_values[s * 3 + i]);
+        }
+      }
+    }
+  }
+
+  // Query on a node returns the node value
+  double node_values[3];
+  interpolator.Interpolate(1, times[1][4], node_values);
+  for (size_t i = 0; i < 3; i++) EXPECT_DOUBLE_EQ(values[3 + i][4], node_values[i]);
+
+  interpolator.InvalidateWindow(1);
+  EXPECT_FALSE(interpolator.IsWindowSet(1));
+}
+
+/**
+ * @fn MakeSp3File
+ * @brief Make SP3 file lines of all GNSS satellites on the circular orbits
+ * @param [in] start_tm: Calendar time of the first epoch
+ * @param [in] number_of_epochs: Number of epochs
+ * @param [in] satellite_ids: SP3 satellite IDs
+ */
+std::vector<std::vector<std::string>> MakeSp3File(const tm& start_tm, const size_t number_of_epochs, const std::vector<std::string>& satellite_ids) {
+  std::vector<std::string> lines;
+  char buffer[256];
+  snprintf(buffer, sizeof(buffer), "#cP%4d %2d %2d %2d %2d %11.8f %7zu ORBIT IGS14 HLM  IGS", start_tm.tm_year + 1900, start_tm.tm_mon + 1,
+           start_tm.tm_mday, start_tm.tm_hour, start_tm.tm_min, 0.0, number_of_epochs);
+  lines.push_back(buffer);
+  snprintf(buffer, sizeof(buffer), "## 2086 259200.00000000 %14.8f 58849 0.0000000000000", kNodeInterval_s);
+  lines.push_back(buffer);
+  snprintf(buffer, sizeof(buffer), "+  %3zu", satellite_ids.size());
+  lines.push_back(buffer);
+  for (size_t epoch = 0; epoch < number_of_epochs; epoch++) {
+    tm epoch_tm = start_tm;
+    epoch_tm.tm_sec = (int)(kNodeInterval_s * (double)epoch);
+    mktime(&epoch_tm);
+    snprintf(buffer, sizeof(buffer), "*  %4d %2d %2d %2d %2d %11.8f", epoch_tm.tm_year + 1900, epoch_tm.tm_mon + 1, epoch_tm.tm_mday,
+             epoch_tm.tm_hour, epoch_tm.tm_min, (double)epoch_tm.tm_sec);
+    lines.push_back(buffer);
+    for (size_t s = 0; s < satellite_ids.size(); s++) {
+      const double time_s = kNodeInterval_s * (double)epoch;
+      const double clock_us = 100.0 + 1.0e-3 * time_s + 1.0e-9 * time_s * time_s;
+      snprintf(buffer, sizeof(buffer), "P%s %13.6f %13.6f %13.6f %13.6f", satellite_ids[s].c_str(), CalcOrbitPosition_m(0, s, time_s) * 1.0e-3,
+               CalcOrbitPosition_m(1, s, time_s) * 1.0e-3, CalcOrbitPosition_m(2, s, time_s) * 1.0e-3, clock_us);
+      lines.push_back(buffer);
+    }
+  }
+  return std::vector<std::vector<std::string>>(1, lines);
+}
+
+}  // namespace
+
+/**
+ * @brief Test for the trigonometric interpolation
+ */
+TEST(GnssInterpolator, Trigonometric) { CheckMethod(GnssInterpolationMethod::kTrigonometric); }
+
+/**
+ * @brief Test for the Lagrange interpolation
+ */
+TEST(GnssInterpolator, Lagrange) { CheckMethod(GnssInterpolationMethod::kLagrange); }
+
+/**
+ * @brief Test for the window management of GnssSat_position and GnssSat_clock
+ */
+TEST(GnssInterpolator, Sp3Windows) {
+  const std::vector<std::string> satellite_ids = {"G01", "R05", "E12", "C03", "J02"};
+  const size_t number_of_epochs = 20;
+  tm start_tm = {};
+  start_tm.tm_year = 2020 - 1900;
+  start_tm.tm_mon = 0;
+  start_tm.tm_mday = 1;
+  start_tm.tm_isdst = 0;
+  tm start_tm_copy = start_tm;
+  const double start_unix_time = (double)mktime(&start_tm_copy);
+
+  std::vector<std::vector<std::string>> file = MakeSp3File(start_tm, number_of_epochs, satellite_ids);
+  GnssSat_position position;
+  position.Init(file, 1, (int)kNumberOfNodes, kNotUse);
+  GnssSat_clock clock;
+  clock.Init(file, ".sp3", 3, kNotUse, std::make_pair(0.0, 0.0));
+
+  const double step_s = 7.0;
+  position.SetUp(start_unix_time, step_s);
+  clock.SetUp(start_unix_time, step_s);
+  for (double elapsed_time_s = 0.0; elapsed_time_s < kNodeInterval_s * (double)(number_of_epochs - 1); elapsed_time_s += step_s) {
+    const double unix_time = start_unix_time + elapsed_time_s;
+    if (elapsed_time_s > 0.0) {
+      position.Update(unix_time);
+      clock.Update(unix_time);
+    }
+    // The nearest epoch is moved when the next epoch becomes strictly closer
+    const size_t nearest_epoch = (size_t)ceil(elapsed_time_s / kNodeInterval_s - 0.5);
+    // The windows are not available around the ends of the table
+    const bool is_expected_valid = nearest_epoch >= kNumberOfNodes / 2 && nearest_epoch + kNumberOfNodes / 2 < number_of_epochs;
+    const bool is_expected_clock_valid = nearest_epoch >= 1 && nearest_epoch + 1 < number_of_epochs;
+
+    for (size_t s = 0; s < satellite_ids.size(); s++) {
+      const int id = position.GetIndexFromID(satellite_ids[s]);
+      EXPECT_EQ(is_expected_valid, position.GetWhetherValid(id));
+      EXPECT_EQ(is_expected_clock_valid, clock.GetWhetherValid(id));
+      if (!is_expected_valid) continue;
+
+      std::vector<double> times, values[3];
+      for (size_t k = nearest_epoch - kNumberOfNodes / 2; k <= nearest_epoch + kNumberOfNodes / 2; k++) {
+        times.push_back(kNodeInterval_s * (double)k);
+        // SP3 resolution is 1 mm
+        for (size_t i = 0; i < 3; i++) values[i].push_back(round(CalcOrbitPosition_m(i, s, times.back()) * 1.0e3) * 1.0e-3);
+      }
+      libra::Vector<3> position_ecef_m = position.GetSatEcef(id);
+      for (size_t i = 0; i < 3; i++) {
+        const double reference_m = NaiveInterpolation(GnssInterpolationMethod::kTrigonometric, times, values[i], elapsed_time_s);
+        EXPECT_NEAR(reference_m, position_ecef_m(i), 1.0e-3);
+        EXPECT_NEAR(CalcOrbitPosition_m(i, s, elapsed_time_s), position_ecef_m(i), 1.0);
+      }
+    }
+
+    // The clock is the quadratic function, so the Lagrange interpolation with 3 nodes is exact.
+    if (!is_expected_clock_valid) continue;
+    const double clock_us = 100.0 + 1.0e-3 * elapsed_time_s + 1.0e-9 * elapsed_time_s * elapsed_time_s;
+    const double clock_m = clock_us * environment::speed_of_light_m_s * 1.0e-6;
+    EXPECT_NEAR(clock_m, clock.GetSatClock(position.GetIndexFromID("E12")), 1.0e-3);
+  }
+}
+
+/**
+ * @brief Test for the binary cache of the parsed SP3 file
+ */
+TEST(GnssInterpolator, BinaryCache) {
+  const std::vector<std::string> satellite_ids = {"G01", "R05", "E12", "C03", "J02"};
+  const size_t number_of_epochs = 20;
+  tm start_tm = {};
+  start_tm.tm_year = 2020 - 1900;
+  start_tm.tm_mday = 1;
+  tm start_tm_copy = start_tm;
+  const double start_unix_time = (double)mktime(&start_tm_copy);
+
+  GnssBinaryCacheFile position_cache_file;
+  position_cache_file.path = "test_gnss_interpolator_position_cache.bin";
+  position_cache_file.signature = "position signature";
+  GnssBinaryCacheFile clock_cache_file;
+  clock_cache_file.path = "test_gnss_interpolator_clock_cache.bin";
+  clock_cache_file.signature = "clock signature";
+  std::remove(position_cache_file.path.c_str());
+  std::remove(clock_cache_file.path.c_str());
+
+  // The first initialization parses the file and writes the cache
+  std::vector<std::vector<std::string>> file = MakeSp3File(start_tm, number_of_epochs, satellite_ids);
+  GnssSat_position position;
+  const std::pair<double, double> period = position.Init(file, 1, (int)kNumberOfNodes, kNotUse, position_cache_file);
+  GnssSat_clock clock;
+  clock.Init(file, ".sp3", 3, kNotUse, period, clock_cache_file);
+
+  GnssProductCache cache;
+  ASSERT_TRUE(cache.Open(position_cache_file.path, position_cache_file.signature));
+  EXPECT_EQ(6u, cache.GetNumberOfValues());
+  EXPECT_DOUBLE_EQ(period.first, cache.GetUnixTimePeriod().first);
+  EXPECT_DOUBLE_EQ(period.second, cache.GetUnixTimePeriod().second);
+  EXPECT_FALSE(cache.Open(position_cache_file.path, "stale signature"));
+
+  // The second initialization reads the cache without the file contents
+  std::vector<std::vector<std::string>> empty_file;
+  GnssSat_position cached_position;
+  const std::pair<double, double> cached_period = cached_position.Init(empty_file, 1, (int)kNumberOfNodes, kNotUse, position_cache_file);
+  EXPECT_DOUBLE_EQ(period.first, cached_period.first);
+  EXPECT_DOUBLE_EQ(period.second, cached_period.second);
+  GnssSat_clock cached_clock;
+  cached_clock.Init(empty_file, ".sp3", 3, kNotUse, cached_period, clock_cache_file);
+
+  const double unix_time = start_unix_time + kNodeInterval_s * 10.3;
+  position.SetUp(unix_time, 1.0);
+  clock.SetUp(unix_time, 1.0);
+  cached_position.SetUp(unix_time, 1.0);
+  cached_clock.SetUp(unix_time, 1.0);
+  ASSERT_EQ(position.GetNumOfSatellites(), cached_position.GetNumOfSatellites());
+  for (int id = 0; id < position.GetNumOfSatellites(); id++) {
+    EXPECT_EQ(position.GetWhetherValid(id), cached_position.GetWhetherValid(id));
+    EXPECT_EQ(clock.GetWhetherValid(id), cached_clock.GetWhetherValid(id));
+    if (!position.GetWhetherValid(id)) continue;
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_DOUBLE_EQ(position.GetSatEcef(id)(i), cached_position.GetSatEcef(id)(i));
+      EXPECT_DOUBLE_EQ(position.GetSatEci(id)(i), cached_position.GetSatEci(id)(i));
+    }
+    if (clock.GetWhetherValid(id)) {
+      EXPECT_DOUBLE_EQ(clock.GetSatClock(id), cached_clock.GetSatClock(id));
+    }
+  }
+
+  std::remove(position_cache_file.path.c_str());
+  std::remove(clock_cache_file.path.c_str());
+}
@@ -0,0 +1,71 @@
+/**
+ * @file test_multi_rate_scheduler.cpp
+ * @brief Test codes for MultiRateScheduler class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "multi_rate_scheduler.hpp"
+
+/**
+ * @brief Test for the jump to the next due step
+ */
+TEST(MultiRateScheduler, Advance) {
+  MultiRateScheduler scheduler(0.001);
+  const size_t fast = scheduler.RegisterTask("fast", 0.25);
+  const size_t slow = scheduler.RegisterTask("slow", 1.0);
+
+  const double expected_times_s[5] = {0.25, 0.5, 0.75, 1.0, 1.25};
+  for (size_t i = 0; i < 5; i++) {
+    scheduler.Advance();
+    EXPECT_DOUBLE_EQ(expected_times_s[i], scheduler.GetTime_s());
+    EXPECT_TRUE(scheduler.IsDue(fast));
+    EXPECT_EQ(i == 3, scheduler.IsDue(slow));
+  }
+  EXPECT_EQ(5u, scheduler.GetNumberOfEvents());
+  EXPECT_EQ(1250u, scheduler.GetCurrentStep());
+  EXPECT_EQ(5u, scheduler.GetTask(fast).number_of_executions);
+  EXPECT_EQ(1u, scheduler.GetTask(slow).number_of_executions);
+}
+
+/**
+ * @brief Test for the period which is not the integer multiple of the base step and the long run without drift
+ */
+TEST(MultiRateScheduler, PeriodRounding) {
+  MultiRateScheduler scheduler(0.1);
+  const size_t task = scheduler.RegisterTask("task", 0.25);
+  EXPECT_EQ(3u, scheduler.GetTask(task).period_steps);
+
+  MultiRateScheduler scheduler_long(0.1);
+  scheduler_long.RegisterTask("task", 0.1);
+  for (size_t i = 0; i < 100000; i++) scheduler_long.Advance();
+  EXPECT_DOUBLE_EQ(10000.0, scheduler_long.GetTime_s());
+}
+
+/**
+ * @brief Test for the skip and the reset
+ */
+TEST(MultiRateScheduler, SkipToAndReset) {
+  MultiRateScheduler scheduler(0.1);
+  const size_t fast = scheduler.RegisterTask("fast", 0.1);
+  const size_t slow = scheduler.RegisterTask("slow", 10.0);
+
+  scheduler.SkipTo(25.0);
+  EXPECT_DOUBLE_EQ(25.0, scheduler.GetTime_s());
+  EXPECT_TRUE(scheduler.IsDue(fast));
+  EXPECT_TRUE(scheduler.IsDue(slow));
+  scheduler.Advance();
+  EXPECT_DOUBLE_EQ(25.1, scheduler.GetTime_s());
+  EXPECT_FALSE(scheduler.IsDue(slow));
+  EXPECT_EQ(3u, scheduler.GetTask(slow).next_step / 100);
+
+  scheduler.RecordExecutionTime(fast, 2.0e-3);
+  scheduler.RecordExecutionTime(fast, 1.0e-3);
+  EXPECT_DOUBLE_EQ(3.0e-3, scheduler.GetTask(fast).total_execution_time_s);
+  EXPECT_DOUBLE_EQ(2.0e-3, scheduler.GetTask(fast).max_execution_time_s);
+
+  scheduler.Reset();
+  EXPECT_EQ(0u, scheduler.GetCurrentStep());
+  EXPECT_EQ(0u, scheduler.GetTask(fast).number_of_measurements);
+  scheduler.Advance();
+  EXPECT_DOUBLE_EQ(0.1, scheduler.GetTime_s());
+}
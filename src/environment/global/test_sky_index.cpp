@@ -0,0 +1,71 @@
+/**
+ * @file test_sky_index.cpp
+ * @brief Test codes for SkyIndex class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "sky_index.hpp"
+
+namespace {
+/**
+ * @fn MakeRandomDirections
+ * @brief Return uniformly distributed unit vectors
+ */
+std::vector<libra::Vector<3>> MakeRandomDirections(const size_t number_of_directions, const unsigned int seed) {
+  std::mt19937 engine(seed);
+  std::normal_distribution<double> normal(0.0, 1.0);
+  std::vector<libra::Vector<3>> directions(number_of_directions);
+  for (auto& direction : directions) {
+    for (size_t k = 0; k < 3; k++) direction[k] = normal(engine);
+    direction = direction.CalcNormalizedVector();
+  }
+  return directions;
+}
+}  // namespace
+
+/**
+ * @brief Test that the cone query returns the same result with the brute force search
+ */
+TEST(SkyIndex, FindInCone) {
+  std::vector<libra::Vector<3>> directions = MakeRandomDirections(20000, 1);
+  // Directions on the edges and the corners of the cube faces
+  for (int x = -1; x <= 1; x++) {
+    for (int y = -1; y <= 1; y++) {
+      for (int z = -1; z <= 1; z++) {
+        if (x == 0 && y == 0 && z == 0) continue;
+        libra::Vector<3> direction;
+        direction[0] = x;
+        direction[1] = y;
+        direction[2] = z;
+        directions.push_back(direction.CalcNormalizedVector());
+      }
+    }
+  }
+  SkyIndex sky_index(4);
+  sky_index.Build(directions);
+  EXPECT_EQ(directions.size(), sky_index.GetNumberOfDirections());
+  EXPECT_EQ(6u * 16u * 16u, sky_index.GetNumberOfCells());
+
+  const std::vector<libra::Vector<3>> centers = MakeRandomDirections(50, 2);
+  const double half_angles_rad[6] = {0.0, 0.001, 0.05, 0.3, 1.7, 3.2};
+  std::vector<size_t> indices;
+  for (const auto& center : centers) {
+    for (size_t a = 0; a < 6; a++) {
+      sky_index.FindInCone(center, half_angles_rad[a], indices);
+      std::vector<size_t> expected_indices;
+      for (size_t i = 0; i < directions.size(); i++) {
+        if (libra::InnerProduct(directions[i], center) >= cos(half_angles_rad[a])) expected_indices.push_back(i);
+      }
+      EXPECT_EQ(expected_indices, indices);
+    }
+  }
+
+  // Center on the corner of the faces
+  sky_index.FindInCone(directions.back(), 0.01, indices);
+  ASSERT_FALSE(indices.empty());
+  EXPECT_EQ(directions.size() - 1, indices.back());
+}
@@ -5,15 +5,32 @@
 
 #include "atmosphere.hpp"
 
+#include <mutex>
+
 #include "library/logger/log_utility.hpp"
+#include "library/math/constants.hpp"
 #include "library/math/vector.hpp"
 #include "library/randomization/global_randomization.hpp"
 #include "library/randomization/normal_randomization.hpp"
 #include "library/randomization/random_walk.hpp"
 
+namespace {
+std::mutex nrlmsise00_mutex;  //!< NRLMSISE00 library uses global variables, so it is serialized for the parallel update of spacecraft
+}  // namespace
+
+AtmosphereModel SetAtmosphereModel(const std::string model_name) {
+  if (model_name == "STANDARD") {
+    return AtmosphereModel::kStandard;
+  } else if (model_name == "NRLMSISE00") {
+    return AtmosphereModel::kNrlmsise00;
+  } else {
+    return AtmosphereModel::kNone;
+  }
+}
+
 Atmosphere::Atmosphere(const std::string model, const std::string initialize_file_name, const double gauss_standard_deviation_rate,
                        const bool is_manual_param, const double manual_f107, const double manual_f107a, const double manual_ap)
-    : model_(model),
+    : model_(SetAtmosphereModel(model)),
       initialize_file_name_(initialize_file_name),
       air_density_kg_m3_(0.0),
       gauss_standard_deviation_rate_(gauss_standard_deviation_rate),
@@ -21,10 +38,13 @@ Atmosphere::Atmosphere(const std::string model, const std::string initialize_fil
       is_manual_param_used_(is_manual_param),
       manual_daily_f107_(manual_f107),
       manual_average_f107_(manual_f107a),
-      manual_ap_(manual_ap) {
-  if (model_ == "STANDARD") {
+      manual_ap_(manual_ap),
+      is_density_cache_enabled_(false),
+      cached_day_of_year_(-1),
+      cached_space_weather_row_(-1) {
+  if (model_ == AtmosphereModel::kStandard) {
     std::cerr << "Air density model : STANDARD" << std::endl;
-  } else if (model_ == "NRLMSISE00") {
+  } else if (model_ == AtmosphereModel::kNrlmsise00) {
     std::cerr << "Air density model : NRLMSISE00" << std::endl;
   } else {
     std::cerr << "Air density model : None" << std::endl;
@@ -32,43 +52,87 @@ Atmosphere::Atmosphere(const std::string model, const std::string initialize_fil
   }
 }
 
+void Atmosphere::EnableDensityCache(const double altitude_step_m, const double latitude_step_rad, const double local_time_step_hour,
+                                    const double tolerance, const double universal_time_step_hour) {
+  density_cache_ = AtmosphereDensityCache(altitude_step_m, latitude_step_rad, local_time_step_hour, tolerance, universal_time_step_hour);
+  is_density_cache_enabled_ = true;
+  cached_day_of_year_ = -1;
+}
+
 int Atmosphere::GetSpaceWeatherTable(double decimal_year, double end_time_s) {
   // Get table of simulation duration only to decrease memory
-  return GetSpaceWeatherTable_(decimal_year, end_time_s, initialize_file_name_, space_weather_table_);
+  return GetSpaceWeatherTable_(decimal_year, end_time_s, initialize_file_name_, space_weather_table_, space_weather_table_index_);
 }
 
 double Atmosphere::CalcAirDensity_kg_m3(const double decimal_year, const double end_time_s, const GeodeticPosition position) {
   if (!IsCalcEnabled) return 0;
 
-  if (model_ == "STANDARD") {
-    double altitude_m = position.GetAltitude_m();
-    air_density_kg_m3_ = CalcStandard(altitude_m);
-  } else if (model_ == "NRLMSISE00")  // NRLMSISE00 model
-  {
-    if (!is_manual_param_used_) {
-      if (!is_space_weather_table_imported_) {
-        if (GetSpaceWeatherTable(decimal_year, end_time_s)) {
-          is_space_weather_table_imported_ = true;
-        } else {
-          std::cerr << "Air density is switched to STANDARD model" << std::endl;
-          model_ = "STANDARD";
-        }
-      }
+  if (model_ == AtmosphereModel::kNrlmsise00 && !is_manual_param_used_ && !is_space_weather_table_imported_) {
+    if (GetSpaceWeatherTable(decimal_year, end_time_s)) {
+      is_space_weather_table_imported_ = true;
+    } else {
+      std::cerr << "Air density is switched to STANDARD model" << std::endl;
+      model_ = AtmosphereModel::kStandard;
     }
+  }
 
-    double lat_rad = position.GetLatitude_rad();
-    double lon_rad = position.GetLongitude_rad();
-    double alt_m = position.GetAltitude_m();
-    air_density_kg_m3_ = CalcNRLMSISE00(decimal_year, lat_rad, lon_rad, alt_m, space_weather_table_, is_manual_param_used_, manual_daily_f107_,
-                                        manual_average_f107_, manual_ap_);
-  } else {
-    // No suitable model
-    return air_density_kg_m3_ = 0.0;
+  switch (model_) {
+    case AtmosphereModel::kStandard:
+      air_density_kg_m3_ = CalcStandard(position.GetAltitude_m());
+      break;
+    case AtmosphereModel::kNrlmsise00:
+      air_density_kg_m3_ = CalcNrlmsise00(decimal_year, position);
+      break;
+    default:
+      // No suitable model
+      return air_density_kg_m3_ = 0.0;
   }
 
   return AddNoise(air_density_kg_m3_);
 }
 
+double Atmosphere::CalcNrlmsise00(const double decimal_year, const GeodeticPosition position) {
+  double f107 = manual_daily_f107_;
+  double f107a = manual_average_f107_;
+  double ap = manual_ap_;
+  int space_weather_row = -1;
+  if (!is_manual_param_used_) {
+    // f10.7 and ap from table
+    space_weather_row = SearchSpaceWeatherTable(decimal_year, space_weather_table_index_);
+    f107 = space_weather_table_[space_weather_row].F107_adj;
+    f107a = space_weather_table_[space_weather_row].Ctr81_adj;
+    ap = space_weather_table_[space_weather_row].Ap_avg;
+  }
+
+  double lat_rad = position.GetLatitude_rad();
+  double lon_rad = position.GetLongitude_rad();
+  double alt_m = position.GetAltitude_m();
+  if (!is_density_cache_enabled_) {
+    std::lock_guard<std::mutex> lock(nrlmsise00_mutex);
+    return CalcNRLMSISE00(decimal_year, lat_rad, lon_rad, alt_m, f107, f107a, ap);
+  }
+
+  // The cells are valid while the day of year and the space weather parameters are not changed
+  int day_of_year;
+  double universal_time_s;
+  CalcNRLMSISE00Time(decimal_year, &day_of_year, &universal_time_s);
+  if (day_of_year != cached_day_of_year_ || space_weather_row != cached_space_weather_row_) {
+    density_cache_.Clear();
+    cached_day_of_year_ = day_of_year;
+    cached_space_weather_row_ = space_weather_row;
+  }
+
+  // The corners of the cells are evaluated at the longitude of the local time at the UT given by the cache
+  const double universal_time_hour = universal_time_s / 3600.0;
+  const double local_time_hour = universal_time_hour + lon_rad * libra::rad_to_deg / 15.0;
+  auto density_function = [&](double cell_alt_m, double cell_lat_rad, double cell_local_time_hour, double cell_universal_time_hour) {
+    std::lock_guard<std::mutex> lock(nrlmsise00_mutex);
+    const double cell_lon_rad = (cell_local_time_hour - cell_universal_time_hour) * 15.0 * libra::deg_to_rad;
+    return CalcNRLMSISE00(day_of_year, cell_universal_time_hour * 3600.0, cell_lat_rad, cell_lon_rad, cell_alt_m, f107, f107a, ap);
+  };
+  return density_cache_.GetAirDensity_kg_m3(alt_m, lat_rad, local_time_hour, universal_time_hour, density_function);
+}
+
 double Atmosphere::CalcStandard(const double altitude_m) {
   double altitude_km = altitude_m / 1000.0;
   double scale_height_km;
@@ -207,6 +271,18 @@ double Atmosphere::AddNoise(const double rho_kg_m3) {
   return rho_kg_m3 + nrd;
 }
 
+void Atmosphere::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("Atmosphere");
+  writer.Write(air_density_kg_m3_);
+  writer.Write(model_);
+}
+
+void Atmosphere::LoadState(CheckpointReader& reader) {
+  reader.BeginSection("Atmosphere");
+  reader.Read(air_density_kg_m3_);
+  reader.Read(model_);
+}
+
 std::string Atmosphere::GetLogValue() const {
   std::string str_tmp = "";
   str_tmp += WriteScalar(air_density_kg_m3_);
@@ -214,6 +290,10 @@ std::string Atmosphere::GetLogValue() const {
   return str_tmp;
 }
 
+void Atmosphere::PushLogValue(LogValueBuffer& buffer) const {
+  buffer.Push(air_density_kg_m3_);
+}
+
 std::string Atmosphere::GetLogHeader() const {
   std::string str_tmp = "";
 
@@ -10,10 +10,30 @@
 #include <string>
 #include <vector>
 
+#include "atmosphere_density_cache.hpp"
 #include "library/external/nrlmsise00/wrapper_nrlmsise00.hpp"
 #include "library/geodesy/geodetic_position.hpp"
 #include "library/logger/loggable.hpp"
 #include "library/math/vector.hpp"
+#include "library/utilities/checkpoint.hpp"
+
+/**
+ * @enum AtmosphereModel
+ * @brief Atmospheric density model
+ */
+enum class AtmosphereModel {
+  kStandard,    //!< Model using scale height
+  kNrlmsise00,  //!< NRLMSISE-00 model
+  kNone,        //!< No model (the density is 0.0)
+};
+
+/**
+ * @fn SetAtmosphereModel
+ * @brief Convert the model name to AtmosphereModel
+ * @param [in] model_name: Atmospheric density model name
+ * @return Atmospheric density model
+ */
+AtmosphereModel SetAtmosphereModel(const std::string model_name);
 
 /**
  * @class Atmosphere
@@ -55,6 +75,42 @@ class Atmosphere : public ILoggable {
    * @brief Return Atmospheric density [kg/m^3]
    */
   inline double GetAirDensity_kg_m3() const { return air_density_kg_m3_; }
+  /**
+   * @fn GetModel
+   * @brief Return atmospheric density model
+   */
+  inline AtmosphereModel GetModel() const { return model_; }
+
+  /**
+   * @fn EnableDensityCache
+   * @brief Enable the density cache for NRLMSISE00 model
+   * @param [in] altitude_step_m: Altitude width of a cell [m]
+   * @param [in] latitude_step_rad: Latitude width of a cell [rad]
+   * @param [in] local_time_step_hour: Local time width of a cell [hour]
+   * @param [in] tolerance: Tolerance of the relative interpolation error at the cell center
+   * @param [in] universal_time_step_hour: UT width of the bin in which the cells are valid [hour]
+   */
+  void EnableDensityCache(const double altitude_step_m, const double latitude_step_rad, const double local_time_step_hour, const double tolerance,
+                          const double universal_time_step_hour);
+  /**
+   * @fn GetDensityCache
+   * @brief Return the density cache for NRLMSISE00 model
+   */
+  inline const AtmosphereDensityCache& GetDensityCache() const { return density_cache_; }
+
+  /**
+   * @fn SaveState
+   * @brief Write the atmospheric density and the model to the checkpoint
+   * @note The density cache is not included since the cells are made again with the same values.
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the atmospheric density and the model from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
 
   // Override ILoggable
   /**
@@ -67,13 +123,19 @@ class Atmosphere : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn PushLogValue
+   * @brief Override PushLogValue function of ILoggable
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const;
 
  private:
-  std::string model_;                                //!< Atmospheric density model name
+  AtmosphereModel model_;                            //!< Atmospheric density model
   std::string initialize_file_name_;                 //!< Path and name of initialize file
   double air_density_kg_m3_;                         //!< Atmospheric density [kg/m^3]
   double gauss_standard_deviation_rate_;             //!< Standard deviation of density noise (defined as percentage)
   std::vector<nrlmsise_table> space_weather_table_;  //!< Space weather table
+  nrlmsise_table_index space_weather_table_index_;   //!< Index of the space weather table
   bool is_space_weather_table_imported_;             //!< Flag of the space weather table is imported or not
   bool is_manual_param_used_;                        //!< Flag to use manual parameters
 
@@ -82,6 +144,12 @@ class Atmosphere : public ILoggable {
   double manual_average_f107_;  //!< Manual 3-month averaged f10.7 value
   double manual_ap_;            //!< Manual ap value Ref: http://wdc.kugi.kyoto-u.ac.jp/kp/kpexp-j.html
 
+  // Density cache for NRLMSISE00 model
+  bool is_density_cache_enabled_;         //!< Flag to use the density cache
+  AtmosphereDensityCache density_cache_;  //!< Density cache
+  int cached_day_of_year_;                //!< Day of year of the cells in the density cache
+  int cached_space_weather_row_;          //!< Row of the space weather table of the cells in the density cache (-1: manual parameters)
+
   // TODO: Add random walk noise
   //  double rw_stepwidth_;
   //  double rw_stddev_;
@@ -94,6 +162,14 @@ class Atmosphere : public ILoggable {
    * @return Atmospheric density [kg/m^3]
    */
   double CalcStandard(const double altitude_m);
+  /**
+   * @fn CalcNrlmsise00
+   * @brief Calculate atmospheric density with NRLMSISE-00 model
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] position: Position of target point to calculate the air density
+   * @return Atmospheric density [kg/m^3]
+   */
+  double CalcNrlmsise00(const double decimal_year, const GeodeticPosition position);
   /**
    * @fn GetSpaceWeatherTable
    * @param [in] decimal_year: Decimal year of simulation start [year]
@@ -0,0 +1,126 @@
+/**
+ * @file atmosphere_density_cache.cpp
+ * @brief Class to cache the atmospheric density in the cells of altitude, latitude, and local time
+ */
+
+#include "atmosphere_density_cache.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+const int64_t kMaxCellIndex = (int64_t)1 << 20;  //!< Maximum absolute value of the cell index packed in the key
+}  // namespace
+
+AtmosphereDensityCache::AtmosphereDensityCache(const double altitude_step_m, const double latitude_step_rad, const double local_time_step_hour,
+                                               const double tolerance, const double universal_time_step_hour)
+    : altitude_step_m_(altitude_step_m),
+      latitude_step_rad_(latitude_step_rad),
+      local_time_step_hour_(local_time_step_hour),
+      tolerance_(tolerance),
+      universal_time_step_hour_(universal_time_step_hour) {}
+
+double AtmosphereDensityCache::GetAirDensity_kg_m3(const double altitude_m, const double latitude_rad, const double local_time_hour,
+                                                   const double universal_time_hour,
+                                                   const std::function<double(double, double, double, double)>& density_function) {
+  // Local time in [0, 24) hour
+  double local_time_normalized_hour = std::fmod(local_time_hour, 24.0);
+  if (local_time_normalized_hour < 0.0) local_time_normalized_hour += 24.0;
+
+  const int64_t altitude_index = (int64_t)std::floor(altitude_m / altitude_step_m_);
+  const int64_t latitude_index = (int64_t)std::floor(latitude_rad / latitude_step_rad_);
+  const int64_t local_time_index = (int64_t)std::floor(local_time_normalized_hour / local_time_step_hour_);
+  const int64_t universal_time_index = (int64_t)std::floor(universal_time_hour / universal_time_step_hour_);
+  if (std::abs(altitude_index) >= kMaxCellIndex || std::abs(latitude_index) >= kMaxCellIndex || local_time_index >= kMaxCellIndex) {
+    number_of_evaluations_++;
+    return density_function(altitude_m, latitude_rad, local_time_hour, universal_time_hour);
+  }
+
+  // Corners of the cell. The latitudes are limited in [-pi/2, pi/2].
+  const double altitude_corner_m[2] = {altitude_index * altitude_step_m_, (altitude_index + 1) * altitude_step_m_};
+  const double latitude_corner_rad[2] = {std::max(latitude_index * latitude_step_rad_, -libra::pi_2),
+                                         std::min((latitude_index + 1) * latitude_step_rad_, libra::pi_2)};
+  const double local_time_corner_hour[2] = {local_time_index * local_time_step_hour_, (local_time_index + 1) * local_time_step_hour_};
+
+  const uint64_t mask = ((uint64_t)1 << 21) - 1;
+  const uint64_t key = (((uint64_t)altitude_index & mask) << 42) | (((uint64_t)latitude_index & mask) << 21) | ((uint64_t)local_time_index & mask);
+  auto cell = cells_.find(key);
+  if (cell == cells_.end()) {
+    if (cells_.size() >= kMaxNumberOfCells) Clear();
+    cell =
+        cells_.emplace(key, MakeCell(altitude_corner_m, latitude_corner_rad, local_time_corner_hour, universal_time_index, density_function)).first;
+  } else if (cell->second.universal_time_index != universal_time_index) {
+    // The mapping between the local time and the longitude is changed, so the cell is made again and the interpolation error is checked again
+    if (!cell->second.is_interpolated) number_of_direct_cells_--;
+    cell->second = MakeCell(altitude_corner_m, latitude_corner_rad, local_time_corner_hour, universal_time_index, density_function);
+  }
+
+  if (!cell->second.is_interpolated) {
+    number_of_evaluations_++;
+    return density_function(altitude_m, latitude_rad, local_time_hour, universal_time_hour);
+  }
+
+  double weight[3];
+  weight[0] = (altitude_m - altitude_corner_m[0]) / altitude_step_m_;
+  const double latitude_width_rad = latitude_corner_rad[1] - latitude_corner_rad[0];
+  weight[1] = latitude_width_rad > 0.0 ? (latitude_rad - latitude_corner_rad[0]) / latitude_width_rad : 0.0;
+  weight[2] = (local_time_normalized_hour - local_time_corner_hour[0]) / local_time_step_hour_;
+  return Interpolate(cell->second, weight);
+}
+
+void AtmosphereDensityCache::Clear() {
+  cells_.clear();
+  number_of_direct_cells_ = 0;
+}
+
+AtmosphereDensityCache::Cell AtmosphereDensityCache::MakeCell(const double altitude_m[2], const double latitude_rad[2],
+                                                              const double local_time_hour[2], const int64_t universal_time_index,
+                                                              const std::function<double(double, double, double, double)>& density_function) {
+  Cell cell;
+  cell.is_interpolated = true;
+  cell.universal_time_index = universal_time_index;
+  const double universal_time_hour = (universal_time_index + 0.5) * universal_time_step_hour_;
+  for (size_t i = 0; i < 2; i++) {
+    for (size_t j = 0; j < 2; j++) {
+      for (size_t k = 0; k < 2; k++) {
+        const double density_kg_m3 = density_function(altitude_m[i], latitude_rad[j], local_time_hour[k], universal_time_hour);
+        number_of_evaluations_++;
+        if (density_kg_m3 <= 0.0) {
+          // The logarithm is not defined
+          cell.is_interpolated = false;
+          cell.log_density[i][j][k] = 0.0;
+        } else {
+          cell.log_density[i][j][k] = std::log(density_kg_m3);
+        }
+      }
+    }
+  }
+
+  // Check the interpolation error at the center of the cell
+  if (cell.is_interpolated) {
+    const double center_density_kg_m3 = density_function(0.5 * (altitude_m[0] + altitude_m[1]), 0.5 * (latitude_rad[0] + latitude_rad[1]),
+                                                         0.5 * (local_time_hour[0] + local_time_hour[1]), universal_time_hour);
+    number_of_evaluations_++;
+    const double weight[3] = {0.5, 0.5, 0.5};
+    const double relative_error = std::abs(Interpolate(cell, weight) - center_density_kg_m3) / center_density_kg_m3;
+    if (!(relative_error <= tolerance_)) cell.is_interpolated = false;
+  }
+
+  if (!cell.is_interpolated) number_of_direct_cells_++;
+  return cell;
+}
+
+double AtmosphereDensityCache::Interpolate(const Cell& cell, const double weight[3]) {
+  double log_density = 0.0;
+  for (size_t i = 0; i < 2; i++) {
+    const double weight_altitude = i == 0 ? 1.0 - weight[0] : weight[0];
+    for (size_t j = 0; j < 2; j++) {
+      const double weight_latitude = j == 0 ? 1.0 - weight[1] : weight[1];
+      for (size_t k = 0; k < 2; k++) {
+        const double weight_local_time = k == 0 ? 1.0 - weight[2] : weight[2];
+        log_density += weight_altitude * weight_latitude * weight_local_time * cell.log_density[i][j][k];
+      }
+    }
+  }
+  return std::exp(log_density);
+}
@@ -0,0 +1,119 @@
+/**
+ * @file atmosphere_density_cache.hpp
+ * @brief Class to cache the atmospheric density in the cells of altitude, latitude, and local time
+ */
+
+#ifndef S2E_ENVIRONMENT_LOCAL_ATMOSPHERE_DENSITY_CACHE_HPP_
+#define S2E_ENVIRONMENT_LOCAL_ATMOSPHERE_DENSITY_CACHE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <library/math/constants.hpp>
+#include <unordered_map>
+
+/**
+ * @class AtmosphereDensityCache
+ * @brief Class to cache the atmospheric density in the cells of altitude, latitude, and local time
+ * @details The logarithm of the density is evaluated at the eight corners of a cell when the cell is used first, and it is interpolated
+ *          trilinearly in the cell. The interpolation error is checked at the center of the cell when the cell is made. When the relative error
+ *          exceeds the tolerance, the density in the cell is always evaluated directly by the density function.
+ *          The density at the same local time also depends on the universal time (UT), so the corners are evaluated at the center of the UT bin
+ *          of the query. The cell is made again with the interpolation error check when the UT bin changes.
+ *          The cache does not know the other inputs of the density model (ex. day of year and space weather), so the user clears the cache
+ *          when they change.
+ */
+class AtmosphereDensityCache {
+ public:
+  /**
+   * @fn AtmosphereDensityCache
+   * @brief Constructor
+   * @param [in] altitude_step_m: Altitude width of a cell [m]
+   * @param [in] latitude_step_rad: Latitude width of a cell [rad]
+   * @param [in] local_time_step_hour: Local time width of a cell [hour]
+   * @param [in] tolerance: Tolerance of the relative interpolation error at the cell center
+   * @param [in] universal_time_step_hour: UT width of the bin in which the cells are valid [hour]
+   */
+  AtmosphereDensityCache(const double altitude_step_m = 5000.0, const double latitude_step_rad = 5.0 * libra::deg_to_rad,
+                         const double local_time_step_hour = 1.0, const double tolerance = 0.01, const double universal_time_step_hour = 1.0);
+
+  /**
+   * @fn GetAirDensity_kg_m3
+   * @brief Return the atmospheric density interpolated in the cell
+   * @param [in] altitude_m: Altitude [m]
+   * @param [in] latitude_rad: Latitude [rad]
+   * @param [in] local_time_hour: Local solar time [hour]
+   * @param [in] universal_time_hour: Universal time [hour]
+   * @param [in] density_function: Function to evaluate the density [kg/m^3] with the altitude [m], the latitude [rad], the local time [hour],
+   *                               and the universal time [hour]
+   * @return Atmospheric density [kg/m^3]
+   */
+  double GetAirDensity_kg_m3(const double altitude_m, const double latitude_rad, const double local_time_hour, const double universal_time_hour,
+                             const std::function<double(double, double, double, double)>& density_function);
+  /**
+   * @fn Clear
+   * @brief Clear all cells
+   */
+  void Clear();
+
+  // Getters
+  /**
+   * @fn GetNumberOfCells
+   * @brief Return number of the cells in the cache
+   */
+  inline size_t GetNumberOfCells() const { return cells_.size(); }
+  /**
+   * @fn GetNumberOfDirectCells
+   * @brief Return number of the cells evaluated directly since the interpolation error exceeds the tolerance
+   */
+  inline size_t GetNumberOfDirectCells() const { return number_of_direct_cells_; }
+  /**
+   * @fn GetNumberOfEvaluations
+   * @brief Return total number of the density function calls
+   */
+  inline size_t GetNumberOfEvaluations() const { return number_of_evaluations_; }
+
+ private:
+  static const size_t kMaxNumberOfCells = 1 << 20;  //!< Maximum number of the cells. The cache is cleared when it is exceeded.
+
+  /**
+   * @struct Cell
+   * @brief Logarithm of the density at the corners of a cell
+   */
+  struct Cell {
+    bool is_interpolated;          //!< Flag of the interpolation. False means the direct evaluation.
+    int64_t universal_time_index;  //!< Index of the UT bin in which the cell is valid
+    double log_density[2][2][2];   //!< Logarithm of the density at the corners [altitude][latitude][local time]
+  };
+
+  double altitude_step_m_;                    //!< Altitude width of a cell [m]
+  double latitude_step_rad_;                  //!< Latitude width of a cell [rad]
+  double local_time_step_hour_;               //!< Local time width of a cell [hour]
+  double tolerance_;                          //!< Tolerance of the relative interpolation error
+  double universal_time_step_hour_;           //!< UT width of the bin in which the cells are valid [hour]
+  std::unordered_map<uint64_t, Cell> cells_;  //!< Cells in the cache
+  size_t number_of_direct_cells_ = 0;         //!< Number of the cells evaluated directly
+  size_t number_of_evaluations_ = 0;          //!< Number of the density function calls
+
+  /**
+   * @fn MakeCell
+   * @brief Evaluate the density at the corners of the cell and check the interpolation error
+   * @param [in] altitude_m: Altitudes of the lower and the upper corners [m]
+   * @param [in] latitude_rad: Latitudes of the lower and the upper corners [rad]
+   * @param [in] local_time_hour: Local times of the lower and the upper corners [hour]
+   * @param [in] universal_time_index: Index of the UT bin. The corners are evaluated at the center of the bin.
+   * @param [in] density_function: Function to evaluate the density
+   */
+  Cell MakeCell(const double altitude_m[2], const double latitude_rad[2], const double local_time_hour[2], const int64_t universal_time_index,
+                const std::function<double(double, double, double, double)>& density_function);
+  /**
+   * @fn Interpolate
+   * @brief Trilinear interpolation of the logarithm of the density in the cell
+   * @param [in] cell: Cell
+   * @param [in] weight: Normalized position in the cell (0 to 1) for altitude, latitude, and local time
+   * @return Atmospheric density [kg/m^3]
+   */
+  static double Interpolate(const Cell& cell, const double weight[3]);
+};
+
+#endif  // S2E_ENVIRONMENT_LOCAL_ATMOSPHERE_DENSITY_CACHE_HPP_
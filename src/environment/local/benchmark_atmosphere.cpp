@@ -0,0 +1,80 @@
+/**
+ * @file benchmark_atmosphere.cpp
+ * @brief Benchmark codes for Atmosphere class with NRLMSISE-00 model with Google Benchmark
+ * @note The spacecraft flies a very low earth orbit. The maximum relative difference from the direct evaluation is reported as a counter.
+ */
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <library/math/constants.hpp>
+#include <vector>
+
+#include "atmosphere.hpp"
+
+namespace {
+
+const double kStartDecimalYear = 2024.3;  //!< Decimal year of the simulation start
+const double kStepTime_s = 1.0;           //!< Step time of the orbit [s]
+const size_t kNumberOfSteps = 5400 * 3;   //!< Number of steps (about three orbits)
+
+/**
+ * @fn MakeTrajectory
+ * @brief Make the geodetic positions of a circular orbit at 250 km altitude with 97 deg inclination
+ */
+std::vector<GeodeticPosition> MakeTrajectory() {
+  const double period_s = 5360.0;
+  const double earth_rotation_rad_s = 7.2921159e-5;
+  const double inclination_rad = 97.0 * libra::deg_to_rad;
+  std::vector<GeodeticPosition> trajectory;
+  for (size_t step = 0; step < kNumberOfSteps; step++) {
+    const double time_s = step * kStepTime_s;
+    const double phase_rad = libra::tau * time_s / period_s;
+    const double latitude_rad = std::asin(std::sin(inclination_rad) * std::sin(phase_rad));
+    const double longitude_rad = std::remainder(std::atan2(std::cos(inclination_rad) * std::sin(phase_rad), std::cos(phase_rad)) -
+                                                    earth_rotation_rad_s * time_s,
+                                                libra::tau);
+    trajectory.push_back(GeodeticPosition(latitude_rad, longitude_rad, 250.0e3));
+  }
+  return trajectory;
+}
+
+/**
+ * @fn MakeAtmosphere
+ * @brief Make NRLMSISE-00 model with the manual space weather parameters and without noise
+ */
+Atmosphere MakeAtmosphere() { return Atmosphere("NRLMSISE00", "", 0.0, true, 150.0, 150.0, 3.0); }
+
+}  // namespace
+
+/**
+ * @brief Benchmark of the density calculation along the orbit
+ * @note Argument: density cache (0: disabled, 1: enabled)
+ */
+static void BM_AtmosphereNrlmsise00(benchmark::State& state) {
+  const std::vector<GeodeticPosition> trajectory = MakeTrajectory();
+  Atmosphere atmosphere = MakeAtmosphere();
+  if (state.range(0)) atmosphere.EnableDensityCache(5000.0, 5.0 * libra::deg_to_rad, 1.0, 0.01, 1.0);
+
+  std::vector<double> densities_kg_m3(trajectory.size());
+  for (auto _ : state) {
+    for (size_t step = 0; step < trajectory.size(); step++) {
+      const double decimal_year = kStartDecimalYear + step * kStepTime_s / (86400.0 * 365.0);
+      densities_kg_m3[step] = atmosphere.CalcAirDensity_kg_m3(decimal_year, 0.0, trajectory[step]);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * trajectory.size());
+
+  // Validation with the direct evaluation
+  Atmosphere reference_atmosphere = MakeAtmosphere();
+  double max_relative_difference = 0.0;
+  for (size_t step = 0; step < trajectory.size(); step++) {
+    const double decimal_year = kStartDecimalYear + step * kStepTime_s / (86400.0 * 365.0);
+    const double reference_kg_m3 = reference_atmosphere.CalcAirDensity_kg_m3(decimal_year, 0.0, trajectory[step]);
+    max_relative_difference = std::max(max_relative_difference, std::abs(densities_kg_m3[step] - reference_kg_m3) / reference_kg_m3);
+  }
+  state.counters["max_relative_difference"] = max_relative_difference;
+  state.counters["cells"] = (double)atmosphere.GetDensityCache().GetNumberOfCells();
+}
+BENCHMARK(BM_AtmosphereNrlmsise00)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
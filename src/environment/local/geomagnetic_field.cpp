@@ -5,51 +5,52 @@
 
 #include "geomagnetic_field.hpp"
 
-#include "library/external/igrf/igrf.h"
 #include "library/initialize/initialize_file_access.hpp"
 #include "library/randomization/global_randomization.hpp"
-#include "library/randomization/normal_randomization.hpp"
-#include "library/randomization/random_walk.hpp"
 
 GeomagneticField::GeomagneticField(const std::string igrf_file_name, const double random_walk_srandard_deviation_nT,
-                                   const double random_walk_limit_nT, const double white_noise_standard_deviation_nT)
+                                   const double random_walk_limit_nT, const double white_noise_standard_deviation_nT, const size_t degree)
     : magnetic_field_i_nT_(0.0),
       magnetic_field_b_nT_(0.0),
       random_walk_standard_deviation_nT_(random_walk_srandard_deviation_nT),
       random_walk_limit_nT_(random_walk_limit_nT),
       white_noise_standard_deviation_nT_(white_noise_standard_deviation_nT),
-      igrf_file_name_(igrf_file_name) {
-  set_file_path(igrf_file_name_.c_str());
+      igrf_file_name_(igrf_file_name),
+      random_walk_(0.1, libra::Vector<3>(random_walk_srandard_deviation_nT), libra::Vector<3>(random_walk_limit_nT)),
+      white_noise_(0.0, white_noise_standard_deviation_nT, global_randomization.MakeSeed()) {
+  igrf_model_.ReadCoefficientFile(igrf_file_name_, degree);
 }
 
 void GeomagneticField::CalcMagneticField(const double decimal_year, const double sidereal_day, const GeodeticPosition position,
                                          const libra::Quaternion quaternion_i2b) {
   if (!IsCalcEnabled) return;
 
-  const double lat_rad = position.GetLatitude_rad();
-  const double lon_rad = position.GetLongitude_rad();
-  const double alt_m = position.GetAltitude_m();
+  magnetic_field_i_nT_ = igrf_model_.CalcMagneticField_i_nT(decimal_year, position, sidereal_day);
+  AddNoise(magnetic_field_i_nT_);
+  magnetic_field_b_nT_ = quaternion_i2b.FrameConversion(magnetic_field_i_nT_);
+}
 
-  double magnetic_field_array_i_nT[3];
-  IgrfCalc(decimal_year, lat_rad, lon_rad, alt_m, sidereal_day, magnetic_field_array_i_nT);
-  AddNoise(magnetic_field_array_i_nT);
+void GeomagneticField::AddNoise(libra::Vector<3>& magnetic_field_i_nT) {
   for (int i = 0; i < 3; ++i) {
-    magnetic_field_i_nT_[i] = magnetic_field_array_i_nT[i];
+    magnetic_field_i_nT[i] += random_walk_[i] + white_noise_;
   }
-  magnetic_field_b_nT_ = quaternion_i2b.FrameConversion(magnetic_field_i_nT_);
+  ++random_walk_;  // Update random walk
 }
 
-void GeomagneticField::AddNoise(double* magnetic_field_array_i_nT) {
-  static libra::Vector<3> standard_deviation(random_walk_standard_deviation_nT_);
-  static libra::Vector<3> limit(random_walk_limit_nT_);
-  static RandomWalk<3> random_walk(0.1, standard_deviation, limit);
-
-  static libra::NormalRand white_noise(0.0, white_noise_standard_deviation_nT_, global_randomization.MakeSeed());
+void GeomagneticField::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("GeomagneticField");
+  writer.Write(magnetic_field_i_nT_);
+  writer.Write(magnetic_field_b_nT_);
+  random_walk_.SaveState(writer);
+  white_noise_.SaveState(writer);
+}
 
-  for (int i = 0; i < 3; ++i) {
-    magnetic_field_array_i_nT[i] += random_walk[i] + white_noise;
-  }
-  ++random_walk;  // Update random walk
+void GeomagneticField::LoadState(CheckpointReader& reader) {
+  reader.BeginSection("GeomagneticField");
+  reader.Read(magnetic_field_i_nT_);
+  reader.Read(magnetic_field_b_nT_);
+  random_walk_.LoadState(reader);
+  white_noise_.LoadState(reader);
 }
 
 std::string GeomagneticField::GetLogHeader() const {
@@ -69,3 +70,8 @@ std::string GeomagneticField::GetLogValue() const {
 
   return str_tmp;
 }
+
+void GeomagneticField::PushLogValue(LogValueBuffer& buffer) const {
+  buffer.Push(magnetic_field_i_nT_);
+  buffer.Push(magnetic_field_b_nT_);
+}
@@ -7,9 +7,13 @@
 #define S2E_ENVIRONMENT_LOCAL_GEOMAGNETIC_FIELD_HPP_
 
 #include "library/geodesy/geodetic_position.hpp"
+#include "library/geomagnetism/igrf_model.hpp"
 #include "library/logger/loggable.hpp"
 #include "library/math/quaternion.hpp"
 #include "library/math/vector.hpp"
+#include "library/randomization/normal_randomization.hpp"
+#include "library/randomization/random_walk.hpp"
+#include "library/utilities/checkpoint.hpp"
 
 /**
  * @class GeomagneticField
@@ -26,9 +30,10 @@ class GeomagneticField : public ILoggable {
    * @param [in] random_walk_srandard_deviation_nT: Standard deviation of Random Walk [nT]
    * @param [in] random_walk_limit_nT: Limit of Random Walk [nT]
    * @param [in] white_noise_standard_deviation_nT: Standard deviation of white noise [nT]
+   * @param [in] degree: Maximum degree of the IGRF model. 0 means the maximum degree in the coefficient file.
    */
   GeomagneticField(const std::string igrf_file_name, const double random_walk_srandard_deviation_nT, const double random_walk_limit_nT,
-                   const double white_noise_standard_deviation_nT);
+                   const double white_noise_standard_deviation_nT, const size_t degree = 0);
   /**
    * @fn ~GeomagneticField
    * @brief Destructor
@@ -57,6 +62,19 @@ class GeomagneticField : public ILoggable {
    */
   inline libra::Vector<3> GetGeomagneticField_b_nT() const { return magnetic_field_b_nT_; }
 
+  /**
+   * @fn SaveState
+   * @brief Write the magnetic field and the state of the noise to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the magnetic field and the state of the noise from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
+
   // Override ILoggable
   /**
    * @fn GetLogHeader
@@ -68,6 +86,11 @@ class GeomagneticField : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn PushLogValue
+   * @brief Override PushLogValue function of ILoggable
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const;
 
  private:
   libra::Vector<3> magnetic_field_i_nT_;      //!< Magnetic field vector at the inertial frame [nT]
@@ -76,13 +99,16 @@ class GeomagneticField : public ILoggable {
   double random_walk_limit_nT_;               //!< Limit of Random Walk [nT]
   double white_noise_standard_deviation_nT_;  //!< Standard deviation of white noise [nT]
   std::string igrf_file_name_;                //!< Path to the initialize file
+  IgrfModel igrf_model_;                      //!< IGRF model with the daily updated coefficients
+  RandomWalk<3> random_walk_;                 //!< Random walk noise
+  libra::NormalRand white_noise_;             //!< White noise
 
   /**
    * @fn AddNoise
    * @brief Add magnetic field noise
-   * @param [in/out] magnetic_field_array_i_nT: input true magnetic field, output magnetic field with noise
+   * @param [in/out] magnetic_field_i_nT: input true magnetic field, output magnetic field with noise
    */
-  void AddNoise(double* magnetic_field_array_i_nT);
+  void AddNoise(libra::Vector<3>& magnetic_field_i_nT);
 };
 
 #endif  // S2E_ENVIRONMENT_LOCAL_GEOMAGNETIC_FIELD_HPP_
@@ -6,6 +6,7 @@
 #include "initialize_local_environment.hpp"
 
 #include <library/initialize/initialize_file_access.hpp>
+#include <library/math/constants.hpp>
 #include <string>
 
 #define CALC_LABEL "calculation"
@@ -19,8 +20,10 @@ GeomagneticField InitGeomagneticField(std::string initialize_file_path) {
   double mag_rwdev = conf.ReadDouble(section, "magnetic_field_random_walk_standard_deviation_nT");
   double mag_rwlimit = conf.ReadDouble(section, "magnetic_field_random_walk_limit_nT");
   double mag_wnvar = conf.ReadDouble(section, "magnetic_field_white_noise_standard_deviation_nT");
+  int degree = conf.ReadInt(section, "degree");
+  if (degree < 0) degree = 0;
 
-  GeomagneticField geomagnetic_field(fname, mag_rwdev, mag_rwlimit, mag_wnvar);
+  GeomagneticField geomagnetic_field(fname, mag_rwdev, mag_rwlimit, mag_wnvar, (size_t)degree);
   geomagnetic_field.IsCalcEnabled = conf.ReadEnable(section, CALC_LABEL);
   geomagnetic_field.is_log_enabled_ = conf.ReadEnable(section, LOG_LABEL);
 
@@ -69,5 +72,21 @@ Atmosphere InitAtmosphere(std::string initialize_file_path) {
   atmosphere.IsCalcEnabled = conf.ReadEnable(section, CALC_LABEL);
   atmosphere.is_log_enabled_ = conf.ReadEnable(section, LOG_LABEL);
 
+  if (conf.ReadEnable(section, "is_density_cache_enabled")) {
+    double cache_altitude_step_m = conf.ReadDouble(section, "density_cache_altitude_step_m");
+    double cache_latitude_step_rad = conf.ReadDouble(section, "density_cache_latitude_step_deg") * libra::deg_to_rad;
+    double cache_local_time_step_hour = conf.ReadDouble(section, "density_cache_local_time_step_hour");
+    double cache_tolerance = conf.ReadDouble(section, "density_cache_tolerance");
+    double cache_universal_time_step_hour = conf.ReadDouble(section, "density_cache_universal_time_step_hour");
+    if (cache_altitude_step_m > 0.0 && cache_latitude_step_rad > 0.0 && cache_local_time_step_hour > 0.0 && cache_universal_time_step_hour > 0.0) {
+      atmosphere.EnableDensityCache(cache_altitude_step_m, cache_latitude_step_rad, cache_local_time_step_hour, cache_tolerance,
+                                    cache_universal_time_step_hour);
+    } else {
+      std::cerr << "Density cache steps must be positive. The density cache is disabled. "
+                   "Check [ATMOSPHERE] section in LocalEnvironment.ini."
+                << std::endl;
+    }
+  }
+
   return atmosphere;
 }
@@ -197,3 +197,14 @@ std::string LocalCelestialInformation::GetLogValue() const {
   }
   return str_tmp;
 }
+
+void LocalCelestialInformation::PushLogValue(LogValueBuffer& buffer) const {
+  for (int i = 0; i < global_celestial_information_->GetNumberOfSelectedBodies(); i++) {
+    for (int j = 0; j < 3; j++) {
+      buffer.Push(celestial_body_position_from_spacecraft_b_m_[i * 3 + j]);
+    }
+    for (int j = 0; j < 3; j++) {
+      buffer.Push(celestial_body_velocity_from_spacecraft_b_m_s_[i * 3 + j]);
+    }
+  }
+}
@@ -79,6 +79,11 @@ class LocalCelestialInformation : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn PushLogValue
+   * @brief Override PushLogValue function of ILoggable
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const;
 
  private:
   const CelestialInformation* global_celestial_information_;  //!< Global celestial information
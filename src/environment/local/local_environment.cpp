@@ -8,6 +8,7 @@
 #include "dynamics/orbit/orbit.hpp"
 #include "initialize_local_environment.hpp"
 #include "library/initialize/initialize_file_access.hpp"
+#include "library/utilities/profiler.hpp"
 
 LocalEnvironment::LocalEnvironment(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment,
                                    const int spacecraft_id) {
@@ -49,6 +50,7 @@ void LocalEnvironment::Initialize(const SimulationConfiguration* simulation_conf
 }
 
 void LocalEnvironment::Update(const Dynamics* dynamics, const SimulationTime* simulation_time) {
+  S2E_PROFILE_SCOPE("LocalEnvironment::Update");
   auto& orbit = dynamics->GetOrbit();
   auto& attitude = dynamics->GetAttitude();
 
@@ -67,6 +69,24 @@ void LocalEnvironment::Update(const Dynamics* dynamics, const SimulationTime* si
   }
 }
 
+void LocalEnvironment::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("LocalEnvironment");
+  geomagnetic_field_->SaveState(writer);
+  atmosphere_->SaveState(writer);
+}
+
+void LocalEnvironment::LoadState(CheckpointReader& reader, const Dynamics* dynamics) {
+  reader.BeginSection("LocalEnvironment");
+  geomagnetic_field_->LoadState(reader);
+  atmosphere_->LoadState(reader);
+
+  auto& orbit = dynamics->GetOrbit();
+  auto& attitude = dynamics->GetAttitude();
+  celestial_information_->UpdateAllObjectsInformation(orbit.GetPosition_i_m(), orbit.GetVelocity_i_m_s(), attitude.GetQuaternion_i2b(),
+                                                      attitude.GetAngularVelocity_b_rad_s());
+  solar_radiation_pressure_environment_->UpdateAllStates();
+}
+
 void LocalEnvironment::LogSetup(Logger& logger) {
   logger.AddLogList(geomagnetic_field_);
   logger.AddLogList(solar_radiation_pressure_environment_);
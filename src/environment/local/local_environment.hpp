@@ -42,6 +42,21 @@ class LocalEnvironment {
    */
   void Update(const Dynamics* dynamics, const SimulationTime* simulation_time);
 
+  /**
+   * @fn SaveState
+   * @brief Write the states of the local environments with noise to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the states of the local environments from the checkpoint
+   * @note The celestial information and the solar radiation pressure are calculated again with the restored dynamics.
+   * @param [in] reader: Checkpoint reader
+   * @param [in] dynamics: Dynamics information of the satellite restored in advance
+   */
+  void LoadState(CheckpointReader& reader, const Dynamics* dynamics);
+
   /**
    * @fn LogSetup
    * @brief Log setup for local environments
@@ -51,6 +51,11 @@ std::string SolarRadiationPressureEnvironment::GetLogValue() const {
   return str_tmp;
 }
 
+void SolarRadiationPressureEnvironment::PushLogValue(LogValueBuffer& buffer) const {
+  buffer.Push(solar_radiation_pressure_N_m2_ * shadow_coefficient_);
+  buffer.Push(shadow_coefficient_);
+}
+
 void SolarRadiationPressureEnvironment::CalcShadowCoefficient(std::string shadow_source_name) {
   if (shadow_source_name == "SUN") {
     shadow_coefficient_ = 1.0;
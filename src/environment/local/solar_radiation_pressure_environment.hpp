@@ -78,6 +78,11 @@ class SolarRadiationPressureEnvironment : public ILoggable {
    * @brief Override GetLogValue function of ILoggable
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn PushLogValue
+   * @brief Override PushLogValue function of ILoggable
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const;
 
  private:
   double solar_radiation_pressure_N_m2_;  //!< Solar radiation pressure [N/m^2]
@@ -0,0 +1,117 @@
+/**
+ * @file test_atmosphere_density_cache.cpp
+ * @brief Test codes for AtmosphereDensityCache class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <library/utilities/macros.hpp>
+
+#include "atmosphere_density_cache.hpp"
+
+namespace {
+/**
+ * @fn SmoothDensity_kg_m3
+ * @brief Smooth density model with the exponential altitude profile, the latitude dependence, and the diurnal bulge
+ */
+double SmoothDensity_kg_m3(const double altitude_m, const double latitude_rad, const double local_time_hour, const double universal_time_hour) {
+  UNUSED(universal_time_hour);
+  const double scale_height_m = 50.0e3 + 0.1 * (altitude_m - 300.0e3);
+  return 2.4e-11 * std::exp(-(altitude_m - 300.0e3) / scale_height_m) * (1.0 + 0.2 * std::cos(latitude_rad)) *
+         (1.0 + 0.4 * std::cos(2.0 * libra::pi * (local_time_hour - 14.0) / 24.0));
+}
+}  // namespace
+
+/**
+ * @brief Test the interpolation error and the number of evaluations along a low earth orbit
+ */
+TEST(AtmosphereDensityCache, LowEarthOrbit) {
+  AtmosphereDensityCache cache(5000.0, 5.0 * libra::deg_to_rad, 1.0, 0.01);
+  size_t number_of_queries = 0;
+  double max_relative_error = 0.0;
+  // 10 orbits of 90 minutes with 1 second step. The inclination is 51.6 deg and the local time drifts slowly.
+  for (size_t step = 0; step < 10 * 5400; step++) {
+    const double phase_rad = 2.0 * libra::pi * step / 5400.0;
+    const double altitude_m = 350.0e3 + 10.0e3 * std::sin(phase_rad);
+    const double latitude_rad = std::asin(std::sin(51.6 * libra::deg_to_rad) * std::sin(phase_rad));
+    const double local_time_hour = 12.0 + 12.0 * std::cos(phase_rad) + step / 3600.0 * 0.01;
+    const double density_kg_m3 = cache.GetAirDensity_kg_m3(altitude_m, latitude_rad, local_time_hour, 0.0, SmoothDensity_kg_m3);
+    const double reference_kg_m3 = SmoothDensity_kg_m3(altitude_m, latitude_rad, local_time_hour, 0.0);
+    max_relative_error = std::max(max_relative_error, std::abs(density_kg_m3 - reference_kg_m3) / reference_kg_m3);
+    number_of_queries++;
+  }
+  EXPECT_LT(max_relative_error, 0.01);
+  EXPECT_EQ(0u, cache.GetNumberOfDirectCells());
+  EXPECT_LT(cache.GetNumberOfEvaluations() * 10, number_of_queries);
+
+  cache.Clear();
+  EXPECT_EQ(0u, cache.GetNumberOfCells());
+}
+
+/**
+ * @brief Test that the cell is evaluated directly when the interpolation error exceeds the tolerance
+ */
+TEST(AtmosphereDensityCache, Tolerance) {
+  // The density has a sharp change in the altitude cells
+  auto density_function = [](double altitude_m, double latitude_rad, double local_time_hour, double universal_time_hour) {
+    return SmoothDensity_kg_m3(altitude_m, latitude_rad, local_time_hour, universal_time_hour) * (1.0 + 0.5 * std::sin(altitude_m / 300.0));
+  };
+  AtmosphereDensityCache cache(5000.0, 5.0 * libra::deg_to_rad, 1.0, 0.01);
+  for (size_t i = 0; i < 100; i++) {
+    const double altitude_m = 400.0e3 + 123.0 * i;
+    const double latitude_rad = 0.1;
+    const double local_time_hour = 3.0;
+    EXPECT_DOUBLE_EQ(density_function(altitude_m, latitude_rad, local_time_hour, 0.0),
+                     cache.GetAirDensity_kg_m3(altitude_m, latitude_rad, local_time_hour, 0.0, density_function));
+  }
+  EXPECT_EQ(cache.GetNumberOfCells(), cache.GetNumberOfDirectCells());
+}
+
+/**
+ * @brief Test the boundaries of the latitude and the local time
+ */
+TEST(AtmosphereDensityCache, Boundary) {
+  AtmosphereDensityCache cache(5000.0, 5.0 * libra::deg_to_rad, 1.0, 0.01);
+  const double altitude_m = 400.0e3;
+
+  // The local time is periodic
+  const double density_kg_m3 = cache.GetAirDensity_kg_m3(altitude_m, 0.0, 23.5, 0.0, SmoothDensity_kg_m3);
+  EXPECT_DOUBLE_EQ(density_kg_m3, cache.GetAirDensity_kg_m3(altitude_m, 0.0, -0.5, 0.0, SmoothDensity_kg_m3));
+  EXPECT_DOUBLE_EQ(density_kg_m3, cache.GetAirDensity_kg_m3(altitude_m, 0.0, 47.5, 0.0, SmoothDensity_kg_m3));
+  EXPECT_EQ(1u, cache.GetNumberOfCells());
+
+  // The poles
+  const double latitudes_rad[2] = {-libra::pi_2, libra::pi_2};
+  for (size_t i = 0; i < 2; i++) {
+    const double reference_kg_m3 = SmoothDensity_kg_m3(altitude_m, latitudes_rad[i], 10.0, 0.0);
+    EXPECT_NEAR(reference_kg_m3, cache.GetAirDensity_kg_m3(altitude_m, latitudes_rad[i], 10.0, 0.0, SmoothDensity_kg_m3), reference_kg_m3 * 0.01);
+  }
+}
+
+/**
+ * @brief Test that the cell is made again when the UT bin changes
+ */
+TEST(AtmosphereDensityCache, UniversalTime) {
+  // The density at the same local time changes with the UT
+  auto density_function = [](double altitude_m, double latitude_rad, double local_time_hour, double universal_time_hour) {
+    return SmoothDensity_kg_m3(altitude_m, latitude_rad, local_time_hour, universal_time_hour) *
+           (1.0 + 0.05 * std::sin(2.0 * libra::pi * universal_time_hour / 24.0));
+  };
+  AtmosphereDensityCache cache(5000.0, 5.0 * libra::deg_to_rad, 1.0, 0.01, 1.0);
+  const double altitude_m = 400.0e3;
+  const double latitude_rad = 0.1;
+  const double local_time_hour = 3.0;
+  double max_relative_error = 0.0;
+  // Every minute for a day at the same cell
+  for (size_t minute = 0; minute < 24 * 60; minute++) {
+    const double universal_time_hour = minute / 60.0;
+    const double density_kg_m3 = cache.GetAirDensity_kg_m3(altitude_m, latitude_rad, local_time_hour, universal_time_hour, density_function);
+    const double reference_kg_m3 = density_function(altitude_m, latitude_rad, local_time_hour, universal_time_hour);
+    max_relative_error = std::max(max_relative_error, std::abs(density_kg_m3 - reference_kg_m3) / reference_kg_m3);
+  }
+  EXPECT_LT(max_relative_error, 0.01);
+  EXPECT_EQ(1u, cache.GetNumberOfCells());
+  EXPECT_EQ(0u, cache.GetNumberOfDirectCells());
+  // Eight corners and the center of the cell for each UT bin
+  EXPECT_EQ(24u * 9u, cache.GetNumberOfEvaluations());
+}
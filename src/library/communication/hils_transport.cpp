@@ -0,0 +1,443 @@
+/**
+ * @file hils_transport.cpp
+ * @brief Non-blocking byte stream transports for HILS test
+ */
+
+#include "hils_transport.hpp"
+
+#ifndef WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+// HilsTransport
+void HilsTransport::Close() {
+  rx_queue_.clear();
+  rx_head_ = 0;
+  tx_queue_.clear();
+  tx_head_ = 0;
+}
+
+int HilsTransport::Write(const unsigned char* buffer, const size_t length) {
+  if (!IsOpen()) return -1;
+  tx_queue_.insert(tx_queue_.end(), buffer, buffer + length);
+  return Flush() < 0 ? -1 : 0;
+}
+
+int HilsTransport::Read(unsigned char* buffer, const size_t length) {
+  if (!IsOpen()) return -1;
+  if (rx_queue_.size() - rx_head_ < length) {
+    if (Receive() < 0) return -1;
+  }
+  const size_t read_length = std::min(length, rx_queue_.size() - rx_head_);
+  if (read_length > 0) memcpy(buffer, rx_queue_.data() + rx_head_, read_length);
+  rx_head_ += read_length;
+  if (rx_head_ == rx_queue_.size()) {
+    rx_queue_.clear();
+    rx_head_ = 0;
+  }
+  return (int)read_length;
+}
+
+int HilsTransport::GetBytesToRead() {
+  if (!IsOpen()) return -1;
+  if (Receive() < 0) return -1;
+  return (int)(rx_queue_.size() - rx_head_);
+}
+
+int HilsTransport::Receive() {
+  if (!IsOpen()) return -1;
+  if (receive_chunk_.empty()) receive_chunk_.resize(kReceiveChunkSize);
+  // Remove the read data before appending
+  if (rx_head_ > 0) {
+    rx_queue_.erase(rx_queue_.begin(), rx_queue_.begin() + rx_head_);
+    rx_head_ = 0;
+  }
+
+  int received_length = 0;
+  while (true) {
+    const int ret = ReceiveBytes(receive_chunk_.data(), receive_chunk_.size());
+    if (ret < 0) return -1;
+    if (ret == 0) break;
+    rx_queue_.insert(rx_queue_.end(), receive_chunk_.begin(), receive_chunk_.begin() + ret);
+    received_length += ret;
+  }
+  return received_length;
+}
+
+int HilsTransport::Flush() {
+  if (!IsOpen()) return -1;
+  while (tx_head_ < tx_queue_.size()) {
+    const int ret = SendBytes(tx_queue_.data() + tx_head_, tx_queue_.size() - tx_head_);
+    if (ret < 0) return -1;
+    if (ret == 0) break;
+    tx_head_ += (size_t)ret;
+  }
+  if (tx_head_ == tx_queue_.size()) {
+    tx_queue_.clear();
+    tx_head_ = 0;
+  }
+  return (int)GetBytesToWrite();
+}
+
+void HilsTransport::DiscardReceivedData() {
+  Receive();
+  rx_queue_.clear();
+  rx_head_ = 0;
+}
+
+void HilsTransport::DiscardQueuedData() {
+  tx_queue_.clear();
+  tx_head_ = 0;
+}
+
+// HilsLoopbackTransport
+bool HilsLoopbackTransport::Open() {
+  is_open_ = true;
+  return true;
+}
+
+void HilsLoopbackTransport::Close() {
+  HilsTransport::Close();
+  wire_.clear();
+  is_open_ = false;
+}
+
+int HilsLoopbackTransport::ReceiveBytes(unsigned char* buffer, const size_t length) {
+  const size_t received_length = std::min(length, wire_.size());
+  if (received_length == 0) return 0;
+  memcpy(buffer, wire_.data(), received_length);
+  wire_.erase(wire_.begin(), wire_.begin() + received_length);
+  return (int)received_length;
+}
+
+int HilsLoopbackTransport::SendBytes(const unsigned char* buffer, const size_t length) {
+  wire_.insert(wire_.end(), buffer, buffer + length);
+  return (int)length;
+}
+
+#ifndef WIN32
+namespace {
+/**
+ * @fn ConvertBaudRate
+ * @brief Convert the baud rate to the termios speed constant
+ * @return Speed constant, or B0 when the baud rate is not supported
+ */
+speed_t ConvertBaudRate(const unsigned int baud_rate) {
+  switch (baud_rate) {
+    case 1200:
+      return B1200;
+    case 2400:
+      return B2400;
+    case 4800:
+      return B4800;
+    case 9600:
+      return B9600;
+    case 19200:
+      return B19200;
+    case 38400:
+      return B38400;
+    case 57600:
+      return B57600;
+    case 115200:
+      return B115200;
+    case 230400:
+      return B230400;
+#ifdef B460800
+    case 460800:
+      return B460800;
+#endif
+#ifdef B921600
+    case 921600:
+      return B921600;
+#endif
+    default:
+      return B0;
+  }
+}
+
+/**
+ * @fn SetRawMode
+ * @brief Set the terminal as the raw mode
+ * @return True when success
+ */
+bool SetRawMode(const int file_descriptor, const speed_t speed) {
+  struct termios settings;
+  if (tcgetattr(file_descriptor, &settings) != 0) return false;
+  cfmakeraw(&settings);
+  settings.c_cflag |= (CLOCAL | CREAD);
+  settings.c_cc[VMIN] = 0;
+  settings.c_cc[VTIME] = 0;
+  if (speed != B0 && (cfsetispeed(&settings, speed) != 0 || cfsetospeed(&settings, speed) != 0)) return false;
+  return tcsetattr(file_descriptor, TCSANOW, &settings) == 0;
+}
+}  // namespace
+
+// HilsFileDescriptorTransport
+HilsFileDescriptorTransport::~HilsFileDescriptorTransport() { HilsFileDescriptorTransport::Close(); }
+
+void HilsFileDescriptorTransport::Close() {
+  HilsTransport::Close();
+  if (file_descriptor_ >= 0) close(file_descriptor_);
+  file_descriptor_ = -1;
+}
+
+int HilsFileDescriptorTransport::ReceiveBytes(unsigned char* buffer, const size_t length) {
+  while (true) {
+    const ssize_t ret = read(file_descriptor_, buffer, length);
+    if (ret >= 0) return (int)ret;
+    if (errno == EINTR) continue;
+    // The master side of the pseudo-terminal returns EIO when the slave side is not opened, and the connected UDP socket returns
+    // ECONNREFUSED when the previous datagram was not received
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EIO || errno == ECONNREFUSED) return 0;
+    return -1;
+  }
+}
+
+int HilsFileDescriptorTransport::SendBytes(const unsigned char* buffer, const size_t length) {
+  while (true) {
+    const ssize_t ret = write(file_descriptor_, buffer, length);
+    if (ret >= 0) return (int)ret;
+    if (errno == EINTR) continue;
+    // The connected UDP socket returns ECONNREFUSED when the previous datagram was not received
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ECONNREFUSED) return 0;
+    return -1;
+  }
+}
+
+bool HilsFileDescriptorTransport::SetNonBlocking() {
+  const int flags = fcntl(file_descriptor_, F_GETFL, 0);
+  if (flags < 0) return false;
+  return fcntl(file_descriptor_, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+// HilsSerialTransport
+bool HilsSerialTransport::Open() {
+  Close();
+  const speed_t speed = ConvertBaudRate(baud_rate_);
+  if (speed == B0) {
+    std::cerr << "WARNING: HILS serial port: baud rate " << baud_rate_ << " is not supported" << std::endl;
+    return false;
+  }
+  file_descriptor_ = open(device_path_.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (file_descriptor_ < 0) {
+    std::cerr << "WARNING: HILS serial port: " << device_path_ << " cannot be opened: " << strerror(errno) << std::endl;
+    return false;
+  }
+  if (!SetRawMode(file_descriptor_, speed)) {
+    std::cerr << "WARNING: HILS serial port: " << device_path_ << " cannot be configured: " << strerror(errno) << std::endl;
+    Close();
+    return false;
+  }
+  tcflush(file_descriptor_, TCIOFLUSH);
+  return true;
+}
+
+// HilsPseudoTerminalTransport
+bool HilsPseudoTerminalTransport::Open() {
+  Close();
+  file_descriptor_ = posix_openpt(O_RDWR | O_NOCTTY);
+  if (file_descriptor_ < 0) return false;
+  const char* slave_path = nullptr;
+  if (grantpt(file_descriptor_) != 0 || unlockpt(file_descriptor_) != 0 || (slave_path = ptsname(file_descriptor_)) == nullptr ||
+      !SetRawMode(file_descriptor_, B0) || !SetNonBlocking()) {
+    Close();
+    return false;
+  }
+  slave_path_ = slave_path;
+  return true;
+}
+
+// HilsTcpTransport
+bool HilsTcpTransport::Open() {
+  Close();
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  struct addrinfo* addresses = nullptr;
+  if (getaddrinfo(host_.c_str(), port_.c_str(), &hints, &addresses) != 0) {
+    std::cerr << "WARNING: HILS TCP: " << host_ << ":" << port_ << " cannot be resolved" << std::endl;
+    return false;
+  }
+
+  // The connection is established in the blocking mode, and the socket is set as non-blocking after that
+  for (struct addrinfo* address = addresses; address != nullptr; address = address->ai_next) {
+    file_descriptor_ = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+    if (file_descriptor_ < 0) continue;
+    if (connect(file_descriptor_, address->ai_addr, address->ai_addrlen) == 0) break;
+    close(file_descriptor_);
+    file_descriptor_ = -1;
+  }
+  freeaddrinfo(addresses);
+  if (file_descriptor_ < 0) {
+    std::cerr << "WARNING: HILS TCP: " << host_ << ":" << port_ << " cannot be connected" << std::endl;
+    return false;
+  }
+
+  const int no_delay = 1;
+  setsockopt(file_descriptor_, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+  if (!SetNonBlocking()) {
+    Close();
+    return false;
+  }
+  return true;
+}
+
+// HilsUdpTransport
+bool HilsUdpTransport::Open() {
+  Close();
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_DGRAM;
+  struct addrinfo* remote_address = nullptr;
+  if (getaddrinfo(remote_host_.c_str(), remote_port_.c_str(), &hints, &remote_address) != 0) {
+    std::cerr << "WARNING: HILS UDP: " << remote_host_ << ":" << remote_port_ << " cannot be resolved" << std::endl;
+    return false;
+  }
+  hints.ai_flags = AI_PASSIVE;
+  struct addrinfo* local_address = nullptr;
+  if (getaddrinfo(nullptr, local_port_.c_str(), &hints, &local_address) != 0) {
+    freeaddrinfo(remote_address);
+    return false;
+  }
+
+  file_descriptor_ = socket(AF_INET, SOCK_DGRAM, 0);
+  bool is_succeeded = file_descriptor_ >= 0 && bind(file_descriptor_, local_address->ai_addr, local_address->ai_addrlen) == 0 &&
+                      connect(file_descriptor_, remote_address->ai_addr, remote_address->ai_addrlen) == 0 && SetNonBlocking();
+  freeaddrinfo(local_address);
+  freeaddrinfo(remote_address);
+  if (!is_succeeded) {
+    std::cerr << "WARNING: HILS UDP: local port " << local_port_ << " cannot be opened" << std::endl;
+    Close();
+    return false;
+  }
+  return true;
+}
+#endif  // WIN32
+
+// HilsTransportPoller
+HilsTransportPoller::HilsTransportPoller() {
+#ifdef __linux__
+  epoll_file_descriptor_ = epoll_create1(EPOLL_CLOEXEC);
+#endif
+}
+
+HilsTransportPoller::~HilsTransportPoller() {
+#ifdef __linux__
+  if (epoll_file_descriptor_ >= 0) close(epoll_file_descriptor_);
+#endif
+}
+
+bool HilsTransportPoller::Register(HilsTransport* transport) {
+  if (transport == nullptr || !transport->IsOpen()) return false;
+  if (std::find(transports_.begin(), transports_.end(), transport) != transports_.end()) return true;
+#ifdef __linux__
+  const int file_descriptor = transport->GetFileDescriptor();
+  if (file_descriptor >= 0 && epoll_file_descriptor_ >= 0) {
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.ptr = transport;
+    if (epoll_ctl(epoll_file_descriptor_, EPOLL_CTL_ADD, file_descriptor, &event) != 0) return false;
+  }
+#endif
+  transports_.push_back(transport);
+  return true;
+}
+
+void HilsTransportPoller::Unregister(HilsTransport* transport) {
+  auto found = std::find(transports_.begin(), transports_.end(), transport);
+  if (found == transports_.end()) return;
+#ifdef __linux__
+  const int file_descriptor = transport->GetFileDescriptor();
+  if (file_descriptor >= 0 && epoll_file_descriptor_ >= 0) epoll_ctl(epoll_file_descriptor_, EPOLL_CTL_DEL, file_descriptor, nullptr);
+#endif
+  transports_.erase(found);
+}
+
+int HilsTransportPoller::Poll(const int timeout_ms) {
+  for (auto transport : transports_) {
+    if (transport->GetBytesToWrite() > 0) transport->Flush();
+  }
+
+  int number_of_received_transports = 0;
+  bool is_epoll_used = false;
+#ifdef __linux__
+  if (epoll_file_descriptor_ >= 0) {
+    is_epoll_used = true;
+    // The transports without a file descriptor are always ready
+    bool has_other_transports = false;
+    for (auto transport : transports_) {
+      if (transport->GetFileDescriptor() < 0 && transport->Receive() > 0) {
+        has_other_transports = true;
+        number_of_received_transports++;
+      }
+    }
+
+    static const int kMaxEvents = 64;
+    struct epoll_event events[kMaxEvents];
+    int number_of_events;
+    do {
+      number_of_events = epoll_wait(epoll_file_descriptor_, events, kMaxEvents, has_other_transports ? 0 : timeout_ms);
+    } while (number_of_events < 0 && errno == EINTR);
+    if (number_of_events < 0) return -1;
+    for (int i = 0; i < number_of_events; i++) {
+      if (static_cast<HilsTransport*>(events[i].data.ptr)->Receive() > 0) number_of_received_transports++;
+    }
+  }
+#endif
+  if (!is_epoll_used) {
+    (void)timeout_ms;
+    for (auto transport : transports_) {
+      if (transport->Receive() > 0) number_of_received_transports++;
+    }
+  }
+  return number_of_received_transports;
+}
+
+std::unique_ptr<HilsTransport> CreateHilsTransport(const std::string& address, const unsigned int baud_rate) {
+  const size_t separator = address.find(':');
+  const std::string type = address.substr(0, separator);
+  const std::string parameter = separator == std::string::npos ? "" : address.substr(separator + 1);
+
+  if (type == "loopback") return std::unique_ptr<HilsTransport>(new HilsLoopbackTransport());
+#ifndef WIN32
+  if (type == "serial") return std::unique_ptr<HilsTransport>(new HilsSerialTransport(parameter, baud_rate));
+  if (type == "pty") return std::unique_ptr<HilsTransport>(new HilsPseudoTerminalTransport());
+  if (type == "tcp") {
+    const size_t port_separator = parameter.rfind(':');
+    if (port_separator != std::string::npos) {
+      return std::unique_ptr<HilsTransport>(new HilsTcpTransport(parameter.substr(0, port_separator), parameter.substr(port_separator + 1)));
+    }
+  }
+  if (type == "udp") {
+    const size_t local_separator = parameter.find(':');
+    const size_t remote_separator = parameter.rfind(':');
+    if (local_separator != std::string::npos && remote_separator > local_separator) {
+      const std::string remote_host = parameter.substr(local_separator + 1, remote_separator - local_separator - 1);
+      return std::unique_ptr<HilsTransport>(
+          new HilsUdpTransport(parameter.substr(0, local_separator), remote_host, parameter.substr(remote_separator + 1)));
+    }
+  }
+#else
+  (void)baud_rate;
+#endif
+  std::cerr << "WARNING: HILS transport address: " << address << " is not supported" << std::endl;
+  return nullptr;
+}
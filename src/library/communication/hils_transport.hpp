@@ -0,0 +1,309 @@
+/**
+ * @file hils_transport.hpp
+ * @brief Non-blocking byte stream transports for HILS test
+ */
+
+#ifndef S2E_LIBRARY_COMMUNICATION_HILS_TRANSPORT_HPP_
+#define S2E_LIBRARY_COMMUNICATION_HILS_TRANSPORT_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @class HilsTransport
+ * @brief Base class of non-blocking byte stream transports for HILS test
+ * @details Received bytes and bytes which could not be sent immediately are kept in the internal queues, so Read and Write never wait
+ *          for the external device. The transports with a file descriptor can be polled in a batch with HilsTransportPoller.
+ */
+class HilsTransport {
+ public:
+  /**
+   * @fn ~HilsTransport
+   * @brief Destructor
+   */
+  virtual ~HilsTransport() {}
+
+  /**
+   * @fn Open
+   * @brief Open the transport
+   * @return True when success
+   */
+  virtual bool Open() = 0;
+  /**
+   * @fn Close
+   * @brief Close the transport and discard the queued data
+   */
+  virtual void Close();
+  /**
+   * @fn IsOpen
+   * @brief Return true when the transport is opened
+   */
+  virtual bool IsOpen() const = 0;
+  /**
+   * @fn GetFileDescriptor
+   * @brief Return file descriptor for polling, or -1 when the transport does not have it
+   */
+  virtual int GetFileDescriptor() const { return -1; }
+
+  /**
+   * @fn Write
+   * @brief Send data. The data which cannot be sent immediately is queued and sent by the following Write or Flush.
+   * @param [in] buffer: Data buffer to send
+   * @param [in] length: Length of data to send
+   * @return 0: success, -1: error
+   */
+  int Write(const unsigned char* buffer, const size_t length);
+  /**
+   * @fn Read
+   * @brief Read received data without waiting
+   * @param [out] buffer: Data buffer to store read data
+   * @param [in] length: Maximum length of data to read
+   * @return Length of read data (0 when no data is available), -1: error
+   */
+  int Read(unsigned char* buffer, const size_t length);
+  /**
+   * @fn GetBytesToRead
+   * @brief Receive the available data and return length of data to read
+   * @return Length of data to read, -1: error
+   */
+  int GetBytesToRead();
+  /**
+   * @fn Receive
+   * @brief Receive all available data into the internal queue
+   * @return Length of received data, -1: error
+   */
+  int Receive();
+  /**
+   * @fn Flush
+   * @brief Send the queued data as much as possible without waiting
+   * @return Length of data still queued, -1: error
+   */
+  int Flush();
+  /**
+   * @fn GetBytesToWrite
+   * @brief Return length of queued data to send
+   */
+  inline size_t GetBytesToWrite() const { return tx_queue_.size() - tx_head_; }
+  /**
+   * @fn DiscardReceivedData
+   * @brief Receive the available data and discard all received data
+   */
+  void DiscardReceivedData();
+  /**
+   * @fn DiscardQueuedData
+   * @brief Discard the queued data to send
+   */
+  void DiscardQueuedData();
+
+ protected:
+  /**
+   * @fn ReceiveBytes
+   * @brief Receive data from the device without waiting
+   * @return Length of received data (0 when no data is available), -1: error
+   */
+  virtual int ReceiveBytes(unsigned char* buffer, const size_t length) = 0;
+  /**
+   * @fn SendBytes
+   * @brief Send data to the device without waiting
+   * @return Length of sent data (0 when the device is busy), -1: error
+   */
+  virtual int SendBytes(const unsigned char* buffer, const size_t length) = 0;
+
+ private:
+  static const size_t kReceiveChunkSize = 65536;  //!< Maximum size of one receive call (maximum UDP datagram size)
+  std::vector<unsigned char> rx_queue_;           //!< Received data
+  size_t rx_head_ = 0;                            //!< Position of the first unread data in rx_queue_
+  std::vector<unsigned char> tx_queue_;           //!< Data waiting to be sent
+  size_t tx_head_ = 0;                            //!< Position of the first unsent data in tx_queue_
+  std::vector<unsigned char> receive_chunk_;      //!< Buffer for one receive call
+};
+
+/**
+ * @class HilsLoopbackTransport
+ * @brief Stand-in device which returns the sent data as the received data like a wire connecting TX and RX
+ */
+class HilsLoopbackTransport : public HilsTransport {
+ public:
+  bool Open() override;
+  void Close() override;
+  bool IsOpen() const override { return is_open_; }
+
+ protected:
+  int ReceiveBytes(unsigned char* buffer, const size_t length) override;
+  int SendBytes(const unsigned char* buffer, const size_t length) override;
+
+ private:
+  bool is_open_ = false;             //!< Open flag
+  std::vector<unsigned char> wire_;  //!< Data on the wire
+};
+
+#ifndef WIN32
+/**
+ * @class HilsFileDescriptorTransport
+ * @brief Base class of the transports with a non-blocking file descriptor
+ */
+class HilsFileDescriptorTransport : public HilsTransport {
+ public:
+  /**
+   * @fn ~HilsFileDescriptorTransport
+   * @brief Destructor to close the file descriptor
+   */
+  virtual ~HilsFileDescriptorTransport();
+  void Close() override;
+  bool IsOpen() const override { return file_descriptor_ >= 0; }
+  int GetFileDescriptor() const override { return file_descriptor_; }
+
+ protected:
+  int file_descriptor_ = -1;  //!< File descriptor
+
+  int ReceiveBytes(unsigned char* buffer, const size_t length) override;
+  int SendBytes(const unsigned char* buffer, const size_t length) override;
+  /**
+   * @fn SetNonBlocking
+   * @brief Set the file descriptor as non-blocking
+   * @return True when success
+   */
+  bool SetNonBlocking();
+};
+
+/**
+ * @class HilsSerialTransport
+ * @brief Serial port with POSIX termios in the raw mode
+ */
+class HilsSerialTransport : public HilsFileDescriptorTransport {
+ public:
+  /**
+   * @fn HilsSerialTransport
+   * @brief Constructor
+   * @param [in] device_path: Path to the device like /dev/ttyUSB0
+   * @param [in] baud_rate: Baud rate ex. 9600, 115200
+   */
+  HilsSerialTransport(const std::string& device_path, const unsigned int baud_rate) : device_path_(device_path), baud_rate_(baud_rate) {}
+  bool Open() override;
+
+ private:
+  std::string device_path_;  //!< Path to the device
+  unsigned int baud_rate_;   //!< Baud rate
+};
+
+/**
+ * @class HilsPseudoTerminalTransport
+ * @brief Master side of a pseudo-terminal. An external program or device emulator connects to the slave side.
+ */
+class HilsPseudoTerminalTransport : public HilsFileDescriptorTransport {
+ public:
+  bool Open() override;
+  /**
+   * @fn GetSlavePath
+   * @brief Return path to the slave side like /dev/pts/3
+   */
+  inline const std::string& GetSlavePath() const { return slave_path_; }
+
+ private:
+  std::string slave_path_;  //!< Path to the slave side
+};
+
+/**
+ * @class HilsTcpTransport
+ * @brief TCP client connection
+ */
+class HilsTcpTransport : public HilsFileDescriptorTransport {
+ public:
+  /**
+   * @fn HilsTcpTransport
+   * @brief Constructor
+   * @param [in] host: Host name or IP address of the server
+   * @param [in] port: Port number of the server
+   */
+  HilsTcpTransport(const std::string& host, const std::string& port) : host_(host), port_(port) {}
+  bool Open() override;
+
+ private:
+  std::string host_;  //!< Host name or IP address of the server
+  std::string port_;  //!< Port number of the server
+};
+
+/**
+ * @class HilsUdpTransport
+ * @brief UDP socket bound to a local port and connected to a remote address
+ * @note The boundaries of the datagrams are not kept.
+ */
+class HilsUdpTransport : public HilsFileDescriptorTransport {
+ public:
+  /**
+   * @fn HilsUdpTransport
+   * @brief Constructor
+   * @param [in] local_port: Local port number to receive
+   * @param [in] remote_host: Host name or IP address to send
+   * @param [in] remote_port: Port number to send
+   */
+  HilsUdpTransport(const std::string& local_port, const std::string& remote_host, const std::string& remote_port)
+      : local_port_(local_port), remote_host_(remote_host), remote_port_(remote_port) {}
+  bool Open() override;
+
+ private:
+  std::string local_port_;   //!< Local port number to receive
+  std::string remote_host_;  //!< Host name or IP address to send
+  std::string remote_port_;  //!< Port number to send
+};
+#endif  // WIN32
+
+/**
+ * @class HilsTransportPoller
+ * @brief Batched receive and send of the registered transports
+ * @details The readable transports are detected with one epoll_wait call on Linux. The transports without a file descriptor and the
+ *          transports on other platforms are polled by trying to receive.
+ */
+class HilsTransportPoller {
+ public:
+  /**
+   * @fn HilsTransportPoller
+   * @brief Constructor
+   */
+  HilsTransportPoller();
+  /**
+   * @fn ~HilsTransportPoller
+   * @brief Destructor
+   */
+  ~HilsTransportPoller();
+  HilsTransportPoller(const HilsTransportPoller&) = delete;
+  HilsTransportPoller& operator=(const HilsTransportPoller&) = delete;
+
+  /**
+   * @fn Register
+   * @brief Register the opened transport
+   * @return True when success
+   */
+  bool Register(HilsTransport* transport);
+  /**
+   * @fn Unregister
+   * @brief Unregister the transport
+   */
+  void Unregister(HilsTransport* transport);
+  /**
+   * @fn Poll
+   * @brief Send the queued data of all transports and receive the available data into the queues of the transports
+   * @param [in] timeout_ms: Maximum time to wait for the received data [ms]. 0 does not wait.
+   * @return Number of transports which received data, -1: error
+   */
+  int Poll(const int timeout_ms = 0);
+
+ private:
+  std::vector<HilsTransport*> transports_;  //!< Registered transports
+  int epoll_file_descriptor_ = -1;          //!< File descriptor of epoll
+};
+
+/**
+ * @fn CreateHilsTransport
+ * @brief Create the transport from the address
+ * @note Address format:
+ *       serial:<device path> (e.g. serial:/dev/ttyUSB0), pty:, tcp:<host>:<port>, udp:<local port>:<remote host>:<remote port>, loopback:
+ * @param [in] address: Address of the transport
+ * @param [in] baud_rate: Baud rate for the serial port
+ * @return Created transport (not opened), or nullptr when the address is not supported
+ */
+std::unique_ptr<HilsTransport> CreateHilsTransport(const std::string& address, const unsigned int baud_rate);
+
+#endif  // S2E_LIBRARY_COMMUNICATION_HILS_TRANSPORT_HPP_
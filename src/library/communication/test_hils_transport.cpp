@@ -0,0 +1,162 @@
+/**
+ * @file test_hils_transport.cpp
+ * @brief Test codes for HILS transports with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "hils_transport.hpp"
+
+#ifndef WIN32
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace {
+/**
+ * @fn ReadAll
+ * @brief Poll the transport until the expected length of data is received
+ */
+std::vector<unsigned char> ReadAll(HilsTransportPoller& poller, HilsTransport& transport, const size_t length) {
+  std::vector<unsigned char> received(length);
+  size_t received_length = 0;
+  for (int i = 0; i < 100 && received_length < length; i++) {
+    poller.Poll(10);
+    const int ret = transport.Read(received.data() + received_length, length - received_length);
+    if (ret < 0) break;
+    received_length += (size_t)ret;
+  }
+  received.resize(received_length);
+  return received;
+}
+}  // namespace
+
+/**
+ * @brief Test of the loopback transport
+ */
+TEST(HilsTransport, Loopback) {
+  std::unique_ptr<HilsTransport> transport = CreateHilsTransport("loopback:", 115200);
+  ASSERT_NE(nullptr, transport);
+  unsigned char buffer[8];
+  EXPECT_EQ(-1, transport->Write(buffer, 1));  // Not opened
+  ASSERT_TRUE(transport->Open());
+
+  const std::vector<unsigned char> sent = {0x01, 0x02, 0x03, 0x04, 0x05};
+  EXPECT_EQ(0, transport->Write(sent.data(), sent.size()));
+  EXPECT_EQ(5, transport->GetBytesToRead());
+  EXPECT_EQ(3, transport->Read(buffer, 3));
+  EXPECT_EQ(0x03, buffer[2]);
+  EXPECT_EQ(2, transport->Read(buffer, 8));
+  EXPECT_EQ(0x05, buffer[1]);
+  EXPECT_EQ(0, transport->Read(buffer, 8));
+
+  HilsTransportPoller poller;
+  ASSERT_TRUE(poller.Register(transport.get()));
+  EXPECT_EQ(0, transport->Write(sent.data(), sent.size()));
+  EXPECT_EQ(1, poller.Poll());
+  EXPECT_EQ(sent, ReadAll(poller, *transport, sent.size()));
+  poller.Unregister(transport.get());
+
+  EXPECT_EQ(nullptr, CreateHilsTransport("unknown:", 115200));
+}
+
+#ifndef WIN32
+/**
+ * @brief Test of the pseudo-terminal and the serial transport connected to the slave side
+ */
+TEST(HilsTransport, PseudoTerminal) {
+  HilsPseudoTerminalTransport master;
+  ASSERT_TRUE(master.Open());
+  ASSERT_FALSE(master.GetSlavePath().empty());
+  std::unique_ptr<HilsTransport> slave = CreateHilsTransport("serial:" + master.GetSlavePath(), 115200);
+  ASSERT_NE(nullptr, slave);
+  ASSERT_TRUE(slave->Open());
+
+  HilsTransportPoller poller;
+  ASSERT_TRUE(poller.Register(&master));
+  ASSERT_TRUE(poller.Register(slave.get()));
+
+  // Binary data including the control characters
+  std::vector<unsigned char> sent(300);
+  for (size_t i = 0; i < sent.size(); i++) sent[i] = (unsigned char)i;
+  EXPECT_EQ(0, master.Write(sent.data(), sent.size()));
+  EXPECT_EQ(sent, ReadAll(poller, *slave, sent.size()));
+  EXPECT_EQ(0, slave->Write(sent.data(), sent.size()));
+  EXPECT_EQ(sent, ReadAll(poller, master, sent.size()));
+
+  EXPECT_FALSE(CreateHilsTransport("serial:" + master.GetSlavePath(), 12345)->Open());
+}
+
+/**
+ * @brief Test of the TCP transport connected to a local server
+ */
+TEST(HilsTransport, Tcp) {
+  const int server = socket(AF_INET, SOCK_STREAM, 0);
+  ASSERT_GE(server, 0);
+  struct sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;
+  ASSERT_EQ(0, bind(server, (struct sockaddr*)&address, sizeof(address)));
+  ASSERT_EQ(0, listen(server, 1));
+  socklen_t address_length = sizeof(address);
+  ASSERT_EQ(0, getsockname(server, (struct sockaddr*)&address, &address_length));
+
+  std::unique_ptr<HilsTransport> client = CreateHilsTransport("tcp:127.0.0.1:" + std::to_string(ntohs(address.sin_port)), 0);
+  ASSERT_NE(nullptr, client);
+  ASSERT_TRUE(client->Open());
+  const int connection = accept(server, nullptr, nullptr);
+  ASSERT_GE(connection, 0);
+
+  HilsTransportPoller poller;
+  ASSERT_TRUE(poller.Register(client.get()));
+  const std::vector<unsigned char> sent = {0xde, 0xad, 0xbe, 0xef};
+  EXPECT_EQ(0, client->Write(sent.data(), sent.size()));
+  std::vector<unsigned char> echoed(sent.size());
+  ASSERT_EQ((ssize_t)sent.size(), read(connection, echoed.data(), echoed.size()));
+  EXPECT_EQ(sent, echoed);
+  ASSERT_EQ((ssize_t)sent.size(), write(connection, echoed.data(), echoed.size()));
+  EXPECT_EQ(sent, ReadAll(poller, *client, sent.size()));
+
+  close(connection);
+  close(server);
+}
+
+/**
+ * @brief Test of the UDP transports connected to each other
+ */
+TEST(HilsTransport, Udp) {
+  // Find free ports
+  std::vector<int> ports;
+  for (int i = 0; i < 2; i++) {
+    const int probe = socket(AF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(0, bind(probe, (struct sockaddr*)&address, sizeof(address)));
+    socklen_t address_length = sizeof(address);
+    getsockname(probe, (struct sockaddr*)&address, &address_length);
+    ports.push_back(ntohs(address.sin_port));
+    close(probe);
+  }
+
+  std::unique_ptr<HilsTransport> a = CreateHilsTransport("udp:" + std::to_string(ports[0]) + ":127.0.0.1:" + std::to_string(ports[1]), 0);
+  std::unique_ptr<HilsTransport> b = CreateHilsTransport("udp:" + std::to_string(ports[1]) + ":127.0.0.1:" + std::to_string(ports[0]), 0);
+  ASSERT_TRUE(a->Open());
+  ASSERT_TRUE(b->Open());
+
+  HilsTransportPoller poller;
+  ASSERT_TRUE(poller.Register(a.get()));
+  ASSERT_TRUE(poller.Register(b.get()));
+  const std::vector<unsigned char> sent = {0x10, 0x20, 0x30};
+  EXPECT_EQ(0, a->Write(sent.data(), sent.size()));
+  EXPECT_EQ(0, a->Write(sent.data(), sent.size()));
+  std::vector<unsigned char> expected = sent;
+  expected.insert(expected.end(), sent.begin(), sent.end());
+  EXPECT_EQ(expected, ReadAll(poller, *b, expected.size()));
+}
+#endif  // WIN32
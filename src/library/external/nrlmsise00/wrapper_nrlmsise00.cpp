@@ -17,7 +17,6 @@ extern "C" {
 #include <cmath> /* maths functions */
 #include <environment/global/physical_constants.hpp>
 #include <library/math/constants.hpp>
-#include <numeric>
 
 #include "wrapper_nrlmsise00.hpp" /* header for nrlmsise-00.h */
 
@@ -27,64 +26,32 @@ using namespace std;
 /* ------------------------------ DEFINES ---------------------------- */
 /* ------------------------------------------------------------------- */
 
-static double decyear_monthly;
+//! Number of days before each month for normal years and leap years
+static const int kDaysBeforeMonth[2][13] = {{0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365},
+                                            {0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335, 366}};
 
 int LeapYear(int year) { return ((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0); }
 
 void ConvertDaysToMonthDay(int days, int is_leap_year, int* month_day) {
-  int days_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  const int* days_before_month = kDaysBeforeMonth[is_leap_year ? 1 : 0];
 
-  if (is_leap_year) {
-    days_month[1] = 29;
-  }
-
-  if (days <= days_month[0]) {
-    month_day[0] = 1;
-    month_day[1] = days;
-  } else if (days > days_month[0] && days <= accumulate(days_month, days_month + 2, 0)) {
-    month_day[0] = 2;
-    month_day[1] = days - days_month[0];
-  } else if (days > accumulate(days_month, days_month + 2, 0) && days <= accumulate(days_month, days_month + 3, 0)) {
-    month_day[0] = 3;
-    month_day[1] = days - accumulate(days_month, days_month + 2, 0);
-  } else if (days > accumulate(days_month, days_month + 3, 0) && days <= accumulate(days_month, days_month + 4, 0)) {
-    month_day[0] = 4;
-    month_day[1] = days - accumulate(days_month, days_month + 3, 0);
-  } else if (days > accumulate(days_month, days_month + 4, 0) && days <= accumulate(days_month, days_month + 5, 0)) {
-    month_day[0] = 5;
-    month_day[1] = days - accumulate(days_month, days_month + 4, 0);
-  } else if (days > accumulate(days_month, days_month + 5, 0) && days <= accumulate(days_month, days_month + 6, 0)) {
-    month_day[0] = 6;
-    month_day[1] = days - accumulate(days_month, days_month + 5, 0);
-  } else if (days > accumulate(days_month, days_month + 6, 0) && days <= accumulate(days_month, days_month + 7, 0)) {
-    month_day[0] = 7;
-    month_day[1] = days - accumulate(days_month, days_month + 6, 0);
-  } else if (days > accumulate(days_month, days_month + 7, 0) && days <= accumulate(days_month, days_month + 8, 0)) {
-    month_day[0] = 8;
-    month_day[1] = days - accumulate(days_month, days_month + 7, 0);
-  } else if (days > accumulate(days_month, days_month + 8, 0) && days <= accumulate(days_month, days_month + 9, 0)) {
-    month_day[0] = 9;
-    month_day[1] = days - accumulate(days_month, days_month + 8, 0);
-  } else if (days > accumulate(days_month, days_month + 9, 0) && days <= accumulate(days_month, days_month + 10, 0)) {
-    month_day[0] = 10;
-    month_day[1] = days - accumulate(days_month, days_month + 9, 0);
-  } else if (days > accumulate(days_month, days_month + 10, 0) && days <= accumulate(days_month, days_month + 11, 0)) {
-    month_day[0] = 11;
-    month_day[1] = days - accumulate(days_month, days_month + 10, 0);
-  } else if (days > accumulate(days_month, days_month + 11, 0) && days <= accumulate(days_month, days_month + 12, 0)) {
-    month_day[0] = 12;
-    month_day[1] = days - accumulate(days_month, days_month + 11, 0);
+  for (int month = 1; month <= 12; month++) {
+    if (days <= days_before_month[month]) {
+      month_day[0] = month;
+      month_day[1] = days - days_before_month[month - 1];
+      return;
+    }
   }
 }
 
-void ConvertDecyearToDate(double decyear, int* date) {
+void ConvertDecyearToDayTime(double decyear, int* day_time) {
   // year
   int year = (int)(decyear);
   int is_leap_year = LeapYear(year);
   int days_per_year = is_leap_year ? 366 : 365;
   double reminder = decyear - year;
 
-  // month day
+  // days
   double days_d = reminder * days_per_year;
   int days = (int)days_d;
   if (days == 0) {
@@ -105,33 +72,84 @@ void ConvertDecyearToDate(double decyear, int* date) {
   // second
   double seconds_d = reminder * 60;
   int seconds = (int)seconds_d;
-  reminder = seconds_d - (int)seconds_d;
+
+  day_time[0] = year;
+  day_time[1] = days;
+  day_time[2] = hours;
+  day_time[3] = minutes;
+  day_time[4] = seconds;
+}
+
+void ConvertDecyearToDate(double decyear, int* date) {
+  int day_time[5];
+  ConvertDecyearToDayTime(decyear, day_time);
 
   int month_day[2];
-  ConvertDaysToMonthDay(days, is_leap_year, month_day);
+  ConvertDaysToMonthDay(day_time[1], LeapYear(day_time[0]), month_day);
 
-  date[0] = year;
+  date[0] = day_time[0];
   date[1] = month_day[0];
   date[2] = month_day[1];
-  date[3] = hours;
-  date[4] = minutes;
-  date[5] = seconds;
+  date[3] = day_time[2];
+  date[4] = day_time[3];
+  date[5] = day_time[4];
 }
 
 double ConvertDateToDecyear(int year, int month, int day) {
   int is_leap_year = LeapYear(year);
   int days_per_year = is_leap_year ? 366 : 365;
 
-  int days_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-  if (is_leap_year) {
-    days_month[1] = 29;
-  }
-
-  double days = (double)accumulate(days_month, days_month + month - 1, 0) + (double)day;
+  double days = (double)kDaysBeforeMonth[is_leap_year][month - 1] + (double)day;
 
   return (double)year + days / (double)days_per_year;
 }
 
+int ConvertDayOfYearToDayNumber(int year, int day_of_year) {
+  // Number of days from 0001/01/01 in the proleptic Gregorian calendar
+  int y = year - 1;
+  return 365 * y + y / 4 - y / 100 + y / 400 + day_of_year;
+}
+
+int ConvertDateToDayNumber(int year, int month, int day) {
+  return ConvertDayOfYearToDayNumber(year, kDaysBeforeMonth[LeapYear(year)][month - 1] + day);
+}
+
+void MakeSpaceWeatherTableIndex(const vector<nrlmsise_table>& table, nrlmsise_table_index& index) {
+  index.row_of_day.clear();
+  index.row_of_month.clear();
+
+  // Range of the dates in the table
+  bool is_range_set = false;
+  int last_day_number = 0;
+  int last_month_number = 0;
+  for (const auto& row : table) {
+    if (row.month < 1 || row.month > 12) continue;
+    int day_number = ConvertDateToDayNumber(row.year, row.month, row.day);
+    int month_number = row.year * 12 + row.month - 1;
+    if (!is_range_set) {
+      index.first_day_number = last_day_number = day_number;
+      index.first_month_number = last_month_number = month_number;
+      is_range_set = true;
+    }
+    index.first_day_number = min(index.first_day_number, day_number);
+    last_day_number = max(last_day_number, day_number);
+    index.first_month_number = min(index.first_month_number, month_number);
+    last_month_number = max(last_month_number, month_number);
+  }
+  if (!is_range_set) return;
+
+  // Keep the first matched row like the linear search
+  index.row_of_day.assign(last_day_number - index.first_day_number + 1, -1);
+  index.row_of_month.assign(last_month_number - index.first_month_number + 1, -1);
+  for (size_t i = 0; i < table.size(); i++) {
+    if (table[i].month < 1 || table[i].month > 12) continue;
+    int& row_of_day = index.row_of_day[ConvertDateToDayNumber(table[i].year, table[i].month, table[i].day) - index.first_day_number];
+    if (row_of_day < 0) row_of_day = (int)i;
+    int& row_of_month = index.row_of_month[table[i].year * 12 + table[i].month - 1 - index.first_month_number];
+    if (row_of_month < 0) row_of_month = (int)i;
+  }
+}
+
 int ConvertMonthStrToMonthNum(string month_str) {
   if (month_str == "Jan") {
     return 1;
@@ -165,64 +183,36 @@ int ConvertMonthStrToMonthNum(string month_str) {
 /* ------------------------------------------------------------------- */
 /* --------------------------CalcNRLMSISE00--------------------------- */
 /* ------------------------------------------------------------------- */
-double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const vector<nrlmsise_table>& table, bool is_manual_param,
-                      double manual_f107, double manual_f107a, double manual_ap) {
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, double f107, double f107a, double ap) {
+  int doy;
+  double sec;
+  CalcNRLMSISE00Time(decyear, &doy, &sec);
+  return CalcNRLMSISE00(doy, sec, latrad, lonrad, alt, f107, f107a, ap);
+}
+
+double CalcNRLMSISE00(int doy, double sec, double latrad, double lonrad, double alt, double f107, double f107a, double ap) {
   struct nrlmsise_output output;
   struct nrlmsise_input input;
   struct nrlmsise_flags flags;
   struct ap_array aph;
 
   size_t i;
-  int date[6];
-  int idx = 0;
 
   /* input values */
   for (i = 0; i < 24; i++) {
     flags.switches[i] = 1;
   }
 
-  ConvertDecyearToDate(decyear, date);
-
-  input.doy = (int)((decyear - (int)decyear) * 365.25);
+  input.doy = doy;
+  input.sec = sec;
   input.year = 0; /* without effect */
-  input.sec = date[3] * 60.0 * 60.0 + date[4] * 60.0 + date[5];
   input.alt = alt / 1000.0;
   input.g_lat = latrad * libra::rad_to_deg;
   input.g_long = lonrad * libra::rad_to_deg;
   input.lst = input.sec / 3600.0 + lonrad * libra::rad_to_deg / 15.0;
-
-  if (is_manual_param) {
-    input.f107 = manual_f107;
-    input.f107A = manual_f107a;
-    input.ap = manual_ap;
-  } else {
-    // f10.7 and ap from table
-    // If the table size is zero, return 0
-    if (table.size() == 0) {
-      return 0.0;
-    }
-
-    // search table index
-    for (i = 0; i < table.size(); i++) {
-      if (decyear < decyear_monthly) {
-        // Match year, month, date
-        if ((date[0] == table[i].year) && (date[1] == table[i].month) && (date[2] == table[i].day)) {
-          idx = i;
-          break;
-        }
-      } else {
-        // Match year, month
-        if ((date[0] == table[i].year) && (date[1] == table[i].month)) {
-          idx = i;
-          break;
-        }
-      }
-    }
-
-    input.f107A = table[idx].Ctr81_adj;
-    input.f107 = table[idx].F107_adj;
-    input.ap = table[idx].Ap_avg;
-  }
+  input.f107A = f107a;
+  input.f107 = f107;
+  input.ap = ap;
 
   for (i = 0; i < 7; i++) {
     aph.a[i] = input.ap;
@@ -233,10 +223,41 @@ double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt,
   return output.d[5];
 }
 
+void CalcNRLMSISE00Time(double decyear, int* doy, double* sec) {
+  int day_time[5];
+  ConvertDecyearToDayTime(decyear, day_time);
+
+  *doy = (int)((decyear - (int)decyear) * 365.25);
+  *sec = day_time[2] * 60.0 * 60.0 + day_time[3] * 60.0 + day_time[4];
+}
+
+/* ------------------------------------------------------------------- */
+/* ----------------------SearchSpaceWeatherTable---------------------- */
+/* ------------------------------------------------------------------- */
+int SearchSpaceWeatherTable(double decyear, const nrlmsise_table_index& index) {
+  int day_time[5];
+  ConvertDecyearToDayTime(decyear, day_time);
+
+  int row = -1;
+  if (decyear < index.decyear_monthly) {
+    // Match year, month, date
+    int i = ConvertDayOfYearToDayNumber(day_time[0], day_time[1]) - index.first_day_number;
+    if (i >= 0 && i < (int)index.row_of_day.size()) row = index.row_of_day[i];
+  } else {
+    // Match year, month
+    int month_day[2];
+    ConvertDaysToMonthDay(day_time[1], LeapYear(day_time[0]), month_day);
+    int i = day_time[0] * 12 + month_day[0] - 1 - index.first_month_number;
+    if (i >= 0 && i < (int)index.row_of_month.size()) row = index.row_of_month[i];
+  }
+
+  return row < 0 ? 0 : row;
+}
+
 /* ------------------------------------------------------------------- */
 /* -----------------------ReadSpaceWeatherTable----------------------- */
 /* ------------------------------------------------------------------- */
-int GetSpaceWeatherTable_(double decyear, double endsec, const string& filename, vector<nrlmsise_table>& table) {
+int GetSpaceWeatherTable_(double decyear, double endsec, const string& filename, vector<nrlmsise_table>& table, nrlmsise_table_index& index) {
   ifstream ifs(filename);
 
   if (!ifs.is_open()) {
@@ -273,7 +294,7 @@ int GetSpaceWeatherTable_(double decyear, double endsec, const string& filename,
 
         // After 1.5 month from the update date, the data is updated once per month. So calculate the decimal year of the date
         int days_month[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-        decyear_monthly = decyear_updated + (days_month[month_updated] + 14) / 365.0;
+        index.decyear_monthly = decyear_updated + (days_month[month_updated] + 14) / 365.0;
       }
       continue;
     }
@@ -303,5 +324,7 @@ int GetSpaceWeatherTable_(double decyear, double endsec, const string& filename,
     table.push_back(line_data);
   }
 
+  MakeSpaceWeatherTableIndex(table, index);
+
   return table.size();
 }
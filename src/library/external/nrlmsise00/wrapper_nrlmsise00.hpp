@@ -30,22 +30,66 @@ struct nrlmsise_table {
   double Lst81_obs;  //!< Last 81-day arithmetic average of F10.7 (observed).
 };
 
+/**
+ * @struct nrlmsise_table_index
+ * @brief Index of the space weather table to search the row of a date in O(1)
+ * @note The rows are searched by the day number before the table changes to the monthly predicted values, and by the month number after that.
+ */
+struct nrlmsise_table_index {
+  int first_day_number = 0;       //!< Day number of the first element of row_of_day
+  std::vector<int> row_of_day;    //!< First row of the table for each day (-1: no row)
+  int first_month_number = 0;     //!< Month number (year * 12 + month - 1) of the first element of row_of_month
+  std::vector<int> row_of_month;  //!< First row of the table for each month (-1: no row)
+  double decyear_monthly = 0.0;   //!< Decimal year after which the table has the monthly predicted values
+};
+
 /**
  * @fn CalcNRLMSISE00
- * @brief Read the space weather table file
- * @param [in] decyear: Decimal year of the simulation start time
+ * @brief Calculate the atmospheric density with NRLMSISE-00 model
+ * @param [in] decyear: Decimal year
  * @param [in] latrad: Latitude [rad]
  * @param [in] lonrad: Longitude [rad]
  * @param [in] alt: Altitude [m]
- * @param [in] table: Space Weather table
- * @param [in] is_manual_param: Flag to use manual parameters
- * @param [in] manual_f107: Manual setting F10.7
- * @param [in] manual_f107a: Manual setting averaged F10.7
- * @param [in] manual_ap: Manual setting Ap-index
+ * @param [in] f107: Daily F10.7
+ * @param [in] f107a: Averaged F10.7
+ * @param [in] ap: Ap-index
  * @return Atmospheric density [kg/m3]
+ * @note NRLMSISE-00 library uses global variables, so the function is not reentrant
+ */
+double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, double f107, double f107a, double ap);
+/**
+ * @fn CalcNRLMSISE00
+ * @brief Calculate the atmospheric density with NRLMSISE-00 model at the day of year and the UT
+ * @param [in] doy: Day of year
+ * @param [in] sec: Seconds in the day (UT) [sec]
+ * @param [in] latrad: Latitude [rad]
+ * @param [in] lonrad: Longitude [rad]
+ * @param [in] alt: Altitude [m]
+ * @param [in] f107: Daily F10.7
+ * @param [in] f107a: Averaged F10.7
+ * @param [in] ap: Ap-index
+ * @return Atmospheric density [kg/m3]
+ * @note NRLMSISE-00 library uses global variables, so the function is not reentrant
+ */
+double CalcNRLMSISE00(int doy, double sec, double latrad, double lonrad, double alt, double f107, double f107a, double ap);
+
+/**
+ * @fn CalcNRLMSISE00Time
+ * @brief Calculate the day of year and the seconds in the day used in NRLMSISE-00 model
+ * @param [in] decyear: Decimal year
+ * @param [out] doy: Day of year
+ * @param [out] sec: Seconds in the day (UT) [sec]
+ */
+void CalcNRLMSISE00Time(double decyear, int* doy, double* sec);
+
+/**
+ * @fn SearchSpaceWeatherTable
+ * @brief Search the row of the space weather table for the date
+ * @param [in] decyear: Decimal year
+ * @param [in] index: Index of the space weather table
+ * @return Row of the table (0 when the date is not in the table)
  */
-double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt, const std::vector<nrlmsise_table>& table, bool is_manual_param,
-                      double manual_f107, double manual_f107a, double manual_ap);
+int SearchSpaceWeatherTable(double decyear, const nrlmsise_table_index& index);
 
 /**
  * @fn GetSpaceWeatherTable_
@@ -54,9 +98,11 @@ double CalcNRLMSISE00(double decyear, double latrad, double lonrad, double alt,
  * @param [in] endsec: Simulation end time [sec]
  * @param [in] filename: Path to the SpaceWeather file (Ex: ftp://ftp.agi.com/pub/DynamicEarthData/SpaceWeather-v1.2.txt)
  * @param [out] table: Space weather table
+ * @param [out] index: Index of the space weather table
  * @return Size of table
  */
-int GetSpaceWeatherTable_(double decyear, double endsec, const std::string& filename, std::vector<nrlmsise_table>& table);
+int GetSpaceWeatherTable_(double decyear, double endsec, const std::string& filename, std::vector<nrlmsise_table>& table,
+                          nrlmsise_table_index& index);
 
 /* ------------------------------------------------------------------- */
 /* ----------------------- COMPILATION TWEAKS ------------------------ */
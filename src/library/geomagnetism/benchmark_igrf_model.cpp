@@ -0,0 +1,105 @@
+/**
+ * @file benchmark_igrf_model.cpp
+ * @brief Benchmark codes for IgrfModel class with Google Benchmark
+ * @note A synthetic coefficient file of degree 13 is used. The spacecraft moves along a low earth orbit with 1 second step.
+ */
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../external/igrf/igrf.h"
+#include "../math/constants.hpp"
+#include "igrf_model.hpp"
+
+namespace {
+
+// The file name includes "13" since IgrfCalc replaces it with the generation number
+const std::string kCoefficientFileName = "benchmark_igrf13.coef";
+const double kStartDecimalYear = 2022.1;  //!< Decimal year of the simulation start
+const size_t kNumberOfSteps = 5400;       //!< Number of steps (about one orbit)
+
+/**
+ * @fn WriteCoefficientFile
+ * @brief Write a synthetic coefficient file of degree 13 with the epochs 2015, 2020 and the secular variation
+ */
+void WriteCoefficientFile() {
+  std::ofstream ofs(kCoefficientFileName);
+  ofs << " 13  3 2015 2025\n";
+  ofs << "y  0  0  2015.0  2020.0 2020-25\n";
+  for (int n = 1; n <= 13; n++) {
+    for (int m = 0; m <= n; m++) {
+      for (int h = 0; h < 2; h++) {
+        if (h == 1 && m == 0) continue;
+        const double base_nT = (h == 0 ? -30000.0 : 5000.0) / std::pow(3.0, n - 1) / (m + 1);
+        ofs << (h == 0 ? "g" : "h") << " " << n << " " << m << " " << base_nT << " " << base_nT * 1.01 << " " << base_nT * 0.002 << "\n";
+      }
+    }
+  }
+}
+
+/**
+ * @fn MakeTrajectory
+ * @brief Make the geodetic positions of a circular orbit at 500 km altitude with 51.6 deg inclination
+ */
+std::vector<GeodeticPosition> MakeTrajectory() {
+  const double period_s = 5670.0;
+  const double inclination_rad = 51.6 * libra::deg_to_rad;
+  std::vector<GeodeticPosition> trajectory;
+  for (size_t step = 0; step < kNumberOfSteps; step++) {
+    const double phase_rad = libra::tau * step / period_s;
+    const double latitude_rad = std::asin(std::sin(inclination_rad) * std::sin(phase_rad));
+    const double longitude_rad = std::atan2(std::cos(inclination_rad) * std::sin(phase_rad), std::cos(phase_rad));
+    trajectory.push_back(GeodeticPosition(latitude_rad, longitude_rad, 500.0e3));
+  }
+  return trajectory;
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmark of IgrfCalc in library/external/igrf
+ */
+static void BM_IgrfCalc(benchmark::State& state) {
+  WriteCoefficientFile();
+  set_file_path(kCoefficientFileName.c_str());
+  const std::vector<GeodeticPosition> trajectory = MakeTrajectory();
+
+  double magnetic_field_i_nT[3];
+  for (auto _ : state) {
+    for (size_t step = 0; step < trajectory.size(); step++) {
+      const double decimal_year = kStartDecimalYear + step / (86400.0 * 365.25);
+      IgrfCalc(decimal_year, trajectory[step].GetLatitude_rad(), trajectory[step].GetLongitude_rad(), trajectory[step].GetAltitude_m(), 0.0,
+               magnetic_field_i_nT);
+      benchmark::DoNotOptimize(magnetic_field_i_nT);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * trajectory.size());
+  std::remove(kCoefficientFileName.c_str());
+}
+BENCHMARK(BM_IgrfCalc)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Benchmark of IgrfModel
+ * @note Argument: maximum degree to calculate
+ */
+static void BM_IgrfModel(benchmark::State& state) {
+  WriteCoefficientFile();
+  IgrfModel igrf_model;
+  igrf_model.ReadCoefficientFile(kCoefficientFileName, (size_t)state.range(0));
+  std::remove(kCoefficientFileName.c_str());
+  const std::vector<GeodeticPosition> trajectory = MakeTrajectory();
+
+  for (auto _ : state) {
+    for (size_t step = 0; step < trajectory.size(); step++) {
+      const double decimal_year = kStartDecimalYear + step / (86400.0 * 365.25);
+      libra::Vector<3> magnetic_field_i_nT = igrf_model.CalcMagneticField_i_nT(decimal_year, trajectory[step], 0.0);
+      benchmark::DoNotOptimize(magnetic_field_i_nT);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * trajectory.size());
+}
+BENCHMARK(BM_IgrfModel)->Arg(13)->Arg(8)->Arg(4)->Unit(benchmark::kMillisecond);
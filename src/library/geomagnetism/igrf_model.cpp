@@ -0,0 +1,277 @@
+/**
+ * @file igrf_model.cpp
+ * @brief Class to calculate the geomagnetic field with IGRF (International Geomagnetic Reference Field) model
+ */
+
+#include "igrf_model.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "../external/sgp4/sgp4ext.h"
+#include "../math/constants.hpp"
+
+namespace {
+const double kEquatorialRadius_km = 6378.137;  //!< Equatorial radius of WGS84 [km]
+const double kFlattening = 298.25722;          //!< Inverse flattening of WGS84
+const double kReferenceRadius_km = 6371.2;     //!< Reference radius of IGRF [km]
+const double kDaysPerYear = 365.25;            //!< Days per year to make the update interval [day/year]
+}  // namespace
+
+IgrfModel::IgrfModel(const double coefficient_update_interval_day)
+    : max_degree_(0),
+      valid_start_year_(0.0),
+      valid_end_year_(0.0),
+      degree_(0),
+      coefficient_update_interval_day_(coefficient_update_interval_day),
+      cached_interval_index_(0),
+      cached_column_(-1),
+      base_epoch_year_(0.0),
+      is_out_of_period_warned_(false) {}
+
+bool IgrfModel::ReadCoefficientFile(const std::string& file_name, const size_t degree) {
+  std::ifstream ifs(file_name);
+  if (!ifs.is_open()) {
+    std::cerr << "file open error(IGRF coefficient file). filename = " << file_name << std::endl;
+    return false;
+  }
+
+  // Line 1: maximum degree, number of columns, and valid period
+  std::string line;
+  int file_degree = 0;
+  int number_of_columns = 0;
+  if (std::getline(ifs, line)) {
+    std::istringstream header(line);
+    header >> file_degree >> number_of_columns >> valid_start_year_ >> valid_end_year_;
+  }
+  if (file_degree < 1 || number_of_columns < 2) {
+    std::cerr << "IGRF coefficient file format error: Line-1 invalid" << std::endl;
+    return false;
+  }
+  max_degree_ = (size_t)file_degree;
+
+  // Line 2: epochs of the columns. The last column is the secular variation.
+  epochs_year_.assign(number_of_columns - 1, 0.0);
+  bool is_epoch_read = false;
+  if (std::getline(ifs, line)) {
+    std::istringstream epochs(line);
+    std::string label;
+    epochs >> label >> label >> label;
+    for (auto& epoch_year : epochs_year_) epochs >> epoch_year;
+    is_epoch_read = !epochs.fail();
+  }
+  if (!is_epoch_read) {
+    std::cerr << "IGRF coefficient file format error: Line-2 invalid" << std::endl;
+    return false;
+  }
+
+  // Coefficients
+  const size_t table_size = (max_degree_ + 1) * (max_degree_ + 1);
+  coefficients_.assign(number_of_columns, std::vector<double>(table_size, 0.0));
+  size_t line_number = 2;
+  while (std::getline(ifs, line)) {
+    line_number++;
+    if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+    std::istringstream coefficient(line);
+    char type;
+    int n, m;
+    coefficient >> type >> n >> m;
+    std::vector<double> values(number_of_columns);
+    for (auto& value : values) coefficient >> value;
+    if (coefficient.fail() || n < 1 || n > file_degree || m < 0 || m > n || (type != 'g' && type != 'h') || (type == 'h' && m == 0)) {
+      std::cerr << "IGRF coefficient file format error: Line-" << line_number << " invalid" << std::endl;
+      return false;
+    }
+    const size_t index = type == 'g' ? Index(m, n) : Index(n, m - 1);
+    for (int column = 0; column < number_of_columns; column++) coefficients_[column][index] = values[column];
+  }
+
+  degree_ = (degree == 0 || degree > max_degree_) ? max_degree_ : degree;
+
+  base_coefficients_.assign(table_size, 0.0);
+  rate_coefficients_.assign(table_size, 0.0);
+  coefficients_now_.assign(table_size, 0.0);
+  cached_column_ = -1;
+  is_out_of_period_warned_ = false;
+
+  radius_ratio_.assign(max_degree_ + 1, 0.0);
+  cos_m_phi_.assign(max_degree_ + 1, 0.0);
+  sin_m_phi_.assign(max_degree_ + 1, 0.0);
+  legendre_.assign((max_degree_ + 2) * (max_degree_ + 1), 0.0);
+
+  return true;
+}
+
+libra::Vector<3> IgrfModel::CalcMagneticField_ned_nT(const double decimal_year, const GeodeticPosition& position) {
+  double cos_colatitude;
+  return CalcMagneticField(decimal_year, position, cos_colatitude);
+}
+
+libra::Vector<3> IgrfModel::CalcMagneticField_i_nT(const double decimal_year, const GeodeticPosition& position, const double gmst_rad) {
+  double cos_colatitude;
+  const libra::Vector<3> magnetic_field_ned_nT = CalcMagneticField(decimal_year, position, cos_colatitude);
+  if (degree_ == 0) return magnetic_field_ned_nT;
+
+  double magnetic_field_nT[3] = {magnetic_field_ned_nT[0], magnetic_field_ned_nT[1], magnetic_field_ned_nT[2]};
+  RotationY(magnetic_field_nT, magnetic_field_nT, libra::pi - acos(cos_colatitude));
+  RotationZ(magnetic_field_nT, magnetic_field_nT, -position.GetLongitude_rad());
+  RotationZ(magnetic_field_nT, magnetic_field_nT, -gmst_rad);
+
+  libra::Vector<3> magnetic_field_i_nT;
+  for (size_t i = 0; i < 3; i++) magnetic_field_i_nT[i] = magnetic_field_nT[i];
+  return magnetic_field_i_nT;
+}
+
+libra::Vector<3> IgrfModel::CalcMagneticField(const double decimal_year, const GeodeticPosition& position, double& cos_colatitude) {
+  libra::Vector<3> magnetic_field_ned_nT(0.0);
+  cos_colatitude = 1.0;
+  if (degree_ == 0) return magnetic_field_ned_nT;
+
+  UpdateCoefficients(decimal_year);
+  const double* g = coefficients_now_.data();
+  double* p = legendre_.data();
+  const size_t max_order = degree_;
+
+  // Geocentric radius and colatitude
+  const double polar_radius_km = kEquatorialRadius_km * (1.0 - 1.0 / kFlattening);
+  const double re2 = kEquatorialRadius_km * kEquatorialRadius_km;
+  const double re4 = re2 * re2;
+  const double rp2 = polar_radius_km * polar_radius_km;
+  const double rp4 = rp2 * rp2;
+  const double altitude_km = position.GetAltitude_m() / 1000.0;
+  const double slat = sin(position.GetLatitude_rad());
+  const double slat2 = slat * slat;
+  const double clat2 = 1.0 - slat2;
+  const double rm2 = re2 * clat2 + rp2 * slat2;
+  const double rm = sqrt(rm2);
+  const double rrm = (re4 * clat2 + rp4 * slat2) / rm2;
+  const double r = sqrt(rrm + 2.0 * altitude_km * rm + altitude_km * altitude_km);
+  const double cth = slat * (altitude_km + rp2 / rm) / r;
+  cos_colatitude = cth;
+  const double sth = sqrt(1.0 - cth * cth);
+  const double inv_sth = 1.0 / sth;
+  const double cph = cos(position.GetLongitude_rad());
+  const double sph = sin(position.GetLongitude_rad());
+
+  // Powers of the radius ratio
+  const double t = kReferenceRadius_km / r;
+  radius_ratio_[0] = t * t;
+  for (size_t n = 0; n < max_order; n++) radius_ratio_[n + 1] = radius_ratio_[n] * t;
+
+  // Legendre functions (p[m][n]) and their derivatives (p[n + 1][m])
+  p[Index(0, 0)] = 1.0;
+  p[Index(1, 0)] = 0.0;
+  p[Index(0, 1)] = cth;
+  p[Index(1, 1)] = sth;
+  p[Index(2, 0)] = -sth;
+  p[Index(2, 1)] = cth;
+  for (size_t n = 1; n < max_order; n++) {
+    const double n_d = (double)n;
+    p[Index(0, n + 1)] = (p[Index(0, n)] * cth * (n_d + n_d + 1.0) - p[Index(0, n - 1)] * n_d) / (n_d + 1.0);
+    p[Index(n + 2, 0)] = (p[Index(0, n + 1)] * cth - p[Index(0, n)]) * (n_d + 1.0) * inv_sth;
+    for (size_t m = 0; m <= n; m++) {
+      const double m_d = (double)m;
+      const double pn1m = p[Index(m, n + 1)];
+      p[Index(m + 1, n + 1)] = (p[Index(m, n)] * (n_d + m_d + 1.0) - pn1m * cth * (n_d - m_d + 1.0)) * inv_sth;
+      p[Index(n + 2, m + 1)] = pn1m * (n_d + m_d + 2.0) * (n_d - m_d + 1.0) - p[Index(m + 1, n + 1)] * cth * (m_d + 1.0) * inv_sth;
+    }
+  }
+
+  // cos(m * phi) and sin(m * phi)
+  cos_m_phi_[0] = 1.0;
+  sin_m_phi_[0] = 0.0;
+  for (size_t m = 0; m < max_order; m++) {
+    cos_m_phi_[m + 1] = cos_m_phi_[m] * cph - sin_m_phi_[m] * sph;
+    sin_m_phi_[m + 1] = sin_m_phi_[m] * cph + cos_m_phi_[m] * sph;
+  }
+
+  // Spherical harmonics
+  double x = 0.0;
+  double y = 0.0;
+  double z = 0.0;
+  for (size_t n = 0; n < max_order; n++) {
+    double tx = g[Index(0, n + 1)] * p[Index(n + 2, 0)];
+    double ty = 0.0;
+    double tz = g[Index(0, n + 1)] * p[Index(0, n + 1)];
+    for (size_t m = 0; m <= n; m++) {
+      const double gc_hs = g[Index(m + 1, n + 1)] * cos_m_phi_[m + 1] + g[Index(n + 1, m)] * sin_m_phi_[m + 1];
+      const double gs_hc = g[Index(m + 1, n + 1)] * sin_m_phi_[m + 1] - g[Index(n + 1, m)] * cos_m_phi_[m + 1];
+      tx += gc_hs * p[Index(n + 2, m + 1)];
+      ty += gs_hc * p[Index(m + 1, n + 1)] * (double)(m + 1);
+      tz += gc_hs * p[Index(m + 1, n + 1)];
+    }
+    x += radius_ratio_[n + 1] * tx;
+    y += radius_ratio_[n + 1] * ty;
+    z -= radius_ratio_[n + 1] * tz * (double)(n + 2);
+  }
+  y *= inv_sth;
+
+  magnetic_field_ned_nT[0] = x;
+  magnetic_field_ned_nT[1] = y;
+  magnetic_field_ned_nT[2] = z;
+  return magnetic_field_ned_nT;
+}
+
+void IgrfModel::UpdateCoefficients(const double decimal_year) {
+  double time_year = decimal_year;
+  if (coefficient_update_interval_day_ > 0.0) {
+    // The coefficients are evaluated at the center of the update interval
+    const long long interval_index = (long long)floor(decimal_year * kDaysPerYear / coefficient_update_interval_day_);
+    if (cached_column_ >= 0 && interval_index == cached_interval_index_) return;
+    cached_interval_index_ = interval_index;
+    time_year = ((double)interval_index + 0.5) * coefficient_update_interval_day_ / kDaysPerYear;
+  }
+
+  if (!is_out_of_period_warned_ && (time_year < valid_start_year_ || time_year > valid_end_year_)) {
+    std::cerr << "IGRF coefficients are not defined for " << time_year << std::endl;
+    is_out_of_period_warned_ = true;
+  }
+
+  // Column of the base coefficients. After the last epoch, the secular variation is used.
+  const size_t number_of_epochs = epochs_year_.size();
+  size_t column = number_of_epochs - 1;
+  for (size_t c = 1; c < number_of_epochs; c++) {
+    if (time_year < epochs_year_[c]) {
+      column = c - 1;
+      break;
+    }
+  }
+  if ((int)column != cached_column_) SetInterpolationColumn(column);
+
+  const double elapsed_time_year = time_year - base_epoch_year_;
+  for (size_t i = 0; i < coefficients_now_.size(); i++) {
+    coefficients_now_[i] = base_coefficients_[i] + rate_coefficients_[i] * elapsed_time_year;
+  }
+}
+
+void IgrfModel::SetInterpolationColumn(const size_t column) {
+  cached_column_ = (int)column;
+  base_epoch_year_ = epochs_year_[column];
+
+  const std::vector<double>& base = coefficients_[column];
+  const bool is_secular_variation = column + 1 == epochs_year_.size();
+  for (size_t i = 0; i < base.size(); i++) {
+    base_coefficients_[i] = base[i];
+    if (is_secular_variation) {
+      rate_coefficients_[i] = coefficients_[column + 1][i];
+    } else {
+      rate_coefficients_[i] = (coefficients_[column + 1][i] - base[i]) / (epochs_year_[column + 1] - epochs_year_[column]);
+    }
+  }
+
+  // Normalization factors from the Schmidt semi-normalized coefficients
+  base_coefficients_[Index(0, 0)] = 0.0;
+  rate_coefficients_[Index(0, 0)] = 0.0;
+  for (size_t n = 1; n <= max_degree_; n++) {
+    double factor = sqrt(2.0);
+    for (size_t m = 1; m <= n; m++) {
+      factor /= sqrt((double)((n + m) * (n - m + 1)));
+      base_coefficients_[Index(m, n)] *= factor;
+      base_coefficients_[Index(n, m - 1)] *= factor;
+      rate_coefficients_[Index(m, n)] *= factor;
+      rate_coefficients_[Index(n, m - 1)] *= factor;
+    }
+  }
+}
@@ -0,0 +1,127 @@
+/**
+ * @file igrf_model.hpp
+ * @brief Class to calculate the geomagnetic field with IGRF (International Geomagnetic Reference Field) model
+ */
+
+#ifndef S2E_LIBRARY_GEOMAGNETISM_IGRF_MODEL_HPP_
+#define S2E_LIBRARY_GEOMAGNETISM_IGRF_MODEL_HPP_
+
+#include <string>
+#include <vector>
+
+#include "../geodesy/geodetic_position.hpp"
+#include "../math/vector.hpp"
+
+/**
+ * @class IgrfModel
+ * @brief Class to calculate the geomagnetic field with IGRF (International Geomagnetic Reference Field) model
+ * @details The coefficients of all epochs are read once from the coefficient file. The coefficients interpolated at the time are cached
+ *          and updated when the time moves to the next update interval (one day as default). The spherical harmonics are evaluated with the
+ *          same recursion as IgrfCalc in library/external/igrf, and the scratch memory for the Legendre functions is allocated at the file
+ *          reading. The class has no global state, so the instances can be used in parallel. An instance is not shared by threads.
+ */
+class IgrfModel {
+ public:
+  /**
+   * @fn IgrfModel
+   * @brief Default constructor (the field is always zero until the coefficient file is read)
+   * @param [in] coefficient_update_interval_day: Update interval of the time interpolated coefficients [day]. 0 means the update at every call.
+   */
+  IgrfModel(const double coefficient_update_interval_day = 1.0);
+
+  /**
+   * @fn ReadCoefficientFile
+   * @brief Read the IGRF coefficient file (ex. igrf13.coef)
+   * @param [in] file_name: Path to the coefficient file
+   * @param [in] degree: Maximum degree to calculate. 0 means the maximum degree in the file.
+   * @return True when the file is read successfully
+   */
+  bool ReadCoefficientFile(const std::string& file_name, const size_t degree = 0);
+
+  /**
+   * @fn CalcMagneticField_ned_nT
+   * @brief Calculate the geomagnetic field in the local north-east-down frame of the geocentric latitude
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] position: Geodetic position
+   * @return Geomagnetic field (north, east, down) [nT]
+   */
+  libra::Vector<3> CalcMagneticField_ned_nT(const double decimal_year, const GeodeticPosition& position);
+  /**
+   * @fn CalcMagneticField_i_nT
+   * @brief Calculate the geomagnetic field in the inertial frame
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] position: Geodetic position
+   * @param [in] gmst_rad: Greenwich mean sidereal time [rad]
+   * @return Geomagnetic field in the inertial frame [nT]
+   */
+  libra::Vector<3> CalcMagneticField_i_nT(const double decimal_year, const GeodeticPosition& position, const double gmst_rad);
+
+  // Getters
+  /**
+   * @fn GetDegree
+   * @brief Return the maximum degree to calculate
+   */
+  inline size_t GetDegree() const { return degree_; }
+  /**
+   * @fn GetMaxDegree
+   * @brief Return the maximum degree in the coefficient file
+   */
+  inline size_t GetMaxDegree() const { return max_degree_; }
+
+ private:
+  // Coefficient file
+  size_t max_degree_;                              //!< Maximum degree in the coefficient file
+  double valid_start_year_;                        //!< Start of the valid period of the coefficients [year]
+  double valid_end_year_;                          //!< End of the valid period of the coefficients [year]
+  std::vector<double> epochs_year_;                //!< Epochs of the coefficient columns [year]
+  std::vector<std::vector<double>> coefficients_;  //!< Coefficients of each column. The last column is the secular variation [nT/year].
+
+  // Time interpolation
+  size_t degree_;                           //!< Maximum degree to calculate
+  double coefficient_update_interval_day_;  //!< Update interval of the time interpolated coefficients [day]
+  long long cached_interval_index_;         //!< Index of the update interval of the cached coefficients
+  int cached_column_;                       //!< Column of the base coefficients of the cached rate (-1: not cached)
+  double base_epoch_year_;                  //!< Epoch of the base coefficients [year]
+  std::vector<double> base_coefficients_;   //!< Base coefficients multiplied with the normalization factors
+  std::vector<double> rate_coefficients_;   //!< Rate of the coefficients multiplied with the normalization factors [1/year]
+  std::vector<double> coefficients_now_;    //!< Time interpolated coefficients
+  bool is_out_of_period_warned_;            //!< Flag of the warning for the time out of the valid period
+
+  // Scratch memory
+  std::vector<double> radius_ratio_;  //!< Powers of the radius ratio
+  std::vector<double> cos_m_phi_;     //!< cos(m * longitude)
+  std::vector<double> sin_m_phi_;     //!< sin(m * longitude)
+  std::vector<double> legendre_;      //!< Legendre functions and their derivatives
+
+  /**
+   * @fn Index
+   * @brief Return index of the flat coefficient and Legendre tables
+   * @param [in] row: Row index
+   * @param [in] column: Column index
+   * @note g(n, m) is stored at (m, n) and h(n, m) is stored at (n, m - 1) like library/external/igrf
+   */
+  inline size_t Index(const size_t row, const size_t column) const { return row * (max_degree_ + 1) + column; }
+  /**
+   * @fn CalcMagneticField
+   * @brief Calculate the geomagnetic field in the local north-east-down frame of the geocentric latitude
+   * @param [in] decimal_year: Decimal year [year]
+   * @param [in] position: Geodetic position
+   * @param [out] cos_colatitude: Cosine of the geocentric colatitude
+   * @return Geomagnetic field (north, east, down) [nT]
+   */
+  libra::Vector<3> CalcMagneticField(const double decimal_year, const GeodeticPosition& position, double& cos_colatitude);
+  /**
+   * @fn UpdateCoefficients
+   * @brief Update the time interpolated coefficients when the time moves to the next update interval
+   * @param [in] decimal_year: Decimal year [year]
+   */
+  void UpdateCoefficients(const double decimal_year);
+  /**
+   * @fn SetInterpolationColumn
+   * @brief Set the base coefficients and the rate of the column
+   * @param [in] column: Column of the base coefficients
+   */
+  void SetInterpolationColumn(const size_t column);
+};
+
+#endif  // S2E_LIBRARY_GEOMAGNETISM_IGRF_MODEL_HPP_
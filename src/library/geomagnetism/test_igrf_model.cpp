@@ -0,0 +1,138 @@
+/**
+ * @file test_igrf_model.cpp
+ * @brief Test codes for IgrfModel class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "../external/igrf/igrf.h"
+#include "../math/constants.hpp"
+#include "igrf_model.hpp"
+
+namespace {
+// The file name includes "13" since IgrfCalc replaces it with the generation number
+const std::string kCoefficientFileName = "test_igrf13.coef";
+
+/**
+ * @fn WriteCoefficientFile
+ * @brief Write a synthetic coefficient file of degree 8 with the epochs 2010, 2015, 2020 and the secular variation
+ */
+void WriteCoefficientFile() {
+  std::ofstream ofs(kCoefficientFileName);
+  ofs << "  8  4 2010 2025\n";
+  ofs << "y  0  0  2010.0  2015.0  2020.0 2020-25\n";
+  for (int n = 1; n <= 8; n++) {
+    for (int m = 0; m <= n; m++) {
+      for (int h = 0; h < 2; h++) {
+        if (h == 1 && m == 0) continue;
+        const double base_nT = (h == 0 ? -30000.0 : 5000.0) / std::pow(3.0, n - 1) / (m + 1);
+        ofs << (h == 0 ? "g" : "h") << " " << n << " " << m;
+        for (int column = 0; column < 3; column++) ofs << " " << base_nT * (1.0 + 0.01 * column * (n + m));
+        ofs << " " << base_nT * 0.002 << "\n";
+      }
+    }
+  }
+}
+
+/**
+ * @fn MakeIgrfModel
+ * @brief Make IgrfModel with the synthetic coefficient file
+ */
+IgrfModel MakeIgrfModel(const double coefficient_update_interval_day, const size_t degree = 0) {
+  IgrfModel igrf_model(coefficient_update_interval_day);
+  EXPECT_TRUE(igrf_model.ReadCoefficientFile(kCoefficientFileName, degree));
+  return igrf_model;
+}
+}  // namespace
+
+/**
+ * @brief Test that the results are the same as IgrfCalc in library/external/igrf
+ */
+TEST(IgrfModel, CompareWithIgrfCalc) {
+  WriteCoefficientFile();
+  IgrfModel igrf_model = MakeIgrfModel(0.0);
+  EXPECT_EQ(8u, igrf_model.GetMaxDegree());
+  EXPECT_EQ(8u, igrf_model.GetDegree());
+
+  set_file_path(kCoefficientFileName.c_str());
+  const double decimal_years[3] = {2021.3, 2021.31, 2023.9};
+  for (size_t t = 0; t < 3; t++) {
+    for (int i = 0; i < 50; i++) {
+      const double latitude_rad = (-85.0 + 3.4 * i) * libra::deg_to_rad;
+      const double longitude_rad = (-180.0 + 7.1 * i) * libra::deg_to_rad;
+      const double altitude_m = 300.0e3 + 10.0e3 * i;
+      const double gmst_rad = 0.37 * i;
+      double reference_i_nT[3];
+      IgrfCalc(decimal_years[t], latitude_rad, longitude_rad, altitude_m, gmst_rad, reference_i_nT);
+
+      const GeodeticPosition position(latitude_rad, longitude_rad, altitude_m);
+      const libra::Vector<3> magnetic_field_i_nT = igrf_model.CalcMagneticField_i_nT(decimal_years[t], position, gmst_rad);
+      // IgrfCalc converts the angles with the truncated pi, so the relative tolerance is used
+      for (size_t k = 0; k < 3; k++) EXPECT_NEAR(reference_i_nT[k], magnetic_field_i_nT[k], std::abs(reference_i_nT[k]) * 1.0e-8);
+    }
+  }
+  std::remove(kCoefficientFileName.c_str());
+}
+
+/**
+ * @brief Test the time interpolation of the coefficients and the cache of the update interval
+ */
+TEST(IgrfModel, TimeInterpolation) {
+  WriteCoefficientFile();
+  IgrfModel exact_model = MakeIgrfModel(0.0);
+  IgrfModel daily_model = MakeIgrfModel(1.0);
+  std::remove(kCoefficientFileName.c_str());
+
+  const GeodeticPosition position(0.6, -2.1, 500.0e3);
+  // The field is linear to the coefficients
+  const libra::Vector<3> field_2010_nT = exact_model.CalcMagneticField_ned_nT(2010.0, position);
+  const libra::Vector<3> field_2015_nT = exact_model.CalcMagneticField_ned_nT(2015.0, position);
+  const libra::Vector<3> field_2012_nT = exact_model.CalcMagneticField_ned_nT(2012.5, position);
+  // Continuity at the epoch
+  const libra::Vector<3> field_before_2015_nT = exact_model.CalcMagneticField_ned_nT(2015.0 - 1.0e-9, position);
+  for (size_t k = 0; k < 3; k++) {
+    EXPECT_NEAR(0.5 * (field_2010_nT[k] + field_2015_nT[k]), field_2012_nT[k], 1.0e-6);
+    EXPECT_NEAR(field_2015_nT[k], field_before_2015_nT[k], 1.0e-6);
+  }
+
+  // The daily coefficients are constant in a day and evaluated at the center of the day
+  const double day_index = std::floor(2012.3 * 365.25);
+  const libra::Vector<3> center_field_nT = exact_model.CalcMagneticField_ned_nT((day_index + 0.5) / 365.25, position);
+  for (size_t i = 0; i < 10; i++) {
+    const double decimal_year = (day_index + 0.05 + 0.09 * i) / 365.25;
+    const libra::Vector<3> daily_field_nT = daily_model.CalcMagneticField_ned_nT(decimal_year, position);
+    for (size_t k = 0; k < 3; k++) EXPECT_NEAR(center_field_nT[k], daily_field_nT[k], 1.0e-6);
+  }
+}
+
+/**
+ * @brief Test the selection of the degree and the invalid files
+ */
+TEST(IgrfModel, Degree) {
+  WriteCoefficientFile();
+  IgrfModel full_model = MakeIgrfModel(0.0);
+  IgrfModel dipole_model = MakeIgrfModel(0.0, 1);
+  IgrfModel too_large_degree_model = MakeIgrfModel(0.0, 20);
+  std::remove(kCoefficientFileName.c_str());
+  EXPECT_EQ(1u, dipole_model.GetDegree());
+  EXPECT_EQ(8u, too_large_degree_model.GetDegree());
+
+  // Geomagnetic dipole at the equator on the prime meridian: B = (-g10, -g11 ... ) scaled by (a / r)^3
+  const double radius_ratio = 6371.2 / (6378.137 + 1000.0);
+  const GeodeticPosition position(0.0, 0.0, 1000.0e3);
+  const libra::Vector<3> dipole_field_nT = dipole_model.CalcMagneticField_ned_nT(2010.0, position);
+  EXPECT_NEAR(30000.0 * std::pow(radius_ratio, 3.0), dipole_field_nT[0], 1.0e-6);
+  EXPECT_NEAR(-5000.0 / 2.0 * std::pow(radius_ratio, 3.0), dipole_field_nT[1], 1.0e-6);
+  EXPECT_NEAR(2.0 * 30000.0 / 2.0 * std::pow(radius_ratio, 3.0), dipole_field_nT[2], 1.0e-6);
+
+  const libra::Vector<3> full_field_nT = full_model.CalcMagneticField_ned_nT(2010.0, position);
+  EXPECT_GT(std::abs(full_field_nT[0] - dipole_field_nT[0]), 1.0);
+
+  IgrfModel invalid_model;
+  EXPECT_FALSE(invalid_model.ReadCoefficientFile("not_existing_file.coef"));
+  EXPECT_EQ(0.0, invalid_model.CalcMagneticField_ned_nT(2010.0, position)[0]);
+}
@@ -0,0 +1,145 @@
+/**
+ * @file benchmark_gravity_potential.cpp
+ * @brief Benchmark codes for GravityPotential class with Google Benchmark
+ */
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+
+#include "gravity_potential.hpp"
+
+namespace {
+
+const double kGravityConstant_m3_s2 = 3.986004415e14;
+const double kRadius_m = 6378136.6;
+
+/**
+ * @fn GenerateCoefficients
+ * @brief Generate normalized coefficients following the Kaula's rule of thumb
+ */
+void GenerateCoefficients(const size_t degree, std::vector<std::vector<double>>& c, std::vector<std::vector<double>>& s) {
+  std::mt19937 generator(0);
+  std::normal_distribution<double> distribution(0.0, 1.0);
+  c.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+  s.assign(degree + 1, std::vector<double>(degree + 1, 0.0));
+  for (size_t n = 2; n <= degree; n++) {
+    for (size_t m = 0; m <= n; m++) {
+      c[n][m] = 1.0e-5 / (double)(n * n) * distribution(generator);
+      if (m > 0) s[n][m] = 1.0e-5 / (double)(n * n) * distribution(generator);
+    }
+  }
+  if (degree >= 2) c[2][0] = -4.84165e-4;
+}
+
+/**
+ * @fn CalcAccelerationReference
+ * @brief Reference implementation of the previous Geopotential::CalcAccelerationEcef
+ * @note Two dimensional V/W tables are allocated and all the normalization factors are calculated in each call.
+ */
+libra::Vector<3> CalcAccelerationReference(const int degree, const std::vector<std::vector<double>>& c, const std::vector<std::vector<double>>& s,
+                                           const libra::Vector<3>& position_m) {
+  const double x = position_m[0], y = position_m[1], z = position_m[2];
+  const double r = sqrt(x * x + y * y + z * z);
+  const double tmp = kRadius_m / (r * r);
+
+  const int degree_vw = degree + 1;
+  std::vector<std::vector<double>> v(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
+  std::vector<std::vector<double>> w(degree_vw + 1, std::vector<double>(degree_vw + 1, 0.0));
+  v[0][0] = kRadius_m / r;
+  for (int m = 0; m < degree_vw; m++) {
+    const double m_d = (double)m;
+    for (int n = m + 1; n <= degree_vw; n++) {
+      const double n_d = (double)n;
+      const double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
+      const double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
+      const double c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
+      double c2_normalize = 1.0;
+      if (n > 1) c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+      const double v_prev2 = (n > m + 1) ? v[n - 2][m] : 0.0;
+      const double w_prev2 = (n > m + 1) ? w[n - 2][m] : 0.0;
+      v[n][m] = c_normalize * (c1 * z * tmp * v[n - 1][m] - c2 * c2_normalize * kRadius_m * tmp * v_prev2);
+      w[n][m] = c_normalize * (c1 * z * tmp * w[n - 1][m] - c2 * c2_normalize * kRadius_m * tmp * w_prev2);
+    }
+    const int k = m + 1;
+    const double k_d = (double)k;
+    double c_normalize = sqrt((2.0 * k_d + 1.0) / (2.0 * k_d));
+    if (k == 1) c_normalize = sqrt(3.0);
+    v[k][k] = c_normalize * (x * tmp * v[k - 1][k - 1] - y * tmp * w[k - 1][k - 1]);
+    w[k][k] = c_normalize * (x * tmp * w[k - 1][k - 1] + y * tmp * v[k - 1][k - 1]);
+  }
+
+  libra::Vector<3> acceleration_m_s2(0.0);
+  for (int n = 0; n <= degree; n++) {
+    const double n_d = (double)n;
+    const double normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 3.0));
+    const double normalize_xy = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
+    acceleration_m_s2[0] += -c[n][0] * v[n + 1][1] * normalize_xy;
+    acceleration_m_s2[1] += -c[n][0] * w[n + 1][1] * normalize_xy;
+    acceleration_m_s2[2] += (n_d + 1.0) * (-c[n][0] * v[n + 1][0] - s[n][0] * w[n + 1][0]) * normalize;
+    for (int m = 1; m <= n; m++) {
+      const double m_d = (double)m;
+      const double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0);
+      const double normalize_xy1 = normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
+      double normalize_xy2 = normalize * sqrt(factorial);
+      if (m == 1) normalize_xy2 *= sqrt(2.0);
+      const double normalize_z = normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
+      acceleration_m_s2[0] += 0.5 * (normalize_xy1 * (-c[n][m] * v[n + 1][m + 1] - s[n][m] * w[n + 1][m + 1]) +
+                                     normalize_xy2 * (c[n][m] * v[n + 1][m - 1] + s[n][m] * w[n + 1][m - 1]));
+      acceleration_m_s2[1] += 0.5 * (normalize_xy1 * (-c[n][m] * w[n + 1][m + 1] + s[n][m] * v[n + 1][m + 1]) +
+                                     normalize_xy2 * (-c[n][m] * w[n + 1][m - 1] + s[n][m] * v[n + 1][m - 1]));
+      acceleration_m_s2[2] += (n_d - m_d + 1.0) * (-c[n][m] * v[n + 1][m] - s[n][m] * w[n + 1][m]) * normalize_z;
+    }
+  }
+  acceleration_m_s2 *= kGravityConstant_m3_s2 / (kRadius_m * kRadius_m);
+  return acceleration_m_s2;
+}
+
+libra::Vector<3> GetTestPosition() {
+  libra::Vector<3> position_m;
+  position_m[0] = 4.5e6;
+  position_m[1] = -2.1e6;
+  position_m[2] = 4.9e6;
+  return position_m;
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmark of GravityPotential with the maximum relative error against the reference implementation
+ */
+static void BM_GravityPotential(benchmark::State& state) {
+  const size_t degree = (size_t)state.range(0);
+  std::vector<std::vector<double>> c, s;
+  GenerateCoefficients(degree, c, s);
+  GravityPotential gravity_potential(degree, c, s, kGravityConstant_m3_s2, kRadius_m);
+  const libra::Vector<3> position_m = GetTestPosition();
+
+  const libra::Vector<3> reference_m_s2 = CalcAccelerationReference((int)degree, c, s, position_m);
+  const libra::Vector<3> result_m_s2 = gravity_potential.CalcAcceleration_xcxf_m_s2(position_m);
+  double max_error_m_s2 = 0.0;
+  for (size_t i = 0; i < 3; i++) max_error_m_s2 = std::max(max_error_m_s2, fabs(result_m_s2[i] - reference_m_s2[i]));
+  const double relative_error = max_error_m_s2 / reference_m_s2.CalcNorm();
+  if (relative_error > 1.0e-12) state.SkipWithError("GravityPotential does not match the reference implementation");
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(gravity_potential.CalcAcceleration_xcxf_m_s2(position_m));
+  }
+  state.counters["relative_error"] = relative_error;
+}
+BENCHMARK(BM_GravityPotential)->Arg(2)->Arg(4)->Arg(10)->Arg(20)->Arg(50)->Arg(100)->Arg(200)->Arg(360);
+
+/**
+ * @brief Benchmark of the reference implementation (previous Geopotential) for the speedup comparison
+ */
+static void BM_GravityPotentialReference(benchmark::State& state) {
+  const int degree = (int)state.range(0);
+  std::vector<std::vector<double>> c, s;
+  GenerateCoefficients((size_t)degree, c, s);
+  const libra::Vector<3> position_m = GetTestPosition();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(CalcAccelerationReference(degree, c, s, position_m));
+  }
+}
+BENCHMARK(BM_GravityPotentialReference)->Arg(2)->Arg(4)->Arg(10)->Arg(20)->Arg(50)->Arg(100)->Arg(200)->Arg(360);
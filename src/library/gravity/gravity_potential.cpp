@@ -0,0 +1,172 @@
+/**
+ * @file gravity_potential.cpp
+ * @brief Class to calculate the high-order gravity acceleration with normalized spherical harmonics coefficients
+ */
+
+#include "gravity_potential.hpp"
+
+#include <cmath>
+
+GravityPotential::GravityPotential() : GravityPotential(0, {{0.0}}, {{0.0}}, 0.0, 1.0) {}
+
+GravityPotential::GravityPotential(const size_t degree, const std::vector<std::vector<double>> &cosine_coefficients,
+                                   const std::vector<std::vector<double>> &sine_coefficients, const double gravity_constant_m3_s2,
+                                   const double center_body_radius_m)
+    : degree_(degree), gravity_constant_m3_s2_(gravity_constant_m3_s2), center_body_radius_m_(center_body_radius_m) {
+  // The acceleration of degree n requires V and W of degree n+1
+  const size_t degree_vw = degree_ + 1;
+
+  // Recursion factors
+  recursion_offset_.assign(degree_vw + 1, 0);
+  diagonal_factor_.assign(degree_vw + 1, 0.0);
+  for (size_t m = 0; m <= degree_vw; m++) {
+    recursion_offset_[m] = recursion_factor_a_.size();
+    const double m_d = (double)m;
+    for (size_t n = m + 1; n <= degree_vw; n++) {
+      const double n_d = (double)n;
+      const double c1 = (2.0 * n_d - 1.0) / (n_d - m_d);
+      const double c2 = (n_d + m_d - 1.0) / (n_d - m_d);
+      const double c_normalize = sqrt(((2.0 * n_d + 1.0) * (n_d - m_d)) / ((2.0 * n_d - 1.0) * (n_d + m_d)));
+      double c2_normalize = 0.0;  // V[n-2][m] does not exist for n = m+1
+      if (n > m + 1) c2_normalize = sqrt(((2.0 * n_d - 1.0) * (n_d - m_d - 1.0)) / ((2.0 * n_d - 3.0) * (n_d + m_d - 1.0)));
+      recursion_factor_a_.push_back(c_normalize * c1);
+      recursion_factor_b_.push_back(c_normalize * c2 * c2_normalize);
+    }
+    if (m == 1) {
+      diagonal_factor_[m] = sqrt(3.0);
+    } else if (m > 1) {
+      diagonal_factor_[m] = sqrt((2.0 * m_d + 1.0) / (2.0 * m_d));
+    }
+  }
+
+  // Coefficients with acceleration normalization factors
+  coefficient_offset_.assign(degree_ + 1, 0);
+  for (size_t m = 0; m <= degree_; m++) {
+    coefficient_offset_[m] = c_z_.size();
+    const double m_d = (double)m;
+    for (size_t n = m; n <= degree_; n++) {
+      const double n_d = (double)n;
+      const double c_nm = cosine_coefficients[n][m];
+      const double s_nm = sine_coefficients[n][m];
+      const double normalize = sqrt((2.0 * n_d + 1.0) / (2.0 * n_d + 3.0));
+      if (m == 0) {
+        const double normalize_xy = normalize * sqrt((n_d + 2.0) * (n_d + 1.0) / 2.0);
+        c_xy_plus_.push_back(c_nm * normalize_xy);
+        s_xy_plus_.push_back(0.0);
+        c_xy_minus_.push_back(0.0);
+        s_xy_minus_.push_back(0.0);
+        c_z_.push_back(c_nm * (n_d + 1.0) * normalize);
+        s_z_.push_back(s_nm * (n_d + 1.0) * normalize);
+      } else {
+        const double factorial = (n_d - m_d + 1.0) * (n_d - m_d + 2.0);
+        const double normalize_xy1 = normalize * sqrt((n_d + m_d + 1.0) * (n_d + m_d + 2.0));
+        double normalize_xy2 = normalize * sqrt(factorial);
+        if (m == 1) normalize_xy2 *= sqrt(2.0);
+        const double normalize_z = normalize * sqrt((n_d + m_d + 1.0) / (n_d - m_d + 1.0));
+        c_xy_plus_.push_back(0.5 * c_nm * normalize_xy1);
+        s_xy_plus_.push_back(0.5 * s_nm * normalize_xy1);
+        c_xy_minus_.push_back(0.5 * c_nm * normalize_xy2);
+        s_xy_minus_.push_back(0.5 * s_nm * normalize_xy2);
+        c_z_.push_back(c_nm * (n_d - m_d + 1.0) * normalize_z);
+        s_z_.push_back(s_nm * (n_d - m_d + 1.0) * normalize_z);
+      }
+    }
+  }
+
+  // Scratch memory for three orders
+  v_.assign(3 * (degree_vw + 1), 0.0);
+  w_.assign(3 * (degree_vw + 1), 0.0);
+}
+
+libra::Vector<3> GravityPotential::CalcAcceleration_xcxf_m_s2(const libra::Vector<3> &position_xcxf_m) {
+  const double x_m = position_xcxf_m[0];
+  const double y_m = position_xcxf_m[1];
+  const double z_m = position_xcxf_m[2];
+  const double radius_m = sqrt(x_m * x_m + y_m * y_m + z_m * z_m);
+
+  const double tmp = center_body_radius_m_ / (radius_m * radius_m);
+  const double x_factor = x_m * tmp;
+  const double y_factor = y_m * tmp;
+  const double z_factor = z_m * tmp;
+  const double r_factor = center_body_radius_m_ * tmp;
+
+  // Column buffers for order m-1, m, m+1
+  const size_t column_length = degree_ + 2;
+  double *v_prev = &v_[0];
+  double *w_prev = &w_[0];
+  double *v_curr = &v_[column_length];
+  double *w_curr = &w_[column_length];
+  double *v_next = &v_[2 * column_length];
+  double *w_next = &w_[2 * column_length];
+
+  // m = 0 and m = 1
+  v_curr[0] = center_body_radius_m_ / radius_m;
+  w_curr[0] = 0.0;
+  CalcRecursionColumn(0, z_factor, r_factor, v_curr, w_curr);
+  v_next[1] = diagonal_factor_[1] * (x_factor * v_curr[0] - y_factor * w_curr[0]);
+  w_next[1] = diagonal_factor_[1] * (x_factor * w_curr[0] + y_factor * v_curr[0]);
+  CalcRecursionColumn(1, z_factor, r_factor, v_next, w_next);
+
+  double acc_x = 0.0, acc_y = 0.0, acc_z = 0.0;
+  {
+    const size_t offset = coefficient_offset_[0];
+    for (size_t n = 0; n <= degree_; n++) {
+      const size_t i = offset + n;
+      acc_x -= c_xy_plus_[i] * v_next[n + 1];
+      acc_y -= c_xy_plus_[i] * w_next[n + 1];
+      acc_z -= c_z_[i] * v_curr[n + 1] + s_z_[i] * w_curr[n + 1];
+    }
+  }
+
+  for (size_t m = 1; m <= degree_; m++) {
+    // Rotate the column buffers
+    double *v_tmp = v_prev, *w_tmp = w_prev;
+    v_prev = v_curr;
+    w_prev = w_curr;
+    v_curr = v_next;
+    w_curr = w_next;
+    v_next = v_tmp;
+    w_next = w_tmp;
+
+    // V and W of the order m+1
+    v_next[m + 1] = diagonal_factor_[m + 1] * (x_factor * v_curr[m] - y_factor * w_curr[m]);
+    w_next[m + 1] = diagonal_factor_[m + 1] * (x_factor * w_curr[m] + y_factor * v_curr[m]);
+    CalcRecursionColumn(m + 1, z_factor, r_factor, v_next, w_next);
+
+    // Acceleration terms of the order m
+    const size_t offset = coefficient_offset_[m] - m;
+    for (size_t n = m; n <= degree_; n++) {
+      const size_t i = offset + n;
+      const size_t k = n + 1;
+      acc_x += -c_xy_plus_[i] * v_next[k] - s_xy_plus_[i] * w_next[k] + c_xy_minus_[i] * v_prev[k] + s_xy_minus_[i] * w_prev[k];
+      acc_y += -c_xy_plus_[i] * w_next[k] + s_xy_plus_[i] * v_next[k] - c_xy_minus_[i] * w_prev[k] + s_xy_minus_[i] * v_prev[k];
+      acc_z -= c_z_[i] * v_curr[k] + s_z_[i] * w_curr[k];
+    }
+  }
+
+  libra::Vector<3> acceleration_xcxf_m_s2;
+  const double scale = gravity_constant_m3_s2_ / (center_body_radius_m_ * center_body_radius_m_);
+  acceleration_xcxf_m_s2[0] = acc_x * scale;
+  acceleration_xcxf_m_s2[1] = acc_y * scale;
+  acceleration_xcxf_m_s2[2] = acc_z * scale;
+  return acceleration_xcxf_m_s2;
+}
+
+void GravityPotential::CalcRecursionColumn(const size_t m, const double z_factor, const double r_factor, double *v, double *w) const {
+  const size_t degree_vw = degree_ + 1;
+  if (m >= degree_vw) return;
+
+  const size_t offset = recursion_offset_[m] - (m + 1);
+  const double *a = &recursion_factor_a_[0];
+  const double *b = &recursion_factor_b_[0];
+
+  // n = m+1
+  v[m + 1] = a[offset + m + 1] * z_factor * v[m];
+  w[m + 1] = a[offset + m + 1] * z_factor * w[m];
+  // n = m+2 ... degree+1
+  for (size_t n = m + 2; n <= degree_vw; n++) {
+    const size_t i = offset + n;
+    v[n] = a[i] * z_factor * v[n - 1] - b[i] * r_factor * v[n - 2];
+    w[n] = a[i] * z_factor * w[n - 1] - b[i] * r_factor * w[n - 2];
+  }
+}
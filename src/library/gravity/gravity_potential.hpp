@@ -0,0 +1,90 @@
+/**
+ * @file gravity_potential.hpp
+ * @brief Class to calculate the high-order gravity acceleration with normalized spherical harmonics coefficients
+ */
+
+#ifndef S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_HPP_
+#define S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_HPP_
+
+#include <vector>
+
+#include "../math/vector.hpp"
+
+/**
+ * @class GravityPotential
+ * @brief Class to calculate the high-order gravity acceleration with normalized spherical harmonics coefficients
+ * @details The V/W recursion (Montenbruck & Gill, Satellite Orbits, Sec. 3.2) is evaluated column by column (order by order), and the
+ * acceleration terms of each order are summed as soon as the neighboring columns are available. All normalization factors are
+ * precomputed in flat tables packed by order at the construction, and the scratch memory is reused, so that no memory allocation and
+ * no square root calculation are executed in the acceleration calculation.
+ */
+class GravityPotential {
+ public:
+  /**
+   * @fn GravityPotential
+   * @brief Default constructor (degree = 0, the acceleration is always zero)
+   */
+  GravityPotential();
+  /**
+   * @fn GravityPotential
+   * @brief Constructor
+   * @param [in] degree: Maximum degree to calculate the gravity potential
+   * @param [in] cosine_coefficients: Normalized cosine coefficients C[n][m] (size should be larger than degree + 1)
+   * @param [in] sine_coefficients: Normalized sine coefficients S[n][m] (size should be larger than degree + 1)
+   * @param [in] gravity_constant_m3_s2: Gravitational constant of the center body [m3/s2]
+   * @param [in] center_body_radius_m: Reference radius of the center body [m]
+   */
+  GravityPotential(const size_t degree, const std::vector<std::vector<double>> &cosine_coefficients,
+                   const std::vector<std::vector<double>> &sine_coefficients, const double gravity_constant_m3_s2, const double center_body_radius_m);
+
+  /**
+   * @fn CalcAcceleration_xcxf_m_s2
+   * @brief Calculate the gravity acceleration in the body fixed frame
+   * @param [in] position_xcxf_m: Position of the spacecraft in the body fixed frame [m]
+   * @return Acceleration in the body fixed frame [m/s2]
+   */
+  libra::Vector<3> CalcAcceleration_xcxf_m_s2(const libra::Vector<3> &position_xcxf_m);
+
+  /**
+   * @fn GetDegree
+   * @brief Return the maximum degree
+   */
+  inline size_t GetDegree() const { return degree_; }
+
+ private:
+  size_t degree_;                  //!< Maximum degree
+  double gravity_constant_m3_s2_;  //!< Gravitational constant of the center body [m3/s2]
+  double center_body_radius_m_;    //!< Reference radius of the center body [m]
+
+  // Recursion factors of V and W for n = m+1 ... degree+1, packed by order m
+  std::vector<size_t> recursion_offset_;    //!< Start index of the order m in the recursion tables
+  std::vector<double> recursion_factor_a_;  //!< Factor for V[n-1][m] (n > m)
+  std::vector<double> recursion_factor_b_;  //!< Factor for V[n-2][m] (n > m)
+  std::vector<double> diagonal_factor_;     //!< Factor for V[m-1][m-1] to calculate V[m][m]
+
+  // Coefficients multiplied with the normalization factors of the acceleration for n = m ... degree, packed by order m
+  std::vector<size_t> coefficient_offset_;  //!< Start index of the order m in the coefficient tables
+  std::vector<double> c_xy_plus_;           //!< Factor of C[n][m] for V[n+1][m+1] and W[n+1][m+1]
+  std::vector<double> s_xy_plus_;           //!< Factor of S[n][m] for V[n+1][m+1] and W[n+1][m+1]
+  std::vector<double> c_xy_minus_;          //!< Factor of C[n][m] for V[n+1][m-1] and W[n+1][m-1]
+  std::vector<double> s_xy_minus_;          //!< Factor of S[n][m] for V[n+1][m-1] and W[n+1][m-1]
+  std::vector<double> c_z_;                 //!< Factor of C[n][m] for V[n+1][m] and W[n+1][m]
+  std::vector<double> s_z_;                 //!< Factor of S[n][m] for V[n+1][m] and W[n+1][m]
+
+  // Scratch memory
+  std::vector<double> v_;  //!< V values for three successive orders (m-1, m, m+1)
+  std::vector<double> w_;  //!< W values for three successive orders (m-1, m, m+1)
+
+  /**
+   * @fn CalcRecursionColumn
+   * @brief Calculate V and W for n = m+1 ... degree+1 with the already calculated V[m][m] and W[m][m]
+   * @param [in] m: Order
+   * @param [in] z_factor: Normalized z position factor
+   * @param [in] r_factor: Normalized radius factor
+   * @param [in/out] v: V values of the order m
+   * @param [in/out] w: W values of the order m
+   */
+  void CalcRecursionColumn(const size_t m, const double z_factor, const double r_factor, double *v, double *w) const;
+};
+
+#endif  // S2E_LIBRARY_GRAVITY_GRAVITY_POTENTIAL_HPP_
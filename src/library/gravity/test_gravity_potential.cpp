@@ -0,0 +1,82 @@
+/**
+ * @file test_gravity_potential.cpp
+ * @brief Test codes for GravityPotential class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "gravity_potential.hpp"
+
+/**
+ * @brief Test for the J2 term with the analytical solution
+ */
+TEST(GravityPotential, J2Acceleration) {
+  const double gravity_constant_m3_s2 = 3.986004415e14;
+  const double radius_m = 6378136.3;
+  const double j2 = 1.0826e-3;
+  const size_t degree = 2;
+
+  std::vector<std::vector<double>> c(degree + 1, std::vector<double>(degree + 1, 0.0));
+  std::vector<std::vector<double>> s(degree + 1, std::vector<double>(degree + 1, 0.0));
+  c[2][0] = -j2 / sqrt(5.0);  // Normalized C20
+  GravityPotential gravity_potential(degree, c, s, gravity_constant_m3_s2, radius_m);
+
+  libra::Vector<3> position_m;
+  position_m[0] = 4.0e6;
+  position_m[1] = -3.0e6;
+  position_m[2] = 5.0e6;
+  const double r_m = position_m.CalcNorm();
+  const double z2_r2 = position_m[2] * position_m[2] / (r_m * r_m);
+  const double factor = 1.5 * j2 * gravity_constant_m3_s2 * radius_m * radius_m / pow(r_m, 5.0);
+
+  libra::Vector<3> acceleration_m_s2 = gravity_potential.CalcAcceleration_xcxf_m_s2(position_m);
+  const double accuracy = 1.0e-12 * factor * r_m;
+  EXPECT_NEAR(factor * position_m[0] * (5.0 * z2_r2 - 1.0), acceleration_m_s2[0], accuracy);
+  EXPECT_NEAR(factor * position_m[1] * (5.0 * z2_r2 - 1.0), acceleration_m_s2[1], accuracy);
+  EXPECT_NEAR(factor * position_m[2] * (5.0 * z2_r2 - 3.0), acceleration_m_s2[2], accuracy);
+}
+
+/**
+ * @brief Test for repeated calculation with the reused scratch memory
+ */
+TEST(GravityPotential, RepeatedCalculation) {
+  const size_t degree = 20;
+  std::vector<std::vector<double>> c(degree + 1, std::vector<double>(degree + 1, 0.0));
+  std::vector<std::vector<double>> s(degree + 1, std::vector<double>(degree + 1, 0.0));
+  for (size_t n = 2; n <= degree; n++) {
+    for (size_t m = 0; m <= n; m++) {
+      c[n][m] = 1.0e-6 / (double)(n * n + m);
+      if (m > 0) s[n][m] = -1.0e-6 / (double)(n * n + 2 * m);
+    }
+  }
+  GravityPotential gravity_potential(degree, c, s, 3.986004415e14, 6378136.3);
+
+  libra::Vector<3> position_1_m;
+  position_1_m[0] = 7.0e6;
+  position_1_m[1] = 1.0e5;
+  position_1_m[2] = -2.0e5;
+  libra::Vector<3> position_2_m;
+  position_2_m[0] = -1.0e6;
+  position_2_m[1] = 2.0e6;
+  position_2_m[2] = 6.5e6;
+
+  libra::Vector<3> acceleration_1_m_s2 = gravity_potential.CalcAcceleration_xcxf_m_s2(position_1_m);
+  gravity_potential.CalcAcceleration_xcxf_m_s2(position_2_m);
+  libra::Vector<3> acceleration_2_m_s2 = gravity_potential.CalcAcceleration_xcxf_m_s2(position_1_m);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(acceleration_1_m_s2[i], acceleration_2_m_s2[i]);
+  }
+}
+
+/**
+ * @brief Test for zero coefficients
+ */
+TEST(GravityPotential, ZeroCoefficients) {
+  GravityPotential gravity_potential;
+  libra::Vector<3> position_m(7.0e6);
+  libra::Vector<3> acceleration_m_s2 = gravity_potential.CalcAcceleration_xcxf_m_s2(position_m);
+  for (size_t i = 0; i < 3; i++) {
+    EXPECT_DOUBLE_EQ(0.0, acceleration_m_s2[i]);
+  }
+}
@@ -0,0 +1,106 @@
+/**
+ * @file configuration_database.cpp
+ * @brief Process-wide database of the parsed `ini` format files
+ */
+
+#include "configuration_database.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+#include "../external/inih/ini.h"
+
+ConfigurationDatabase configuration_database;
+
+ConfigurationFile::ConfigurationFile(const std::string& file_path) : file_path_(file_path) {
+  parse_error_ = ini_parse(file_path.c_str(), ValueHandler, this);
+
+  for (auto& entry : entries_) {
+    const char* value = entry.value.c_str();
+    char* end;
+    entry.real_value = strtod(value, &end);
+    entry.is_real = end > value;
+    entry.integer_value = strtol(value, &end, 0);
+    entry.is_integer = end > value;
+  }
+}
+
+const ConfigurationFile::Entry* ConfigurationFile::Find(const std::string& section_name, const std::string& key_name,
+                                                        const bool records_missing) const {
+  const std::string key = MakeKey(section_name, key_name);
+  const auto found = index_.find(key);
+  if (found == index_.end()) {
+    if (records_missing) {
+      std::lock_guard<std::mutex> lock(missing_keys_mutex_);
+      missing_keys_.insert(section_name + "." + key_name);
+    }
+    return nullptr;
+  }
+  found->second->is_read = true;
+  return found->second;
+}
+
+size_t ConfigurationFile::PrintReport(std::ostream& stream) const {
+  size_t number_of_reported_keys = 0;
+  {
+    std::lock_guard<std::mutex> lock(missing_keys_mutex_);
+    for (const auto& key : missing_keys_) {
+      stream << "  missing: " << file_path_ << ": " << key << std::endl;
+      number_of_reported_keys++;
+    }
+  }
+  for (const auto& name : original_names_) {
+    if (index_.at(name.first)->is_read) continue;
+    stream << "  unused: " << file_path_ << ": " << name.second << std::endl;
+    number_of_reported_keys++;
+  }
+  return number_of_reported_keys;
+}
+
+std::string ConfigurationFile::MakeKey(const std::string& section_name, const std::string& key_name) {
+  std::string key = section_name + "=" + key_name;
+  // The section and key names are case-insensitive
+  std::transform(key.begin(), key.end(), key.begin(), [](char c) { return static_cast<char>(std::tolower(c)); });
+  return key;
+}
+
+int ConfigurationFile::ValueHandler(void* user, const char* section_name, const char* key_name, const char* value) {
+  if (!key_name) return 1;
+  ConfigurationFile* file = static_cast<ConfigurationFile*>(user);
+  const std::string key = MakeKey(section_name, key_name);
+  auto found = file->index_.find(key);
+  if (found == file->index_.end()) {
+    file->entries_.emplace_back();
+    found = file->index_.emplace(key, &file->entries_.back()).first;
+    file->original_names_[key] = std::string(section_name) + "." + key_name;
+  }
+  // Multi-line values are joined as INIReader
+  Entry* entry = found->second;
+  if (entry->value.size() > 0) entry->value += "\n";
+  entry->value += value ? value : "";
+  return 1;
+}
+
+const ConfigurationFile& ConfigurationDatabase::GetFile(const std::string& file_path) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto found = files_.find(file_path);
+  if (found == files_.end()) {
+    found = files_.emplace(file_path, std::unique_ptr<ConfigurationFile>(new ConfigurationFile(file_path))).first;
+  }
+  return *found->second;
+}
+
+size_t ConfigurationDatabase::PrintReport(std::ostream& stream) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t number_of_reported_keys = 0;
+  for (const auto& file : files_) {
+    number_of_reported_keys += file.second->PrintReport(stream);
+  }
+  return number_of_reported_keys;
+}
+
+void ConfigurationDatabase::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  files_.clear();
+}
@@ -0,0 +1,136 @@
+/**
+ * @file configuration_database.hpp
+ * @brief Process-wide database of the parsed `ini` format files
+ */
+
+#ifndef S2E_LIBRARY_INITIALIZE_CONFIGURATION_DATABASE_HPP_
+#define S2E_LIBRARY_INITIALIZE_CONFIGURATION_DATABASE_HPP_
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @class ConfigurationFile
+ * @brief Key/value table of an `ini` format file parsed once
+ * @details The section and key names are case-insensitive as INIReader. The numbers are converted at the parse, so the lookups only cost a
+ *          hash of the key. The table records which keys are read and which keys are requested but missing for the configuration report.
+ */
+class ConfigurationFile {
+ public:
+  /**
+   * @struct Entry
+   * @brief Value of a key
+   */
+  struct Entry {
+    std::string value;                  //!< Raw value (multi-line values are joined with '\n')
+    double real_value = 0.0;            //!< Value converted with strtod
+    bool is_real = false;               //!< Flag that the value is a valid floating point number
+    long integer_value = 0;             //!< Value converted with strtol (decimal or hex)
+    bool is_integer = false;            //!< Flag that the value is a valid integer
+    mutable std::atomic<bool> is_read;  //!< Flag that the value is read by the simulation
+    Entry() : is_read(false) {}
+  };
+
+  /**
+   * @fn ConfigurationFile
+   * @brief Constructor. Parse the file.
+   * @param [in] file_path: Path to the `ini` file
+   */
+  explicit ConfigurationFile(const std::string& file_path);
+
+  /**
+   * @fn Find
+   * @brief Find the value of the key
+   * @param [in] section_name: Section name
+   * @param [in] key_name: Key name
+   * @param [in] records_missing: Record the key for the configuration report when it is not found
+   * @return Value, or nullptr when the key is not found
+   */
+  const Entry* Find(const std::string& section_name, const std::string& key_name, const bool records_missing = true) const;
+
+  /**
+   * @fn PrintReport
+   * @brief Print the missing keys and the unused keys
+   * @param [out] stream: Output stream
+   * @return Number of the reported keys
+   */
+  size_t PrintReport(std::ostream& stream) const;
+
+  // Getters
+  /**
+   * @fn GetParseError
+   * @brief Return the result of ini_parse (0: success, line number of the first error, or -1: file open error)
+   */
+  inline int GetParseError() const { return parse_error_; }
+  /**
+   * @fn GetFilePath
+   * @brief Return the file path
+   */
+  inline const std::string& GetFilePath() const { return file_path_; }
+
+ private:
+  std::string file_path_;                              //!< File path
+  int parse_error_;                                    //!< Result of ini_parse
+  std::deque<Entry> entries_;                          //!< Values in the order of the file
+  std::unordered_map<std::string, Entry*> index_;      //!< Lower case "section=key" to value
+  std::map<std::string, std::string> original_names_;  //!< Lower case "section=key" to the name written in the file for the report
+  mutable std::set<std::string> missing_keys_;         //!< Requested keys which are not found
+  mutable std::mutex missing_keys_mutex_;              //!< Mutex for missing_keys_
+
+  /**
+   * @fn MakeKey
+   * @brief Make the lower case "section=key" string
+   */
+  static std::string MakeKey(const std::string& section_name, const std::string& key_name);
+  /**
+   * @fn ValueHandler
+   * @brief Handler called by ini_parse for each value
+   */
+  static int ValueHandler(void* user, const char* section_name, const char* key_name, const char* value);
+};
+
+/**
+ * @class ConfigurationDatabase
+ * @brief Process-wide cache of the parsed `ini` format files
+ * @details Each file is parsed at the first access and shared by all the IniAccess instances. The forked Monte-Carlo workers inherit the files
+ *          already parsed by the parent process.
+ */
+class ConfigurationDatabase {
+ public:
+  /**
+   * @fn GetFile
+   * @brief Return the parsed file. The file is parsed at the first call.
+   * @param [in] file_path: Path to the `ini` file
+   */
+  const ConfigurationFile& GetFile(const std::string& file_path);
+
+  /**
+   * @fn PrintReport
+   * @brief Print the missing keys and the unused keys of all the parsed files
+   * @param [out] stream: Output stream
+   * @return Number of the reported keys
+   */
+  size_t PrintReport(std::ostream& stream) const;
+
+  /**
+   * @fn Clear
+   * @brief Discard the parsed files to read the modified files again
+   * @note The references returned by GetFile become invalid.
+   */
+  void Clear();
+
+ private:
+  std::map<std::string, std::unique_ptr<ConfigurationFile>> files_;  //!< Parsed files
+  mutable std::mutex mutex_;                                         //!< Mutex for files_
+};
+
+extern ConfigurationDatabase configuration_database;  //!< Configuration database
+
+#endif  // S2E_LIBRARY_INITIALIZE_CONFIGURATION_DATABASE_HPP_
@@ -8,6 +8,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <cctype>
 #include <cstring>
 #include <limits>
 
@@ -17,7 +18,7 @@ IniAccess::IniAccess(const std::string file_path) : file_path_(file_path) {
   strncpy(file_path_char_, file_path_.c_str(), kMaxCharLength);
 }
 #else
-IniAccess::IniAccess(const std::string file_path) : file_path_(file_path), ini_reader_(file_path) {
+IniAccess::IniAccess(const std::string file_path) : file_path_(file_path) {
   strncpy(file_path_char_, file_path_.c_str(), kMaxCharLength);
 
   std::string ext = ".ini";
@@ -25,12 +26,19 @@ IniAccess::IniAccess(const std::string file_path) : file_path_(file_path), ini_r
     // this is not ini file(csv)
     return;
   }
-  if (ini_reader_.ParseError() != 0) {
+  // The file is parsed only at the first access in the process
+  configuration_file_ = &configuration_database.GetFile(file_path_);
+  if (configuration_file_->GetParseError() != 0) {
     std::cerr << "Error reading INI file : " << file_path_ << std::endl;
-    std::cerr << "\t error code: " << ini_reader_.ParseError() << std::endl;
+    std::cerr << "\t error code: " << configuration_file_->GetParseError() << std::endl;
     throw std::runtime_error("Error reading INI file");
   }
 }
+
+const ConfigurationFile::Entry* IniAccess::Find(const char* section_name, const std::string& key_name, const bool records_missing) const {
+  if (configuration_file_ == nullptr) return nullptr;
+  return configuration_file_->Find(section_name, key_name, records_missing);
+}
 #endif
 
 double IniAccess::ReadDouble(const char* section_name, const char* key_name) {
@@ -46,7 +54,17 @@ double IniAccess::ReadDouble(const char* section_name, const char* key_name) {
 
   return temp;
 #else
-  return ini_reader_.GetReal(section_name, key_name, 0);
+  const ConfigurationFile::Entry* entry = Find(section_name, key_name);
+  return (entry != nullptr && entry->is_real) ? entry->real_value : 0.0;
+#endif
+}
+
+double IniAccess::ReadOptionalDouble(const char* section_name, const std::string& key_name) {
+#ifdef WIN32
+  return ReadDouble(section_name, key_name.c_str());
+#else
+  const ConfigurationFile::Entry* entry = Find(section_name, key_name, false);
+  return (entry != nullptr && entry->is_real) ? entry->real_value : 0.0;
 #endif
 }
 
@@ -58,7 +76,8 @@ int IniAccess::ReadInt(const char* section_name, const char* key_name) {
 
   return temp;
 #else
-  return (int)ini_reader_.GetInteger(section_name, key_name, 0);
+  const ConfigurationFile::Entry* entry = Find(section_name, key_name);
+  return (entry != nullptr && entry->is_integer) ? (int)entry->integer_value : 0;
 #endif
 }
 bool IniAccess::ReadBoolean(const char* section_name, const char* key_name) {
@@ -71,15 +90,21 @@ bool IniAccess::ReadBoolean(const char* section_name, const char* key_name) {
   }
   return false;
 #else
-  return ini_reader_.GetBoolean(section_name, key_name, false);
+  const ConfigurationFile::Entry* entry = Find(section_name, key_name);
+  if (entry == nullptr) return false;
+  std::string value = entry->value;
+  std::transform(value.begin(), value.end(), value.begin(), [](char c) { return static_cast<char>(std::tolower(c)); });
+  return value == "true" || value == "yes" || value == "on" || value == "1";
 #endif
 }
 
 void IniAccess::ReadDoubleArray(const char* section_name, const char* key_name, const int id, const int num, double* data) {
+  std::string edited_key_name = std::string(key_name) + std::to_string(id) + "(";
+  const size_t prefix_length = edited_key_name.size();
   for (int i = 0; i < num; i++) {
-    std::stringstream edited_key_name;
-    edited_key_name << key_name << id << "(" << i << ")";
-    data[i] = ReadDouble(section_name, edited_key_name.str().c_str());
+    edited_key_name.resize(prefix_length);
+    edited_key_name += std::to_string(i) + ")";
+    data[i] = ReadDouble(section_name, edited_key_name.c_str());
   }
 }
 
@@ -88,16 +113,14 @@ void IniAccess::ReadQuaternion(const char* section_name, const char* key_name, l
   double norm = 0.0;
 
   for (int i = 0; i < 4; i++) {  // Read Quaternion as new format
-    std::stringstream edited_key_name;
-    edited_key_name << key_name << "_(" << i << ")";
-    temp[i] = ReadDouble(section_name, edited_key_name.str().c_str());
+    const std::string edited_key_name = std::string(key_name) + "_(" + std::to_string(i) + ")";
+    temp[i] = ReadOptionalDouble(section_name, edited_key_name);
     norm += temp[i] * temp[i];
   }
   if (norm == 0.0) {  // If it is not new format, try to read old format
     for (int i = 0; i < 4; i++) {
-      std::stringstream edited_key_name;
-      edited_key_name << key_name << "(" << i << ")";
-      data[i] = ReadDouble(section_name, edited_key_name.str().c_str());
+      const std::string edited_key_name = std::string(key_name) + "(" + std::to_string(i) + ")";
+      data[i] = ReadDouble(section_name, edited_key_name.c_str());
     }
   } else {
     data[0] = temp[0];
@@ -122,8 +145,9 @@ std::string IniAccess::ReadString(const char* section_name, const char* key_name
   ReadChar(section_name, key_name, kMaxCharLength, temp);
   return std::string(temp);
 #else
-  std::string value = ini_reader_.GetString(section_name, key_name, "NULL");
-  return value;
+  const ConfigurationFile::Entry* entry = Find(section_name, key_name);
+  if (entry == nullptr || entry->value.empty()) return "NULL";
+  return entry->value;
 #endif
 }
 
@@ -136,23 +160,29 @@ bool IniAccess::ReadEnable(const char* section_name, const char* key_name) {
 
 std::vector<std::string> IniAccess::ReadStrVector(const char* section_name, const char* key_name) {
   std::vector<std::string> data;
+#ifdef WIN32
   char temp[kMaxCharLength];
   unsigned int i = 0;
   while (true) {
     std::stringstream c_name;
     c_name << key_name << "(" << i << ")";
     ReadChar(section_name, c_name.str().c_str(), kMaxCharLength, temp);
-#ifdef WIN32
     if (temp[0] == NULL) {
-#else
-    if (!strcmp(temp, "NULL")) {
-#endif
       break;
     } else {
       data.push_back(temp);
       i++;
     }
   }
+#else
+  // The end of the list is not a missing key
+  for (unsigned int i = 0;; i++) {
+    const std::string element_key_name = std::string(key_name) + "(" + std::to_string(i) + ")";
+    const ConfigurationFile::Entry* entry = Find(section_name, element_key_name, false);
+    if (entry == nullptr || entry->value.empty() || entry->value == "NULL") break;
+    data.push_back(entry->value.substr(0, kMaxCharLength - 1));
+  }
+#endif
   return data;
 }
 
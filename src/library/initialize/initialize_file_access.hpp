@@ -13,7 +13,7 @@
 #include <tchar.h>
 #include <windows.h>
 #else
-#include <library/external/inih/cpp/INIReader.h>
+#include "configuration_database.hpp"
 #endif
 
 #include <fstream>
@@ -163,16 +163,36 @@ class IniAccess {
   char file_path_char_[kMaxCharLength];  //!< File path in char
   char text_buffer_[kMaxCharLength];     //!< buffer
 #ifndef WIN32
-  INIReader ini_reader_;  //!< ini ini_reader_
+  const ConfigurationFile* configuration_file_ = nullptr;  //!< Parsed ini file shared in the process (nullptr for CSV files)
+
+  /**
+   * @fn Find
+   * @brief Find the value in the parsed ini file
+   * @param[in] section_name: Section name
+   * @param[in] key_name: Key name
+   * @param[in] records_missing: Record the key as missing in the configuration report when it is not found
+   * @return Value, or nullptr when the key is not found
+   */
+  const ConfigurationFile::Entry* Find(const char* section_name, const std::string& key_name, const bool records_missing = true) const;
 #endif
+  /**
+   * @fn ReadOptionalDouble
+   * @brief Read a scalar number as double type without recording the key as missing. Used to try the alternative key names.
+   * @param[in] section_name: Section name
+   * @param[in] key_name: Key name
+   * @return Read number, or 0 when the key is not found
+   */
+  double ReadOptionalDouble(const char* section_name, const std::string& key_name);
 };
 
 template <size_t NumElement>
 void IniAccess::ReadVector(const char* section_name, const char* key_name, libra::Vector<NumElement>& data) {
+  std::string element_key_name = std::string(key_name) + "(";
+  const size_t prefix_length = element_key_name.size();
   for (size_t i = 0; i < NumElement; i++) {
-    std::stringstream c_name;
-    c_name << key_name << "(" << i << ")";
-    data[i] = ReadDouble(section_name, c_name.str().c_str());
+    element_key_name.resize(prefix_length);
+    element_key_name += std::to_string(i) + ")";
+    data[i] = ReadDouble(section_name, element_key_name.c_str());
   }
 }
 
@@ -0,0 +1,117 @@
+/**
+ * @file test_configuration_database.cpp
+ * @brief Test codes for ConfigurationDatabase class and IniAccess with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "configuration_database.hpp"
+#include "initialize_file_access.hpp"
+
+/**
+ * @brief Write the test ini file
+ */
+static void WriteTestFile(const std::string& file_path) {
+  std::ofstream file(file_path);
+  file << "[SECTION]\n";
+  file << "double_value = 1.5e3\n";
+  file << "Integer_Value = 0x10\n";
+  file << "boolean_value = Yes\n";
+  file << "enable_value = ENABLE\n";
+  file << "string_value = s2e\n";
+  file << "vector(0) = 1.0\n";
+  file << "vector(1) = 2.0\n";
+  file << "vector(2) = 3.0\n";
+  file << "array2(0) = 4.0\n";
+  file << "array2(1) = 5.0\n";
+  file << "list(0) = first\n";
+  file << "list(1) = second\n";
+  file << "quaternion(0) = 0.5\n";
+  file << "quaternion(1) = 0.5\n";
+  file << "quaternion(2) = 0.5\n";
+  file << "quaternion(3) = 0.5\n";
+  file << "unused_value = 0\n";
+}
+
+/**
+ * @brief Test the values read through IniAccess
+ */
+TEST(ConfigurationDatabase, Read) {
+  const std::string file_path = "test_configuration_database_read.ini";
+  WriteTestFile(file_path);
+  IniAccess ini_access(file_path);
+
+  EXPECT_DOUBLE_EQ(1.5e3, ini_access.ReadDouble("SECTION", "double_value"));
+  EXPECT_EQ(16, ini_access.ReadInt("section", "integer_value"));  // Case-insensitive
+  EXPECT_TRUE(ini_access.ReadBoolean("SECTION", "boolean_value"));
+  EXPECT_TRUE(ini_access.ReadEnable("SECTION", "enable_value"));
+  EXPECT_EQ("s2e", ini_access.ReadString("SECTION", "string_value"));
+
+  libra::Vector<3> vector;
+  ini_access.ReadVector("SECTION", "vector", vector);
+  for (size_t i = 0; i < 3; i++) EXPECT_DOUBLE_EQ(i + 1.0, vector[i]);
+  double array[2];
+  ini_access.ReadDoubleArray("SECTION", "array", 2, 2, array);
+  EXPECT_DOUBLE_EQ(4.0, array[0]);
+  EXPECT_DOUBLE_EQ(5.0, array[1]);
+  std::vector<std::string> list = ini_access.ReadStrVector("SECTION", "list");
+  ASSERT_EQ(2u, list.size());
+  EXPECT_EQ("second", list[1]);
+  libra::Quaternion quaternion;
+  ini_access.ReadQuaternion("SECTION", "quaternion", quaternion);
+  for (size_t i = 0; i < 4; i++) EXPECT_DOUBLE_EQ(0.5, quaternion[i]);
+
+  // Missing keys
+  EXPECT_DOUBLE_EQ(0.0, ini_access.ReadDouble("SECTION", "missing_value"));
+  EXPECT_EQ(0, ini_access.ReadInt("SECTION", "string_value"));
+  EXPECT_EQ("NULL", ini_access.ReadString("OTHER_SECTION", "string_value"));
+
+  configuration_database.Clear();
+  std::remove(file_path.c_str());
+}
+
+/**
+ * @brief Test that the file is parsed only once and the report lists the missing and unused keys
+ */
+TEST(ConfigurationDatabase, ParseOnceAndReport) {
+  const std::string file_path = "test_configuration_database_report.ini";
+  WriteTestFile(file_path);
+  configuration_database.Clear();
+  const ConfigurationFile& file = configuration_database.GetFile(file_path);
+  EXPECT_EQ(0, file.GetParseError());
+
+  {
+    IniAccess ini_access(file_path);
+    ini_access.ReadDouble("SECTION", "double_value");
+  }
+  // The modification is not visible until the database is cleared
+  std::remove(file_path.c_str());
+  EXPECT_EQ(&file, &configuration_database.GetFile(file_path));
+  IniAccess ini_access(file_path);
+  EXPECT_EQ(16, ini_access.ReadInt("SECTION", "integer_value"));
+  ini_access.ReadString("SECTION", "missing_value");
+  libra::Quaternion quaternion;
+  ini_access.ReadQuaternion("SECTION", "quaternion", quaternion);  // The new format keys are not reported
+  ini_access.ReadStrVector("SECTION", "list");                     // The end of the list is not reported
+
+  std::stringstream report;
+  const size_t number_of_reported_keys = configuration_database.PrintReport(report);
+  const std::string report_string = report.str();
+  EXPECT_NE(std::string::npos, report_string.find("missing: " + file_path + ": SECTION.missing_value"));
+  EXPECT_NE(std::string::npos, report_string.find("unused: " + file_path + ": SECTION.unused_value"));
+  EXPECT_EQ(std::string::npos, report_string.find("double_value"));
+  EXPECT_EQ(std::string::npos, report_string.find("quaternion"));
+  EXPECT_EQ(std::string::npos, report_string.find("list"));
+  // missing_value, boolean_value, enable_value, string_value, vector(0-2), array2(0-1), and unused_value
+  EXPECT_EQ(10u, number_of_reported_keys);
+
+  configuration_database.Clear();
+  EXPECT_THROW(IniAccess missing_ini_access(file_path), std::runtime_error);
+  EXPECT_EQ(-1, configuration_database.GetFile(file_path).GetParseError());
+  configuration_database.Clear();
+}
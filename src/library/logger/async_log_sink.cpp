@@ -0,0 +1,79 @@
+/**
+ * @file async_log_sink.cpp
+ * @brief Log output destination which writes rows with a dedicated writer thread
+ */
+
+#include "async_log_sink.hpp"
+
+#include <iostream>
+
+AsyncLogSink::AsyncLogSink(ILogSink* sink, const size_t buffer_size, const AsyncLogOverflowPolicy overflow_policy)
+    : sink_(sink), overflow_policy_(overflow_policy), ring_(buffer_size > 0 ? buffer_size : 1) {
+  writer_thread_ = std::thread(&AsyncLogSink::WriterLoop, this);
+}
+
+AsyncLogSink::~AsyncLogSink() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stop_requested_ = true;
+  }
+  row_available_.notify_one();
+  writer_thread_.join();
+  sink_->Flush();
+  if (number_of_dropped_rows_ > 0) {
+    std::cerr << "Warning: " << number_of_dropped_rows_ << " log rows are dropped by the asynchronous log output" << std::endl;
+  }
+  delete sink_;
+}
+
+void AsyncLogSink::WriteHeader(const std::vector<std::string>& column_names) {
+  Flush();
+  sink_->WriteHeader(column_names);
+}
+
+void AsyncLogSink::WriteRow(const LogValueBuffer& row) {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (count_ >= ring_.size()) {
+      if (overflow_policy_ == AsyncLogOverflowPolicy::kDrop) {
+        number_of_dropped_rows_++;
+        return;
+      }
+      buffer_available_.wait(lock, [this] { return count_ < ring_.size(); });
+    }
+  }
+  // The buffer at head_ is not accessed by the writer thread until count_ is incremented
+  ring_[head_] = row;
+  head_ = (head_ + 1) % ring_.size();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    count_++;
+  }
+  row_available_.notify_one();
+}
+
+void AsyncLogSink::Flush() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    buffer_available_.wait(lock, [this] { return count_ == 0; });
+  }
+  sink_->Flush();
+}
+
+void AsyncLogSink::WriterLoop() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      row_available_.wait(lock, [this] { return count_ > 0 || is_stop_requested_; });
+      if (count_ == 0) return;  // Stop requested and all rows are written
+    }
+    // The buffer at tail_ is not modified by the main thread until count_ is decremented
+    sink_->WriteRow(ring_[tail_]);
+    tail_ = (tail_ + 1) % ring_.size();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      count_--;
+    }
+    buffer_available_.notify_all();
+  }
+}
@@ -0,0 +1,80 @@
+/**
+ * @file async_log_sink.hpp
+ * @brief Log output destination which writes rows with a dedicated writer thread
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_ASYNC_LOG_SINK_HPP_
+#define S2E_LIBRARY_LOGGER_ASYNC_LOG_SINK_HPP_
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "log_sink.hpp"
+
+/**
+ * @enum AsyncLogOverflowPolicy
+ * @brief Behavior when all row buffers are waiting to be written
+ */
+enum class AsyncLogOverflowPolicy {
+  kBlock = 0,  //!< Wait until the writer thread releases a buffer
+  kDrop,       //!< Drop the row and count the number of dropped rows
+};
+
+/**
+ * @class AsyncLogSink
+ * @brief Log output destination which writes rows with a dedicated writer thread
+ * @details The main thread copies each row into a ring of preallocated row buffers, and the writer thread passes them to the
+ *          wrapped sink. The file access and the string formatting of the wrapped sink are executed in the writer thread.
+ */
+class AsyncLogSink : public ILogSink {
+ public:
+  /**
+   * @fn AsyncLogSink
+   * @brief Constructor
+   * @param [in] sink: Wrapped log sink. The ownership is moved to this class.
+   * @param [in] buffer_size: Number of row buffers in the ring
+   * @param [in] overflow_policy: Behavior when all row buffers are used
+   */
+  AsyncLogSink(ILogSink* sink, const size_t buffer_size, const AsyncLogOverflowPolicy overflow_policy);
+  /**
+   * @fn ~AsyncLogSink
+   * @brief Destructor: Write all remaining rows and stop the writer thread
+   */
+  ~AsyncLogSink();
+
+  // Override ILogSink
+  bool IsOpened() const override { return sink_->IsOpened(); }
+  void WriteHeader(const std::vector<std::string>& column_names) override;
+  void WriteRow(const LogValueBuffer& row) override;
+  void Flush() override;
+
+  /**
+   * @fn GetNumberOfDroppedRows
+   * @brief Return number of dropped rows with the kDrop policy
+   */
+  inline size_t GetNumberOfDroppedRows() const { return number_of_dropped_rows_; }
+
+ private:
+  ILogSink* sink_;                            //!< Wrapped log sink
+  AsyncLogOverflowPolicy overflow_policy_;    //!< Behavior when all row buffers are used
+  std::vector<LogValueBuffer> ring_;          //!< Ring of row buffers
+  size_t head_ = 0;                           //!< Index of the next buffer to store a row
+  size_t tail_ = 0;                           //!< Index of the next buffer to write
+  size_t count_ = 0;                          //!< Number of buffers waiting to be written
+  size_t number_of_dropped_rows_ = 0;         //!< Number of dropped rows
+  bool is_stop_requested_ = false;            //!< Stop request for the writer thread
+  std::mutex mutex_;                          //!< Mutex for the ring indices
+  std::condition_variable buffer_available_;  //!< Notified when a buffer is released by the writer thread
+  std::condition_variable row_available_;     //!< Notified when a row is stored by the main thread
+  std::thread writer_thread_;                 //!< Writer thread
+
+  /**
+   * @fn WriterLoop
+   * @brief Main routine of the writer thread
+   */
+  void WriterLoop();
+};
+
+#endif  // S2E_LIBRARY_LOGGER_ASYNC_LOG_SINK_HPP_
@@ -0,0 +1,86 @@
+/**
+ * @file binary_log_sink.cpp
+ * @brief Log output destination writing a chunked columnar binary file
+ */
+
+#include "binary_log_sink.hpp"
+
+#include <cmath>
+#include <iostream>
+
+BinaryLogSink::BinaryLogSink(const std::string& file_path, const size_t chunk_size_rows)
+    : chunk_size_rows_(chunk_size_rows > 0 ? chunk_size_rows : 1) {
+  file_.open(file_path, std::ios::out | std::ios::binary);
+  if (!file_.is_open()) std::cerr << "Error opening log file: " << file_path << std::endl;
+}
+
+BinaryLogSink::~BinaryLogSink() {
+  Flush();
+  if (!is_schema_written_) WriteSchema();
+  if (file_.is_open()) file_.close();
+}
+
+void BinaryLogSink::WriteHeader(const std::vector<std::string>& column_names) {
+  column_names_ = column_names;
+  column_types_.assign(column_names_.size(), LogValueType::kReal);
+  chunk_.assign(column_names_.size() * chunk_size_rows_, 0.0);
+  number_of_rows_ = 0;
+}
+
+void BinaryLogSink::WriteRow(const LogValueBuffer& text_row) {
+  // Parse the texts pushed by the loggables without PushLogValue override
+  expanded_row_.ExpandTexts(text_row);
+  const LogValueBuffer& row = expanded_row_;
+
+  const size_t number_of_columns = column_names_.size();
+  if (row.GetSize() != number_of_columns && !is_size_warned_) {
+    std::cerr << "Warning: number of log values (" << row.GetSize() << ") does not match the number of log headers (" << number_of_columns
+              << ")" << std::endl;
+    is_size_warned_ = true;
+  }
+  if (!is_schema_written_ && number_of_rows_ == 0) {
+    for (size_t i = 0; i < number_of_columns && i < row.GetSize(); i++) column_types_[i] = row.GetTypes()[i];
+  }
+
+  const std::vector<double>& values = row.GetValues();
+  for (size_t i = 0; i < number_of_columns; i++) {
+    chunk_[i * chunk_size_rows_ + number_of_rows_] = (i < values.size()) ? values[i] : NAN;
+  }
+  number_of_rows_++;
+  if (number_of_rows_ >= chunk_size_rows_) Flush();
+}
+
+void BinaryLogSink::Flush() {
+  if (!file_.is_open() || number_of_rows_ == 0) return;
+  if (!is_schema_written_) WriteSchema();
+
+  const uint32_t number_of_rows = (uint32_t)number_of_rows_;
+  file_.write(reinterpret_cast<const char*>(&number_of_rows), sizeof(number_of_rows));
+  for (size_t i = 0; i < column_names_.size(); i++) {
+    file_.write(reinterpret_cast<const char*>(&chunk_[i * chunk_size_rows_]), sizeof(double) * number_of_rows_);
+  }
+  file_.flush();
+  number_of_rows_ = 0;
+}
+
+void BinaryLogSink::WriteSchema() {
+  if (!file_.is_open()) return;
+
+  const char magic[8] = {'S', '2', 'E', 'B', 'L', 'O', 'G', '\0'};
+  const uint32_t version = kFormatVersion;
+  const uint32_t number_of_columns = (uint32_t)column_names_.size();
+  const uint32_t chunk_size_rows = (uint32_t)chunk_size_rows_;
+  file_.write(magic, sizeof(magic));
+  file_.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  file_.write(reinterpret_cast<const char*>(&number_of_columns), sizeof(number_of_columns));
+  file_.write(reinterpret_cast<const char*>(&chunk_size_rows), sizeof(chunk_size_rows));
+
+  for (size_t i = 0; i < column_names_.size(); i++) {
+    const uint8_t type = (uint8_t)column_types_[i];
+    const uint32_t name_length = (uint32_t)column_names_[i].size();
+    file_.write(reinterpret_cast<const char*>(&type), sizeof(type));
+    file_.write(reinterpret_cast<const char*>(&name_length), sizeof(name_length));
+    file_.write(column_names_[i].c_str(), name_length);
+  }
+  is_schema_written_ = true;
+}
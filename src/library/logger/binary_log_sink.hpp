@@ -0,0 +1,66 @@
+/**
+ * @file binary_log_sink.hpp
+ * @brief Log output destination writing a chunked columnar binary file
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_BINARY_LOG_SINK_HPP_
+#define S2E_LIBRARY_LOGGER_BINARY_LOG_SINK_HPP_
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "log_sink.hpp"
+
+/**
+ * @class BinaryLogSink
+ * @brief Log output destination writing a chunked columnar binary file
+ * @details File layout (native byte order, little endian on all supported platforms)
+ *          - File header: magic "S2EBLOG" + '\0' (8 bytes), version (uint32), number of columns (uint32), maximum rows per chunk (uint32)
+ *          - Schema: for each column, type (uint8, LogValueType), name length (uint32), name (char array without '\0')
+ *          - Chunks: number of rows N (uint32), then N float64 values of the first column, N values of the second column, ...
+ *          The schema is written together with the first chunk since the value types are decided by the first row.
+ *          Use scripts/Plot/convert_binary_log_to_csv.py to convert the file into the CSV format.
+ */
+class BinaryLogSink : public ILogSink {
+ public:
+  /**
+   * @fn BinaryLogSink
+   * @brief Constructor
+   * @param [in] file_path: Path to the output file
+   * @param [in] chunk_size_rows: Maximum number of rows stored in a chunk
+   */
+  BinaryLogSink(const std::string& file_path, const size_t chunk_size_rows = 1024);
+  /**
+   * @fn ~BinaryLogSink
+   * @brief Destructor
+   */
+  ~BinaryLogSink();
+
+  // Override ILogSink
+  bool IsOpened() const override { return file_.is_open(); }
+  void WriteHeader(const std::vector<std::string>& column_names) override;
+  void WriteRow(const LogValueBuffer& row) override;
+  void Flush() override;
+
+  static const uint32_t kFormatVersion = 1;  //!< Version of the file format
+
+ private:
+  std::ofstream file_;                      //!< Output file
+  size_t chunk_size_rows_;                  //!< Maximum number of rows stored in a chunk
+  std::vector<std::string> column_names_;   //!< Column names
+  std::vector<LogValueType> column_types_;  //!< Column types
+  std::vector<double> chunk_;               //!< Column major buffer of the current chunk
+  size_t number_of_rows_ = 0;               //!< Number of rows in the current chunk
+  bool is_schema_written_ = false;          //!< Is the file header and schema written?
+  bool is_size_warned_ = false;             //!< Is the column size mismatch warned?
+  LogValueBuffer expanded_row_;             //!< Row buffer after parsing the texts
+
+  /**
+   * @fn WriteSchema
+   * @brief Write the file header and the schema
+   */
+  void WriteSchema();
+};
+
+#endif  // S2E_LIBRARY_LOGGER_BINARY_LOG_SINK_HPP_
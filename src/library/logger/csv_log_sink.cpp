@@ -0,0 +1,68 @@
+/**
+ * @file csv_log_sink.cpp
+ * @brief Log output destination writing a CSV file from typed log values
+ */
+
+#include "csv_log_sink.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+
+CsvLogSink::CsvLogSink(const std::string& file_path, const int precision) : precision_(precision) {
+  file_.open(file_path);
+  if (!file_.is_open()) std::cerr << "Error opening log file: " << file_path << std::endl;
+}
+
+CsvLogSink::~CsvLogSink() {
+  if (file_.is_open()) file_.close();
+}
+
+void CsvLogSink::WriteHeader(const std::vector<std::string>& column_names) {
+  line_.clear();
+  for (size_t i = 0; i < column_names.size(); i++) {
+    line_ += column_names[i];
+    line_ += ',';
+  }
+  line_ += '\n';
+  file_ << line_;
+}
+
+void CsvLogSink::WriteRow(const LogValueBuffer& row) {
+  const size_t kSize = 64;
+  char value_string[kSize];
+
+  line_.clear();
+  for (size_t i = 0; i < row.GetSize(); i++) {
+    const double value = row.GetValues()[i];
+    if (row.GetTypes()[i] == LogValueType::kText) {
+      // The text is already formatted by GetLogValue
+      row.AppendText((size_t)value, line_);
+      continue;
+    } else if (row.GetTypes()[i] == LogValueType::kDateTime) {
+      // Convert elapsed days from 2000/01/01 to the calendar date
+      const double days = floor(value / 86400.0);
+      const double second_of_day = value - days * 86400.0;
+      const int z = (int)days + 730425;
+      const int era = (z >= 0 ? z : z - 146096) / 146097;
+      const int day_of_era = z - era * 146097;
+      const int year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+      const int day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+      const int mp = (5 * day_of_year + 2) / 153;
+      const int day = day_of_year - (153 * mp + 2) / 5 + 1;
+      const int month = mp < 10 ? mp + 3 : mp - 9;
+      const int year = year_of_era + era * 400 + (month <= 2 ? 1 : 0);
+      const int hour = (int)(second_of_day / 3600.0);
+      const int minute = (int)((second_of_day - hour * 3600.0) / 60.0);
+      const double second = second_of_day - hour * 3600.0 - minute * 60.0;
+      snprintf(value_string, kSize, "%4d/%02d/%02d %02d:%02d:%.3lf,", year, month, day, hour, minute, second);
+    } else {
+      snprintf(value_string, kSize, "%.*g,", precision_, value);
+    }
+    line_ += value_string;
+  }
+  line_ += '\n';
+  file_ << line_;
+}
+
+void CsvLogSink::Flush() { file_.flush(); }
@@ -0,0 +1,47 @@
+/**
+ * @file csv_log_sink.hpp
+ * @brief Log output destination writing a CSV file from typed log values
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_CSV_LOG_SINK_HPP_
+#define S2E_LIBRARY_LOGGER_CSV_LOG_SINK_HPP_
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "log_sink.hpp"
+
+/**
+ * @class CsvLogSink
+ * @brief Log output destination writing a CSV file from typed log values
+ * @note The layout is same with the CSV file written by Logger, but all real values are written with the same precision.
+ */
+class CsvLogSink : public ILogSink {
+ public:
+  /**
+   * @fn CsvLogSink
+   * @brief Constructor
+   * @param [in] file_path: Path to the output file
+   * @param [in] precision: Number of significant digits of real values
+   */
+  CsvLogSink(const std::string& file_path, const int precision = 16);
+  /**
+   * @fn ~CsvLogSink
+   * @brief Destructor
+   */
+  ~CsvLogSink();
+
+  // Override ILogSink
+  bool IsOpened() const override { return file_.is_open(); }
+  void WriteHeader(const std::vector<std::string>& column_names) override;
+  void WriteRow(const LogValueBuffer& row) override;
+  void Flush() override;
+
+ private:
+  std::ofstream file_;  //!< Output file
+  int precision_;       //!< Number of significant digits of real values
+  std::string line_;    //!< Line buffer
+};
+
+#endif  // S2E_LIBRARY_LOGGER_CSV_LOG_SINK_HPP_
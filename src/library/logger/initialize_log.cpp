@@ -5,15 +5,17 @@
 
 #include "initialize_log.hpp"
 
-#include <library/initialize/initialize_file_access.hpp>
+#include <iostream>
 
 Logger* InitLog(std::string file_name) {
   IniAccess ini_file(file_name);
 
   std::string log_file_path = ini_file.ReadString("SIMULATION_SETTINGS", "log_file_save_directory");
   bool log_ini = ini_file.ReadEnable("SIMULATION_SETTINGS", "save_initialize_files");
+  LogFileFormat file_format = ReadLogFileFormat(ini_file);
 
-  Logger* log = new Logger("default.csv", log_file_path, file_name, log_ini, true);
+  Logger* log = new Logger("default" + GetLogFileExtension(file_format), log_file_path, file_name, log_ini, true, file_format);
+  InitAsyncLogOutput(ini_file, *log);
 
   return log;
 }
@@ -28,3 +30,37 @@ Logger* InitMonteCarloLog(std::string file_name, bool enable) {
 
   return log;
 }
+
+LogFileFormat ReadLogFileFormat(IniAccess& ini_file) {
+  std::string file_format = ini_file.ReadString("SIMULATION_SETTINGS", "log_file_format");
+
+  if (file_format == "BINARY") {
+    return LogFileFormat::kBinary;
+  } else if (file_format != "CSV" && file_format != "" && file_format != "NULL") {
+    std::cerr << "WARNING: log file format: " << file_format << " is not defined! CSV is used." << std::endl;
+  }
+  return LogFileFormat::kCsv;
+}
+
+void InitAsyncLogOutput(IniAccess& ini_file, Logger& logger) {
+  const char* section = "SIMULATION_SETTINGS";
+  if (!ini_file.ReadEnable(section, "log_async_output")) return;
+
+  int buffer_size = ini_file.ReadInt(section, "log_async_buffer_size");
+  if (buffer_size <= 0) buffer_size = 1024;
+
+  AsyncLogOverflowPolicy overflow_policy = AsyncLogOverflowPolicy::kBlock;
+  std::string policy = ini_file.ReadString(section, "log_async_overflow_policy");
+  if (policy == "DROP") {
+    overflow_policy = AsyncLogOverflowPolicy::kDrop;
+  } else if (policy != "BLOCK") {
+    std::cerr << "WARNING: log async overflow policy: " << policy << " is not defined! BLOCK is used." << std::endl;
+  }
+
+  logger.EnableAsyncOutput((size_t)buffer_size, overflow_policy);
+}
+
+std::string GetLogFileExtension(const LogFileFormat file_format) {
+  if (file_format == LogFileFormat::kBinary) return ".bin";
+  return ".csv";
+}
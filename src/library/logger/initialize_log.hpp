@@ -6,6 +6,7 @@
 #ifndef S2E_LIBRARY_LOGGER_INITIALIZE_LOG_HPP_
 #define S2E_LIBRARY_LOGGER_INITIALIZE_LOG_HPP_
 
+#include <library/initialize/initialize_file_access.hpp>
 #include <library/logger/logger.hpp>
 
 /**
@@ -23,4 +24,27 @@ Logger* InitLog(std::string file_name);
  */
 Logger* InitMonteCarloLog(std::string file_name, bool enable);
 
+/**
+ * @fn ReadLogFileFormat
+ * @brief Read the log file format setting (CSV or BINARY) in the SIMULATION_SETTINGS section
+ * @param [in] ini_file: Initialize file of the simulation base
+ * @return Log file format (CSV when the setting is not found)
+ */
+LogFileFormat ReadLogFileFormat(IniAccess& ini_file);
+
+/**
+ * @fn InitAsyncLogOutput
+ * @brief Enable the asynchronous log output when it is set in the SIMULATION_SETTINGS section
+ * @param [in] ini_file: Initialize file of the simulation base
+ * @param [in/out] logger: Target logger
+ */
+void InitAsyncLogOutput(IniAccess& ini_file, Logger& logger);
+
+/**
+ * @fn GetLogFileExtension
+ * @brief Return the file extension for the log file format
+ * @param [in] file_format: Log file format
+ */
+std::string GetLogFileExtension(const LogFileFormat file_format);
+
 #endif  // S2E_LIBRARY_LOGGER_INITIALIZE_LOG_HPP_
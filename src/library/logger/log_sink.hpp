@@ -0,0 +1,50 @@
+/**
+ * @file log_sink.hpp
+ * @brief Interface class of log output destinations for typed log values
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_LOG_SINK_HPP_
+#define S2E_LIBRARY_LOGGER_LOG_SINK_HPP_
+
+#include <string>
+#include <vector>
+
+#include "log_value_buffer.hpp"
+
+/**
+ * @class ILogSink
+ * @brief Interface class of log output destinations for typed log values
+ */
+class ILogSink {
+ public:
+  /**
+   * @fn ~ILogSink
+   * @brief Destructor
+   */
+  virtual ~ILogSink() {}
+
+  /**
+   * @fn IsOpened
+   * @brief Return true when the output destination is available
+   */
+  virtual bool IsOpened() const = 0;
+  /**
+   * @fn WriteHeader
+   * @brief Set the column names of the log
+   * @param [in] column_names: Column names generated from the log headers
+   */
+  virtual void WriteHeader(const std::vector<std::string>& column_names) = 0;
+  /**
+   * @fn WriteRow
+   * @brief Write a row of the log
+   * @param [in] row: Values of the row
+   */
+  virtual void WriteRow(const LogValueBuffer& row) = 0;
+  /**
+   * @fn Flush
+   * @brief Write all buffered rows to the output destination
+   */
+  virtual void Flush() = 0;
+};
+
+#endif  // S2E_LIBRARY_LOGGER_LOG_SINK_HPP_
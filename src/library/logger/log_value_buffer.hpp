@@ -0,0 +1,209 @@
+/**
+ * @file log_value_buffer.hpp
+ * @brief Buffer to store typed log values of a row without string formatting
+ */
+
+#ifndef S2E_LIBRARY_LOGGER_LOG_VALUE_BUFFER_HPP_
+#define S2E_LIBRARY_LOGGER_LOG_VALUE_BUFFER_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <library/math/matrix.hpp>
+#include <library/math/quaternion.hpp>
+#include <library/math/vector.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @enum LogValueType
+ * @brief Type of log value stored as double
+ */
+enum class LogValueType : uint8_t {
+  kReal = 0,      //!< Real value
+  kDateTime = 1,  //!< UTC date time expressed as elapsed seconds from 2000/01/01 00:00:00 UTC
+  kText = 2,      //!< Comma separated values formatted by GetLogValue. The value is the index of the text.
+};
+
+/**
+ * @class LogValueBuffer
+ * @brief Buffer to store typed log values of a row without string formatting
+ * @note The memory is kept between rows, so no allocation happens after the first row.
+ */
+class LogValueBuffer {
+ public:
+  /**
+   * @fn Clear
+   * @brief Clear the values with keeping the allocated memory
+   */
+  inline void Clear() {
+    values_.clear();
+    types_.clear();
+    text_.clear();
+    text_ends_.clear();
+  }
+
+  /**
+   * @fn Push
+   * @brief Push scalar value
+   * @param [in] value: Scalar value
+   */
+  inline void Push(const double value) {
+    values_.push_back(value);
+    types_.push_back(LogValueType::kReal);
+  }
+  /**
+   * @fn Push
+   * @brief Push vector value
+   * @param [in] vector: Vector value
+   */
+  template <size_t N>
+  inline void Push(const libra::Vector<N, double>& vector) {
+    for (size_t i = 0; i < N; i++) Push(vector[i]);
+  }
+  /**
+   * @fn Push
+   * @brief Push matrix value with row major order
+   * @param [in] matrix: Matrix value
+   */
+  template <size_t R, size_t C>
+  inline void Push(const libra::Matrix<R, C, double>& matrix) {
+    for (size_t i = 0; i < R; i++) {
+      for (size_t j = 0; j < C; j++) Push(matrix[i][j]);
+    }
+  }
+  /**
+   * @fn Push
+   * @brief Push quaternion value with the order of x, y, z, w
+   * @param [in] quaternion: Quaternion value
+   */
+  inline void Push(const libra::Quaternion& quaternion) {
+    for (size_t i = 0; i < 4; i++) Push(quaternion[i]);
+  }
+  /**
+   * @fn PushDateTime
+   * @brief Push UTC date time
+   * @param [in] year: Year
+   * @param [in] month: Month
+   * @param [in] day: Day
+   * @param [in] hour: Hour
+   * @param [in] minute: Minute
+   * @param [in] second: Second
+   */
+  inline void PushDateTime(const int year, const int month, const int day, const int hour, const int minute, const double second) {
+    // Days from 2000/01/01 with the proleptic Gregorian calendar
+    const int y = (month <= 2) ? year - 1 : year;
+    const int era = (y >= 0 ? y : y - 399) / 400;
+    const int year_of_era = y - era * 400;
+    const int day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    const int days_from_2000 = era * 146097 + day_of_era - 730425;
+
+    values_.push_back(days_from_2000 * 86400.0 + hour * 3600.0 + minute * 60.0 + second);
+    types_.push_back(LogValueType::kDateTime);
+  }
+
+  /**
+   * @fn PushText
+   * @brief Push comma separated values formatted by GetLogValue without parsing
+   * @note The text is parsed by the log sink with PushParsedText, so the parsing runs on the writer thread of the asynchronous output.
+   * @param [in] text: Comma separated values
+   */
+  inline void PushText(const std::string& text) {
+    values_.push_back((double)text_ends_.size());
+    types_.push_back(LogValueType::kText);
+    text_ += text;
+    text_ends_.push_back(text_.size());
+  }
+  /**
+   * @fn PushParsedText
+   * @brief Parse comma separated values formatted by GetLogValue and push them as typed values
+   * @param [in] text: Comma separated values
+   * @param [in] begin: Begin position of the values in the text
+   * @param [in] end: End position of the values in the text
+   */
+  inline void PushParsedText(const std::string& text, const size_t begin, const size_t end) {
+    size_t start = begin;
+    while (start < end) {
+      size_t value_end = text.find(',', start);
+      if (value_end == std::string::npos || value_end > end) value_end = end;
+      value_string_.assign(text, start, value_end - start);
+      start = value_end + 1;
+
+      char* parse_end = nullptr;
+      const double number = strtod(value_string_.c_str(), &parse_end);
+      if (!value_string_.empty() && *parse_end == '\0') {
+        Push(number);
+        continue;
+      }
+      int year, month, day, hour, minute;
+      double second;
+      if (sscanf(value_string_.c_str(), "%d/%d/%d %d:%d:%lf", &year, &month, &day, &hour, &minute, &second) == 6) {
+        PushDateTime(year, month, day, hour, minute, second);
+      } else {
+        Push(NAN);
+      }
+    }
+  }
+  /**
+   * @fn ExpandTexts
+   * @brief Copy the values of the other buffer with parsing the texts
+   * @param [in] row: Buffer which may include texts
+   */
+  inline void ExpandTexts(const LogValueBuffer& row) {
+    Clear();
+    for (size_t i = 0; i < row.GetSize(); i++) {
+      if (row.types_[i] == LogValueType::kText) {
+        const size_t index = (size_t)row.values_[i];
+        PushParsedText(row.text_, row.GetTextBegin(index), row.text_ends_[index]);
+      } else {
+        values_.push_back(row.values_[i]);
+        types_.push_back(row.types_[i]);
+      }
+    }
+  }
+
+  // Getter
+  /**
+   * @fn GetSize
+   * @brief Return number of stored values
+   */
+  inline size_t GetSize() const { return values_.size(); }
+  /**
+   * @fn GetValues
+   * @brief Return stored values
+   */
+  inline const std::vector<double>& GetValues() const { return values_; }
+  /**
+   * @fn GetTypes
+   * @brief Return types of the stored values
+   */
+  inline const std::vector<LogValueType>& GetTypes() const { return types_; }
+  /**
+   * @fn AppendText
+   * @brief Append the pushed text to the output string
+   * @param [in] index: Index of the text stored as the value of kText
+   * @param [out] output: Output string
+   */
+  inline void AppendText(const size_t index, std::string& output) const {
+    const size_t begin = GetTextBegin(index);
+    output.append(text_, begin, text_ends_[index] - begin);
+  }
+
+ private:
+  std::vector<double> values_;       //!< Values
+  std::vector<LogValueType> types_;  //!< Types of the values
+  std::string text_;                 //!< Concatenated texts
+  std::vector<size_t> text_ends_;    //!< End position of each text in text_
+  std::string value_string_;         //!< Work buffer to parse a value of the texts
+
+  /**
+   * @fn GetTextBegin
+   * @brief Return begin position of the text in text_
+   * @param [in] index: Index of the text
+   */
+  inline size_t GetTextBegin(const size_t index) const { return (index == 0) ? 0 : text_ends_[index - 1]; }
+};
+
+#endif  // S2E_LIBRARY_LOGGER_LOG_VALUE_BUFFER_HPP_
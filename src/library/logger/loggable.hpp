@@ -9,6 +9,7 @@
 #include <string>
 
 #include "log_utility.hpp"  // This is not necessary but include here for convenience
+#include "log_value_buffer.hpp"
 
 /**
  * @class ILoggable
@@ -31,6 +32,15 @@ class ILoggable {
    */
   virtual std::string GetLogValue() const = 0;
 
+  /**
+   * @fn PushLogValue
+   * @brief Push values as typed numbers for binary log outputs
+   * @note The default implementation pushes the string of GetLogValue, which is parsed by the log sink. Override this to skip the string
+   * formatting.
+   * @param [out] buffer: Buffer to push the values
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const { buffer.PushText(GetLogValue()); }
+
   bool is_log_enabled_ = true;  //!< Log enable flag
 };
 
@@ -5,8 +5,13 @@
 
 #include "logger.hpp"
 
+#include <cerrno>
 #include <ctime>
 #include <sstream>
+
+#include "../utilities/profiler.hpp"
+#include "binary_log_sink.hpp"
+#include "csv_log_sink.hpp"
 #ifdef _WIN32
 #include <direct.h>
 #else
@@ -15,10 +20,11 @@
 
 std::vector<ILoggable *> log_list_;
 bool Logger::is_directory_created_ = false;
+bool Logger::is_directory_shared_ = false;
 
 Logger::Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool is_ini_save_enabled,
-               const bool is_enabled)
-    : is_enabled_(is_enabled), is_ini_save_enabled_(is_ini_save_enabled) {
+               const bool is_enabled, const LogFileFormat file_format)
+    : is_enabled_(is_enabled), is_ini_save_enabled_(is_ini_save_enabled), file_format_(file_format) {
   is_file_opened_ = false;
   if (is_enabled_ == false) return;
 
@@ -30,7 +36,9 @@ Logger::Logger(const std::string &file_name, const std::string &data_path, const
   strftime(start_time_c, 64, "%y%m%d_%H%M%S", now);
 
   // Create directory
-  if (is_ini_save_enabled_ == true || is_directory_created_ == false) {
+  if (is_directory_shared_) {
+    directory_path_ = data_path;
+  } else if (is_ini_save_enabled_ == true || is_directory_created_ == false) {
     directory_path_ = CreateDirectory(data_path, start_time_c);
   } else {
     directory_path_ = data_path;
@@ -38,10 +46,16 @@ Logger::Logger(const std::string &file_name, const std::string &data_path, const
   // Create File
   std::stringstream file_path;
   file_path << directory_path_ << start_time_c << "_" << file_name;
+  file_path_ = file_path.str();
   if (is_enabled_) {
-    csv_file_.open(file_path.str());
-    is_file_opened_ = csv_file_.is_open();
-    if (!is_file_opened_) std::cerr << "Error opening log file: " << file_path.str() << std::endl;
+    if (file_format_ == LogFileFormat::kBinary) {
+      log_sink_ = new BinaryLogSink(file_path_);
+      is_file_opened_ = log_sink_->IsOpened();
+    } else {
+      csv_file_.open(file_path_);
+      is_file_opened_ = csv_file_.is_open();
+      if (!is_file_opened_) std::cerr << "Error opening log file: " << file_path_ << std::endl;
+    }
   }
 
   // Copy SimBase.ini
@@ -49,12 +63,23 @@ Logger::Logger(const std::string &file_name, const std::string &data_path, const
 }
 
 Logger::~Logger(void) {
-  if (is_file_opened_) {
+  delete log_sink_;
+  if (csv_file_.is_open()) {
     csv_file_.close();
   }
 }
 
 void Logger::WriteHeaders(const bool add_newline) {
+  if (log_sink_ != nullptr) {
+    std::vector<std::string> column_names;
+    for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr) {
+      if (!((*itr)->is_log_enabled_)) continue;
+      SplitHeader((*itr)->GetLogHeader(), column_names);
+    }
+    log_sink_->WriteHeader(column_names);
+    return;
+  }
+
   for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr) {
     if (!((*itr)->is_log_enabled_)) continue;
     Write((*itr)->GetLogHeader());
@@ -63,6 +88,18 @@ void Logger::WriteHeaders(const bool add_newline) {
 }
 
 void Logger::WriteValues(const bool add_newline) {
+  S2E_PROFILE_SCOPE("Logger::WriteValues");
+  if (log_sink_ != nullptr) {
+    if (!is_enabled_) return;
+    log_value_buffer_.Clear();
+    for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr) {
+      if (!((*itr)->is_log_enabled_)) continue;
+      (*itr)->PushLogValue(log_value_buffer_);
+    }
+    log_sink_->WriteRow(log_value_buffer_);
+    return;
+  }
+
   for (auto itr = log_list_.begin(); itr != log_list_.end(); ++itr) {
     if (!((*itr)->is_log_enabled_)) continue;
     Write((*itr)->GetLogValue());
@@ -70,6 +107,17 @@ void Logger::WriteValues(const bool add_newline) {
   if (add_newline) WriteNewLine();
 }
 
+void Logger::EnableAsyncOutput(const size_t buffer_size, const AsyncLogOverflowPolicy overflow_policy) {
+  if (!is_file_opened_) return;
+
+  if (log_sink_ == nullptr) {
+    // Replace the CSV file stream with the CSV log sink to move the formatting to the writer thread
+    csv_file_.close();
+    log_sink_ = new CsvLogSink(file_path_);
+  }
+  log_sink_ = new AsyncLogSink(log_sink_, buffer_size, overflow_policy);
+}
+
 void Logger::WriteNewLine() { Write("\n"); }
 
 void Logger::Write(const std::string log, const bool flag) {
@@ -78,6 +126,18 @@ void Logger::Write(const std::string log, const bool flag) {
   }
 }
 
+std::string Logger::CreateSharedDirectory(const std::string &data_path) {
+  time_t timer = time(NULL);
+  struct tm *now;
+  now = localtime(&timer);
+  char start_time_c[64];
+  strftime(start_time_c, 64, "%y%m%d_%H%M%S", now);
+
+  const std::string directory_path = CreateDirectory(data_path, start_time_c);
+  is_directory_shared_ = directory_path != data_path;
+  return directory_path;
+}
+
 void Logger::AddLogList(ILoggable *loggable) { log_list_.push_back(loggable); }
 
 void Logger::ClearLogList() { log_list_.clear(); }
@@ -91,7 +151,8 @@ std::string Logger::CreateDirectory(const std::string &data_path, const std::str
 #else
   rtn_mkdir = mkdir(directory_path_tmp_.c_str(), 0777);
 #endif
-  if (rtn_mkdir == 0) {
+  // The directory can be already created by the other logger started at the same time
+  if (rtn_mkdir == 0 || errno == EEXIST) {
   } else {
     std::cerr << "Error making directory: " << directory_path_tmp_ << std::endl;
     return data_path;
@@ -129,3 +190,13 @@ std::string Logger::GetFileName(const std::string &path) {
 
   return path;
 }
+
+void Logger::SplitHeader(const std::string &header, std::vector<std::string> &column_names) {
+  size_t start = 0;
+  while (start < header.size()) {
+    size_t end = header.find(',', start);
+    if (end == std::string::npos) end = header.size();
+    column_names.push_back(header.substr(start, end - start));
+    start = end + 1;
+  }
+}
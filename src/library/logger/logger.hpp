@@ -12,8 +12,19 @@
 #include <string>
 #include <vector>
 
+#include "async_log_sink.hpp"
+#include "log_sink.hpp"
 #include "loggable.hpp"
 
+/**
+ * @enum LogFileFormat
+ * @brief Format of the log output file
+ */
+enum class LogFileFormat {
+  kCsv = 0,  //!< CSV text file
+  kBinary,   //!< Chunked columnar binary file (See BinaryLogSink)
+};
+
 /**
  * @class Logger
  * @brief Class to manage log output file
@@ -28,15 +39,25 @@ class Logger {
    * @param [in] ini_file_name: Initialize file name
    * @param [in] is_ini_save_enabled: Enable flag to save ini files
    * @param [in] is_enabled: Enable flag for logging
+   * @param [in] file_format: Format of the log output file
    */
   Logger(const std::string &file_name, const std::string &data_path, const std::string &ini_file_name, const bool is_ini_save_enabled,
-         const bool is_enabled = true);
+         const bool is_enabled = true, const LogFileFormat file_format = LogFileFormat::kCsv);
   /**
    * @fn ~Logger
    * @brief Destructor
    */
   ~Logger(void);
 
+  /**
+   * @fn CreateSharedDirectory
+   * @brief Create a directory shared by all the loggers created after this call
+   * @note This is used to store the logs of all the Monte-Carlo cases in a directory. Call this before the worker processes are forked.
+   * @param [in] data_path: Path to `data` directory
+   * @return Path to the created directory, which should be given to the constructor as data_path
+   */
+  static std::string CreateSharedDirectory(const std::string &data_path);
+
   /**
    * @fn AddLogList
    * @brief Add a loggable into the log list
@@ -62,6 +83,15 @@ class Logger {
    */
   void WriteValues(const bool add_newline = true);
 
+  /**
+   * @fn EnableAsyncOutput
+   * @brief Write the log with a dedicated writer thread
+   * @note This should be called before WriteHeaders. In the CSV format, all real values are written with the same precision.
+   * @param [in] buffer_size: Number of row buffers shared with the writer thread
+   * @param [in] overflow_policy: Behavior when all row buffers are used
+   */
+  void EnableAsyncOutput(const size_t buffer_size, const AsyncLogOverflowPolicy overflow_policy);
+
   /**
    * @fn Enabled
    * @brief Set enable flag of the log
@@ -91,10 +121,16 @@ class Logger {
   bool is_enabled_;                    //!< Enable flag for logging
   bool is_file_opened_;                //!< Is the CSV file opened?
   static bool is_directory_created_;   //!< Is the log output directory is created in the scenario
+  static bool is_directory_shared_;    //!< Is the log output directory shared by all the loggers?
   std::vector<ILoggable *> log_list_;  //!< Log list
 
   bool is_ini_save_enabled_;    //!< Enable flag to save ini files
   std::string directory_path_;  //!< Path to the directory for log files
+  std::string file_path_;       //!< Path to the log file
+
+  LogFileFormat file_format_;        //!< Format of the log output file
+  ILogSink *log_sink_ = nullptr;     //!< Log sink for the typed log output (nullptr for the CSV format)
+  LogValueBuffer log_value_buffer_;  //!< Buffer to store the typed log values of a row
 
   /**
    * @fn Write
@@ -117,7 +153,7 @@ class Logger {
    * @param[in] time: Time stamp (YYYYMMDD_hhmmss)
    * @return Path to the created directory
    */
-  std::string CreateDirectory(const std::string &data_path, const std::string &time);
+  static std::string CreateDirectory(const std::string &data_path, const std::string &time);
 
   /**
    * @fn GetFileName
@@ -126,6 +162,14 @@ class Logger {
    * @return The extracted file name
    */
   std::string GetFileName(const std::string &path);
+
+  /**
+   * @fn SplitHeader
+   * @brief Split the comma separated log header into column names
+   * @param [in] header: Log header
+   * @param [out] column_names: Column names
+   */
+  void SplitHeader(const std::string &header, std::vector<std::string> &column_names);
 };
 
 #endif  // S2E_LIBRARY_LOGGER_LOGGER_HPP_
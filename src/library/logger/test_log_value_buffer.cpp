@@ -0,0 +1,47 @@
+/**
+ * @file test_log_value_buffer.cpp
+ * @brief Test codes for LogValueBuffer class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+
+#include "log_value_buffer.hpp"
+
+/**
+ * @brief Test that the texts of GetLogValue are kept in order and parsed into typed values
+ */
+TEST(LogValueBuffer, ExpandTexts) {
+  LogValueBuffer row;
+  row.Push(1.25);
+  row.PushText("1.5,2000/01/02 03:04:05.500,abc,");
+  row.Push(2.0);
+  row.PushText("-3e-05,7,");
+  EXPECT_EQ(4u, row.GetSize());
+
+  std::string line;
+  row.AppendText(0, line);
+  row.AppendText(1, line);
+  EXPECT_EQ("1.5,2000/01/02 03:04:05.500,abc,-3e-05,7,", line);
+
+  LogValueBuffer expanded_row;
+  expanded_row.ExpandTexts(row);
+  ASSERT_EQ(7u, expanded_row.GetSize());
+  const double expected_values[7] = {1.25, 1.5, 86400.0 + 3 * 3600.0 + 4 * 60.0 + 5.5, NAN, 2.0, -3e-05, 7.0};
+  for (size_t i = 0; i < 7; i++) {
+    if (i == 3) {
+      EXPECT_TRUE(std::isnan(expanded_row.GetValues()[i]));
+    } else {
+      EXPECT_DOUBLE_EQ(expected_values[i], expanded_row.GetValues()[i]);
+    }
+    EXPECT_EQ(i == 2 ? LogValueType::kDateTime : LogValueType::kReal, expanded_row.GetTypes()[i]);
+  }
+
+  // The memory is kept but the texts are cleared
+  row.Clear();
+  row.PushText("4,");
+  expanded_row.ExpandTexts(row);
+  ASSERT_EQ(1u, expanded_row.GetSize());
+  EXPECT_DOUBLE_EQ(4.0, expanded_row.GetValues()[0]);
+}
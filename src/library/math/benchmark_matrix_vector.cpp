@@ -0,0 +1,136 @@
+/**
+ * @file benchmark_matrix_vector.cpp
+ * @brief Benchmark codes for the libra::Vector, libra::Matrix, and libra::Quaternion operations with Google Benchmark
+ */
+#include <benchmark/benchmark.h>
+
+#include "matrix_vector.hpp"
+#include "quaternion.hpp"
+
+namespace {
+
+/**
+ * @fn MakeVector
+ * @brief Return a vector with different elements
+ */
+template <size_t N>
+libra::Vector<N> MakeVector(const double offset) {
+  libra::Vector<N> vector;
+  for (size_t i = 0; i < N; i++) vector[i] = offset + 0.1 * (double)(i + 1);
+  return vector;
+}
+
+/**
+ * @fn MakeMatrix
+ * @brief Return a diagonally dominant matrix which is invertible
+ */
+template <size_t N>
+libra::Matrix<N, N> MakeMatrix(const double offset) {
+  libra::Matrix<N, N> matrix;
+  for (size_t i = 0; i < N; i++) {
+    for (size_t j = 0; j < N; j++) matrix[i][j] = (i == j) ? 10.0 + offset : 0.1 * (double)(i + 2 * j + 1);
+  }
+  return matrix;
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmark of the inner and outer products of 3D vectors
+ */
+static void BM_VectorProducts(benchmark::State& state) {
+  libra::Vector<3> a = MakeVector<3>(0.0);
+  const libra::Vector<3> b = MakeVector<3>(1.0);
+  for (auto _ : state) {
+    const libra::Vector<3> c = libra::OuterProduct(a, b);
+    const double d = libra::InnerProduct(a, c);
+    benchmark::DoNotOptimize(d);
+    a[0] += 1.0e-9;
+  }
+}
+BENCHMARK(BM_VectorProducts);
+
+/**
+ * @brief Benchmark of the normalization of a 3D vector
+ */
+static void BM_VectorNormalize(benchmark::State& state) {
+  libra::Vector<3> a = MakeVector<3>(0.0);
+  for (auto _ : state) {
+    const libra::Vector<3> b = a.CalcNormalizedVector();
+    benchmark::DoNotOptimize(b);
+    a[0] += 1.0e-9;
+  }
+}
+BENCHMARK(BM_VectorNormalize);
+
+/**
+ * @brief Benchmark of the 3x3 matrix operations used in the frame conversions
+ */
+static void BM_Matrix3Operations(benchmark::State& state) {
+  libra::Matrix<3, 3> a = MakeMatrix<3>(0.0);
+  const libra::Matrix<3, 3> b = MakeMatrix<3>(1.0);
+  const libra::Vector<3> v = MakeVector<3>(0.0);
+  for (auto _ : state) {
+    const libra::Matrix<3, 3> c = a * b.Transpose();
+    const libra::Vector<3> w = c * v;
+    benchmark::DoNotOptimize(w);
+    a[0][0] += 1.0e-9;
+  }
+}
+BENCHMARK(BM_Matrix3Operations);
+
+/**
+ * @brief Benchmark of the matrix inversion with the LU decomposition
+ * @note Argument: size of the matrix
+ */
+template <size_t N>
+static void BM_MatrixInverse(benchmark::State& state) {
+  libra::Matrix<N, N> a = MakeMatrix<N>(0.0);
+  for (auto _ : state) {
+    const libra::Matrix<N, N> b = libra::CalcInverseMatrix(a);
+    benchmark::DoNotOptimize(b);
+    a[0][0] += 1.0e-9;
+  }
+}
+BENCHMARK_TEMPLATE(BM_MatrixInverse, 3);
+BENCHMARK_TEMPLATE(BM_MatrixInverse, 6);
+
+/**
+ * @brief Benchmark of the quaternion product and normalization used in the attitude propagation
+ */
+static void BM_QuaternionProduct(benchmark::State& state) {
+  libra::Quaternion q(0.5, 0.5, 0.5, 0.5);
+  const libra::Quaternion dq(libra::Vector<3>(MakeVector<3>(0.0).CalcNormalizedVector()), 1.0e-3);
+  for (auto _ : state) {
+    q = q * dq;
+    q.Normalize();
+    benchmark::DoNotOptimize(q);
+  }
+}
+BENCHMARK(BM_QuaternionProduct);
+
+/**
+ * @brief Benchmark of the frame conversion of a vector with a quaternion
+ */
+static void BM_QuaternionFrameConversion(benchmark::State& state) {
+  libra::Quaternion q(0.5, 0.5, 0.5, 0.5);
+  libra::Vector<3> v = MakeVector<3>(0.0);
+  for (auto _ : state) {
+    v = q.FrameConversion(v);
+    benchmark::DoNotOptimize(v);
+  }
+}
+BENCHMARK(BM_QuaternionFrameConversion);
+
+/**
+ * @brief Benchmark of the conversion from a quaternion to a DCM
+ */
+static void BM_QuaternionToDcm(benchmark::State& state) {
+  libra::Quaternion q(0.5, 0.5, 0.5, 0.5);
+  for (auto _ : state) {
+    const libra::Matrix<3, 3> dcm = q.ConvertToDcm();
+    benchmark::DoNotOptimize(dcm);
+    q[0] += 1.0e-12;
+  }
+}
+BENCHMARK(BM_QuaternionToDcm);
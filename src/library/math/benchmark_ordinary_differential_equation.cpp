@@ -0,0 +1,105 @@
+/**
+ * @file benchmark_ordinary_differential_equation.cpp
+ * @brief Benchmark codes for the numerical integration methods of OrdinaryDifferentialEquation class with Google Benchmark
+ */
+#include <benchmark/benchmark.h>
+
+#include "ordinary_differential_equation.hpp"
+
+namespace {
+
+const double kGravityConstant_m3_s2 = 3.986004415e14;
+const double kGeoRadius_m = 42164.0e3;
+const double kDuration_s = 86400.0;
+const double kSynchronizationPeriod_s = 600.0;
+const double kRk4Step_s = 60.0;
+
+/**
+ * @class TwoBodyOde
+ * @brief Two body problem in the inertial frame
+ */
+class TwoBodyOde : public libra::OrdinaryDifferentialEquation<6> {
+ public:
+  TwoBodyOde(const double step_width_s) : libra::OrdinaryDifferentialEquation<6>(step_width_s) {
+    libra::Vector<6> initial_state(0.0);
+    initial_state[0] = kGeoRadius_m;
+    initial_state[4] = sqrt(kGravityConstant_m3_s2 / kGeoRadius_m);
+    initial_state[5] = 10.0;  // Small inclination
+    Setup(0.0, initial_state);
+  }
+  void DerivativeFunction(double t, const libra::Vector<6>& state, libra::Vector<6>& rhs) {
+    (void)t;
+    const double r3 = pow(state[0] * state[0] + state[1] * state[1] + state[2] * state[2], 1.5);
+    for (size_t i = 0; i < 3; i++) {
+      rhs[i] = state[i + 3];
+      rhs[i + 3] = -kGravityConstant_m3_s2 / r3 * state[i];
+    }
+  }
+};
+
+/**
+ * @fn Propagate
+ * @brief Propagate one day with the synchronization points like the main loop of the simulation
+ */
+void Propagate(TwoBodyOde& ode) {
+  const size_t number_of_sync = (size_t)(kDuration_s / kSynchronizationPeriod_s);
+  for (size_t i = 1; i <= number_of_sync; i++) ode.Integrate(kSynchronizationPeriod_s * (double)i);
+}
+
+/**
+ * @fn CalcPositionError_m
+ * @brief Calculate the position error against the tightly controlled DOP853 integration
+ */
+double CalcPositionError_m(const TwoBodyOde& ode) {
+  static TwoBodyOde* reference = nullptr;
+  if (reference == nullptr) {
+    reference = new TwoBodyOde(kSynchronizationPeriod_s);
+    reference->SetIntegrationMethod(libra::NumericalIntegrationMethod::kDop853);
+    reference->SetTolerance(1.0e-14, 1.0e-9);
+    Propagate(*reference);
+  }
+  double error_squared_m2 = 0.0;
+  for (size_t i = 0; i < 3; i++) error_squared_m2 += pow(ode[i] - (*reference)[i], 2.0);
+  return sqrt(error_squared_m2);
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmark of one day GEO propagation with the fixed step RK4
+ */
+static void BM_OdeRk4(benchmark::State& state) {
+  size_t number_of_evaluations = 0;
+  double position_error_m = 0.0;
+  for (auto _ : state) {
+    TwoBodyOde ode(kRk4Step_s);
+    Propagate(ode);
+    number_of_evaluations = ode.GetNumberOfDerivativeEvaluations();
+    position_error_m = CalcPositionError_m(ode);
+  }
+  state.counters["derivative_evaluations"] = (double)number_of_evaluations;
+  state.counters["position_error_m"] = position_error_m;
+}
+BENCHMARK(BM_OdeRk4);
+
+/**
+ * @brief Benchmark of one day GEO propagation with the adaptive step methods
+ */
+static void BM_OdeAdaptive(benchmark::State& state) {
+  const libra::NumericalIntegrationMethod method = (libra::NumericalIntegrationMethod)state.range(0);
+  size_t number_of_evaluations = 0;
+  double position_error_m = 0.0;
+  for (auto _ : state) {
+    TwoBodyOde ode(kRk4Step_s);
+    ode.SetIntegrationMethod(method);
+    ode.SetTolerance(1.0e-10, 1.0e-3);
+    Propagate(ode);
+    number_of_evaluations = ode.GetNumberOfDerivativeEvaluations();
+    position_error_m = CalcPositionError_m(ode);
+  }
+  state.counters["derivative_evaluations"] = (double)number_of_evaluations;
+  state.counters["position_error_m"] = position_error_m;
+}
+BENCHMARK(BM_OdeAdaptive)
+    ->Arg((int)libra::NumericalIntegrationMethod::kDormandPrince5)
+    ->Arg((int)libra::NumericalIntegrationMethod::kDop853);
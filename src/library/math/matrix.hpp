@@ -166,7 +166,7 @@ class Matrix {
    * @param [in] column: Target column number
    * @return True: row/column number is in the range
    */
-  inline bool IsValidRange(size_t row, size_t column) { return (row < R && column < C); }
+  inline bool IsValidRange(size_t row, size_t column) const { return (row < R && column < C); }
 };
 
 /**
@@ -6,10 +6,23 @@
 #ifndef S2E_LIBRARY_MATH_ORDINARY_DIFFERENTIA_EQUATION_HPP_
 #define S2E_LIBRARY_MATH_ORDINARY_DIFFERENTIA_EQUATION_HPP_
 
+#include <cstddef>
+
+#include "../utilities/checkpoint.hpp"
 #include "./vector.hpp"
 
 namespace libra {
 
+/**
+ * @enum NumericalIntegrationMethod
+ * @brief Numerical integration method of the ordinary differential equation
+ */
+enum class NumericalIntegrationMethod {
+  kRk4 = 0,         //!< Classical 4th order Runge-Kutta method with the fixed step width
+  kDormandPrince5,  //!< Dormand-Prince 5(4) embedded method with the adaptive step width
+  kDop853,          //!< Dormand-Prince 8(5,3) embedded method with the adaptive step width
+};
+
 /**
  * @class OrdinaryDifferentialEquation
  * @brief Class for Ordinary Differential Equation
@@ -47,9 +60,27 @@ class OrdinaryDifferentialEquation {
   /**
    * @fn Update
    * @brief Update the state
+   * @note RK4 updates the state with one step. The adaptive methods integrate the state over the step width with error control.
    */
   void Update();
 
+  /**
+   * @fn Integrate
+   * @brief Integrate the state until the end value of the independent variable
+   * @note The last step is shortened to stop exactly at the end value, so the end value works as the synchronization point with outside.
+   *       The adaptive methods keep the step width estimated before the shortening for the next call.
+   * @param [in] end_independent_variable: End value of independent variable
+   */
+  void Integrate(const double end_independent_variable);
+
+  /**
+   * @fn CalcDenseOutput
+   * @brief Calculate the interpolated state in the latest step with the continuous extension of the method
+   * @param [in] independent_variable: Independent variable between the beginning and the end of the latest step
+   * @return Interpolated state vector
+   */
+  Vector<N> CalcDenseOutput(const double independent_variable);
+
   /**
    * @fn Setup
    * @brief Initialize the state vector
@@ -65,6 +96,37 @@ class OrdinaryDifferentialEquation {
    */
   inline void SetStepWidth(const double step_width_s) { step_width_s_ = step_width_s; }
 
+  /**
+   * @fn SetIntegrationMethod
+   * @brief Set numerical integration method
+   * @param [in] method: Numerical integration method
+   */
+  void SetIntegrationMethod(const NumericalIntegrationMethod method);
+
+  /**
+   * @fn SetTolerance
+   * @brief Set tolerances of the local error for the adaptive methods
+   * @param [in] relative_tolerance: Relative tolerance
+   * @param [in] absolute_tolerance: Absolute tolerance with the unit of the state vector
+   */
+  inline void SetTolerance(const double relative_tolerance, const double absolute_tolerance) {
+    relative_tolerance_ = relative_tolerance;
+    absolute_tolerance_ = absolute_tolerance;
+  }
+
+  /**
+   * @fn SaveState
+   * @brief Write the state and the internal variables of the integration to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the state and the internal variables of the integration from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
   // Getter
   /**
    * @fn GetStepWidth
@@ -72,6 +134,42 @@ class OrdinaryDifferentialEquation {
    */
   inline double GetStepWidth() const { return step_width_s_; }
 
+  /**
+   * @fn GetIntegrationMethod
+   * @brief Return numerical integration method
+   */
+  inline NumericalIntegrationMethod GetIntegrationMethod() const { return method_; }
+
+  /**
+   * @fn GetRelativeTolerance
+   * @brief Return relative tolerance of the local error
+   */
+  inline double GetRelativeTolerance() const { return relative_tolerance_; }
+
+  /**
+   * @fn GetAbsoluteTolerance
+   * @brief Return absolute tolerance of the local error
+   */
+  inline double GetAbsoluteTolerance() const { return absolute_tolerance_; }
+
+  /**
+   * @fn GetAdaptiveStepWidth
+   * @brief Return step width estimated by the error control for the next step
+   */
+  inline double GetAdaptiveStepWidth() const { return adaptive_step_width_; }
+
+  /**
+   * @fn GetNumberOfDerivativeEvaluations
+   * @brief Return total number of the derivative function evaluations
+   */
+  inline size_t GetNumberOfDerivativeEvaluations() const { return number_of_derivative_evaluations_; }
+
+  /**
+   * @fn GetNumberOfRejectedSteps
+   * @brief Return total number of the steps rejected by the error control
+   */
+  inline size_t GetNumberOfRejectedSteps() const { return number_of_rejected_steps_; }
+
   /**
    * @fn GetIndependentVariable
    * @brief Return current independent variable
@@ -105,10 +203,71 @@ class OrdinaryDifferentialEquation {
   inline libra::Vector<N>& GetState() { return state_; }
 
  private:
+  static const size_t kMaxStages = 16;  //!< Maximum number of stages including the stages for the dense output
+
   double independent_variable_;  //!< Latest value of independent variable
   Vector<N> state_;              //!< Latest state vector
   Vector<N> derivative_;         //!< Latest differentiate of the state vector
   double step_width_s_;          //!< Step width
+
+  NumericalIntegrationMethod method_ = NumericalIntegrationMethod::kRk4;  //!< Numerical integration method
+  double relative_tolerance_ = 1.0e-10;                                   //!< Relative tolerance of the local error
+  double absolute_tolerance_ = 1.0e-6;                                    //!< Absolute tolerance of the local error
+  double adaptive_step_width_ = 0.0;                                      //!< Step width for the next adaptive step (0 means not estimated)
+  size_t number_of_derivative_evaluations_ = 0;                           //!< Total number of the derivative function evaluations
+  size_t number_of_rejected_steps_ = 0;                                   //!< Total number of the rejected steps
+
+  // Latest step for the dense output
+  double previous_independent_variable_ = 0.0;  //!< Independent variable at the beginning of the latest step
+  double previous_step_width_ = 0.0;            //!< Width of the latest step (0 means no step is available)
+  Vector<N> previous_state_;                    //!< State vector at the beginning of the latest step
+  Vector<N> stages_[kMaxStages];                //!< Derivatives of the stages in the latest step
+  bool is_first_stage_available_ = false;       //!< Whether the last stage can be reused as the first stage of the next step
+  bool is_dense_stages_available_ = false;      //!< Whether the additional stages for the DOP853 dense output are calculated
+
+  /**
+   * @fn CalcDerivative
+   * @brief Call the derivative function with counting
+   */
+  inline void CalcDerivative(const double independent_variable, const Vector<N>& state, Vector<N>& derivative) {
+    number_of_derivative_evaluations_++;
+    DerivativeFunction(independent_variable, state, derivative);
+  }
+
+  /**
+   * @fn UpdateRk4
+   * @brief Update the state with one step of RK4
+   */
+  void UpdateRk4();
+  /**
+   * @fn IntegrateAdaptive
+   * @brief Integrate the state with the adaptive methods until the end value of independent variable
+   * @param [in] end_independent_variable: End value of independent variable
+   */
+  void IntegrateAdaptive(const double end_independent_variable);
+  /**
+   * @fn TryDormandPrince5Step
+   * @brief Calculate a candidate step of Dormand-Prince 5(4)
+   * @param [in] step_width: Step width
+   * @param [out] new_state: State vector at the end of the step
+   * @return Normalized error (The step is accepted when it is smaller than 1)
+   */
+  double TryDormandPrince5Step(const double step_width, Vector<N>& new_state);
+  /**
+   * @fn TryDop853Step
+   * @brief Calculate a candidate step of DOP853
+   * @param [in] step_width: Step width
+   * @param [out] new_state: State vector at the end of the step
+   * @return Normalized error (The step is accepted when it is smaller than 1)
+   */
+  double TryDop853Step(const double step_width, Vector<N>& new_state);
+  /**
+   * @fn CalcErrorScale
+   * @brief Calculate the scale of the error for each element
+   * @param [in] new_state: State vector at the end of the step
+   * @param [in] index: Index of the element
+   */
+  inline double CalcErrorScale(const Vector<N>& new_state, const size_t index) const;
 };
 
 }  // namespace libra
@@ -5,8 +5,22 @@
 #ifndef S2E_LIBRARY_MATH_ORDINARY_DIFFERENTIA_EQUATION_TEMPLATE_FUNCTIONS_HPP_
 #define S2E_LIBRARY_MATH_ORDINARY_DIFFERENTIA_EQUATION_TEMPLATE_FUNCTIONS_HPP_
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "./runge_kutta_coefficients.hpp"
+
 namespace libra {
 
+namespace runge_kutta {
+// Step width control parameters
+inline constexpr double kSafetyFactor = 0.9;                                                   //!< Safety factor for the new step width
+inline constexpr double kMinimumFactor = 0.2;                                                  //!< Minimum change ratio of the step width
+inline constexpr double kMaximumFactor = 10.0;                                                 //!< Maximum change ratio of the step width
+inline constexpr double kRelativeMinimumStep = 10.0 * std::numeric_limits<double>::epsilon();  //!< Minimum step relative to the variable
+}  // namespace runge_kutta
+
 template <size_t N>
 OrdinaryDifferentialEquation<N>::OrdinaryDifferentialEquation(double step_width_s)
     : independent_variable_(0.0), state_(0.0), derivative_(0.0), step_width_s_(step_width_s) {}
@@ -15,6 +29,52 @@ template <size_t N>
 void OrdinaryDifferentialEquation<N>::Setup(double initial_independent_variable, const Vector<N>& initial_state) {
   independent_variable_ = initial_independent_variable;
   state_ = initial_state;
+  previous_step_width_ = 0.0;
+  is_first_stage_available_ = false;
+}
+
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::SetIntegrationMethod(const NumericalIntegrationMethod method) {
+  method_ = method;
+  adaptive_step_width_ = 0.0;
+  previous_step_width_ = 0.0;
+  is_first_stage_available_ = false;
+}
+
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("OrdinaryDifferentialEquation");
+  writer.Write(independent_variable_);
+  writer.Write(state_);
+  writer.Write(derivative_);
+  writer.Write(step_width_s_);
+  writer.Write(adaptive_step_width_);
+  writer.Write(number_of_derivative_evaluations_);
+  writer.Write(number_of_rejected_steps_);
+  writer.Write(previous_independent_variable_);
+  writer.Write(previous_step_width_);
+  writer.Write(previous_state_);
+  for (size_t i = 0; i < kMaxStages; i++) writer.Write(stages_[i]);
+  writer.Write(is_first_stage_available_);
+  writer.Write(is_dense_stages_available_);
+}
+
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::LoadState(CheckpointReader& reader) {
+  reader.BeginSection("OrdinaryDifferentialEquation");
+  reader.Read(independent_variable_);
+  reader.Read(state_);
+  reader.Read(derivative_);
+  reader.Read(step_width_s_);
+  reader.Read(adaptive_step_width_);
+  reader.Read(number_of_derivative_evaluations_);
+  reader.Read(number_of_rejected_steps_);
+  reader.Read(previous_independent_variable_);
+  reader.Read(previous_step_width_);
+  reader.Read(previous_state_);
+  for (size_t i = 0; i < kMaxStages; i++) reader.Read(stages_[i]);
+  reader.Read(is_first_stage_available_);
+  reader.Read(is_dense_stages_available_);
 }
 
 template <size_t N>
@@ -25,23 +85,247 @@ OrdinaryDifferentialEquation<N>& OrdinaryDifferentialEquation<N>::operator++() {
 
 template <size_t N>
 void OrdinaryDifferentialEquation<N>::Update() {
-  DerivativeFunction(independent_variable_, state_, derivative_);  // Current derivative calculation
+  if (method_ == NumericalIntegrationMethod::kRk4) {
+    UpdateRk4();
+  } else {
+    IntegrateAdaptive(independent_variable_ + step_width_s_);
+  }
+}
+
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::Integrate(const double end_independent_variable) {
+  if (method_ != NumericalIntegrationMethod::kRk4) {
+    IntegrateAdaptive(end_independent_variable);
+    return;
+  }
+
+  const double nominal_step_width = step_width_s_;
+  while (end_independent_variable - independent_variable_ - nominal_step_width > 1.0e-6) {
+    UpdateRk4();
+  }
+  step_width_s_ = end_independent_variable - independent_variable_;  // Adjust the last step width
+  UpdateRk4();
+  independent_variable_ = end_independent_variable;
+  step_width_s_ = nominal_step_width;
+}
+
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::UpdateRk4() {
+  CalcDerivative(independent_variable_, state_, derivative_);  // Current derivative calculation
+  previous_independent_variable_ = independent_variable_;
+  previous_state_ = state_;
 
   // 4th order Runge-Kutta method
-  Vector<N> k1(derivative_);
+  Vector<N>& k1 = stages_[0];
+  k1 = derivative_;
   k1 *= step_width_s_;
-  Vector<N> k2(state_.GetLength());
-  DerivativeFunction(independent_variable_ + 0.5 * step_width_s_, state_ + 0.5 * k1, k2);
+  Vector<N>& k2 = stages_[1];
+  CalcDerivative(independent_variable_ + 0.5 * step_width_s_, state_ + 0.5 * k1, k2);
   k2 *= step_width_s_;
-  Vector<N> k3(state_.GetLength());
-  DerivativeFunction(independent_variable_ + 0.5 * step_width_s_, state_ + 0.5 * k2, k3);
+  Vector<N>& k3 = stages_[2];
+  CalcDerivative(independent_variable_ + 0.5 * step_width_s_, state_ + 0.5 * k2, k3);
   k3 *= step_width_s_;
-  Vector<N> k4(state_.GetLength());
-  DerivativeFunction(independent_variable_ + step_width_s_, state_ + k3, k4);
+  Vector<N>& k4 = stages_[3];
+  CalcDerivative(independent_variable_ + step_width_s_, state_ + k3, k4);
   k4 *= step_width_s_;
 
   state_ += (1.0 / 6.0) * (k1 + 2.0 * (k2 + k3) + k4);  // Update state vector
   independent_variable_ += step_width_s_;               // Update independent variable
+  previous_step_width_ = step_width_s_;
+}
+
+template <size_t N>
+void OrdinaryDifferentialEquation<N>::IntegrateAdaptive(const double end_independent_variable) {
+  using namespace runge_kutta;
+  const bool is_dop853 = (method_ == NumericalIntegrationMethod::kDop853);
+  const double error_exponent = is_dop853 ? -1.0 / 8.0 : -1.0 / 5.0;
+  const size_t last_stage = is_dop853 ? 12 : 6;
+  const double direction = (end_independent_variable >= independent_variable_) ? 1.0 : -1.0;
+
+  // The derivative can depend on the outside variables updated between the calls, so the first stage is calculated again
+  is_first_stage_available_ = false;
+  if (adaptive_step_width_ <= 0.0) adaptive_step_width_ = fabs(step_width_s_);
+
+  Vector<N> new_state;
+  while (direction * (end_independent_variable - independent_variable_) > 0.0) {
+    const double remaining_width = fabs(end_independent_variable - independent_variable_);
+    const double minimum_step_width = kRelativeMinimumStep * std::max(1.0, fabs(independent_variable_));
+    double step_width = std::min(adaptive_step_width_, remaining_width);
+    bool is_rejected = false;
+
+    // FSAL: The last stage of the previous step is the first stage of this step
+    if (is_first_stage_available_) {
+      stages_[0] = stages_[last_stage];
+    } else {
+      CalcDerivative(independent_variable_, state_, stages_[0]);
+    }
+
+    while (true) {
+      const bool is_last_step = (step_width >= remaining_width);
+      const double signed_step_width = direction * step_width;
+      const double error_norm = is_dop853 ? TryDop853Step(signed_step_width, new_state) : TryDormandPrince5Step(signed_step_width, new_state);
+
+      if (error_norm < 1.0 || step_width <= minimum_step_width) {
+        double factor = (error_norm == 0.0) ? kMaximumFactor : std::min(kMaximumFactor, kSafetyFactor * pow(error_norm, error_exponent));
+        if (is_rejected) factor = std::min(1.0, factor);
+        if (is_last_step) {
+          // The shortened step for the synchronization should not shrink the estimated step width
+          adaptive_step_width_ = std::max(adaptive_step_width_, step_width * factor);
+        } else {
+          adaptive_step_width_ = step_width * factor;
+        }
+
+        previous_independent_variable_ = independent_variable_;
+        previous_step_width_ = signed_step_width;
+        previous_state_ = state_;
+        state_ = new_state;
+        independent_variable_ = is_last_step ? end_independent_variable : independent_variable_ + signed_step_width;
+        is_first_stage_available_ = true;
+        is_dense_stages_available_ = false;
+        break;
+      }
+
+      number_of_rejected_steps_++;
+      step_width *= std::max(kMinimumFactor, kSafetyFactor * pow(error_norm, error_exponent));
+      step_width = std::max(step_width, minimum_step_width);
+      is_rejected = true;
+    }
+  }
+  if (is_first_stage_available_) derivative_ = stages_[last_stage];
+}
+
+template <size_t N>
+double OrdinaryDifferentialEquation<N>::CalcErrorScale(const Vector<N>& new_state, const size_t index) const {
+  return absolute_tolerance_ + std::max(fabs(state_[index]), fabs(new_state[index])) * relative_tolerance_;
+}
+
+template <size_t N>
+double OrdinaryDifferentialEquation<N>::TryDormandPrince5Step(const double step_width, Vector<N>& new_state) {
+  using namespace runge_kutta;
+  const size_t kStages = 6;
+
+  Vector<N> stage_state;
+  for (size_t s = 1; s < kStages; s++) {
+    stage_state = state_;
+    for (size_t j = 0; j < s; j++) {
+      if (kDormandPrince5A[s][j] != 0.0) stage_state += (step_width * kDormandPrince5A[s][j]) * stages_[j];
+    }
+    CalcDerivative(independent_variable_ + kDormandPrince5C[s] * step_width, stage_state, stages_[s]);
+  }
+  new_state = state_;
+  for (size_t j = 0; j < kStages; j++) {
+    if (kDormandPrince5A[kStages][j] != 0.0) new_state += (step_width * kDormandPrince5A[kStages][j]) * stages_[j];
+  }
+  CalcDerivative(independent_variable_ + step_width, new_state, stages_[kStages]);
+
+  double error_norm2 = 0.0;
+  for (size_t i = 0; i < N; i++) {
+    double error = 0.0;
+    for (size_t j = 0; j <= kStages; j++) error += kDormandPrince5E[j] * stages_[j][i];
+    error_norm2 += pow(step_width * error / CalcErrorScale(new_state, i), 2.0);
+  }
+  return sqrt(error_norm2 / (double)N);
+}
+
+template <size_t N>
+double OrdinaryDifferentialEquation<N>::TryDop853Step(const double step_width, Vector<N>& new_state) {
+  using namespace runge_kutta;
+  const size_t kStages = 12;
+
+  Vector<N> stage_state;
+  for (size_t s = 1; s < kStages; s++) {
+    stage_state = state_;
+    for (size_t j = 0; j < s; j++) {
+      if (kDop853A[s][j] != 0.0) stage_state += (step_width * kDop853A[s][j]) * stages_[j];
+    }
+    CalcDerivative(independent_variable_ + kDop853C[s] * step_width, stage_state, stages_[s]);
+  }
+  new_state = state_;
+  for (size_t j = 0; j < kStages; j++) {
+    if (kDop853A[kStages][j] != 0.0) new_state += (step_width * kDop853A[kStages][j]) * stages_[j];
+  }
+  CalcDerivative(independent_variable_ + step_width, new_state, stages_[kStages]);
+
+  // Error estimation combining the 5th and 3rd order estimators
+  double error5_norm2 = 0.0;
+  double error3_norm2 = 0.0;
+  for (size_t i = 0; i < N; i++) {
+    double error5 = 0.0;
+    double error3 = 0.0;
+    for (size_t j = 0; j <= kStages; j++) {
+      error5 += kDop853E5[j] * stages_[j][i];
+      error3 += kDop853E3[j] * stages_[j][i];
+    }
+    const double scale = CalcErrorScale(new_state, i);
+    error5_norm2 += pow(error5 / scale, 2.0);
+    error3_norm2 += pow(error3 / scale, 2.0);
+  }
+  if (error5_norm2 == 0.0 && error3_norm2 == 0.0) return 0.0;
+  return fabs(step_width) * error5_norm2 / sqrt((error5_norm2 + 0.01 * error3_norm2) * (double)N);
+}
+
+template <size_t N>
+Vector<N> OrdinaryDifferentialEquation<N>::CalcDenseOutput(const double independent_variable) {
+  if (previous_step_width_ == 0.0) return state_;
+  const double h = previous_step_width_;
+  const double x = (independent_variable - previous_independent_variable_) / h;
+  Vector<N> output(0.0);
+
+  if (method_ == NumericalIntegrationMethod::kRk4) {
+    // Continuous extension of the classical RK4 (stages are already multiplied by the step width)
+    const double x2 = x * x;
+    const double x3 = x2 * x;
+    const double b1 = x - 1.5 * x2 + 2.0 / 3.0 * x3;
+    const double b23 = x2 - 2.0 / 3.0 * x3;
+    const double b4 = -0.5 * x2 + 2.0 / 3.0 * x3;
+    output = previous_state_ + b1 * stages_[0] + b23 * (stages_[1] + stages_[2]) + b4 * stages_[3];
+  } else if (method_ == NumericalIntegrationMethod::kDormandPrince5) {
+    using runge_kutta::kDormandPrince5P;
+    for (size_t i = 0; i < N; i++) {
+      double power = x;
+      double sum = 0.0;
+      for (size_t p = 0; p < 4; p++) {
+        double q = 0.0;
+        for (size_t j = 0; j < 7; j++) q += stages_[j][i] * kDormandPrince5P[j][p];
+        sum += q * power;
+        power *= x;
+      }
+      output[i] = previous_state_[i] + h * sum;
+    }
+  } else {
+    using namespace runge_kutta;
+    // Additional stages for the dense output are calculated only when they are required
+    if (!is_dense_stages_available_) {
+      Vector<N> stage_state;
+      for (size_t s = 13; s < kMaxStages; s++) {
+        stage_state = previous_state_;
+        for (size_t j = 0; j < s; j++) {
+          if (kDop853A[s][j] != 0.0) stage_state += (h * kDop853A[s][j]) * stages_[j];
+        }
+        CalcDerivative(previous_independent_variable_ + kDop853C[s] * h, stage_state, stages_[s]);
+      }
+      is_dense_stages_available_ = true;
+    }
+    for (size_t i = 0; i < N; i++) {
+      const double delta = state_[i] - previous_state_[i];
+      double f[7];
+      f[0] = delta;
+      f[1] = h * stages_[0][i] - delta;
+      f[2] = 2.0 * delta - h * (stages_[12][i] + stages_[0][i]);
+      for (size_t m = 0; m < 4; m++) {
+        double sum = 0.0;
+        for (size_t j = 0; j < kMaxStages; j++) sum += kDop853D[m][j] * stages_[j][i];
+        f[3 + m] = h * sum;
+      }
+      double y = 0.0;
+      for (size_t k = 0; k < 7; k++) {
+        y += f[6 - k];
+        y *= (k % 2 == 0) ? x : 1.0 - x;
+      }
+      output[i] = previous_state_[i] + y;
+    }
+  }
+  return output;
 }
 
 }  // namespace libra
@@ -0,0 +1,146 @@
+/**
+ * @file test_ordinary_differential_equation.cpp
+ * @brief Test codes for OrdinaryDifferentialEquation class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include "constants.hpp"
+#include "ordinary_differential_equation.hpp"
+
+namespace {
+
+/**
+ * @class KeplerOde
+ * @brief Two body problem with normalized units
+ */
+class KeplerOde : public libra::OrdinaryDifferentialEquation<4> {
+ public:
+  KeplerOde(const double step_width) : libra::OrdinaryDifferentialEquation<4>(step_width) {}
+  void DerivativeFunction(double t, const libra::Vector<4>& state, libra::Vector<4>& rhs) {
+    (void)t;
+    const double r3 = pow(state[0] * state[0] + state[1] * state[1], 1.5);
+    rhs[0] = state[2];
+    rhs[1] = state[3];
+    rhs[2] = -state[0] / r3;
+    rhs[3] = -state[1] / r3;
+  }
+};
+
+/**
+ * @fn SetupEllipticOrbit
+ * @brief Setup elliptic orbit with the eccentricity 0.5 starting from the periapsis (The period is 2 pi)
+ */
+void SetupEllipticOrbit(KeplerOde& ode) {
+  const double eccentricity = 0.5;
+  libra::Vector<4> initial_state(0.0);
+  initial_state[0] = 1.0 - eccentricity;
+  initial_state[3] = sqrt((1.0 + eccentricity) / (1.0 - eccentricity));
+  ode.Setup(0.0, initial_state);
+}
+
+/**
+ * @fn CalcPositionError
+ * @brief Calculate the position error from the initial position after the integration of one period
+ */
+double CalcPositionError(const KeplerOde& ode) { return sqrt(pow(ode[0] - 0.5, 2.0) + pow(ode[1], 2.0)); }
+
+}  // namespace
+
+/**
+ * @brief Test for RK4 integration which is same with the step by step Update
+ */
+TEST(OrdinaryDifferentialEquation, Rk4Integrate) {
+  KeplerOde ode_integrate(0.01);
+  KeplerOde ode_update(0.01);
+  SetupEllipticOrbit(ode_integrate);
+  SetupEllipticOrbit(ode_update);
+
+  ode_integrate.Integrate(0.105);
+  for (size_t i = 0; i < 10; i++) ode_update.Update();
+  ode_update.SetStepWidth(0.005);
+  ode_update.Update();
+
+  for (size_t i = 0; i < 4; i++) EXPECT_DOUBLE_EQ(ode_update[i], ode_integrate[i]);
+  EXPECT_DOUBLE_EQ(0.105, ode_integrate.GetIndependentVariable());
+  EXPECT_DOUBLE_EQ(0.01, ode_integrate.GetStepWidth());
+  EXPECT_EQ(44u, ode_integrate.GetNumberOfDerivativeEvaluations());
+}
+
+/**
+ * @brief Test for the accuracy and the number of evaluations of the adaptive methods
+ */
+TEST(OrdinaryDifferentialEquation, AdaptiveMethods) {
+  const double period = libra::tau;
+
+  KeplerOde ode_rk4(3.0e-3);
+  SetupEllipticOrbit(ode_rk4);
+  ode_rk4.Integrate(period);
+  const double error_rk4 = CalcPositionError(ode_rk4);
+
+  const libra::NumericalIntegrationMethod methods[2] = {libra::NumericalIntegrationMethod::kDormandPrince5,
+                                                        libra::NumericalIntegrationMethod::kDop853};
+  const double tolerances[2] = {1.0e-11, 1.0e-12};
+  const size_t reduction_ratios[2] = {4, 8};
+  for (size_t m = 0; m < 2; m++) {
+    KeplerOde ode(1.0e-3);
+    ode.SetIntegrationMethod(methods[m]);
+    ode.SetTolerance(tolerances[m], tolerances[m]);
+    SetupEllipticOrbit(ode);
+    ode.Integrate(period);
+
+    EXPECT_DOUBLE_EQ(period, ode.GetIndependentVariable());
+    EXPECT_LT(CalcPositionError(ode), error_rk4);
+    EXPECT_LT(ode.GetNumberOfDerivativeEvaluations() * reduction_ratios[m], ode_rk4.GetNumberOfDerivativeEvaluations());
+  }
+}
+
+/**
+ * @brief Test for the synchronization points which should not change the step width estimation
+ */
+TEST(OrdinaryDifferentialEquation, SynchronizationPoints) {
+  KeplerOde ode_single(0.1);
+  ode_single.SetIntegrationMethod(libra::NumericalIntegrationMethod::kDop853);
+  ode_single.SetTolerance(1.0e-10, 1.0e-10);
+  SetupEllipticOrbit(ode_single);
+  ode_single.Integrate(libra::tau);
+
+  KeplerOde ode_sync(0.1);
+  ode_sync.SetIntegrationMethod(libra::NumericalIntegrationMethod::kDop853);
+  ode_sync.SetTolerance(1.0e-10, 1.0e-10);
+  SetupEllipticOrbit(ode_sync);
+  const size_t number_of_sync = 20;
+  for (size_t i = 1; i <= number_of_sync; i++) {
+    ode_sync.Integrate(libra::tau * (double)i / (double)number_of_sync);
+    EXPECT_DOUBLE_EQ(libra::tau * (double)i / (double)number_of_sync, ode_sync.GetIndependentVariable());
+  }
+
+  for (size_t i = 0; i < 4; i++) EXPECT_NEAR(ode_single[i], ode_sync[i], 1.0e-8);
+}
+
+/**
+ * @brief Test for the dense output compared with the integration to the same point
+ */
+TEST(OrdinaryDifferentialEquation, DenseOutput) {
+  const libra::NumericalIntegrationMethod methods[3] = {libra::NumericalIntegrationMethod::kRk4, libra::NumericalIntegrationMethod::kDormandPrince5,
+                                                        libra::NumericalIntegrationMethod::kDop853};
+  const double tolerances[3] = {1.0e-7, 1.0e-8, 1.0e-10};
+  for (size_t m = 0; m < 3; m++) {
+    KeplerOde ode(0.01);
+    ode.SetIntegrationMethod(methods[m]);
+    ode.SetTolerance(1.0e-6, 1.0e-6);
+    SetupEllipticOrbit(ode);
+    ode.Update();
+
+    const double middle = 0.5 * ode.GetIndependentVariable();
+    const libra::Vector<4> interpolated = ode.CalcDenseOutput(middle);
+    const libra::Vector<4> end_point = ode.CalcDenseOutput(ode.GetIndependentVariable());
+
+    KeplerOde reference(1.0e-4);
+    SetupEllipticOrbit(reference);
+    reference.Integrate(middle);
+    for (size_t i = 0; i < 4; i++) {
+      EXPECT_NEAR(reference[i], interpolated[i], tolerances[m]);
+      EXPECT_NEAR(ode[i], end_point[i], 1.0e-12);
+    }
+  }
+}
@@ -51,6 +51,11 @@ class KeplerOrbit {
    * @brief Return velocity vector in the inertial frame [m/s]
    */
   inline const libra::Vector<3> GetVelocity_i_m_s() const { return velocity_i_m_s_; }
+  /**
+   * @fn GetOrbitalElements
+   * @brief Return orbital elements
+   */
+  inline const OrbitalElements& GetOrbitalElements() const { return oe_; }
 
  protected:
   libra::Vector<3> position_i_m_;    //!< Position vector in the inertial frame [m]
@@ -10,15 +10,28 @@ GlobalRandomization global_randomization;
 GlobalRandomization::GlobalRandomization() { seed_ = 0xdeadbeef; }
 
 void GlobalRandomization::SetSeed(const long seed) {
+  std::lock_guard<std::mutex> lock(mutex_);
   base_randomizer_.Initialize(seed);
   // double dl = base_randomizer_;
 }
 
 long GlobalRandomization::MakeSeed() {
+  std::lock_guard<std::mutex> lock(mutex_);
   double rand = base_randomizer_;
   long seed = (long)((rand - 0.5) * kMaxSeed);
   if (seed == 0) {
     seed = 0xdeadbeef;
   }
   return seed;
-}
\ No newline at end of file
+}
+void GlobalRandomization::SaveState(CheckpointWriter& writer) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  writer.BeginSection("GlobalRandomization");
+  base_randomizer_.SaveState(writer);
+}
+
+void GlobalRandomization::LoadState(CheckpointReader& reader) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  reader.BeginSection("GlobalRandomization");
+  base_randomizer_.LoadState(reader);
+}
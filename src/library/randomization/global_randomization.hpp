@@ -6,6 +6,8 @@
 #ifndef S2E_LIBRARY_RANDOMIZATION_GLOBAL_RANDOMIZATION_HPP_
 #define S2E_LIBRARY_RANDOMIZATION_GLOBAL_RANDOMIZATION_HPP_
 
+#include <mutex>
+
 #include "./minimal_standard_linear_congruential_generator.hpp"
 
 /**
@@ -31,10 +33,24 @@ class GlobalRandomization {
    */
   long MakeSeed();
 
+  /**
+   * @fn SaveState
+   * @brief Write the state of the base randomizer to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer);
+  /**
+   * @fn LoadState
+   * @brief Restore the state of the base randomizer from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
+
  private:
   static const unsigned int kMaxSeed = 0xffffffff;  //!< Maximum value of seed
   libra::MinimalStandardLcg base_randomizer_;       //!< Base of global randomization
   long seed_;                                       //!< Seed of global randomization
+  std::mutex mutex_;                                //!< Mutex for the spacecraft updated in parallel
 };
 
 extern GlobalRandomization global_randomization;  //!< Global randomization
@@ -33,3 +33,7 @@ MinimalStandardLcg::operator double() {
   }
   return a_m_ * seed_;
 }
+
+void MinimalStandardLcg::SaveState(CheckpointWriter& writer) const { writer.Write(seed_); }
+
+void MinimalStandardLcg::LoadState(CheckpointReader& reader) { reader.Read(seed_); }
@@ -7,6 +7,8 @@
 #ifndef S2E_LIBRARY_RANDOMIZATION_MINIMAL_STANDARD_LINEAR_CONGRUENTIAL_GENERATOR_HPP_
 #define S2E_LIBRARY_RANDOMIZATION_MINIMAL_STANDARD_LINEAR_CONGRUENTIAL_GENERATOR_HPP_
 
+#include "../utilities/checkpoint.hpp"
+
 namespace libra {
 
 /**
@@ -44,6 +46,19 @@ class MinimalStandardLcg {
    */
   operator double();
 
+  /**
+   * @fn SaveState
+   * @brief Write the current seed to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the current seed from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
+
  private:
   static const double a_m_;       //!< A/M
   static const long q_ = 127773;  //!< Integer part of A/M
@@ -36,3 +36,15 @@ MinimalStandardLcgWithShuffle::operator double() {
 
   return out;
 }
+
+void MinimalStandardLcgWithShuffle::SaveState(CheckpointWriter& writer) const {
+  minimal_lcg_.SaveState(writer);
+  writer.Write(table_position_);
+  writer.Write(mixing_table_);
+}
+
+void MinimalStandardLcgWithShuffle::LoadState(CheckpointReader& reader) {
+  minimal_lcg_.LoadState(reader);
+  reader.Read(table_position_);
+  reader.Read(mixing_table_);
+}
@@ -45,6 +45,19 @@ class MinimalStandardLcgWithShuffle {
    */
   void InitSeed(const long seed);
 
+  /**
+   * @fn SaveState
+   * @brief Write the generator state and the mixing table to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the generator state and the mixing table from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
+
  private:
   /**
    * @fn Initialize
@@ -36,3 +36,15 @@ NormalRand::operator double() {
     return holder_ * standard_deviation_ + average_;
   }
 }
+
+void NormalRand::SaveState(CheckpointWriter& writer) const {
+  randomizer_.SaveState(writer);
+  writer.Write(holder_);
+  writer.Write(is_empty_);
+}
+
+void NormalRand::LoadState(CheckpointReader& reader) {
+  randomizer_.LoadState(reader);
+  reader.Read(holder_);
+  reader.Read(is_empty_);
+}
@@ -96,6 +96,19 @@ class NormalRand {
     randomizer_.InitSeed(seed);
   }
 
+  /**
+   * @fn SaveState
+   * @brief Write the randomizer state and the held value to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the randomizer state and the held value from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
+
  private:
   double average_;                            //!< Average
   double standard_deviation_;                 //!< Standard deviation
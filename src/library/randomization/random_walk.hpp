@@ -35,6 +35,19 @@ class RandomWalk : public libra::OrdinaryDifferentialEquation<N> {
    */
   virtual void DerivativeFunction(double x, const libra::Vector<N>& state, libra::Vector<N>& rhs);
 
+  /**
+   * @fn SaveState
+   * @brief Override function of OrdinaryDifferentialEquation to write the excitation noise state together
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Override function of OrdinaryDifferentialEquation to restore the excitation noise state together
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
  private:
   libra::Vector<N> limit_;                  //!< Limit of random walk
   libra::NormalRand normal_randomizer_[N];  //!< Random walk excitation noise
@@ -32,4 +32,20 @@ void RandomWalk<N>::DerivativeFunction(double x, const libra::Vector<N>& state,
   }
 }
 
+template <size_t N>
+void RandomWalk<N>::SaveState(CheckpointWriter& writer) const {
+  libra::OrdinaryDifferentialEquation<N>::SaveState(writer);
+  for (size_t i = 0; i < N; ++i) {
+    normal_randomizer_[i].SaveState(writer);
+  }
+}
+
+template <size_t N>
+void RandomWalk<N>::LoadState(CheckpointReader& reader) {
+  libra::OrdinaryDifferentialEquation<N>::LoadState(reader);
+  for (size_t i = 0; i < N; ++i) {
+    normal_randomizer_[i].LoadState(reader);
+  }
+}
+
 #endif  // S2E_LIBRARY_RANDOMIZATION_RANDOM_WALK_TEMPLATE_FUNCTIONS_HPP_
@@ -0,0 +1,94 @@
+/**
+ * @file benchmark_lockstep_thread.cpp
+ * @brief Benchmark codes for the SILS throughput with the flight software on LockstepThread with Google Benchmark
+ * @note The physics and the flight software are replaced with synthetic loads, and they exchange data through the ring buffers like the
+ *       UART ports of ObcWithC2a.
+ */
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "lockstep_thread.hpp"
+#include "ring_buffer.hpp"
+
+namespace {
+
+const size_t kTicksPerStep = 10;                 //!< Flight software ticks in one simulation step like timing_regulator of ObcWithC2a
+const size_t kPhysicsLoadPerStep = 20000;        //!< Load of the physics in one simulation step
+const size_t kFlightSoftwareLoadPerTick = 2000;  //!< Load of one flight software tick
+const size_t kPacketSize = 16;                   //!< Size of the packet exchanged in one step or tick
+
+/**
+ * @fn Load
+ * @brief Synthetic computational load
+ */
+double Load(const size_t count, double state) {
+  for (size_t i = 0; i < count; i++) state = std::sin(state) + 1.0;
+  return state;
+}
+
+/**
+ * @class SyntheticSils
+ * @brief Simulation step and flight software tick with the port traffic
+ */
+class SyntheticSils {
+ public:
+  SyntheticSils() : tx_buffer_(1024), rx_buffer_(1024) {}
+
+  void PhysicsStep() {
+    physics_state_ = Load(kPhysicsLoadPerStep, physics_state_);
+    byte packet[kPacketSize] = {};
+    tx_buffer_.Read(packet, 0, kPacketSize);
+    rx_buffer_.Write(packet, 0, kPacketSize);
+  }
+
+  void FlightSoftwareTick() {
+    flight_software_state_ = Load(kFlightSoftwareLoadPerTick, flight_software_state_);
+    byte packet[kPacketSize] = {};
+    rx_buffer_.Read(packet, 0, kPacketSize);
+    tx_buffer_.Write(packet, 0, kPacketSize);
+  }
+
+  double GetState() const { return physics_state_ + flight_software_state_; }
+
+ private:
+  RingBuffer tx_buffer_;  //!< Flight software -> Physics
+  RingBuffer rx_buffer_;  //!< Physics -> Flight software
+  double physics_state_ = 0.0;
+  double flight_software_state_ = 0.0;
+};
+
+}  // namespace
+
+/**
+ * @brief Benchmark of the simulation step with the flight software executed in the step
+ */
+static void BM_SilsStepInline(benchmark::State& state) {
+  SyntheticSils sils;
+  for (auto _ : state) {
+    for (size_t i = 0; i < kTicksPerStep; i++) sils.FlightSoftwareTick();
+    sils.PhysicsStep();
+  }
+  benchmark::DoNotOptimize(sils.GetState());
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SilsStepInline)->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief Benchmark of the simulation step with the flight software executed on LockstepThread
+ * @note Argument: sync interval (1: the flight software does not overlap with the physics)
+ */
+static void BM_SilsStepThreaded(benchmark::State& state) {
+  SyntheticSils sils;
+  {
+    LockstepThread flight_software_thread([&sils] { sils.FlightSoftwareTick(); }, (size_t)state.range(0));
+    for (auto _ : state) {
+      flight_software_thread.Advance(kTicksPerStep);
+      sils.PhysicsStep();
+    }
+    flight_software_thread.Synchronize();
+  }
+  benchmark::DoNotOptimize(sils.GetState());
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SilsStepThreaded)->Arg(1)->Arg(10)->Unit(benchmark::kMicrosecond)->UseRealTime();
@@ -0,0 +1,133 @@
+/**
+ * @file checkpoint.cpp
+ * @brief Binary snapshot of the simulation state for checkpoint and restore
+ */
+
+#include "checkpoint.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+#ifdef WIN32
+#define _WINSOCKAPI_  // stops windows.h including winsock.h
+#include <windows.h>
+#endif
+
+namespace {
+const char kMagic[8] = {'S', '2', 'E', 'C', 'K', 'P', 'T', '\0'};  //!< Magic number of the snapshot file
+}  // namespace
+
+const uint32_t CheckpointWriter::kFormatVersion;
+
+CheckpointWriter::CheckpointWriter() {
+  WriteBytes(kMagic, sizeof(kMagic));
+  Write(kFormatVersion);
+}
+
+void CheckpointWriter::Write(const std::string& value) {
+  Write((uint32_t)value.size());
+  WriteBytes(value.data(), value.size());
+}
+
+bool CheckpointWriter::SaveFile(const std::string& file_path) const {
+  const std::string temporary_file_path = file_path + ".tmp";
+  {
+    std::ofstream file(temporary_file_path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+    file.write((const char*)data_.data(), data_.size());
+    if (!file.good()) return false;
+  }
+#ifdef WIN32
+  // std::rename does not overwrite the file on Windows
+  return MoveFileExA(temporary_file_path.c_str(), file_path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+  // std::rename replaces the file atomically on POSIX
+  return std::rename(temporary_file_path.c_str(), file_path.c_str()) == 0;
+#endif
+}
+
+void CheckpointWriter::WriteBytes(const void* data, const size_t size) {
+  const unsigned char* bytes = (const unsigned char*)data;
+  data_.insert(data_.end(), bytes, bytes + size);
+}
+
+CheckpointReader::CheckpointReader(const std::vector<unsigned char>& data) : data_(data) {
+  char magic[sizeof(kMagic)];
+  ReadBytes(magic, sizeof(magic));
+  if (!is_valid_ || memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+    SetError("not a checkpoint file");
+    return;
+  }
+  uint32_t version = 0;
+  Read(version);
+  if (version != CheckpointWriter::kFormatVersion) {
+    SetError("unsupported version " + std::to_string(version));
+  }
+}
+
+CheckpointReader CheckpointReader::LoadFile(const std::string& file_path) {
+  std::ifstream file(file_path, std::ios::binary);
+  if (!file.is_open()) {
+    CheckpointReader reader(std::vector<unsigned char>{});
+    reader.error_message_ = "cannot open " + file_path;
+    return reader;
+  }
+  std::vector<unsigned char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  return CheckpointReader(data);
+}
+
+void CheckpointReader::BeginSection(const std::string& name) {
+  std::string section_name;
+  Read(section_name);
+  if (is_valid_ && section_name != name) {
+    SetError("section " + name + " is expected but " + section_name + " is found");
+  }
+}
+
+void CheckpointReader::Read(std::string& value) {
+  uint32_t size = 0;
+  Read(size);
+  if (!is_valid_) return;
+  if (size > data_.size() - position_) {
+    SetError("unexpected end of the data");
+    return;
+  }
+  value.assign((const char*)&data_[position_], size);
+  position_ += size;
+}
+
+void CheckpointReader::ReadSizeAndCheck(const size_t expected_size, const std::string& name) {
+  uint64_t size = 0;
+  Read(size);
+  if (is_valid_ && size != expected_size) {
+    SetError("size of " + name + " is " + std::to_string(size) + " but " + std::to_string(expected_size) + " is expected");
+  }
+}
+
+void CheckpointReader::ReadBytes(void* data, const size_t size) {
+  if (!is_valid_) return;
+  if (size > data_.size() - position_) {
+    SetError("unexpected end of the data");
+    return;
+  }
+  memcpy(data, &data_[position_], size);
+  position_ += size;
+}
+
+size_t CheckpointReader::ReadSize(const size_t element_size) {
+  uint64_t size = 0;
+  Read(size);
+  if (!is_valid_) return 0;
+  if (element_size > 0 && size > (data_.size() - position_) / element_size) {
+    SetError("unexpected end of the data");
+    return 0;
+  }
+  return (size_t)size;
+}
+
+void CheckpointReader::SetError(const std::string& message) {
+  if (!is_valid_) return;
+  is_valid_ = false;
+  error_message_ = message;
+}
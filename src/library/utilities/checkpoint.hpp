@@ -0,0 +1,286 @@
+/**
+ * @file checkpoint.hpp
+ * @brief Binary snapshot of the simulation state for checkpoint and restore
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_CHECKPOINT_HPP_
+#define S2E_LIBRARY_UTILITIES_CHECKPOINT_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../math/matrix.hpp"
+#include "../math/quaternion.hpp"
+#include "../math/vector.hpp"
+
+/**
+ * @class CheckpointWriter
+ * @brief Writer of the binary snapshot of the simulation state
+ * @details File layout (native byte order, little endian on all supported platforms)
+ *          - File header: magic "S2ECKPT" + '\0' (8 bytes), version (uint32)
+ *          - Body: the values written by the SaveState functions of the simulation objects in the calling order.
+ *            Each object starts with a section name (uint32 length + chars) to detect a mismatch of the simulation setting at the restore.
+ *          The values are stored without any conversion, so the restore is bit-exact on the same platform.
+ */
+class CheckpointWriter {
+ public:
+  /**
+   * @fn CheckpointWriter
+   * @brief Constructor
+   */
+  CheckpointWriter();
+
+  /**
+   * @fn BeginSection
+   * @brief Write the section name. Call this at the beginning of each SaveState function.
+   * @param [in] name: Section name
+   */
+  void BeginSection(const std::string& name) { Write(name); }
+
+  /**
+   * @fn Write
+   * @brief Write a trivially copyable value (number, boolean, enum, or plain structure)
+   * @param [in] value: Value
+   */
+  template <typename T>
+  void Write(const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "The value should be trivially copyable");
+    WriteBytes(&value, sizeof(T));
+  }
+  /**
+   * @fn Write
+   * @brief Write a string with its length
+   * @param [in] value: String
+   */
+  void Write(const std::string& value);
+  /**
+   * @fn Write
+   * @brief Write a vector of trivially copyable values with its size
+   * @param [in] values: Values
+   */
+  template <typename T>
+  void Write(const std::vector<T>& values) {
+    static_assert(std::is_trivially_copyable<T>::value, "The value should be trivially copyable");
+    Write((uint64_t)values.size());
+    if (!values.empty()) WriteBytes(values.data(), sizeof(T) * values.size());
+  }
+  /**
+   * @fn Write
+   * @brief Write a vector of vectors of trivially copyable values with its size
+   * @param [in] values: Values
+   */
+  template <typename T>
+  void Write(const std::vector<std::vector<T>>& values) {
+    Write((uint64_t)values.size());
+    for (const auto& value : values) Write(value);
+  }
+  /**
+   * @fn Write
+   * @brief Write the elements of a libra::Vector
+   * @param [in] vector: Vector
+   */
+  template <size_t N>
+  void Write(const libra::Vector<N>& vector) {
+    for (size_t i = 0; i < N; i++) Write(vector[i]);
+  }
+  /**
+   * @fn Write
+   * @brief Write the elements of a libra::Matrix
+   * @param [in] matrix: Matrix
+   */
+  template <size_t R, size_t C>
+  void Write(const libra::Matrix<R, C>& matrix) {
+    for (size_t i = 0; i < R; i++) {
+      for (size_t j = 0; j < C; j++) Write(matrix(i, j));
+    }
+  }
+  /**
+   * @fn Write
+   * @brief Write the elements of a libra::Quaternion
+   * @param [in] quaternion: Quaternion
+   */
+  void Write(const libra::Quaternion& quaternion) {
+    for (size_t i = 0; i < 4; i++) Write(quaternion[i]);
+  }
+
+  /**
+   * @fn SaveFile
+   * @brief Write the snapshot to the file
+   * @note The snapshot is written to a temporary file and renamed, so the previous snapshot is kept when the process is killed while writing.
+   * @param [in] file_path: Path to the output file
+   * @return True when the file is written
+   */
+  bool SaveFile(const std::string& file_path) const;
+
+  // Getters
+  /**
+   * @fn GetData
+   * @brief Return the snapshot including the file header
+   */
+  inline const std::vector<unsigned char>& GetData() const { return data_; }
+
+  static const uint32_t kFormatVersion = 1;  //!< Version of the snapshot format
+
+ private:
+  std::vector<unsigned char> data_;  //!< Snapshot
+
+  /**
+   * @fn WriteBytes
+   * @brief Append the raw bytes to the snapshot
+   */
+  void WriteBytes(const void* data, const size_t size);
+};
+
+/**
+ * @class CheckpointReader
+ * @brief Reader of the binary snapshot written by CheckpointWriter
+ * @details When the snapshot is broken or does not match the simulation setting, the reader becomes invalid and the following reads return
+ *          without changing the values. Check IsValid after all the objects are restored.
+ */
+class CheckpointReader {
+ public:
+  /**
+   * @fn CheckpointReader
+   * @brief Constructor with the snapshot in the memory
+   * @param [in] data: Snapshot including the file header
+   */
+  explicit CheckpointReader(const std::vector<unsigned char>& data);
+  /**
+   * @fn LoadFile
+   * @brief Read the snapshot from the file
+   * @param [in] file_path: Path to the snapshot file
+   * @return Reader. The reader is invalid when the file cannot be read or the file header is wrong.
+   */
+  static CheckpointReader LoadFile(const std::string& file_path);
+
+  /**
+   * @fn BeginSection
+   * @brief Read and check the section name. Call this at the beginning of each LoadState function.
+   * @param [in] name: Expected section name
+   */
+  void BeginSection(const std::string& name);
+
+  /**
+   * @fn Read
+   * @brief Read a trivially copyable value (number, boolean, enum, or plain structure)
+   * @param [out] value: Value
+   */
+  template <typename T>
+  void Read(T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "The value should be trivially copyable");
+    ReadBytes(&value, sizeof(T));
+  }
+  /**
+   * @fn Read
+   * @brief Read a string
+   * @param [out] value: String
+   */
+  void Read(std::string& value);
+  /**
+   * @fn Read
+   * @brief Read a vector of trivially copyable values. The vector is resized to the stored size.
+   * @param [out] values: Values
+   */
+  template <typename T>
+  void Read(std::vector<T>& values) {
+    static_assert(std::is_trivially_copyable<T>::value, "The value should be trivially copyable");
+    const size_t size = ReadSize(sizeof(T));
+    if (!is_valid_) return;
+    values.resize(size);
+    if (size > 0) ReadBytes(values.data(), sizeof(T) * size);
+  }
+  /**
+   * @fn Read
+   * @brief Read a vector of vectors of trivially copyable values. The vectors are resized to the stored sizes.
+   * @param [out] values: Values
+   */
+  template <typename T>
+  void Read(std::vector<std::vector<T>>& values) {
+    const size_t size = ReadSize(sizeof(uint64_t));
+    if (!is_valid_) return;
+    values.resize(size);
+    for (auto& value : values) Read(value);
+  }
+  /**
+   * @fn Read
+   * @brief Read the elements of a libra::Vector
+   * @param [out] vector: Vector
+   */
+  template <size_t N>
+  void Read(libra::Vector<N>& vector) {
+    for (size_t i = 0; i < N; i++) Read(vector[i]);
+  }
+  /**
+   * @fn Read
+   * @brief Read the elements of a libra::Matrix
+   * @param [out] matrix: Matrix
+   */
+  template <size_t R, size_t C>
+  void Read(libra::Matrix<R, C>& matrix) {
+    for (size_t i = 0; i < R; i++) {
+      for (size_t j = 0; j < C; j++) Read(matrix(i, j));
+    }
+  }
+  /**
+   * @fn Read
+   * @brief Read the elements of a libra::Quaternion
+   * @param [out] quaternion: Quaternion
+   */
+  void Read(libra::Quaternion& quaternion) {
+    for (size_t i = 0; i < 4; i++) Read(quaternion[i]);
+  }
+  /**
+   * @fn ReadSizeAndCheck
+   * @brief Read a size written by Write((uint64_t)size) and check that it matches the expected size
+   * @param [in] expected_size: Size of the container of the current simulation
+   * @param [in] name: Name of the container for the error message
+   */
+  void ReadSizeAndCheck(const size_t expected_size, const std::string& name);
+
+  /**
+   * @fn SetError
+   * @brief Make the reader invalid. Use this when the restored values do not match the current simulation setting.
+   * @param [in] message: Reason of the invalidity
+   */
+  void SetError(const std::string& message);
+
+  // Getters
+  /**
+   * @fn IsValid
+   * @brief Return true when all the reads succeeded
+   */
+  inline bool IsValid() const { return is_valid_; }
+  /**
+   * @fn IsEnd
+   * @brief Return true when the whole snapshot is read
+   */
+  inline bool IsEnd() const { return position_ == data_.size(); }
+  /**
+   * @fn GetErrorMessage
+   * @brief Return the reason why the reader became invalid
+   */
+  inline const std::string& GetErrorMessage() const { return error_message_; }
+
+ private:
+  std::vector<unsigned char> data_;  //!< Snapshot
+  size_t position_ = 0;              //!< Current read position
+  bool is_valid_ = true;             //!< Validity flag
+  std::string error_message_;        //!< Reason of the invalidity
+
+  /**
+   * @fn ReadBytes
+   * @brief Copy the raw bytes from the snapshot
+   */
+  void ReadBytes(void* data, const size_t size);
+  /**
+   * @fn ReadSize
+   * @brief Read a container size and check that the remaining data is large enough
+   * @param [in] element_size: Minimum size of an element [byte]
+   */
+  size_t ReadSize(const size_t element_size);
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_CHECKPOINT_HPP_
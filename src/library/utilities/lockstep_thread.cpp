@@ -0,0 +1,80 @@
+/**
+ * @file lockstep_thread.cpp
+ * @brief Dedicated thread which executes steps granted by the simulation thread
+ */
+
+#include "lockstep_thread.hpp"
+
+LockstepThread::LockstepThread(const std::function<void()>& step, const size_t sync_interval, const std::function<void()>& initialize)
+    : step_(step), initialize_(initialize), sync_interval_(sync_interval > 0 ? sync_interval : 1) {
+  thread_ = std::thread(&LockstepThread::ThreadLoop, this);
+}
+
+LockstepThread::~LockstepThread() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stop_requested_ = true;
+  }
+  steps_granted_.notify_one();
+  thread_.join();
+}
+
+void LockstepThread::Advance(const size_t number_of_steps) {
+  const bool is_sync_point = number_of_advance_calls_ % sync_interval_ == 0;
+  number_of_advance_calls_++;
+  if (number_of_steps > 0) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      number_of_granted_steps_ += number_of_steps;
+    }
+    steps_granted_.notify_one();
+  }
+  // The steps granted at the sync point are also executed before the return, so they do not overlap with the caller
+  if (is_sync_point) Synchronize();
+}
+
+void LockstepThread::Synchronize() {
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    steps_executed_.wait(lock, [this] { return number_of_executed_steps_ == number_of_granted_steps_; });
+    exception = exception_;
+    exception_ = nullptr;
+  }
+  if (exception) std::rethrow_exception(exception);
+}
+
+uint64_t LockstepThread::GetNumberOfExecutedSteps() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return number_of_executed_steps_;
+}
+
+void LockstepThread::ThreadLoop() {
+  bool is_initialized = false;
+  while (true) {
+    uint64_t number_of_steps;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      // The granted steps are executed before the stop, so the steps are not lost at the destruction
+      steps_granted_.wait(lock, [this] { return is_stop_requested_ || number_of_granted_steps_ > number_of_executed_steps_; });
+      if (number_of_granted_steps_ == number_of_executed_steps_) return;
+      number_of_steps = number_of_granted_steps_ - number_of_executed_steps_;
+    }
+
+    // The steps granted in one batch are executed without locking
+    try {
+      if (!is_initialized && initialize_) initialize_();
+      is_initialized = true;
+      for (uint64_t i = 0; i < number_of_steps; i++) step_();
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!exception_) exception_ = std::current_exception();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      number_of_executed_steps_ += number_of_steps;
+    }
+    steps_executed_.notify_one();
+  }
+}
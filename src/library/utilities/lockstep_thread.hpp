@@ -0,0 +1,90 @@
+/**
+ * @file lockstep_thread.hpp
+ * @brief Dedicated thread which executes steps granted by the simulation thread
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_LOCKSTEP_THREAD_HPP_
+#define S2E_LIBRARY_UTILITIES_LOCKSTEP_THREAD_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * @class LockstepThread
+ * @brief Dedicated thread which executes steps granted by the simulation thread
+ * @details The simulation thread grants steps as credits with Advance, and the dedicated thread executes them. At every sync_interval-th
+ *          Advance call, the simulation thread waits until all granted steps including the steps of the call are executed, so the thread
+ *          does not overlap with the work of the simulation thread after the sync point. Between the sync points, the thread executes the
+ *          steps in parallel with the simulation thread.
+ */
+class LockstepThread {
+ public:
+  /**
+   * @fn LockstepThread
+   * @brief Constructor to start the thread
+   * @param [in] step: Function of one step executed on the thread
+   * @param [in] sync_interval: Number of Advance calls between the sync points. 1 means that every Advance call waits for its steps.
+   * @param [in] initialize: Function executed once on the thread before the first step (optional)
+   */
+  LockstepThread(const std::function<void()>& step, const size_t sync_interval = 1, const std::function<void()>& initialize = nullptr);
+  /**
+   * @fn ~LockstepThread
+   * @brief Destructor to stop the thread after the granted steps are executed
+   */
+  ~LockstepThread();
+  LockstepThread(const LockstepThread&) = delete;
+  LockstepThread& operator=(const LockstepThread&) = delete;
+
+  /**
+   * @fn Advance
+   * @brief Grant steps to the thread. The execution is waited for only at the sync points.
+   * @note The exception thrown by the steps is rethrown at the sync points as Synchronize.
+   * @param [in] number_of_steps: Number of steps to grant
+   */
+  void Advance(const size_t number_of_steps);
+  /**
+   * @fn Synchronize
+   * @brief Wait until all granted steps are executed
+   * @note The first exception thrown by the steps is rethrown here. The remaining steps of the batch which threw the exception are skipped.
+   */
+  void Synchronize();
+
+  // Getters
+  /**
+   * @fn GetNumberOfExecutedSteps
+   * @brief Return number of executed steps
+   */
+  uint64_t GetNumberOfExecutedSteps() const;
+  /**
+   * @fn GetSyncInterval
+   * @brief Return number of Advance calls between the sync points
+   */
+  inline size_t GetSyncInterval() const { return sync_interval_; }
+
+ private:
+  std::function<void()> step_;              //!< Function of one step
+  std::function<void()> initialize_;        //!< Function executed before the first step
+  const size_t sync_interval_;              //!< Number of Advance calls between the sync points
+  uint64_t number_of_advance_calls_ = 0;    //!< Number of Advance calls
+  mutable std::mutex mutex_;                //!< Mutex for the shared states below
+  std::condition_variable steps_granted_;   //!< Notified when new steps are granted or the stop is requested
+  std::condition_variable steps_executed_;  //!< Notified when the granted steps are executed
+  uint64_t number_of_granted_steps_ = 0;    //!< Total number of granted steps
+  uint64_t number_of_executed_steps_ = 0;   //!< Total number of executed steps
+  bool is_stop_requested_ = false;          //!< Stop request for the thread
+  std::exception_ptr exception_;            //!< First exception thrown by the steps
+  std::thread thread_;                      //!< Thread to execute the steps
+
+  /**
+   * @fn ThreadLoop
+   * @brief Main routine of the thread
+   */
+  void ThreadLoop();
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_LOCKSTEP_THREAD_HPP_
@@ -0,0 +1,63 @@
+/**
+ * @file memory_mapped_file.cpp
+ * @brief Read-only memory mapped file
+ */
+
+#include "memory_mapped_file.hpp"
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <fstream>
+
+MemoryMappedFile::~MemoryMappedFile() { Close(); }
+
+bool MemoryMappedFile::Open(const std::string& file_path) {
+  Close();
+#ifndef WIN32
+  int file_descriptor = open(file_path.c_str(), O_RDONLY);
+  if (file_descriptor < 0) return false;
+  struct stat file_status;
+  if (fstat(file_descriptor, &file_status) != 0 || file_status.st_size <= 0) {
+    close(file_descriptor);
+    return false;
+  }
+  void* address = mmap(nullptr, (size_t)file_status.st_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  // The mapping is kept after closing the descriptor
+  close(file_descriptor);
+  if (address == MAP_FAILED) return false;
+  data_ = static_cast<const unsigned char*>(address);
+  size_ = (size_t)file_status.st_size;
+#else
+  std::ifstream file(file_path, std::ios::binary | std::ios::ate);
+  if (!file.is_open()) return false;
+  const std::streamoff file_size = file.tellg();
+  if (file_size <= 0) return false;
+  buffer_.resize((size_t)file_size);
+  file.seekg(0);
+  file.read(reinterpret_cast<char*>(buffer_.data()), file_size);
+  if (!file) {
+    buffer_.clear();
+    return false;
+  }
+  data_ = buffer_.data();
+  size_ = buffer_.size();
+#endif
+  return true;
+}
+
+void MemoryMappedFile::Close() {
+  if (data_ == nullptr) return;
+#ifndef WIN32
+  munmap(const_cast<unsigned char*>(data_), size_);
+#else
+  buffer_.clear();
+  buffer_.shrink_to_fit();
+#endif
+  data_ = nullptr;
+  size_ = 0;
+}
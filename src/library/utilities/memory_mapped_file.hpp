@@ -0,0 +1,69 @@
+/**
+ * @file memory_mapped_file.hpp
+ * @brief Read-only memory mapped file
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_MEMORY_MAPPED_FILE_HPP_
+#define S2E_LIBRARY_UTILITIES_MEMORY_MAPPED_FILE_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @class MemoryMappedFile
+ * @brief Read-only memory mapped file
+ * @note The file is mapped with mmap on POSIX platforms. On Windows, the whole file is read into the memory instead.
+ */
+class MemoryMappedFile {
+ public:
+  /**
+   * @fn MemoryMappedFile
+   * @brief Default constructor
+   */
+  MemoryMappedFile() {}
+  /**
+   * @fn ~MemoryMappedFile
+   * @brief Destructor to unmap the file
+   */
+  ~MemoryMappedFile();
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  /**
+   * @fn Open
+   * @brief Map the file. The previously mapped file is closed.
+   * @param [in] file_path: Path to the file
+   * @return True when the file is mapped
+   */
+  bool Open(const std::string& file_path);
+  /**
+   * @fn Close
+   * @brief Unmap the file
+   */
+  void Close();
+
+  // Getters
+  /**
+   * @fn IsOpened
+   * @brief Return true when the file is mapped
+   */
+  inline bool IsOpened() const { return data_ != nullptr; }
+  /**
+   * @fn GetData
+   * @brief Return the head address of the mapped file
+   */
+  inline const unsigned char* GetData() const { return data_; }
+  /**
+   * @fn GetSize
+   * @brief Return the file size [byte]
+   */
+  inline size_t GetSize() const { return size_; }
+
+ private:
+  const unsigned char* data_ = nullptr;  //!< Head address of the mapped file
+  size_t size_ = 0;                      //!< File size [byte]
+  std::vector<unsigned char> buffer_;    //!< Buffer used when the memory map is not available
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_MEMORY_MAPPED_FILE_HPP_
@@ -0,0 +1,330 @@
+/**
+ * @file profiler.cpp
+ * @brief Hierarchical scoped-timer profiler for the simulation step
+ */
+
+#include "profiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <thread>
+
+#ifdef __GNUG__
+#include <cxxabi.h>
+
+#include <cstdlib>
+#endif
+
+Profiler simulation_profiler;
+
+/**
+ * @struct Profiler::ThreadData
+ * @brief Call tree and trace events of a thread
+ */
+struct Profiler::ThreadData {
+  /**
+   * @struct Node
+   * @brief Scope in the call tree
+   */
+  struct Node {
+    const char* name = "";            //!< Scope name
+    std::vector<size_t> children;     //!< IDs of the child nodes
+    uint64_t number_of_calls = 0;     //!< Number of the calls
+    double total_time_s = 0.0;        //!< Total execution time [s]
+    double max_time_s = 0.0;          //!< Maximum execution time [s]
+    std::vector<uint64_t> histogram;  //!< Histogram of the execution time
+  };
+  /**
+   * @struct TraceEvent
+   * @brief Execution of a scope for the Chrome trace
+   */
+  struct TraceEvent {
+    const char* name;    //!< Scope name
+    double start_us;     //!< Start time from the time origin [us]
+    double duration_us;  //!< Execution time [us]
+  };
+
+  std::thread::id thread_id;              //!< ID of the thread
+  size_t thread_index = 0;                //!< Index of the thread in the trace
+  std::vector<Node> nodes;                //!< Nodes. The first node is the root of the tree.
+  size_t current_node_id = 0;             //!< Node of the current scope
+  std::vector<TraceEvent> trace_events;   //!< Recorded trace events
+  uint64_t number_of_dropped_events = 0;  //!< Number of the events not recorded due to the maximum number
+
+  /**
+   * @fn Clear
+   * @brief Clear the call tree and the trace events
+   */
+  void Clear() {
+    nodes.assign(1, Node());
+    current_node_id = 0;
+    trace_events.clear();
+    number_of_dropped_events = 0;
+  }
+  /**
+   * @fn FindOrAddChild
+   * @brief Return the child node with the name
+   */
+  size_t FindOrAddChild(const size_t parent_node_id, const char* name) {
+    for (const size_t child_id : nodes[parent_node_id].children) {
+      const char* child_name = nodes[child_id].name;
+      if (child_name == name || std::strcmp(child_name, name) == 0) return child_id;
+    }
+    Node node;
+    node.name = name;
+    node.histogram.assign(kNumberOfHistogramBins, 0);
+    nodes.push_back(std::move(node));
+    const size_t child_id = nodes.size() - 1;
+    nodes[parent_node_id].children.push_back(child_id);
+    return child_id;
+  }
+};
+
+namespace {
+/**
+ * @struct ThreadCache
+ * @brief Call tree of the current thread for the profiler used last in the thread
+ */
+struct ThreadCache {
+  uint64_t instance_id = 0;     //!< ID of the profiler (0: none)
+  void* thread_data = nullptr;  //!< Call tree
+};
+thread_local ThreadCache thread_cache;
+std::atomic<uint64_t> last_instance_id(0);
+
+/**
+ * @struct ReportNode
+ * @brief Scope in the call tree merged over the threads
+ */
+struct ReportNode {
+  std::string name;                  //!< Demangled scope name
+  uint64_t number_of_calls = 0;      //!< Number of the calls
+  double total_time_s = 0.0;         //!< Total execution time [s]
+  double max_time_s = 0.0;           //!< Maximum execution time [s]
+  std::vector<uint64_t> histogram;   //!< Histogram of the execution time
+  std::vector<ReportNode> children;  //!< Child scopes
+};
+
+/**
+ * @fn Demangle
+ * @brief Return the readable name of the typeid name. Other names are returned as they are.
+ */
+std::string Demangle(const char* name) {
+#ifdef __GNUG__
+  int status = 0;
+  char* demangled_name = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+  if (status == 0 && demangled_name != nullptr) {
+    std::string result(demangled_name);
+    std::free(demangled_name);
+    return result;
+  }
+  std::free(demangled_name);
+#endif
+  return std::string(name);
+}
+
+/**
+ * @fn EscapeJson
+ * @brief Escape the string for JSON
+ */
+std::string EscapeJson(const std::string& input) {
+  std::string output;
+  for (const char c : input) {
+    if (c == '"' || c == '\\') output += '\\';
+    output += c;
+  }
+  return output;
+}
+}  // namespace
+
+Profiler::ScopedTimer::ScopedTimer(Profiler& profiler, const char* name) : profiler_(profiler), thread_data_(profiler.GetThreadData()) {
+  parent_node_id_ = thread_data_.current_node_id;
+  node_id_ = thread_data_.FindOrAddChild(parent_node_id_, name);
+  thread_data_.current_node_id = node_id_;
+  start_time_ = std::chrono::steady_clock::now();
+}
+
+Profiler::ScopedTimer::~ScopedTimer() {
+  const std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
+  const double time_s = std::chrono::duration<double>(end_time - start_time_).count();
+
+  ThreadData::Node& node = thread_data_.nodes[node_id_];
+  node.number_of_calls++;
+  node.total_time_s += time_s;
+  node.max_time_s = std::max(node.max_time_s, time_s);
+  node.histogram[CalcHistogramBin(time_s)]++;
+  thread_data_.current_node_id = parent_node_id_;
+
+  if (profiler_.is_trace_enabled_.load(std::memory_order_relaxed)) {
+    if (thread_data_.trace_events.size() < profiler_.max_number_of_events_) {
+      const double start_us = std::chrono::duration<double, std::micro>(start_time_ - profiler_.origin_time_).count();
+      thread_data_.trace_events.push_back({node.name, start_us, time_s * 1.0e6});
+    } else {
+      thread_data_.number_of_dropped_events++;
+    }
+  }
+}
+
+Profiler::Profiler() : instance_id_(++last_instance_id), origin_time_(std::chrono::steady_clock::now()), is_trace_enabled_(false) {}
+
+Profiler::~Profiler() {}
+
+void Profiler::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& thread_data : thread_data_) thread_data->Clear();
+  origin_time_ = std::chrono::steady_clock::now();
+}
+
+void Profiler::SetTraceEnabled(const bool is_enabled, const size_t max_number_of_events) {
+  max_number_of_events_ = max_number_of_events;
+  is_trace_enabled_ = is_enabled;
+}
+
+Profiler::ThreadData& Profiler::GetThreadData() {
+  if (thread_cache.instance_id == instance_id_) return *static_cast<ThreadData*>(thread_cache.thread_data);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  const std::thread::id thread_id = std::this_thread::get_id();
+  ThreadData* found_thread_data = nullptr;
+  for (auto& thread_data : thread_data_) {
+    if (thread_data->thread_id == thread_id) found_thread_data = thread_data.get();
+  }
+  if (found_thread_data == nullptr) {
+    thread_data_.emplace_back(new ThreadData());
+    found_thread_data = thread_data_.back().get();
+    found_thread_data->thread_id = thread_id;
+    found_thread_data->thread_index = thread_data_.size() - 1;
+    found_thread_data->Clear();
+  }
+  thread_cache.instance_id = instance_id_;
+  thread_cache.thread_data = found_thread_data;
+  return *found_thread_data;
+}
+
+void Profiler::PrintReport(std::ostream& stream) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Merge the call trees of the threads by the scope names
+  ReportNode root;
+  std::function<void(const ThreadData&, const size_t, ReportNode&)> merge_node = [&](const ThreadData& thread_data, const size_t node_id,
+                                                                                       ReportNode& report_node) {
+    for (const size_t child_id : thread_data.nodes[node_id].children) {
+      const ThreadData::Node& child = thread_data.nodes[child_id];
+      const std::string child_name = Demangle(child.name);
+      auto report_child = std::find_if(report_node.children.begin(), report_node.children.end(),
+                                       [&child_name](const ReportNode& node) { return node.name == child_name; });
+      if (report_child == report_node.children.end()) {
+        report_node.children.push_back(ReportNode());
+        report_child = report_node.children.end() - 1;
+        report_child->name = child_name;
+        report_child->histogram.assign(kNumberOfHistogramBins, 0);
+      }
+      report_child->number_of_calls += child.number_of_calls;
+      report_child->total_time_s += child.total_time_s;
+      report_child->max_time_s = std::max(report_child->max_time_s, child.max_time_s);
+      for (size_t bin = 0; bin < kNumberOfHistogramBins; bin++) report_child->histogram[bin] += child.histogram[bin];
+      merge_node(thread_data, child_id, *report_child);
+    }
+  };
+  for (const auto& thread_data : thread_data_) merge_node(*thread_data, 0, root);
+
+  double step_time_s = 0.0;
+  for (const auto& node : root.children) step_time_s = std::max(step_time_s, node.total_time_s);
+
+  // Sort by the total time to find the slow scopes easily
+  size_t name_width = 5;
+  std::function<void(ReportNode&, const size_t)> sort_node = [&](ReportNode& report_node, const size_t depth) {
+    std::sort(report_node.children.begin(), report_node.children.end(),
+              [](const ReportNode& a, const ReportNode& b) { return a.total_time_s > b.total_time_s; });
+    for (auto& child : report_node.children) {
+      name_width = std::max(name_width, 2 * depth + child.name.size());
+      sort_node(child, depth + 1);
+    }
+  };
+  sort_node(root, 0);
+
+  stream << "Profiler report" << std::endl;
+  stream << "  " << std::left << std::setw(name_width) << "Scope" << std::right << std::setw(12) << "Calls" << std::setw(14) << "Mean[us]"
+         << std::setw(14) << "P99[us]" << std::setw(14) << "Max[us]" << std::setw(12) << "Share[%]" << std::endl;
+  std::function<void(const ReportNode&, const size_t)> print_node = [&](const ReportNode& report_node, const size_t depth) {
+    for (const auto& child : report_node.children) {
+      const double mean_time_s = (child.number_of_calls > 0) ? child.total_time_s / (double)child.number_of_calls : 0.0;
+      const double share = (step_time_s > 0.0) ? child.total_time_s / step_time_s * 100.0 : 0.0;
+      stream << "  " << std::string(2 * depth, ' ') << std::left << std::setw(name_width - 2 * depth) << child.name << std::right
+             << std::setw(12) << child.number_of_calls << std::fixed << std::setprecision(3) << std::setw(14) << mean_time_s * 1.0e6
+             << std::setw(14) << CalcPercentile(child.histogram, 0.99) * 1.0e6 << std::setw(14) << child.max_time_s * 1.0e6
+             << std::setprecision(2) << std::setw(12) << share << std::defaultfloat << std::endl;
+      print_node(child, depth + 1);
+    }
+  };
+  print_node(root, 0);
+}
+
+bool Profiler::WriteChromeTrace(const std::string& file_path) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::ofstream file(file_path);
+  if (!file.is_open()) {
+    std::cerr << "WARNING: failed to open the profiler trace file " << file_path << std::endl;
+    return false;
+  }
+
+  std::map<const char*, std::string> names;  // Demangle each name only once
+  uint64_t number_of_dropped_events = 0;
+  bool is_first = true;
+  file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  file << std::fixed << std::setprecision(3);
+  for (const auto& thread_data : thread_data_) {
+    file << (is_first ? "\n" : ",\n");
+    is_first = false;
+    file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread_data->thread_index << ",\"args\":{\"name\":\"thread "
+         << thread_data->thread_index << "\"}}";
+    for (const auto& event : thread_data->trace_events) {
+      auto name = names.find(event.name);
+      if (name == names.end()) name = names.emplace(event.name, EscapeJson(Demangle(event.name))).first;
+      file << ",\n{\"name\":\"" << name->second << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << thread_data->thread_index
+           << ",\"ts\":" << event.start_us << ",\"dur\":" << event.duration_us << "}";
+    }
+    number_of_dropped_events += thread_data->number_of_dropped_events;
+  }
+  file << "\n]}" << std::endl;
+
+  if (number_of_dropped_events > 0) {
+    std::cerr << "WARNING: " << number_of_dropped_events << " profiler trace events are not recorded due to the maximum number" << std::endl;
+  }
+  return file.good();
+}
+
+double Profiler::CalcPercentile(const std::vector<uint64_t>& histogram, const double ratio) {
+  uint64_t number_of_samples = 0;
+  for (const uint64_t count : histogram) number_of_samples += count;
+  if (number_of_samples == 0) return 0.0;
+
+  const double threshold = ratio * (double)number_of_samples;
+  uint64_t cumulative_count = 0;
+  size_t bin = 0;
+  for (; bin < histogram.size(); bin++) {
+    cumulative_count += histogram[bin];
+    if ((double)cumulative_count >= threshold) break;
+  }
+  bin = std::min(bin, histogram.size() - 1);
+  // Upper edge of the bin: (1 + (sub_bin + 1) / 4) * 2^octave [ns]
+  const size_t octave = bin / 4;
+  const size_t sub_bin = bin % 4;
+  return std::ldexp(1.0 + (double)(sub_bin + 1) / 4.0, (int)octave) * 1.0e-9;
+}
+
+size_t Profiler::CalcHistogramBin(const double time_s) {
+  const double time_ns = time_s * 1.0e9;
+  if (!(time_ns >= 1.0)) return 0;
+  int exponent = 0;
+  const double mantissa = std::frexp(time_ns, &exponent);  // time_ns = mantissa * 2^exponent, mantissa in [0.5, 1)
+  const size_t octave = (size_t)(exponent - 1);
+  const size_t sub_bin = std::min((size_t)((mantissa - 0.5) * 8.0), (size_t)3);
+  return std::min(octave * 4 + sub_bin, kNumberOfHistogramBins - 1);
+}
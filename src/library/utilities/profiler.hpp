@@ -0,0 +1,146 @@
+/**
+ * @file profiler.hpp
+ * @brief Hierarchical scoped-timer profiler for the simulation step
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_PROFILER_HPP_
+#define S2E_LIBRARY_UTILITIES_PROFILER_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @class Profiler
+ * @brief Hierarchical scoped-timer profiler
+ * @details The scopes are measured with S2E_PROFILE_SCOPE. The nested scopes make a call tree for each thread, and the trees of all the threads
+ *          are merged by the scope names in the report. The execution time of each scope is accumulated in a histogram with four bins per
+ *          octave to estimate the 99th percentile without storing all the samples.
+ *          Reset, PrintReport and WriteChromeTrace should be called when no scope is measured.
+ */
+class Profiler {
+ private:
+  struct ThreadData;
+
+ public:
+  /**
+   * @class ScopedTimer
+   * @brief Timer to measure the execution time of the scope
+   */
+  class ScopedTimer {
+   public:
+    /**
+     * @fn ScopedTimer
+     * @brief Constructor to start the measurement
+     * @param [in] profiler: Profiler
+     * @param [in] name: Scope name. The string should exist until the report (e.g. string literal or typeid name).
+     */
+    ScopedTimer(Profiler& profiler, const char* name);
+    /**
+     * @fn ~ScopedTimer
+     * @brief Destructor to record the measurement
+     */
+    ~ScopedTimer();
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+   private:
+    Profiler& profiler_;                                //!< Profiler
+    ThreadData& thread_data_;                           //!< Call tree of the current thread
+    size_t node_id_;                                    //!< ID of the measured node in the call tree
+    size_t parent_node_id_;                             //!< ID of the parent node in the call tree
+    std::chrono::steady_clock::time_point start_time_;  //!< Start time of the measurement
+  };
+
+  /**
+   * @fn Profiler
+   * @brief Constructor
+   */
+  Profiler();
+  /**
+   * @fn ~Profiler
+   * @brief Destructor
+   */
+  ~Profiler();
+
+  /**
+   * @fn Reset
+   * @brief Clear the measurements and restart the time origin of the trace
+   */
+  void Reset();
+  /**
+   * @fn SetTraceEnabled
+   * @brief Enable or disable the recording of each scope for the Chrome trace
+   * @param [in] is_enabled: Flag to record the trace events
+   * @param [in] max_number_of_events: Maximum number of the events recorded by each thread to limit the memory usage
+   */
+  void SetTraceEnabled(const bool is_enabled, const size_t max_number_of_events = 1000000);
+
+  /**
+   * @fn PrintReport
+   * @brief Print the call tree with the call counts, the mean and 99th percentile time per call, and the share of the step
+   * @note The share is the ratio to the total time of the root scope which takes the longest time (normally the simulation step).
+   *       The scopes executed on the worker threads appear as separate root scopes.
+   * @param [out] stream: Output stream
+   */
+  void PrintReport(std::ostream& stream) const;
+  /**
+   * @fn WriteChromeTrace
+   * @brief Write the recorded trace events in the Chrome trace JSON format (chrome://tracing or Perfetto)
+   * @param [in] file_path: Path to the output file
+   * @return True when the file is written
+   */
+  bool WriteChromeTrace(const std::string& file_path) const;
+
+  /**
+   * @fn CalcPercentile
+   * @brief Estimate the percentile of the execution time from the histogram
+   * @param [in] histogram: Histogram of the execution time
+   * @param [in] ratio: Percentile ratio (e.g. 0.99)
+   * @return Upper edge of the bin including the percentile [s]
+   */
+  static double CalcPercentile(const std::vector<uint64_t>& histogram, const double ratio);
+  /**
+   * @fn CalcHistogramBin
+   * @brief Return the histogram bin of the execution time
+   * @param [in] time_s: Execution time [s]
+   */
+  static size_t CalcHistogramBin(const double time_s);
+
+  static const size_t kNumberOfHistogramBins = 4 * 48;  //!< Four bins per octave from 1 ns
+
+ private:
+  const uint64_t instance_id_;                            //!< ID to find the thread data of this instance
+  std::vector<std::unique_ptr<ThreadData>> thread_data_;  //!< Call trees of the threads
+  mutable std::mutex mutex_;                              //!< Mutex for thread_data_
+  std::chrono::steady_clock::time_point origin_time_;     //!< Time origin of the trace
+  std::atomic<bool> is_trace_enabled_;                    //!< Flag to record the trace events
+  size_t max_number_of_events_ = 0;                       //!< Maximum number of the trace events of each thread
+
+  /**
+   * @fn GetThreadData
+   * @brief Return the call tree of the current thread. The tree is created at the first call in the thread.
+   */
+  ThreadData& GetThreadData();
+};
+
+extern Profiler simulation_profiler;  //!< Profiler of the simulation
+
+#ifdef S2E_PROFILER
+#define S2E_PROFILE_CONCAT_INNER(a, b) a##b
+#define S2E_PROFILE_CONCAT(a, b) S2E_PROFILE_CONCAT_INNER(a, b)
+/**
+ * @brief Measure the execution time of the current scope. Compiled out when S2E_PROFILER is not defined.
+ * @param name: Scope name (string literal or typeid name)
+ */
+#define S2E_PROFILE_SCOPE(name) Profiler::ScopedTimer S2E_PROFILE_CONCAT(s2e_profile_timer_, __LINE__)(simulation_profiler, name)
+#else
+#define S2E_PROFILE_SCOPE(name)
+#endif
+
+#endif  // S2E_LIBRARY_UTILITIES_PROFILER_HPP_
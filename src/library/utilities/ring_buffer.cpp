@@ -5,42 +5,112 @@
 
 #include "ring_buffer.hpp"
 
-#include <stdlib.h>
-
 #include <algorithm>
 #include <cstring>
 
-RingBuffer::RingBuffer(int buffer_size) : buffer_size_(buffer_size) {
-  buffer_ = new byte[buffer_size];
-  write_pointer_ = 0;
-  read_pointer_ = 0;
+RingBuffer::RingBuffer(int buffer_size) {
+  size_t capacity = 1;
+  while (buffer_size > 0 && capacity < (size_t)buffer_size) capacity <<= 1;
+  buffer_.assign(capacity, 0);
+  index_mask_ = capacity - 1;
 }
 
-RingBuffer::~RingBuffer() { delete[] buffer_; }
-
 int RingBuffer::Write(const byte* buffer, const unsigned int offset, const unsigned int data_length) {
-  unsigned int write_count = 0;
-  while (write_count != data_length) {
-    unsigned int write_len = std::min(buffer_size_ - write_pointer_, data_length - write_count);
-    memcpy(&buffer_[write_pointer_], &buffer[offset + write_count], write_len);
-    write_pointer_ = (write_pointer_ + write_len == buffer_size_) ? 0 : write_pointer_ + write_len;
-    write_count += write_len;
-  }
+  RingBufferRegion<byte> region = GetWritableRegion();
+  const size_t write_length = std::min<size_t>(data_length, region.GetSize());
+  const size_t first_length = std::min(write_length, region.first_size);
+  memcpy(region.first_data, &buffer[offset], first_length);
+  if (write_length > first_length) memcpy(region.second_data, &buffer[offset + first_length], write_length - first_length);
+  CommitWrite(write_length);
 
-  return write_count;
+  if (write_length < data_length) overflow_count_.fetch_add(data_length - write_length, std::memory_order_relaxed);
+  return (int)write_length;
 }
 
 int RingBuffer::Read(byte* buffer, const unsigned int offset, const unsigned int data_length) {
-  unsigned int read_count = 0;
-  // There are four behaviors depending on whether the RP overtakes the WP, or
-  // whether all of the RP to the WP are requested by data_length.
-  while (read_count != data_length && write_pointer_ != read_pointer_) {
-    unsigned int read_len = (write_pointer_ > read_pointer_) ? std::min(write_pointer_ - read_pointer_, data_length - read_count)
-                                                             : std::min(buffer_size_ - read_pointer_, data_length - read_count);
-    memcpy(&buffer[offset + read_count], &buffer_[read_pointer_], read_len);
-    read_pointer_ = (read_pointer_ + read_len == buffer_size_) ? 0 : read_pointer_ + read_len;
-    read_count += read_len;
-  }
+  RingBufferRegion<const byte> region = GetReadableRegion();
+  const size_t read_length = std::min<size_t>(data_length, region.GetSize());
+  const size_t first_length = std::min(read_length, region.first_size);
+  memcpy(&buffer[offset], region.first_data, first_length);
+  if (read_length > first_length) memcpy(&buffer[offset + first_length], region.second_data, read_length - first_length);
+  CommitRead(read_length);
+
+  return (int)read_length;
+}
+
+RingBufferRegion<byte> RingBuffer::GetWritableRegion() {
+  // The acquire load makes sure that the consumer finished reading the released region before it is overwritten
+  const size_t write_index = write_index_.load(std::memory_order_relaxed);
+  const size_t read_index = read_index_.load(std::memory_order_acquire);
+  const size_t free_size = GetCapacity() - (write_index - read_index);
+  const size_t position = write_index & index_mask_;
+
+  RingBufferRegion<byte> region;
+  region.first_data = &buffer_[position];
+  region.first_size = std::min(free_size, GetCapacity() - position);
+  region.second_data = &buffer_[0];
+  region.second_size = free_size - region.first_size;
+  return region;
+}
+
+void RingBuffer::CommitWrite(const size_t length) {
+  const size_t write_index = write_index_.load(std::memory_order_relaxed);
+  const size_t read_index = read_index_.load(std::memory_order_acquire);
+  const size_t commit_length = std::min(length, GetCapacity() - (write_index - read_index));
+  // The release store publishes the written data to the consumer
+  write_index_.store(write_index + commit_length, std::memory_order_release);
+}
 
-  return read_count;
+RingBufferRegion<const byte> RingBuffer::GetReadableRegion() {
+  const size_t read_index = read_index_.load(std::memory_order_relaxed);
+  const size_t write_index = write_index_.load(std::memory_order_acquire);
+  const size_t unread_size = write_index - read_index;
+  const size_t position = read_index & index_mask_;
+
+  RingBufferRegion<const byte> region;
+  region.first_data = &buffer_[position];
+  region.first_size = std::min(unread_size, GetCapacity() - position);
+  region.second_data = &buffer_[0];
+  region.second_size = unread_size - region.first_size;
+  return region;
+}
+
+void RingBuffer::CommitRead(const size_t length) {
+  const size_t read_index = read_index_.load(std::memory_order_relaxed);
+  const size_t write_index = write_index_.load(std::memory_order_acquire);
+  const size_t commit_length = std::min(length, write_index - read_index);
+  // The release store hands the read region back to the producer
+  read_index_.store(read_index + commit_length, std::memory_order_release);
+}
+
+size_t RingBuffer::GetReadableSize() const {
+  // The read index is loaded first, so the write index is not older than it
+  const size_t read_index = read_index_.load(std::memory_order_acquire);
+  const size_t write_index = write_index_.load(std::memory_order_acquire);
+  return std::min(write_index - read_index, GetCapacity());
+}
+
+void RingBuffer::SaveState(CheckpointWriter& writer) const {
+  writer.Write(buffer_);
+  writer.Write((uint64_t)write_index_.load(std::memory_order_acquire));
+  writer.Write((uint64_t)read_index_.load(std::memory_order_acquire));
+  writer.Write(overflow_count_.load(std::memory_order_relaxed));
+}
+
+void RingBuffer::LoadState(CheckpointReader& reader) {
+  std::vector<byte> buffer;
+  uint64_t write_index = 0, read_index = 0, overflow_count = 0;
+  reader.Read(buffer);
+  reader.Read(write_index);
+  reader.Read(read_index);
+  reader.Read(overflow_count);
+  if (!reader.IsValid()) return;
+  if (buffer.size() != buffer_.size()) {
+    reader.SetError("capacity of the ring buffer is different");
+    return;
+  }
+  buffer_ = buffer;
+  write_index_.store((size_t)write_index, std::memory_order_release);
+  read_index_.store((size_t)read_index, std::memory_order_release);
+  overflow_count_.store(overflow_count, std::memory_order_relaxed);
 }
@@ -6,29 +6,57 @@
 #ifndef S2E_LIBRARY_UTILITIES_RING_BUFFER_HPP_
 #define S2E_LIBRARY_UTILITIES_RING_BUFFER_HPP_
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "checkpoint.hpp"
+
 typedef unsigned char byte;
 
+/**
+ * @struct RingBufferRegion
+ * @brief Region in the ring buffer which is made of up to two contiguous spans
+ * @details The second span is used when the region wraps around the end of the buffer.
+ */
+template <typename T>
+struct RingBufferRegion {
+  T* first_data = nullptr;   //!< Pointer to the first span
+  size_t first_size = 0;     //!< Size of the first span
+  T* second_data = nullptr;  //!< Pointer to the second span
+  size_t second_size = 0;    //!< Size of the second span
+
+  /**
+   * @fn GetSize
+   * @brief Return total size of the region
+   */
+  inline size_t GetSize() const { return first_size + second_size; }
+};
+
 /**
  * @class RingBuffer
- * @brief Class to emulate ring buffer
+ * @brief Lock-free single-producer single-consumer ring buffer
+ * @details One thread can write and another thread can read concurrently without locks. The capacity is rounded up to a power of two.
+ *          The data which does not fit the free space is dropped and counted as overflow instead of overwriting the unread data.
+ *          Write, GetWritableRegion, and CommitWrite must be called by the producer thread only, and Read, GetReadableRegion, and
+ *          CommitRead must be called by the consumer thread only.
  */
 class RingBuffer {
  public:
   /**
    * @fn RingBuffer
    * @brief Constructor
-   * @param [in] buffer_size: Buffer size
+   * @param [in] buffer_size: Buffer size. It is rounded up to a power of two.
    */
   RingBuffer(int buffer_size);
-  /**
-   * @fn ~RingBuffer
-   * @brief Destructor
-   */
-  ~RingBuffer();
+  RingBuffer(const RingBuffer&) = delete;
+  RingBuffer& operator=(const RingBuffer&) = delete;
 
   /**
    * @fn Write
    * @brief Write data of (buffer[offset] to buffer[offset + data_length]) to the ring buffer's write pointer
+   * @note The data which exceeds the free space is dropped and added to the overflow count.
    * @param [in] buffer: Data
    * @param [in] offset: Data offset for buffer
    * @param [in] data_length:  Data length for buffer
@@ -45,11 +73,75 @@ class RingBuffer {
    */
   int Read(byte* buffer, const unsigned int offset, const unsigned int data_length);
 
+  // Zero-copy access
+  /**
+   * @fn GetWritableRegion
+   * @brief Return the free region to write directly. The written data is published by CommitWrite.
+   */
+  RingBufferRegion<byte> GetWritableRegion();
+  /**
+   * @fn CommitWrite
+   * @brief Publish the data written in the region returned by GetWritableRegion
+   * @param [in] length: Length of written data. It is limited to the free space.
+   */
+  void CommitWrite(const size_t length);
+  /**
+   * @fn GetReadableRegion
+   * @brief Return the unread region to read directly. The region is released by CommitRead.
+   */
+  RingBufferRegion<const byte> GetReadableRegion();
+  /**
+   * @fn CommitRead
+   * @brief Release the data read in the region returned by GetReadableRegion
+   * @param [in] length: Length of read data. It is limited to the unread data.
+   */
+  void CommitRead(const size_t length);
+
+  /**
+   * @fn SaveState
+   * @brief Write the buffered data and the indices to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the buffered data and the indices from the checkpoint. The capacity should be the same.
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader);
+
+  // Getters
+  /**
+   * @fn GetCapacity
+   * @brief Return capacity of the buffer
+   */
+  inline size_t GetCapacity() const { return buffer_.size(); }
+  /**
+   * @fn GetReadableSize
+   * @brief Return length of the unread data
+   */
+  size_t GetReadableSize() const;
+  /**
+   * @fn GetWritableSize
+   * @brief Return length of the free space
+   */
+  inline size_t GetWritableSize() const { return GetCapacity() - GetReadableSize(); }
+  /**
+   * @fn GetOverflowCount
+   * @brief Return total number of bytes dropped because the buffer was full
+   */
+  inline uint64_t GetOverflowCount() const { return overflow_count_.load(std::memory_order_relaxed); }
+
  private:
-  unsigned int buffer_size_;    //!< Buffer size
-  byte* buffer_;                //!< Buffer
-  unsigned int read_pointer_;   //!< Read pointer
-  unsigned int write_pointer_;  //!< Write pointer
+  static const size_t kCacheLineSize = 64;  //!< Cache line size to separate the indices of the producer and the consumer
+
+  std::vector<byte> buffer_;  //!< Buffer
+  size_t index_mask_;         //!< Mask to convert the index to the position in the buffer
+
+  // The indices increase monotonically and are masked at the access, so the full and the empty states are distinguished.
+  alignas(kCacheLineSize) std::atomic<size_t> write_index_{0};  //!< Write index updated by the producer
+  std::atomic<uint64_t> overflow_count_{0};                     //!< Number of dropped bytes updated by the producer
+  alignas(kCacheLineSize) std::atomic<size_t> read_index_{0};   //!< Read index updated by the consumer
 };
 
 #endif  // S2E_LIBRARY_UTILITIES_RING_BUFFER_HPP_
@@ -0,0 +1,465 @@
+/**
+ * @file test_checkpoint.cpp
+ * @brief Test codes for CheckpointWriter and CheckpointReader classes with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <components/base/sensor.hpp>
+#include <components/real/power/battery.hpp>
+#include <cstdio>
+#include <dynamics/attitude/attitude_rk4.hpp>
+#include <dynamics/orbit/rk4_orbit_propagation.hpp>
+#include <dynamics/thermal/temperature.hpp>
+#include <environment/global/celestial_information.hpp>
+#include <environment/global/clock_generator.hpp>
+#include <simulation/monte_carlo_simulation/simulation_object.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../randomization/global_randomization.hpp"
+#include "../randomization/normal_randomization.hpp"
+#include "../randomization/random_walk.hpp"
+#include "checkpoint.hpp"
+#include "ring_buffer.hpp"
+
+/**
+ * @brief Test that the written values are read in the same order
+ */
+TEST(Checkpoint, RoundTrip) {
+  CheckpointWriter writer;
+  writer.BeginSection("Test");
+  writer.Write(1.0 / 3.0);
+  writer.Write(-7);
+  writer.Write(true);
+  writer.Write(std::string("s2e"));
+  writer.Write(std::vector<double>{1.0, 2.0, 3.0});
+  writer.Write(std::vector<std::vector<int>>{{1}, {}, {2, 3}});
+  libra::Vector<3> vector;
+  for (size_t i = 0; i < 3; i++) vector[i] = 0.1 * (i + 1);
+  writer.Write(vector);
+  writer.Write(libra::Quaternion(0.5, 0.5, 0.5, 0.5));
+  libra::Matrix<2, 2> matrix;
+  matrix(0, 0) = 1.0;
+  matrix(0, 1) = 2.0;
+  matrix(1, 0) = 3.0;
+  matrix(1, 1) = 4.0;
+  writer.Write(matrix);
+
+  CheckpointReader reader(writer.GetData());
+  reader.BeginSection("Test");
+  double double_value = 0.0;
+  int int_value = 0;
+  bool bool_value = false;
+  std::string string_value;
+  std::vector<double> vector_value;
+  std::vector<std::vector<int>> nested_vector_value;
+  libra::Vector<3> libra_vector_value(0.0);
+  libra::Quaternion quaternion_value;
+  libra::Matrix<2, 2> matrix_value;
+  reader.Read(double_value);
+  reader.Read(int_value);
+  reader.Read(bool_value);
+  reader.Read(string_value);
+  reader.Read(vector_value);
+  reader.Read(nested_vector_value);
+  reader.Read(libra_vector_value);
+  reader.Read(quaternion_value);
+  reader.Read(matrix_value);
+
+  ASSERT_TRUE(reader.IsValid());
+  EXPECT_TRUE(reader.IsEnd());
+  EXPECT_EQ(1.0 / 3.0, double_value);
+  EXPECT_EQ(-7, int_value);
+  EXPECT_TRUE(bool_value);
+  EXPECT_EQ("s2e", string_value);
+  EXPECT_EQ((std::vector<double>{1.0, 2.0, 3.0}), vector_value);
+  EXPECT_EQ((std::vector<std::vector<int>>{{1}, {}, {2, 3}}), nested_vector_value);
+  for (size_t i = 0; i < 3; i++) EXPECT_EQ(0.1 * (i + 1), libra_vector_value[i]);
+  for (size_t i = 0; i < 4; i++) EXPECT_EQ(0.5, quaternion_value[i]);
+  EXPECT_EQ(4.0, matrix_value(1, 1));
+}
+
+/**
+ * @brief Test that the snapshot is written to and read from the file
+ */
+TEST(Checkpoint, File) {
+  const std::string file_path = "test_checkpoint.bin";
+  CheckpointWriter writer;
+  writer.BeginSection("Test");
+  writer.Write(42);
+  ASSERT_TRUE(writer.SaveFile(file_path));
+  ASSERT_TRUE(writer.SaveFile(file_path));  // Overwrite
+
+  CheckpointReader reader = CheckpointReader::LoadFile(file_path);
+  reader.BeginSection("Test");
+  int value = 0;
+  reader.Read(value);
+  EXPECT_TRUE(reader.IsValid());
+  EXPECT_TRUE(reader.IsEnd());
+  EXPECT_EQ(42, value);
+  std::remove(file_path.c_str());
+
+  CheckpointReader missing_reader = CheckpointReader::LoadFile("not_existing_checkpoint.bin");
+  EXPECT_FALSE(missing_reader.IsValid());
+}
+
+/**
+ * @brief Test the detection of the broken or mismatched snapshot
+ */
+TEST(Checkpoint, Mismatch) {
+  CheckpointWriter writer;
+  writer.BeginSection("Test");
+  writer.Write(std::vector<double>{1.0, 2.0});
+  std::vector<unsigned char> data = writer.GetData();
+
+  // Section name
+  {
+    CheckpointReader reader(data);
+    reader.BeginSection("Other");
+    EXPECT_FALSE(reader.IsValid());
+    // The values are not changed after the error
+    std::vector<double> values{5.0};
+    reader.Read(values);
+    EXPECT_EQ(std::vector<double>{5.0}, values);
+  }
+  // Container size
+  {
+    CheckpointReader reader(data);
+    reader.BeginSection("Test");
+    reader.ReadSizeAndCheck(3, "values");
+    EXPECT_FALSE(reader.IsValid());
+  }
+  // Truncated data
+  {
+    std::vector<unsigned char> truncated_data(data.begin(), data.end() - 1);
+    CheckpointReader reader(truncated_data);
+    reader.BeginSection("Test");
+    std::vector<double> values;
+    reader.Read(values);
+    EXPECT_FALSE(reader.IsValid());
+  }
+  // Version
+  {
+    std::vector<unsigned char> other_version_data = data;
+    other_version_data[8] ^= 0xff;
+    CheckpointReader reader(other_version_data);
+    EXPECT_FALSE(reader.IsValid());
+  }
+  // Magic number
+  {
+    std::vector<unsigned char> other_file_data = data;
+    other_file_data[0] = 'X';
+    CheckpointReader reader(other_file_data);
+    EXPECT_FALSE(reader.IsValid());
+  }
+}
+
+/**
+ * @brief Test that the restored random number generators continue the same sequences as the original ones
+ */
+TEST(Checkpoint, RandomizationContinuation) {
+  libra::NormalRand normal_rand(0.0, 1.0, 12345);
+  RandomWalk<3> random_walk(0.1, libra::Vector<3>(1.0), libra::Vector<3>(10.0));
+  for (size_t i = 0; i < 101; i++) {  // Odd number of draws to keep the second value of the Box-Muller pair
+    (void)(double)normal_rand;
+    ++random_walk;
+  }
+
+  CheckpointWriter writer;
+  normal_rand.SaveState(writer);
+  random_walk.SaveState(writer);
+
+  libra::NormalRand restored_normal_rand(0.0, 1.0, 1);
+  RandomWalk<3> restored_random_walk(0.1, libra::Vector<3>(1.0), libra::Vector<3>(10.0));
+  CheckpointReader reader(writer.GetData());
+  restored_normal_rand.LoadState(reader);
+  restored_random_walk.LoadState(reader);
+  ASSERT_TRUE(reader.IsValid());
+  EXPECT_TRUE(reader.IsEnd());
+
+  for (size_t i = 0; i < 100; i++) {
+    EXPECT_EQ((double)normal_rand, (double)restored_normal_rand);
+    ++random_walk;
+    ++restored_random_walk;
+    for (size_t axis = 0; axis < 3; axis++) EXPECT_EQ(random_walk[axis], restored_random_walk[axis]);
+  }
+}
+
+/**
+ * @brief Test that the ring buffer is restored only with the same capacity
+ */
+TEST(Checkpoint, RingBuffer) {
+  RingBuffer ring_buffer(8);
+  const unsigned char data[6] = {1, 2, 3, 4, 5, 6};
+  ring_buffer.Write(data, 0, 6);
+  unsigned char read_data[6] = {};
+  ring_buffer.Read(read_data, 0, 4);
+
+  CheckpointWriter writer;
+  ring_buffer.SaveState(writer);
+
+  RingBuffer restored_ring_buffer(8);
+  CheckpointReader reader(writer.GetData());
+  restored_ring_buffer.LoadState(reader);
+  ASSERT_TRUE(reader.IsValid());
+  EXPECT_EQ(2u, restored_ring_buffer.GetReadableSize());
+  EXPECT_EQ(2, restored_ring_buffer.Read(read_data, 0, 6));
+  EXPECT_EQ(5, read_data[0]);
+  EXPECT_EQ(6, read_data[1]);
+
+  RingBuffer small_ring_buffer(4);
+  CheckpointReader small_reader(writer.GetData());
+  small_ring_buffer.LoadState(small_reader);
+  EXPECT_FALSE(small_reader.IsValid());
+}
+
+namespace {
+/**
+ * @class NoisyVectorSensor
+ * @brief Sensor which exposes the noise model for the test
+ */
+class NoisyVectorSensor : public Sensor<3> {
+ public:
+  using Sensor<3>::Sensor;
+  using Sensor<3>::LoadState;
+  using Sensor<3>::Measure;
+  using Sensor<3>::SaveState;
+};
+
+/**
+ * @class ContinuationModels
+ * @brief Set of the dynamics, the thermal model, the RNG driven sensor, and the battery which are saved to the checkpoint
+ */
+class ContinuationModels {
+ public:
+  /**
+   * @fn ContinuationModels
+   * @brief Constructor
+   * @param [in] name: Unique name of the simulation object
+   */
+  explicit ContinuationModels(const std::string& name)
+      : inertia_tensor_kgm2_(MakeInertiaTensor()),
+        celestial_information_("J2000", "NONE", "EARTH", RotationMode::kIdle, 0, new int[0]),
+        attitude_(libra::Vector<3>(0.01), libra::Quaternion(0.0, 0.0, 0.0, 1.0), inertia_tensor_kgm2_, libra::Vector<3>(1.0e-4), 0.1, name),
+        orbit_(&celestial_information_, 3.986004418e14, 1.0, MakeVector(7.0e6, 0.0, 0.0), MakeVector(0.0, 7.5e3, 1.0e3)),
+        temperature_(MakeTemperature()),
+        sensor_(libra::MakeIdentityMatrix<3>(), libra::Vector<3>(1.0e3), libra::Vector<3>(1.0e4), libra::Vector<3>(1.0e-3), libra::Vector<3>(1.0e-2),
+                0.1, libra::Vector<3>(1.0e-3), libra::Vector<3>(1.0e-1)),
+        battery_(1, &clock_generator_, 4, 2, 3.0, {4.2, -0.3}, 20.0, 0.5, 16.8, 0.1, 1.0) {
+    orbit_.SetIsCalcEnabled(true);
+  }
+
+  /**
+   * @fn Step
+   * @brief Propagate all the models by one second
+   * @param [in] step: Step count
+   */
+  void Step(const unsigned int step) {
+    const double time_s = step + 1.0;
+    attitude_.Propagate(time_s);
+    orbit_.Propagate(time_s, 0.0);
+    temperature_.Propagate(MakeVector(1.0e11, 1.0e11, 0.0), time_s);  // Sun position in the body frame [m]
+    measured_value_c_ = sensor_.Measure(attitude_.GetAngularVelocity_b_rad_s());
+    battery_.Tick(step);
+  }
+
+  /**
+   * @fn SaveState
+   * @brief Write the state of all the models to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  void SaveState(CheckpointWriter& writer) const {
+    attitude_.SaveState(writer);
+    orbit_.SaveState(writer);
+    temperature_.SaveState(writer);
+    sensor_.SaveState(writer);
+    battery_.SaveState(writer);
+  }
+  /**
+   * @fn LoadState
+   * @brief Restore the state of all the models from the checkpoint
+   * @param [in] reader: Checkpoint reader
+   */
+  void LoadState(CheckpointReader& reader) {
+    attitude_.LoadState(reader);
+    orbit_.LoadState(reader);
+    temperature_.LoadState(reader);
+    sensor_.LoadState(reader);
+    battery_.LoadState(reader);
+  }
+
+  /**
+   * @fn ExpectEqual
+   * @brief Check that all the outputs are identical with the other models
+   * @param [in] other: Models to compare
+   */
+  void ExpectEqual(ContinuationModels& other) {
+    for (size_t i = 0; i < 3; i++) {
+      EXPECT_EQ(attitude_.GetAngularVelocity_b_rad_s()[i], other.attitude_.GetAngularVelocity_b_rad_s()[i]);
+      EXPECT_EQ(orbit_.GetPosition_i_m()[i], other.orbit_.GetPosition_i_m()[i]);
+      EXPECT_EQ(orbit_.GetVelocity_i_m_s()[i], other.orbit_.GetVelocity_i_m_s()[i]);
+      EXPECT_EQ(measured_value_c_[i], other.measured_value_c_[i]);
+    }
+    for (size_t i = 0; i < 4; i++) {
+      EXPECT_EQ(attitude_.GetQuaternion_i2b()[i], other.attitude_.GetQuaternion_i2b()[i]);
+    }
+    std::vector<Node> nodes = temperature_.GetNodes();
+    std::vector<Node> other_nodes = other.temperature_.GetNodes();
+    ASSERT_EQ(nodes.size(), other_nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+      EXPECT_EQ(nodes[i].GetTemperature_K(), other_nodes[i].GetTemperature_K());
+    }
+    EXPECT_EQ(temperature_.GetHeaterPower_W(0), other.temperature_.GetHeaterPower_W(0));
+    EXPECT_EQ(battery_.GetVoltage_V(), other.battery_.GetVoltage_V());
+  }
+
+  /**
+   * @fn SetChargeCurrent
+   * @brief Set the charge current of the battery
+   * @param [in] current_A: Charge current [A]
+   */
+  inline void SetChargeCurrent(const double current_A) { battery_.SetChargeCurrent(current_A); }
+  /**
+   * @fn SetRwAngularMomentum
+   * @brief Set the angular momentum of the reaction wheels
+   * @param [in] angular_momentum_rw_b_Nms: Angular momentum of the reaction wheels in the body frame [Nms]
+   */
+  inline void SetRwAngularMomentum(const libra::Vector<3>& angular_momentum_rw_b_Nms) {
+    attitude_.SetRwAngularMomentum_b_Nms(angular_momentum_rw_b_Nms);
+  }
+  /**
+   * @fn SetParameters
+   * @brief Apply the Monte-Carlo parameters to the attitude as SimulationObject::SetAllParameters at the branch time
+   * @param [in] monte_carlo_simulator: Monte-Carlo simulation executor
+   */
+  inline void SetParameters(const MonteCarloSimulationExecutor& monte_carlo_simulator) { attitude_.SetParameters(monte_carlo_simulator); }
+
+ private:
+  libra::Matrix<3, 3> inertia_tensor_kgm2_;  //!< Inertia tensor referred by the attitude
+  CelestialInformation celestial_information_;  //!< Celestial information without SPICE bodies
+  ClockGenerator clock_generator_;              //!< Clock generator for the battery
+  AttitudeRk4 attitude_;                        //!< Attitude
+  Rk4OrbitPropagation orbit_;                   //!< Orbit
+  Temperature temperature_;                     //!< Thermal model
+  NoisyVectorSensor sensor_;                    //!< Sensor with random noises
+  Battery battery_;                             //!< Battery
+  libra::Vector<3> measured_value_c_{0.0};      //!< Latest sensor output
+
+  static libra::Matrix<3, 3> MakeInertiaTensor() {
+    libra::Matrix<3, 3> inertia_tensor_kgm2 = libra::MakeIdentityMatrix<3>();
+    inertia_tensor_kgm2(0, 0) = 0.1;
+    inertia_tensor_kgm2(1, 1) = 0.2;
+    inertia_tensor_kgm2(2, 2) = 0.3;
+    return inertia_tensor_kgm2;
+  }
+
+  static libra::Vector<3> MakeVector(const double x, const double y, const double z) {
+    libra::Vector<3> vector;
+    vector[0] = x;
+    vector[1] = y;
+    vector[2] = z;
+    return vector;
+  }
+
+  static Temperature MakeTemperature() {
+    // Heated panel, internal unit, and the space boundary
+    std::vector<Node> nodes{Node(0, "panel", NodeType::kDiffusive, 1, 290.0, 500.0, 0.3, 0.1, MakeVector(1.0, 0.0, 0.0)),
+                            Node(1, "unit", NodeType::kDiffusive, 0, 300.0, 200.0, 0.0, 0.0, MakeVector(0.0, 1.0, 0.0)),
+                            Node(2, "space", NodeType::kBoundary, 0, 3.0, 1.0, 0.0, 0.0, MakeVector(0.0, 0.0, 1.0))};
+    std::vector<Heatload> heatloads{Heatload(0, {0.0, 1000.0}, {0.0, 0.0}), Heatload(1, {0.0, 20.0, 40.0, 1000.0}, {0.0, 5.0, 0.0, 0.0}),
+                                    Heatload(2, {0.0, 1000.0}, {0.0, 0.0})};
+    std::vector<Heater> heaters{Heater(1, 10.0)};
+    std::vector<HeaterController> heater_controllers{HeaterController(16.95, 17.05)};
+    std::vector<std::vector<double>> conductance_matrix_W_K{{0.0, 0.5, 0.0}, {0.5, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+    std::vector<std::vector<double>> radiation_matrix_m2{{0.0, 0.0, 0.05}, {0.0, 0.0, 0.0}, {0.05, 0.0, 0.0}};
+    return Temperature(conductance_matrix_W_K, radiation_matrix_m2, nodes, heatloads, heaters, heater_controllers, 3, 0.1, true,
+                       SolarCalcSetting::kEnable, false);
+  }
+};
+}  // namespace
+
+/**
+ * @brief Test that the models restored from the checkpoint continue the same propagation as the original models
+ */
+TEST(Checkpoint, ModelContinuation) {
+  const unsigned int kStepsBeforeSave = 40;
+  const unsigned int kStepsAfterSave = 40;
+
+  ContinuationModels original("original_attitude");
+  for (unsigned int step = 0; step < kStepsBeforeSave; step++) {
+    original.SetChargeCurrent(0.1 * step);
+    original.Step(step);
+  }
+
+  CheckpointWriter writer;
+  original.SaveState(writer);
+  ContinuationModels restored("restored_attitude");
+  CheckpointReader reader(writer.GetData());
+  restored.LoadState(reader);
+  ASSERT_TRUE(reader.IsValid());
+  EXPECT_TRUE(reader.IsEnd());
+
+  for (unsigned int step = kStepsBeforeSave; step < kStepsBeforeSave + kStepsAfterSave; step++) {
+    original.Step(step);
+    restored.Step(step);
+    restored.ExpectEqual(original);
+  }
+}
+
+/**
+ * @brief Test that the models branched from the snapshot without randomized parameters reproduce the unbranched propagation
+ */
+TEST(Checkpoint, BranchWithoutRandomization) {
+  const unsigned int kStepsBeforeBranch = 40;
+  const unsigned int kStepsAfterBranch = 40;
+  libra::Vector<3> angular_momentum_rw_b_Nms(0.0);
+  angular_momentum_rw_b_Nms[2] = 1.0e-3;
+
+  MonteCarloSimulationExecutor monte_carlo_simulator(2);
+  monte_carlo_simulator.SetBranchTime_s(kStepsBeforeBranch);
+  SimulationObject::CheckAllParametersForBranch(monte_carlo_simulator);
+
+  // The random noises of the sensors are seeded in the same way as the simulations started from the same initialize files
+  const long seed = 0x11;
+  global_randomization.SetSeed(seed);
+  ContinuationModels unbranched("unbranched_attitude");
+  global_randomization.SetSeed(seed);
+  ContinuationModels common("common_attitude");
+  unbranched.SetRwAngularMomentum(angular_momentum_rw_b_Nms);
+  common.SetRwAngularMomentum(angular_momentum_rw_b_Nms);
+  unbranched.SetChargeCurrent(0.5);
+  common.SetChargeCurrent(0.5);
+  for (unsigned int step = 0; step < kStepsBeforeBranch; step++) {
+    unbranched.Step(step);
+    common.Step(step);
+  }
+
+  CheckpointWriter writer;
+  common.SaveState(writer);
+  ContinuationModels branched("branched_attitude");
+  CheckpointReader reader(writer.GetData());
+  branched.LoadState(reader);
+  ASSERT_TRUE(reader.IsValid());
+  branched.SetParameters(monte_carlo_simulator);
+
+  for (unsigned int step = kStepsBeforeBranch; step < kStepsBeforeBranch + kStepsAfterBranch; step++) {
+    unbranched.Step(step);
+    branched.Step(step);
+    branched.ExpectEqual(unbranched);
+  }
+}
+
+/**
+ * @brief Test that the randomization of the initial state is rejected with the branch time
+ */
+TEST(Checkpoint, BranchRejectsInitialState) {
+  ContinuationModels models("randomized_attitude");
+  MonteCarloSimulationExecutor monte_carlo_simulator(2);
+  monte_carlo_simulator.AddInitializedMonteCarloParameter("randomized_attitude", "angular_velocity_b_rad_s", libra::Vector<3>(0.0),
+                                                          libra::Vector<3>(0.01), InitializedMonteCarloParameters::kCartesianNormal);
+  EXPECT_NO_THROW(SimulationObject::CheckAllParametersForBranch(monte_carlo_simulator));
+
+  monte_carlo_simulator.SetBranchTime_s(10.0);
+  EXPECT_THROW(SimulationObject::CheckAllParametersForBranch(monte_carlo_simulator), std::invalid_argument);
+}
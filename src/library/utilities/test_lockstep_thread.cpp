@@ -0,0 +1,112 @@
+/**
+ * @file test_lockstep_thread.cpp
+ * @brief Test codes for LockstepThread class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "lockstep_thread.hpp"
+
+/**
+ * @brief Test that the granted steps are executed before the sync points
+ */
+TEST(LockstepThread, SyncPoint) {
+  const size_t sync_intervals[3] = {1, 3, 10};
+  for (size_t s = 0; s < 3; s++) {
+    uint64_t step_count = 0;
+    LockstepThread lockstep_thread([&step_count] { step_count++; }, sync_intervals[s]);
+    EXPECT_EQ(sync_intervals[s], lockstep_thread.GetSyncInterval());
+
+    uint64_t granted_steps = 0;
+    uint64_t granted_steps_at_sync = 0;
+    for (size_t i = 0; i < 100; i++) {
+      if (i % sync_intervals[s] == 0) granted_steps_at_sync = granted_steps;
+      lockstep_thread.Advance(i % 4);
+      granted_steps += i % 4;
+      // The thread has executed all steps granted before the last sync point
+      EXPECT_LE(granted_steps_at_sync, lockstep_thread.GetNumberOfExecutedSteps());
+      // The steps granted at the sync point are executed before Advance returns
+      if (i % sync_intervals[s] == 0) EXPECT_EQ(granted_steps, lockstep_thread.GetNumberOfExecutedSteps());
+    }
+    lockstep_thread.Synchronize();
+    EXPECT_EQ(granted_steps, lockstep_thread.GetNumberOfExecutedSteps());
+    EXPECT_EQ(granted_steps, step_count);
+  }
+}
+
+/**
+ * @brief Test that the steps do not see the data written by the caller after Advance returns when sync_interval is 1
+ */
+TEST(LockstepThread, NoOverlap) {
+  std::atomic<int> port_value(-1);
+  std::vector<int> read_values;
+  {
+    LockstepThread lockstep_thread([&] { read_values.push_back(port_value.load()); }, 1);
+    for (int i = 0; i < 1000; i++) {
+      lockstep_thread.Advance(2);
+      // The other components write the port after the flight software update
+      port_value.store(i);
+    }
+  }
+  ASSERT_EQ(2000u, read_values.size());
+  for (size_t i = 0; i < read_values.size(); i++) {
+    EXPECT_EQ((int)(i / 2) - 1, read_values[i]);
+  }
+}
+
+/**
+ * @brief Test that the initialize function is executed once on the thread before the first step
+ */
+TEST(LockstepThread, Initialize) {
+  size_t initialize_count = 0;
+  size_t step_count_at_initialize = 1;
+  size_t step_count = 0;
+  std::thread::id initialize_thread_id;
+  LockstepThread lockstep_thread([&step_count] { step_count++; }, 1,
+                                 [&] {
+                                   initialize_count++;
+                                   step_count_at_initialize = step_count;
+                                   initialize_thread_id = std::this_thread::get_id();
+                                 });
+  for (size_t i = 0; i < 10; i++) lockstep_thread.Advance(2);
+  lockstep_thread.Synchronize();
+
+  EXPECT_EQ(1u, initialize_count);
+  EXPECT_EQ(0u, step_count_at_initialize);
+  EXPECT_NE(std::this_thread::get_id(), initialize_thread_id);
+  EXPECT_EQ(20u, step_count);
+}
+
+/**
+ * @brief Test that the exception in the step is rethrown at the sync point and the thread is still available
+ */
+TEST(LockstepThread, Exception) {
+  size_t step_count = 0;
+  LockstepThread lockstep_thread([&step_count] {
+    step_count++;
+    if (step_count == 5) throw std::runtime_error("step error");
+  });
+  // Every Advance call is a sync point with the default sync interval
+  EXPECT_THROW(lockstep_thread.Advance(10), std::runtime_error);
+
+  lockstep_thread.Advance(3);
+  lockstep_thread.Synchronize();
+  EXPECT_EQ(8u, step_count);
+  EXPECT_EQ(13u, lockstep_thread.GetNumberOfExecutedSteps());
+}
+
+/**
+ * @brief Test that the granted steps are executed before the destruction
+ */
+TEST(LockstepThread, Destruction) {
+  size_t step_count = 0;
+  {
+    LockstepThread lockstep_thread([&step_count] { step_count++; }, 100);
+    for (size_t i = 0; i < 10; i++) lockstep_thread.Advance(5);
+  }
+  EXPECT_EQ(50u, step_count);
+}
@@ -0,0 +1,106 @@
+/**
+ * @file test_profiler.cpp
+ * @brief Test codes for Profiler class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "profiler.hpp"
+
+/**
+ * @brief Test the histogram bins and the percentile estimation
+ */
+TEST(Profiler, Histogram) {
+  EXPECT_EQ(0u, Profiler::CalcHistogramBin(0.0));
+  EXPECT_EQ(0u, Profiler::CalcHistogramBin(1.0e-9));
+  EXPECT_EQ(4u, Profiler::CalcHistogramBin(2.0e-9));
+  EXPECT_EQ(7u, Profiler::CalcHistogramBin(3.9e-9));
+  EXPECT_EQ(Profiler::kNumberOfHistogramBins - 1, Profiler::CalcHistogramBin(1.0e9));
+
+  // 98 samples of 1 us and 2 samples of 1 ms
+  std::vector<uint64_t> histogram(Profiler::kNumberOfHistogramBins, 0);
+  histogram[Profiler::CalcHistogramBin(1.0e-6)] = 98;
+  histogram[Profiler::CalcHistogramBin(1.0e-3)] = 2;
+  const double p50_s = Profiler::CalcPercentile(histogram, 0.5);
+  const double p99_s = Profiler::CalcPercentile(histogram, 0.99);
+  EXPECT_GE(p50_s, 1.0e-6);
+  EXPECT_LT(p50_s, 1.0e-6 * 1.25);
+  EXPECT_GE(p99_s, 1.0e-3);
+  EXPECT_LT(p99_s, 1.0e-3 * 1.25);
+  EXPECT_EQ(0.0, Profiler::CalcPercentile(std::vector<uint64_t>(Profiler::kNumberOfHistogramBins, 0), 0.99));
+}
+
+/**
+ * @brief Test the call tree merged over the threads
+ */
+TEST(Profiler, Report) {
+  Profiler profiler;
+  for (size_t i = 0; i < 3; i++) {
+    Profiler::ScopedTimer step_timer(profiler, "Step");
+    {
+      Profiler::ScopedTimer timer(profiler, "Child");
+    }
+    Profiler::ScopedTimer timer(profiler, "OtherChild");
+  }
+  std::thread worker([&profiler]() {
+    Profiler::ScopedTimer timer(profiler, "Step");
+    Profiler::ScopedTimer child_timer(profiler, "Child");
+  });
+  worker.join();
+
+  std::stringstream report;
+  profiler.PrintReport(report);
+  std::string line;
+  std::vector<std::string> lines;
+  while (std::getline(report, line)) lines.push_back(line);
+  ASSERT_EQ(5u, lines.size());  // Title, header, Step, Child, and OtherChild
+  EXPECT_EQ("  Step", lines[2].substr(0, 6));
+  EXPECT_NE(std::string::npos, lines[2].find(" 4 "));  // Called three times in the main thread and once in the worker thread
+  EXPECT_NE(std::string::npos, lines[2].find("100.00"));
+  const std::string child_line = (lines[3].find("OtherChild") == std::string::npos) ? lines[3] : lines[4];
+  EXPECT_EQ("    Child", child_line.substr(0, 9));
+  EXPECT_NE(std::string::npos, child_line.find(" 4 "));
+
+  // The measurements are cleared
+  profiler.Reset();
+  std::stringstream empty_report;
+  profiler.PrintReport(empty_report);
+  EXPECT_EQ(std::string::npos, empty_report.str().find("Step"));
+}
+
+/**
+ * @brief Test the Chrome trace output
+ */
+TEST(Profiler, ChromeTrace) {
+  Profiler profiler;
+  profiler.SetTraceEnabled(true, 2);
+  for (size_t i = 0; i < 3; i++) {
+    Profiler::ScopedTimer timer(profiler, "Scope\"Name");
+  }
+
+  const std::string file_path = "test_profiler_trace.json";
+  ASSERT_TRUE(profiler.WriteChromeTrace(file_path));
+  std::ifstream file(file_path);
+  std::stringstream trace;
+  trace << file.rdbuf();
+  file.close();
+  std::remove(file_path.c_str());
+
+  const std::string trace_string = trace.str();
+  const std::string header = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  EXPECT_EQ(header, trace_string.substr(0, header.size()));
+  EXPECT_NE(std::string::npos, trace_string.find("\"name\":\"Scope\\\"Name\",\"ph\":\"X\""));
+  // The number of the events is limited
+  size_t number_of_events = 0;
+  for (size_t position = trace_string.find("\"ph\":\"X\""); position != std::string::npos;
+       position = trace_string.find("\"ph\":\"X\"", position + 1)) {
+    number_of_events++;
+  }
+  EXPECT_EQ(2u, number_of_events);
+}
@@ -0,0 +1,135 @@
+/**
+ * @file test_ring_buffer.cpp
+ * @brief Test codes for RingBuffer class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+#include "ring_buffer.hpp"
+
+/**
+ * @brief Test that the capacity is rounded up to a power of two
+ */
+TEST(RingBuffer, Capacity) {
+  EXPECT_EQ(1u, RingBuffer(0).GetCapacity());
+  EXPECT_EQ(1u, RingBuffer(1).GetCapacity());
+  EXPECT_EQ(8u, RingBuffer(5).GetCapacity());
+  EXPECT_EQ(1024u, RingBuffer(1024).GetCapacity());
+  EXPECT_EQ(2048u, RingBuffer(1025).GetCapacity());
+}
+
+/**
+ * @brief Test write and read with the offset and the wraparound
+ */
+TEST(RingBuffer, WriteRead) {
+  RingBuffer ring_buffer(8);
+  const byte data[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  byte read_data[12] = {};
+
+  for (size_t repeat = 0; repeat < 10; repeat++) {
+    EXPECT_EQ(5, ring_buffer.Write(data, 2, 5));
+    EXPECT_EQ(5u, ring_buffer.GetReadableSize());
+    EXPECT_EQ(3u, ring_buffer.GetWritableSize());
+    EXPECT_EQ(5, ring_buffer.Read(read_data, 1, 10));
+    for (size_t i = 0; i < 5; i++) EXPECT_EQ(data[2 + i], read_data[1 + i]);
+    EXPECT_EQ(0, ring_buffer.Read(read_data, 0, 10));
+  }
+  EXPECT_EQ(0u, ring_buffer.GetOverflowCount());
+}
+
+/**
+ * @brief Test that the unread data is kept and the dropped data is counted when the buffer is full
+ */
+TEST(RingBuffer, Overflow) {
+  RingBuffer ring_buffer(8);
+  const byte data[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  byte read_data[12] = {};
+
+  EXPECT_EQ(8, ring_buffer.Write(data, 0, 12));
+  EXPECT_EQ(4u, ring_buffer.GetOverflowCount());
+  EXPECT_EQ(0, ring_buffer.Write(data, 0, 3));
+  EXPECT_EQ(7u, ring_buffer.GetOverflowCount());
+
+  EXPECT_EQ(8, ring_buffer.Read(read_data, 0, 12));
+  for (size_t i = 0; i < 8; i++) EXPECT_EQ(data[i], read_data[i]);
+}
+
+/**
+ * @brief Test the zero-copy access with the region wrapping around the end of the buffer
+ */
+TEST(RingBuffer, Region) {
+  RingBuffer ring_buffer(8);
+  const byte data[6] = {10, 11, 12, 13, 14, 15};
+  byte read_data[6] = {};
+  ring_buffer.Write(data, 0, 6);
+  ring_buffer.Read(read_data, 0, 6);
+
+  RingBufferRegion<byte> writable_region = ring_buffer.GetWritableRegion();
+  EXPECT_EQ(2u, writable_region.first_size);
+  EXPECT_EQ(6u, writable_region.second_size);
+  memcpy(writable_region.first_data, data, 2);
+  memcpy(writable_region.second_data, data + 2, 3);
+  ring_buffer.CommitWrite(5);
+
+  RingBufferRegion<const byte> readable_region = ring_buffer.GetReadableRegion();
+  EXPECT_EQ(5u, readable_region.GetSize());
+  EXPECT_EQ(2u, readable_region.first_size);
+  EXPECT_EQ(data[0], readable_region.first_data[0]);
+  EXPECT_EQ(data[2], readable_region.second_data[0]);
+  ring_buffer.CommitRead(3);
+  EXPECT_EQ(2u, ring_buffer.GetReadableSize());
+
+  // The commit is limited to the available data
+  ring_buffer.CommitRead(100);
+  EXPECT_EQ(0u, ring_buffer.GetReadableSize());
+  ring_buffer.CommitWrite(100);
+  EXPECT_EQ(8u, ring_buffer.GetReadableSize());
+}
+
+/**
+ * @brief Test that the data written by the producer thread is read by the consumer thread in order without loss
+ */
+TEST(RingBuffer, ProducerConsumer) {
+  RingBuffer ring_buffer(64);
+  const size_t total_length = 1 << 20;
+
+  std::thread producer([&ring_buffer, total_length]() {
+    byte chunk[37];
+    size_t written_length = 0;
+    while (written_length < total_length) {
+      const size_t length = std::min(sizeof(chunk), total_length - written_length);
+      for (size_t i = 0; i < length; i++) chunk[i] = (byte)(written_length + i);
+      // Retry the dropped part so that the stream is not lost
+      size_t sent_length = 0;
+      while (sent_length < length) {
+        RingBufferRegion<byte> region = ring_buffer.GetWritableRegion();
+        const size_t write_length = std::min(length - sent_length, region.first_size);
+        memcpy(region.first_data, chunk + sent_length, write_length);
+        ring_buffer.CommitWrite(write_length);
+        sent_length += write_length;
+        if (write_length == 0) std::this_thread::yield();
+      }
+      written_length += length;
+    }
+  });
+
+  size_t read_length = 0;
+  size_t error_count = 0;
+  byte chunk[29];
+  while (read_length < total_length) {
+    const int length = ring_buffer.Read(chunk, 0, sizeof(chunk));
+    if (length == 0) std::this_thread::yield();
+    for (int i = 0; i < length; i++) {
+      if (chunk[i] != (byte)(read_length + i)) error_count++;
+    }
+    read_length += length;
+  }
+  producer.join();
+
+  EXPECT_EQ(0u, error_count);
+  EXPECT_EQ(total_length, read_length);
+  EXPECT_EQ(0u, ring_buffer.GetOverflowCount());
+}
@@ -0,0 +1,45 @@
+/**
+ * @file test_thread_pool.cpp
+ * @brief Test codes for ThreadPool class with GoogleTest
+ */
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "thread_pool.hpp"
+
+/**
+ * @brief Test that every task is executed exactly once for repeated calls
+ */
+TEST(ThreadPool, ParallelFor) {
+  const size_t number_of_threads[3] = {1, 4, 0};
+  for (size_t t = 0; t < 3; t++) {
+    ThreadPool thread_pool(number_of_threads[t]);
+    EXPECT_GE(thread_pool.GetNumberOfThreads(), 1u);
+    for (size_t number_of_tasks = 0; number_of_tasks < 100; number_of_tasks += 7) {
+      std::vector<int> counts(number_of_tasks, 0);
+      thread_pool.ParallelFor(number_of_tasks, [&counts](const size_t i) { counts[i]++; });
+      for (size_t i = 0; i < number_of_tasks; i++) EXPECT_EQ(1, counts[i]);
+    }
+  }
+}
+
+/**
+ * @brief Test that the exception in a task is rethrown after all tasks are finished
+ */
+TEST(ThreadPool, Exception) {
+  ThreadPool thread_pool(4);
+  std::vector<int> counts(64, 0);
+  EXPECT_THROW(thread_pool.ParallelFor(counts.size(),
+                                       [&counts](const size_t i) {
+                                         counts[i]++;
+                                         if (i == 10) throw std::runtime_error("task error");
+                                       }),
+               std::runtime_error);
+  for (size_t i = 0; i < counts.size(); i++) EXPECT_EQ(1, counts[i]);
+
+  // The pool is still available after the exception
+  thread_pool.ParallelFor(counts.size(), [&counts](const size_t i) { counts[i]++; });
+  for (size_t i = 0; i < counts.size(); i++) EXPECT_EQ(2, counts[i]);
+}
@@ -0,0 +1,89 @@
+/**
+ * @file thread_pool.cpp
+ * @brief Thread pool to execute independent tasks in parallel
+ */
+
+#include "thread_pool.hpp"
+
+ThreadPool::ThreadPool(const size_t number_of_threads) {
+  size_t number_of_all_threads = number_of_threads;
+  if (number_of_all_threads == 0) number_of_all_threads = std::thread::hardware_concurrency();
+  if (number_of_all_threads == 0) number_of_all_threads = 1;
+
+  for (size_t i = 1; i < number_of_all_threads; i++) {
+    workers_.push_back(std::thread(&ThreadPool::WorkerLoop, this));
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stop_requested_ = true;
+  }
+  task_available_.notify_all();
+  for (auto& worker : workers_) worker.join();
+}
+
+void ThreadPool::ParallelFor(const size_t number_of_tasks, const std::function<void(const size_t)>& task) {
+  if (workers_.empty() || number_of_tasks <= 1) {
+    for (size_t i = 0; i < number_of_tasks; i++) task(i);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    task_ = &task;
+    number_of_tasks_ = number_of_tasks;
+    next_task_index_ = 0;
+    number_of_running_workers_ = workers_.size();
+    exception_ = nullptr;
+    generation_++;
+  }
+  task_available_.notify_all();
+
+  ExecuteTasks();
+
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_finished_.wait(lock, [this] { return number_of_running_workers_ == 0; });
+    task_ = nullptr;
+    exception = exception_;
+    exception_ = nullptr;
+  }
+  if (exception) std::rethrow_exception(exception);
+}
+
+void ThreadPool::WorkerLoop() {
+  uint64_t executed_generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      task_available_.wait(lock, [this, executed_generation] { return is_stop_requested_ || generation_ != executed_generation; });
+      if (is_stop_requested_) return;
+      executed_generation = generation_;
+    }
+
+    ExecuteTasks();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      number_of_running_workers_--;
+      if (number_of_running_workers_ > 0) continue;
+    }
+    task_finished_.notify_one();
+  }
+}
+
+void ThreadPool::ExecuteTasks() {
+  while (true) {
+    const size_t task_index = next_task_index_.fetch_add(1);
+    if (task_index >= number_of_tasks_) return;
+    try {
+      (*task_)(task_index);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!exception_) exception_ = std::current_exception();
+    }
+  }
+}
@@ -0,0 +1,82 @@
+/**
+ * @file thread_pool.hpp
+ * @brief Thread pool to execute independent tasks in parallel
+ */
+
+#ifndef S2E_LIBRARY_UTILITIES_THREAD_POOL_HPP_
+#define S2E_LIBRARY_UTILITIES_THREAD_POOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Thread pool to execute independent tasks in parallel
+ * @details The worker threads are created once and reused for every ParallelFor call. The calling thread also executes the tasks,
+ *          so the pool with one thread runs the tasks in order on the calling thread without any synchronization.
+ */
+class ThreadPool {
+ public:
+  /**
+   * @fn ThreadPool
+   * @brief Constructor
+   * @param [in] number_of_threads: Number of threads including the calling thread. 0 means the number of hardware threads.
+   */
+  explicit ThreadPool(const size_t number_of_threads = 1);
+  /**
+   * @fn ~ThreadPool
+   * @brief Destructor to stop the worker threads
+   */
+  ~ThreadPool();
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /**
+   * @fn ParallelFor
+   * @brief Execute task(0) to task(number_of_tasks - 1) in parallel and wait for all of them
+   * @note The tasks are assigned to the threads dynamically, so the tasks should not depend on the execution order.
+   *       The first exception thrown by the tasks is rethrown after all tasks are finished.
+   * @param [in] number_of_tasks: Number of tasks
+   * @param [in] task: Task function called with the task index
+   */
+  void ParallelFor(const size_t number_of_tasks, const std::function<void(const size_t)>& task);
+
+  /**
+   * @fn GetNumberOfThreads
+   * @brief Return number of threads including the calling thread
+   */
+  inline size_t GetNumberOfThreads() const { return workers_.size() + 1; }
+
+ private:
+  std::vector<std::thread> workers_;                         //!< Worker threads
+  std::mutex mutex_;                                         //!< Mutex for the shared states below
+  std::condition_variable task_available_;                   //!< Notified when new tasks are set or the stop is requested
+  std::condition_variable task_finished_;                    //!< Notified when all workers finish the tasks
+  const std::function<void(const size_t)>* task_ = nullptr;  //!< Current task function
+  size_t number_of_tasks_ = 0;                               //!< Number of current tasks
+  std::atomic<size_t> next_task_index_{0};                   //!< Index of the next task to be executed
+  size_t number_of_running_workers_ = 0;                     //!< Number of workers executing the current tasks
+  uint64_t generation_ = 0;                                  //!< Incremented for every ParallelFor call
+  bool is_stop_requested_ = false;                           //!< Stop request for the worker threads
+  std::exception_ptr exception_;                             //!< First exception thrown by the current tasks
+
+  /**
+   * @fn WorkerLoop
+   * @brief Main routine of the worker threads
+   */
+  void WorkerLoop();
+  /**
+   * @fn ExecuteTasks
+   * @brief Execute the current tasks until no task remains
+   */
+  void ExecuteTasks();
+};
+
+#endif  // S2E_LIBRARY_UTILITIES_THREAD_POOL_HPP_
@@ -13,13 +13,16 @@
 #include <cstdlib>
 #include <iostream>
 #include <string>
+#include <vector>
 
 // Simulator includes
+#include "library/initialize/initialize_file_access.hpp"
 #include "library/logger/logger.hpp"
+#include "simulation/monte_carlo_simulation/initialize_monte_carlo_simulation.hpp"
+#include "simulation/monte_carlo_simulation/simulation_object.hpp"
 
 // Add custom include files
 #include "simulation_sample/case/sample_case.hpp"
-// #include "simulation/monte_carlo_simulation/monte_carlo_simulation_executor.hpp"
 // #include "interface/hils/COSMOSWrapper.h"
 // #include "interface/hils/HardwareMessage.h"
 
@@ -68,9 +71,40 @@ int main(int argc, char *argv[])
   std::cout << "\tIni file: ";
   print_path(ini_file);
 
-  auto simulation_case = SampleCase(ini_file);
-  simulation_case.Initialize();
-  simulation_case.Main();
+  MonteCarloSimulationExecutor *monte_carlo_simulator = InitMonteCarloSimulation(ini_file);
+  if (monte_carlo_simulator->IsEnabled()) {
+    IniAccess ini_access(ini_file);
+    std::string log_path = ini_access.ReadString("SIMULATION_SETTINGS", "log_file_save_directory");
+    // The log directory is created before the cases are forked, so all the cases write their logs in the same directory
+    if (monte_carlo_simulator->GetBranchTime_s() > 0.0) {
+      // Run the common part of the cases once and branch each case from the snapshot
+      std::vector<unsigned char> snapshot;
+      {
+        auto simulation_case = SampleCase(ini_file);
+        simulation_case.Initialize();
+        snapshot = simulation_case.MainUntilBranch(*monte_carlo_simulator);
+      }
+      const std::string log_directory = Logger::CreateSharedDirectory(log_path);
+      monte_carlo_simulator->Execute([&](const MonteCarloSimulationExecutor &prepared_simulator) {
+        auto simulation_case = SampleCase(ini_file, prepared_simulator, log_directory);
+        simulation_case.Initialize();
+        simulation_case.MainFromBranch(snapshot, prepared_simulator);
+      });
+    } else {
+      const std::string log_directory = Logger::CreateSharedDirectory(log_path);
+      monte_carlo_simulator->Execute([&](const MonteCarloSimulationExecutor &prepared_simulator) {
+        auto simulation_case = SampleCase(ini_file, prepared_simulator, log_directory);
+        simulation_case.Initialize();
+        SimulationObject::SetAllParameters(prepared_simulator);
+        simulation_case.Main();
+      });
+    }
+  } else {
+    auto simulation_case = SampleCase(ini_file);
+    simulation_case.Initialize();
+    simulation_case.Main();
+  }
+  delete monte_carlo_simulator;
 
   end = system_clock::now();
   double time = static_cast<double>(duration_cast<microseconds>(end - start).count() / 1000000.0);
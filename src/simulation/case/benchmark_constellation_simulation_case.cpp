@@ -0,0 +1,178 @@
+/**
+ * @file benchmark_constellation_simulation_case.cpp
+ * @brief Benchmark codes for the scaling of ConstellationSimulationCase with Google Benchmark
+ * @note All spacecraft are initialized with spacecraft_file(0) of the initialize file.
+ *       The path of the file is set by the environment variable S2E_BENCHMARK_INI_FILE, and the sample file is used by default.
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <library/initialize/initialize_file_access.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "constellation_simulation_case.hpp"
+
+namespace {
+
+const char* kDefaultIniFile = "../../data/sample/initialize_files/sample_simulation_base.ini";
+
+/**
+ * @fn GetIniFile
+ * @brief Return the initialize file of the benchmark
+ */
+std::string GetIniFile() {
+  const char* ini_file_env = getenv("S2E_BENCHMARK_INI_FILE");
+  return ini_file_env != nullptr ? ini_file_env : kDefaultIniFile;
+}
+
+/**
+ * @fn IsIniFileAvailable
+ * @brief Return true when the initialize file, the SPICE kernels, and the spacecraft file exist
+ */
+bool IsIniFileAvailable() {
+  static int is_available = -1;
+  if (is_available >= 0) return is_available == 1;
+
+  is_available = 0;
+  if (!std::filesystem::exists(GetIniFile())) return false;
+  try {
+    IniAccess ini_file(GetIniFile());
+    const char* keywords[] = {"tls", "tpc1", "tpc2", "tpc3", "bsp"};
+    for (size_t i = 0; i < 5; i++) {
+      if (!std::filesystem::exists(ini_file.ReadString("CSPICE_KERNELS", keywords[i]))) return false;
+    }
+    std::vector<std::string> spacecraft_files = ini_file.ReadStrVector("SIMULATION_SETTINGS", "spacecraft_file");
+    if (spacecraft_files.empty() || !std::filesystem::exists(spacecraft_files[0])) return false;
+  } catch (const std::runtime_error&) {
+    return false;
+  }
+  is_available = 1;
+  return true;
+}
+
+/**
+ * @class BenchmarkSpacecraft
+ * @brief Spacecraft without components
+ */
+class BenchmarkSpacecraft : public Spacecraft {
+ public:
+  BenchmarkSpacecraft(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment, const int spacecraft_id,
+                      RelativeInformation* relative_information)
+      : Spacecraft(simulation_configuration, global_environment, spacecraft_id, relative_information) {
+    components_ = new InstalledComponents();
+  }
+};
+
+/**
+ * @class BenchmarkConstellationCase
+ * @brief Constellation of the same spacecraft
+ */
+class BenchmarkConstellationCase : public ConstellationSimulationCase {
+ public:
+  BenchmarkConstellationCase(const std::string initialize_base_file, const size_t number_of_spacecraft)
+      : ConstellationSimulationCase(initialize_base_file), number_of_spacecraft_(number_of_spacecraft) {}
+
+  /**
+   * @fn Step
+   * @brief Execute one step of the main routine without the log output
+   */
+  void Step() {
+    global_environment_->Update();
+    UpdateTargetObjects();
+  }
+
+  /**
+   * @fn SetFormationPairs
+   * @brief Set the pairs of interest
+   * @param [in] is_all_pairs: Use all pairs when true, and the pairs of the adjacent spacecraft when false
+   */
+  void SetFormationPairs(const bool is_all_pairs) {
+    relative_information_.ClearPairsOfInterest();
+    if (is_all_pairs) return;
+    for (size_t i = 1; i < number_of_spacecraft_; i++) relative_information_.RegisterPairOfInterest((int)i, (int)i - 1);
+  }
+
+  /**
+   * @fn UpdateRelativeInformation
+   * @brief Update the relative information only
+   */
+  void UpdateRelativeInformation() { relative_information_.Update(); }
+
+ private:
+  size_t number_of_spacecraft_;
+
+  void InitializeTargetObjects() {
+    simulation_configuration_.spacecraft_file_list_.resize(number_of_spacecraft_, simulation_configuration_.spacecraft_file_list_[0]);
+    for (size_t i = 0; i < number_of_spacecraft_; i++) {
+      RegisterSpacecraft(new BenchmarkSpacecraft(&simulation_configuration_, global_environment_, (int)i, &relative_information_));
+    }
+  }
+};
+
+/**
+ * @fn GetCase
+ * @brief Return the constellation case with the number of spacecraft. The case is reused while the number of spacecraft is the same.
+ * @note Only one case exists at a time since the simulation objects of the cases have the same names.
+ */
+BenchmarkConstellationCase& GetCase(const size_t number_of_spacecraft) {
+  static std::unique_ptr<BenchmarkConstellationCase> simulation_case;
+  static size_t case_number_of_spacecraft = 0;
+  if (simulation_case != nullptr && case_number_of_spacecraft == number_of_spacecraft) return *simulation_case;
+
+  simulation_case.reset();
+  simulation_case.reset(new BenchmarkConstellationCase(GetIniFile(), number_of_spacecraft));
+  simulation_case->Initialize();
+  case_number_of_spacecraft = number_of_spacecraft;
+  return *simulation_case;
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmark of the step of the constellation with the pairs of the adjacent spacecraft
+ * @note Arguments: number of spacecraft, number of threads (0: number of hardware threads)
+ */
+static void BM_ConstellationStep(benchmark::State& state) {
+  if (!IsIniFileAvailable()) {
+    state.SkipWithError("Initialize files are not available");
+    return;
+  }
+  const size_t number_of_spacecraft = (size_t)state.range(0);
+  BenchmarkConstellationCase& simulation_case = GetCase(number_of_spacecraft);
+  simulation_case.SetNumberOfThreads((size_t)state.range(1));
+  simulation_case.SetFormationPairs(false);
+
+  for (auto _ : state) {
+    simulation_case.Step();
+  }
+  state.counters["threads"] = (double)simulation_case.GetNumberOfThreads();
+  state.SetItemsProcessed(state.iterations() * number_of_spacecraft);
+}
+BENCHMARK(BM_ConstellationStep)
+    ->ArgsProduct({{1, 10, 50, 100, 200, 500}, {1, 0}})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+/**
+ * @brief Benchmark of the relative information update
+ * @note Arguments: number of spacecraft, pairs (0: pairs of the adjacent spacecraft, 1: all pairs)
+ */
+static void BM_RelativeInformationUpdate(benchmark::State& state) {
+  if (!IsIniFileAvailable()) {
+    state.SkipWithError("Initialize files are not available");
+    return;
+  }
+  const size_t number_of_spacecraft = (size_t)state.range(0);
+  BenchmarkConstellationCase& simulation_case = GetCase(number_of_spacecraft);
+  simulation_case.SetFormationPairs(state.range(1) == 1);
+
+  for (auto _ : state) {
+    simulation_case.UpdateRelativeInformation();
+  }
+  state.counters["pairs"] = (double)simulation_case.GetRelativeInformation().GetPairsOfInterest().size();
+  state.SetItemsProcessed(state.iterations() * simulation_case.GetRelativeInformation().GetPairsOfInterest().size());
+}
+BENCHMARK(BM_RelativeInformationUpdate)->ArgsProduct({{10, 200}, {0, 1}})->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,67 @@
+/**
+ * @file constellation_simulation_case.cpp
+ * @brief Base class to define simulation scenario with many spacecraft updated in parallel
+ */
+
+#include "constellation_simulation_case.hpp"
+
+#include <library/initialize/initialize_file_access.hpp>
+
+ConstellationSimulationCase::ConstellationSimulationCase(const std::string initialize_base_file) : SimulationCase(initialize_base_file) {
+  InitializeThreadPool(initialize_base_file);
+}
+
+ConstellationSimulationCase::ConstellationSimulationCase(const std::string initialize_base_file,
+                                                         const MonteCarloSimulationExecutor& monte_carlo_simulator, const std::string log_path)
+    : SimulationCase(initialize_base_file, monte_carlo_simulator, log_path) {
+  InitializeThreadPool(initialize_base_file);
+}
+
+ConstellationSimulationCase::~ConstellationSimulationCase() {
+  // The spacecraft remove themselves from the relative information, so they are deleted before the relative information
+  for (auto spacecraft = spacecraft_list_.rbegin(); spacecraft != spacecraft_list_.rend(); spacecraft++) {
+    delete *spacecraft;
+  }
+}
+
+void ConstellationSimulationCase::SetNumberOfThreads(const size_t number_of_threads) {
+  thread_pool_.reset(new ThreadPool(number_of_threads));
+}
+
+void ConstellationSimulationCase::RegisterSpacecraft(Spacecraft* spacecraft, const size_t update_group) {
+  spacecraft_list_.push_back(spacecraft);
+  if (update_groups_.size() <= update_group) update_groups_.resize(update_group + 1);
+  update_groups_[update_group].push_back(spacecraft);
+}
+
+void ConstellationSimulationCase::UpdateTargetObjects() {
+  const SimulationTime* simulation_time = &(global_environment_->GetSimulationTime());
+  for (auto& update_group : update_groups_) {
+    thread_pool_->ParallelFor(update_group.size(), [&update_group, simulation_time](const size_t i) { update_group[i]->Update(simulation_time); });
+  }
+  relative_information_.Update();
+}
+
+void ConstellationSimulationCase::SaveTargetObjectsState(CheckpointWriter& writer) const {
+  writer.BeginSection("ConstellationSimulationCase");
+  writer.Write((uint64_t)spacecraft_list_.size());
+  for (const auto spacecraft : spacecraft_list_) {
+    spacecraft->SaveState(writer);
+  }
+}
+
+void ConstellationSimulationCase::LoadTargetObjectsState(CheckpointReader& reader) {
+  reader.BeginSection("ConstellationSimulationCase");
+  reader.ReadSizeAndCheck(spacecraft_list_.size(), "spacecraft");
+  for (auto spacecraft : spacecraft_list_) {
+    spacecraft->LoadState(reader);
+  }
+  relative_information_.Update();
+}
+
+void ConstellationSimulationCase::InitializeThreadPool(const std::string initialize_base_file) {
+  IniAccess simulation_base_ini = IniAccess(initialize_base_file);
+  int number_of_threads = simulation_base_ini.ReadInt("SIMULATION_SETTINGS", "number_of_spacecraft_update_threads");
+  if (number_of_threads < 0) number_of_threads = 1;
+  thread_pool_.reset(new ThreadPool((size_t)number_of_threads));
+}
@@ -0,0 +1,123 @@
+/**
+ * @file constellation_simulation_case.hpp
+ * @brief Base class to define simulation scenario with many spacecraft updated in parallel
+ */
+
+#ifndef S2E_SIMULATION_CASE_CONSTELLATION_SIMULATION_CASE_HPP_
+#define S2E_SIMULATION_CASE_CONSTELLATION_SIMULATION_CASE_HPP_
+
+#include <library/utilities/thread_pool.hpp>
+#include <memory>
+#include <simulation/multiple_spacecraft/relative_information.hpp>
+#include <simulation/spacecraft/spacecraft.hpp>
+#include <vector>
+
+#include "simulation_case.hpp"
+
+/**
+ * @class ConstellationSimulationCase
+ * @brief Base class to define simulation scenario with many spacecraft updated in parallel
+ * @details All spacecraft share one global environment. After the global environment update, the registered spacecraft are updated in
+ *          parallel with a thread pool, and then the relative information is updated for the pairs of interest.
+ *          The spacecraft are updated group by group in ascending order of the update group. A spacecraft which refers to another spacecraft
+ *          in its update (e.g. relative orbit) should be registered in a later group than the referred spacecraft.
+ * @note The number of threads is set by number_of_spacecraft_update_threads in [SIMULATION_SETTINGS] (0: number of hardware threads).
+ *       The geomagnetic field model, the NRLMSISE00 model, and the noise shared by all spacecraft are serialized with mutexes, so the order of
+ *       the shared random numbers depends on the thread timing when more than one thread is used.
+ */
+class ConstellationSimulationCase : public SimulationCase {
+ public:
+  /**
+   * @fn ConstellationSimulationCase
+   * @brief Constructor
+   * @param[in] initialize_base_file: File path to initialize base file
+   */
+  ConstellationSimulationCase(const std::string initialize_base_file);
+  /**
+   * @fn ConstellationSimulationCase
+   * @brief Constructor for Monte-Carlo Simulation
+   * @param[in] initialize_base_file: File path to initialize base file
+   * @param[in] monte_carlo_simulator: Monte-Carlo simulator
+   * @param[in] log_path: Log output file path for Monte-Carlo simulation
+   */
+  ConstellationSimulationCase(const std::string initialize_base_file, const MonteCarloSimulationExecutor& monte_carlo_simulator,
+                              const std::string log_path);
+  /**
+   * @fn ~ConstellationSimulationCase
+   * @brief Destructor to delete the registered spacecraft
+   */
+  virtual ~ConstellationSimulationCase();
+
+  /**
+   * @fn SetNumberOfThreads
+   * @brief Set number of threads to update the spacecraft
+   * @param[in] number_of_threads: Number of threads including the main thread (0: number of hardware threads)
+   */
+  void SetNumberOfThreads(const size_t number_of_threads);
+
+  // Getter
+  /**
+   * @fn GetNumberOfThreads
+   * @brief Return number of threads to update the spacecraft
+   */
+  inline size_t GetNumberOfThreads() const { return thread_pool_->GetNumberOfThreads(); }
+  /**
+   * @fn GetNumberOfSpacecraft
+   * @brief Return number of registered spacecraft
+   */
+  inline size_t GetNumberOfSpacecraft() const { return spacecraft_list_.size(); }
+  /**
+   * @fn GetSpacecraft
+   * @brief Return registered spacecraft
+   * @param[in] index: Index of the spacecraft in the registration order
+   */
+  inline const Spacecraft& GetSpacecraft(const size_t index) const { return *spacecraft_list_[index]; }
+  /**
+   * @fn GetRelativeInformation
+   * @brief Return relative information between the spacecraft
+   */
+  inline const RelativeInformation& GetRelativeInformation() const { return relative_information_; }
+
+ protected:
+  RelativeInformation relative_information_;  //!< Relative information between the spacecraft
+
+  /**
+   * @fn RegisterSpacecraft
+   * @brief Register a spacecraft updated by this case. The spacecraft is deleted by this case.
+   * @note The spacecraft should be constructed with &relative_information_ to use the relative information.
+   * @param[in] spacecraft: Spacecraft
+   * @param[in] update_group: Update group of the spacecraft. The groups are updated in ascending order.
+   */
+  void RegisterSpacecraft(Spacecraft* spacecraft, const size_t update_group = 0);
+
+  /**
+   * @fn UpdateTargetObjects
+   * @brief Update the registered spacecraft in parallel and the relative information
+   */
+  virtual void UpdateTargetObjects();
+
+  /**
+   * @fn SaveTargetObjectsState
+   * @brief Write the states of the registered spacecraft to the checkpoint
+   */
+  virtual void SaveTargetObjectsState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadTargetObjectsState
+   * @brief Restore the states of the registered spacecraft from the checkpoint and update the relative information
+   */
+  virtual void LoadTargetObjectsState(CheckpointReader& reader);
+
+ private:
+  std::vector<Spacecraft*> spacecraft_list_;             //!< Registered spacecraft
+  std::vector<std::vector<Spacecraft*>> update_groups_;  //!< Spacecraft list for each update group
+  std::unique_ptr<ThreadPool> thread_pool_;              //!< Thread pool to update the spacecraft
+
+  /**
+   * @fn InitializeThreadPool
+   * @brief Initialize the thread pool with the initialize base file
+   * @param[in] initialize_base_file: File path to initialize base file
+   */
+  void InitializeThreadPool(const std::string initialize_base_file);
+};
+
+#endif  // S2E_SIMULATION_CASE_CONSTELLATION_SIMULATION_CASE_HPP_
@@ -5,8 +5,14 @@
 
 #include "simulation_case.hpp"
 
+#include <library/initialize/configuration_database.hpp>
 #include <library/initialize/initialize_file_access.hpp>
 #include <library/logger/initialize_log.hpp>
+#include <library/randomization/global_randomization.hpp>
+#include <library/utilities/profiler.hpp>
+#include <limits>
+#include <simulation/monte_carlo_simulation/simulation_object.hpp>
+#include <stdexcept>
 #include <string>
 
 SimulationCase::SimulationCase(const std::string initialize_base_file) {
@@ -24,24 +30,40 @@ SimulationCase::SimulationCase(const std::string initialize_base_file, const Mon
     simulation_configuration_.main_logger_ = InitLog(initialize_base_file);
   } else {
     // Monte Carlo Simulation is enabled
-    std::string log_file_name = "default" + std::to_string(monte_carlo_simulator.GetNumberOfExecutionsDone()) + ".csv";
-
     IniAccess ini_file(initialize_base_file);
-    bool save_ini_files = ini_file.ReadEnable("SIMULATION_SETTINGS", "save_initialize_files");
+    // The cases share the log directory, so the initialize files are saved only by the first case
+    bool save_ini_files =
+        ini_file.ReadEnable("SIMULATION_SETTINGS", "save_initialize_files") && monte_carlo_simulator.GetNumberOfExecutionsDone() == 0;
+    LogFileFormat file_format = ReadLogFileFormat(ini_file);
+
+    std::string log_file_name =
+        "default" + std::to_string(monte_carlo_simulator.GetNumberOfExecutionsDone()) + GetLogFileExtension(file_format);
 
     simulation_configuration_.main_logger_ =
-        new Logger(log_file_name, log_path, initialize_base_file, save_ini_files, monte_carlo_simulator.GetSaveLogHistoryFlag());
+        new Logger(log_file_name, log_path, initialize_base_file, save_ini_files, monte_carlo_simulator.GetSaveLogHistoryFlag(), file_format);
+    InitAsyncLogOutput(ini_file, *simulation_configuration_.main_logger_);
   }
   // Initialize Simulation Configuration
   InitializeSimulationConfiguration(initialize_base_file);
 }
 
-SimulationCase::~SimulationCase() { delete global_environment_; }
+SimulationCase::~SimulationCase() {
+  // The loggables are deleted with the case, so they should not remain in the log list for the next case
+  simulation_configuration_.main_logger_->ClearLogList();
+  delete global_environment_;
+}
 
 void SimulationCase::Initialize() {
   // Target Objects Initialize
   InitializeTargetObjects();
 
+  // All the initialize files are read at this point
+  if (simulation_configuration_.is_configuration_report_enabled_) {
+    std::cout << "\nConfiguration report\n";
+    const size_t number_of_reported_keys = configuration_database.PrintReport(std::cout);
+    std::cout << "  " << number_of_reported_keys << " keys reported" << std::endl;
+  }
+
   // Write headers to the log
   simulation_configuration_.main_logger_->WriteHeaders();
 
@@ -52,11 +74,82 @@ void SimulationCase::Initialize() {
 
 void SimulationCase::Main() {
   global_environment_->Reset();  // for MonteCarlo Simulation
+
+  // Restart from the checkpoint
+  bool is_restored = false;
+  if (simulation_configuration_.is_checkpoint_restore_enabled_) {
+    if (!LoadCheckpoint(simulation_configuration_.checkpoint_file_)) {
+      throw std::runtime_error("Failed to restore the checkpoint " + simulation_configuration_.checkpoint_file_);
+    }
+    is_restored = true;
+  }
+
+  // The log at the restored time is already written by the simulation which saved the checkpoint
+  MainLoop(is_restored, std::numeric_limits<double>::max());
+
+  PrintStatistics();
+}
+
+std::vector<unsigned char> SimulationCase::MainUntilBranch(const MonteCarloSimulationExecutor& monte_carlo_simulator) {
+  SimulationObject::CheckAllParametersForBranch(monte_carlo_simulator);
+
+  global_environment_->Reset();
+  MainLoop(false, monte_carlo_simulator.GetBranchTime_s());
+
+  CheckpointWriter writer;
+  WriteState(writer);
+  return writer.GetData();
+}
+
+void SimulationCase::MainFromBranch(const std::vector<unsigned char>& snapshot, const MonteCarloSimulationExecutor& monte_carlo_simulator) {
+  global_environment_->Reset();
+
+  // The seed of the case is drawn before the restore overwrites the global randomization
+  const long case_seed = global_randomization.MakeSeed();
+  CheckpointReader reader(snapshot);
+  if (!ReadState(reader, "branch snapshot")) {
+    throw std::runtime_error("Failed to restore the branch snapshot");
+  }
+  global_randomization.SetSeed(case_seed);
+  SimulationObject::SetAllParameters(monte_carlo_simulator);
+
+  // The log at the branch time is already written by the common part of the simulation
+  MainLoop(true, std::numeric_limits<double>::max());
+
+  PrintStatistics();
+}
+
+void SimulationCase::MainLoop(const bool skips_first_log_output, const double stop_time_s) {
+#ifdef S2E_PROFILER
+  simulation_profiler.Reset();
+  simulation_profiler.SetTraceEnabled(!simulation_configuration_.profiler_trace_file_.empty());
+#endif
+  bool skips_log_output = skips_first_log_output;
+  const double checkpoint_interval_s = simulation_configuration_.checkpoint_interval_s_;
+  double next_checkpoint_time_s = checkpoint_interval_s;
+  while (checkpoint_interval_s > 0.0 && next_checkpoint_time_s <= global_environment_->GetSimulationTime().GetElapsedTime_s()) {
+    next_checkpoint_time_s += checkpoint_interval_s;
+  }
+
   while (!global_environment_->GetSimulationTime().GetState().finish) {
+    S2E_PROFILE_SCOPE("SimulationCase::Step");
     // Logging
-    if (global_environment_->GetSimulationTime().GetState().log_output) {
+    if (global_environment_->GetSimulationTime().GetState().log_output && !skips_log_output) {
+      MultiRateScheduler::ScopedTaskTimer timer(global_environment_->GetSimulationTime().GetScheduler(), (size_t)SimulationTask::kLog);
       simulation_configuration_.main_logger_->WriteValues();
     }
+    skips_log_output = false;
+
+    // Checkpoint
+    // The state is saved after the logging, so the restored simulation continues from the global environment update
+    const double elapsed_time_s = global_environment_->GetSimulationTime().GetElapsedTime_s();
+    if (checkpoint_interval_s > 0.0 && elapsed_time_s >= next_checkpoint_time_s - 1.0e-6) {
+      if (!SaveCheckpoint(simulation_configuration_.checkpoint_file_)) {
+        std::cerr << "WARNING: failed to save the checkpoint " << simulation_configuration_.checkpoint_file_ << std::endl;
+      }
+      while (next_checkpoint_time_s <= elapsed_time_s + 1.0e-6) next_checkpoint_time_s += checkpoint_interval_s;
+    }
+    if (elapsed_time_s >= stop_time_s - 1.0e-6) break;
 
     // Global Environment Update
     global_environment_->Update();
@@ -71,6 +164,53 @@ void SimulationCase::Main() {
   }
 }
 
+void SimulationCase::PrintStatistics() const {
+  if (global_environment_->GetSimulationTime().GetSchedulerStatisticsOutput()) {
+    std::cout << std::endl;
+    global_environment_->GetSimulationTime().GetScheduler().PrintStatistics(std::cout);
+  }
+#ifdef S2E_PROFILER
+  std::cout << std::endl;
+  simulation_profiler.PrintReport(std::cout);
+  if (!simulation_configuration_.profiler_trace_file_.empty()) {
+    simulation_profiler.WriteChromeTrace(simulation_configuration_.profiler_trace_file_);
+  }
+#endif
+}
+
+bool SimulationCase::SaveCheckpoint(const std::string& file_path) const {
+  CheckpointWriter writer;
+  WriteState(writer);
+  return writer.SaveFile(file_path);
+}
+
+bool SimulationCase::LoadCheckpoint(const std::string& file_path) {
+  CheckpointReader reader = CheckpointReader::LoadFile(file_path);
+  return ReadState(reader, file_path);
+}
+
+void SimulationCase::WriteState(CheckpointWriter& writer) const {
+  writer.BeginSection("SimulationCase");
+  global_randomization.SaveState(writer);
+  global_environment_->SaveState(writer);
+  SaveTargetObjectsState(writer);
+}
+
+bool SimulationCase::ReadState(CheckpointReader& reader, const std::string& source_name) {
+  reader.BeginSection("SimulationCase");
+  global_randomization.LoadState(reader);
+  global_environment_->LoadState(reader);
+  LoadTargetObjectsState(reader);
+  if (reader.IsValid() && !reader.IsEnd()) {
+    reader.SetError("unread data remains");
+  }
+  if (!reader.IsValid()) {
+    std::cerr << "ERROR: failed to restore the checkpoint " << source_name << ": " << reader.GetErrorMessage() << std::endl;
+    return false;
+  }
+  return true;
+}
+
 std::string SimulationCase::GetLogHeader() const {
   std::string str_tmp = "";
 
@@ -101,6 +241,18 @@ void SimulationCase::InitializeSimulationConfiguration(const std::string initial
   simulation_configuration_.inter_sc_communication_file_ = simulation_base_ini.ReadString(section, "inter_sat_comm_file");
   simulation_configuration_.gnss_file_ = simulation_base_ini.ReadString(section, "gnss_file");
 
+  // Checkpoint
+  simulation_configuration_.checkpoint_interval_s_ = simulation_base_ini.ReadDouble(section, "checkpoint_interval_s");
+  simulation_configuration_.checkpoint_file_ = simulation_base_ini.ReadString(section, "checkpoint_file");
+  simulation_configuration_.is_checkpoint_restore_enabled_ = simulation_base_ini.ReadEnable(section, "checkpoint_restore");
+
+  // Configuration report
+  simulation_configuration_.is_configuration_report_enabled_ = simulation_base_ini.ReadEnable(section, "configuration_report");
+
+  // Profiler (Used only when S2E_PROFILER is defined)
+  simulation_configuration_.profiler_trace_file_ = simulation_base_ini.ReadString(section, "profiler_trace_file");
+  if (simulation_configuration_.profiler_trace_file_ == "NULL") simulation_configuration_.profiler_trace_file_ = "";
+
   // Global Environment
   global_environment_ = new GlobalEnvironment(&simulation_configuration_);
   global_environment_->LogSetup(*(simulation_configuration_.main_logger_));
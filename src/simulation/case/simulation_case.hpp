@@ -8,6 +8,8 @@
 
 #include <environment/global/global_environment.hpp>
 #include <library/logger/loggable.hpp>
+#include <library/utilities/checkpoint.hpp>
+#include <library/utilities/macros.hpp>
 #include <simulation/monte_carlo_simulation/monte_carlo_simulation_executor.hpp>
 
 #include "../simulation_configuration.hpp"
@@ -30,7 +32,7 @@ class SimulationCase : public ILoggable {
    * @brief Constructor for Monte-Carlo Simulation
    * @param[in] initialize_base_file: File path to initialize base file
    * @param[in] monte_carlo_simulator: Monte-Carlo simulator
-   * @param[in] log_path: Log output file path for Monte-Carlo simulation
+   * @param[in] log_path: Log output directory shared by the Monte-Carlo cases
    */
   SimulationCase(const std::string initialize_base_file, const MonteCarloSimulationExecutor& monte_carlo_simulator, const std::string log_path);
   /**
@@ -50,6 +52,41 @@ class SimulationCase : public ILoggable {
    * @brief Virtual function of main routine of the simulation scenario
    */
   virtual void Main();
+  /**
+   * @fn MainUntilBranch
+   * @brief Run the simulation until the branch time and return the snapshot for MainFromBranch
+   * @details Used for Monte-Carlo simulation to run the common part of the cases only once. The simulation is not started and
+   *          std::invalid_argument is thrown when an initial state parameter is randomized.
+   * @param[in] monte_carlo_simulator: Monte-Carlo simulator with the branch time
+   * @return Snapshot of the simulation state at the branch time
+   */
+  std::vector<unsigned char> MainUntilBranch(const MonteCarloSimulationExecutor& monte_carlo_simulator);
+  /**
+   * @fn MainFromBranch
+   * @brief Restore the snapshot, apply the randomized parameters, and run the rest of the simulation
+   * @note The random number generators restored from the snapshot are common to all the cases. Only the seeds drawn after the branch are
+   *       different in each case.
+   * @param[in] snapshot: Snapshot returned by MainUntilBranch with the same initialize files
+   * @param[in] monte_carlo_simulator: Monte-Carlo simulator prepared for the case
+   */
+  void MainFromBranch(const std::vector<unsigned char>& snapshot, const MonteCarloSimulationExecutor& monte_carlo_simulator);
+
+  /**
+   * @fn SaveCheckpoint
+   * @brief Save the simulation state to the checkpoint file
+   * @param[in] file_path: Path to the checkpoint file
+   * @return True when the checkpoint is saved
+   */
+  bool SaveCheckpoint(const std::string& file_path) const;
+  /**
+   * @fn LoadCheckpoint
+   * @brief Restore the simulation state from the checkpoint file
+   * @note The simulation should be initialized with the same initialize files as the checkpoint. When this returns false, the simulation
+   *       state may be partially restored.
+   * @param[in] file_path: Path to the checkpoint file
+   * @return True when the checkpoint is restored
+   */
+  bool LoadCheckpoint(const std::string& file_path);
 
   /**
    * @fn GetLogHeader
@@ -96,6 +133,47 @@ class SimulationCase : public ILoggable {
    * @brief Virtual function to update target objects(spacecraft and ground station)
    */
   virtual void UpdateTargetObjects() = 0;
+
+  /**
+   * @fn SaveTargetObjectsState
+   * @brief Virtual function to write the states of the target objects to the checkpoint
+   * @param[out] writer: Checkpoint writer
+   */
+  virtual void SaveTargetObjectsState(CheckpointWriter& writer) const { UNUSED(writer); }
+  /**
+   * @fn LoadTargetObjectsState
+   * @brief Virtual function to restore the states of the target objects from the checkpoint
+   * @param[in] reader: Checkpoint reader
+   */
+  virtual void LoadTargetObjectsState(CheckpointReader& reader) { UNUSED(reader); }
+
+ private:
+  /**
+   * @fn MainLoop
+   * @brief Update the simulation until the end or the stop time
+   * @param[in] skips_first_log_output: Skip the log output of the first step which is already written before the restore
+   * @param[in] stop_time_s: Elapsed time to stop the simulation after the log output [s]
+   */
+  void MainLoop(const bool skips_first_log_output, const double stop_time_s);
+  /**
+   * @fn PrintStatistics
+   * @brief Print the scheduler statistics and the profiler report, and write the profiler trace
+   */
+  void PrintStatistics() const;
+  /**
+   * @fn WriteState
+   * @brief Write the whole simulation state to the checkpoint
+   * @param[out] writer: Checkpoint writer
+   */
+  void WriteState(CheckpointWriter& writer) const;
+  /**
+   * @fn ReadState
+   * @brief Restore the whole simulation state from the checkpoint
+   * @param[in] reader: Checkpoint reader
+   * @param[in] source_name: Name of the snapshot for the error message
+   * @return True when the state is restored
+   */
+  bool ReadState(CheckpointReader& reader, const std::string& source_name);
 };
 
 #endif  // S2E_SIMULATION_CASE_SIMULATION_CASE_HPP_
@@ -11,7 +11,37 @@
 
 HilsPortManager::HilsPortManager() {}
 
-HilsPortManager::~HilsPortManager() {}
+HilsPortManager::HilsPortManager(ClockGenerator* clock_generator, const int poll_timeout_ms)
+    : clock_generator_(clock_generator), poll_timeout_ms_(poll_timeout_ms) {
+  clock_generator_->RegisterComponent(this);
+}
+
+HilsPortManager::~HilsPortManager() {
+  if (clock_generator_ != nullptr) clock_generator_->RemoveComponent(this);
+}
+
+void HilsPortManager::Tick(const unsigned int count) {
+  UNUSED(count);
+  PollPorts(poll_timeout_ms_);
+}
+
+void HilsPortManager::SetTransportAddress(const unsigned int port_id, const std::string address) { transport_addresses_[port_id] = address; }
+
+std::string HilsPortManager::GetTransportAddress(const unsigned int port_id) const {
+  auto found = transport_addresses_.find(port_id);
+  if (found == transport_addresses_.end()) return "";
+  return found->second;
+}
+
+int HilsPortManager::PollPorts(const int timeout_ms) {
+#if defined(USE_HILS) && !defined(WIN32)
+  return poller_.Poll(timeout_ms);
+#else
+  UNUSED(timeout_ms);
+
+  return -1;
+#endif
+}
 
 // UART Communication port functions
 int HilsPortManager::UartConnectComPort(unsigned int port_id, unsigned int baud_rate, unsigned int tx_buffer_size, unsigned int rx_buffer_size) {
@@ -24,7 +54,10 @@ int HilsPortManager::UartConnectComPort(unsigned int port_id, unsigned int baud_
     printf("Error: Illegal parameter\n");
     return -1;
   }
-  uart_ports_[port_id] = new HilsUartPort(port_id, baud_rate, tx_buffer_size, rx_buffer_size);
+  uart_ports_[port_id] = new HilsUartPort(port_id, baud_rate, tx_buffer_size, rx_buffer_size, GetTransportAddress(port_id));
+#ifndef WIN32
+  poller_.Register(uart_ports_[port_id]->GetTransport());
+#endif
   return 0;
 #else
   UNUSED(port_id);
@@ -44,6 +77,9 @@ int HilsPortManager::UartCloseComPort(unsigned int port_id) {
     return -1;
   }
 
+#ifndef WIN32
+  poller_.Unregister(uart_ports_[port_id]->GetTransport());
+#endif
   uart_ports_[port_id]->ClosePort();
   HilsUartPort* port = uart_ports_.at(port_id);
   delete port;
@@ -113,8 +149,11 @@ int HilsPortManager::I2cTargetConnectComPort(unsigned int port_id) {
     printf("Error: Port is already used\n");
     return -1;
   }
-  i2c_ports_[port_id] = new HilsI2cTargetPort(port_id);
+  i2c_ports_[port_id] = new HilsI2cTargetPort(port_id, GetTransportAddress(port_id));
   i2c_ports_[port_id]->RegisterDevice();
+#ifndef WIN32
+  poller_.Register(i2c_ports_[port_id]->GetTransport());
+#endif
   return 0;
 #else
   UNUSED(port_id);
@@ -129,6 +168,9 @@ int HilsPortManager::I2cTargetCloseComPort(unsigned int port_id) {
     // Port not used
     return -1;
   }
+#ifndef WIN32
+  poller_.Unregister(i2c_ports_[port_id]->GetTransport());
+#endif
   i2c_ports_[port_id]->ClosePort();
   HilsI2cTargetPort* port = i2c_ports_.at(port_id);
   delete port;
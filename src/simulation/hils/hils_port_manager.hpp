@@ -7,28 +7,72 @@
 #define S2E_SIMULATION_HILS_HILS_PORT_MANAGER_HPP_
 
 #ifdef USE_HILS
-#include "ports/hils_i2c_target_port.hpp"
-#include "ports/hils_uart_port.hpp"
+#include <components/ports/hils_i2c_target_port.hpp>
+#include <components/ports/hils_uart_port.hpp>
 #endif
+#include <components/base/interface_tickable.hpp>
+#include <environment/global/clock_generator.hpp>
 #include <map>
+#include <string>
 
 /**
  * @class HilsPortManager
  * @brief Class to manage COM ports for HILS test
+ * @details On the platforms other than Windows, the ports are opened with the transport address set by SetTransportAddress, and
+ *          PollPorts receives the available data of all ports in a batch. When the manager is registered to the clock generator,
+ *          PollPorts is called at every component update before the components access the ports.
  */
-class HilsPortManager {
+class HilsPortManager : public ITickable {
  public:
   /**
    * @fn HilsPortManager
    * @brief Constructor.
    */
   HilsPortManager();
+  /**
+   * @fn HilsPortManager
+   * @brief Constructor to poll the ports at every component update
+   * @note Construct this before the components using the ports, so that the ports are polled before the components are updated.
+   * @param [in] clock_generator: Clock generator
+   * @param [in] poll_timeout_ms: Maximum time to wait for the received data at each poll [ms]. 0 does not wait.
+   */
+  HilsPortManager(ClockGenerator* clock_generator, const int poll_timeout_ms);
   /**
    * @fn ~HilsPortManager
    * @brief Destructor.
    */
   virtual ~HilsPortManager();
 
+  // Override functions for ITickable
+  /**
+   * @fn Tick
+   * @brief Poll the ports at the component update
+   */
+  void Tick(const unsigned int count) override;
+  /**
+   * @fn FastTick
+   * @brief Do nothing since the ports are polled at the component update
+   */
+  void FastTick(const unsigned int fast_count) override { UNUSED(fast_count); }
+
+  /**
+   * @fn SetTransportAddress
+   * @brief Set the transport address of the port. This should be called before connecting the port.
+   * @note The address is ignored on Windows. See CreateHilsTransport for the address format.
+   * @param [in] port_id: COM port ID
+   * @param [in] address: Transport address like serial:/dev/ttyUSB0, pty:, tcp:localhost:5000, or loopback:
+   */
+  void SetTransportAddress(const unsigned int port_id, const std::string address);
+  /**
+   * @fn PollPorts
+   * @brief Send the queued data and receive the available data of all ports in a batch
+   * @note The ports also receive data when they are read, so calling this function is optional. It is effective to call it once per
+   *       step before the components read the ports.
+   * @param [in] timeout_ms: Maximum time to wait for the received data [ms]. 0 does not wait.
+   * @return Number of ports which received data, -1: error
+   */
+  int PollPorts(const int timeout_ms = 0);
+
   // UART Communication port functions
   /**
    * @fn UartConnectComPort
@@ -162,10 +206,22 @@ class HilsPortManager {
   virtual int I2cControllerSend(unsigned int port_id, const unsigned char* buffer, int offset, int length);
 
  private:
+  ClockGenerator* clock_generator_ = nullptr;                 //!< Clock generator to poll the ports
+  int poll_timeout_ms_ = 0;                                   //!< Maximum time to wait for the received data at each poll [ms]
+  std::map<unsigned int, std::string> transport_addresses_;  //!< Transport addresses of the ports
 #ifdef USE_HILS
   std::map<int, HilsUartPort*> uart_ports_;      //!< UART ports
   std::map<int, HilsI2cTargetPort*> i2c_ports_;  //!< I2C ports
+#ifndef WIN32
+  HilsTransportPoller poller_;  //!< Poller of the transports of the ports
 #endif
+#endif
+
+  /**
+   * @fn GetTransportAddress
+   * @brief Return the transport address of the port, or empty string when it is not set
+   */
+  std::string GetTransportAddress(const unsigned int port_id) const;
 };
 
 #endif  // S2E_SIMULATION_HILS_HILS_PORT_MANAGER_HPP_
@@ -0,0 +1,25 @@
+/**
+ * @file initialize_hils_port_manager.cpp
+ * @brief Initialize function for HilsPortManager
+ */
+
+#include "initialize_hils_port_manager.hpp"
+
+#include <library/initialize/initialize_file_access.hpp>
+
+HilsPortManager* InitHilsPortManager(ClockGenerator* clock_generator, const std::string file_name) {
+  IniAccess ini_file(file_name);
+  const char* section = "HILS_PORT_MANAGER";
+
+  const int poll_timeout_ms = ini_file.ReadInt(section, "poll_timeout_ms");
+  HilsPortManager* hils_port_manager = new HilsPortManager(clock_generator, poll_timeout_ms);
+
+  // The index of the list is the port ID
+  std::vector<std::string> transport_addresses = ini_file.ReadStrVector(section, "transport_address");
+  for (size_t port_id = 0; port_id < transport_addresses.size(); port_id++) {
+    if (transport_addresses[port_id] == "DEFAULT") continue;
+    hils_port_manager->SetTransportAddress((unsigned int)port_id, transport_addresses[port_id]);
+  }
+
+  return hils_port_manager;
+}
@@ -0,0 +1,21 @@
+/**
+ * @file initialize_hils_port_manager.hpp
+ * @brief Initialize function for HilsPortManager
+ */
+
+#ifndef S2E_SIMULATION_HILS_INITIALIZE_HILS_PORT_MANAGER_HPP_
+#define S2E_SIMULATION_HILS_INITIALIZE_HILS_PORT_MANAGER_HPP_
+
+#include "hils_port_manager.hpp"
+
+/**
+ * @fn InitHilsPortManager
+ * @brief Initialize function for HilsPortManager
+ * @note Call this before initializing the components using the ports, so that the ports are opened with the transport addresses and
+ *       polled before the components are updated.
+ * @param [in] clock_generator: Clock generator
+ * @param [in] file_name: Path to the initialize file
+ */
+HilsPortManager* InitHilsPortManager(ClockGenerator* clock_generator, const std::string file_name);
+
+#endif  // S2E_SIMULATION_HILS_INITIALIZE_HILS_PORT_MANAGER_HPP_
@@ -34,6 +34,9 @@ void InitializedMonteCarloParameters::SetSeed(unsigned long seed, bool is_determ
   } else {
     InitializedMonteCarloParameters::mt_.seed(InitializedMonteCarloParameters::randomizer_());
   }
+  // Discard the values cached in the distributions to make the sequence depend only on the seed
+  if (InitializedMonteCarloParameters::uniform_distribution_ != nullptr) InitializedMonteCarloParameters::uniform_distribution_->reset();
+  if (InitializedMonteCarloParameters::normal_distribution_ != nullptr) InitializedMonteCarloParameters::normal_distribution_->reset();
 }
 
 void InitializedMonteCarloParameters::GetRandomizedScalar(double& destination) const {
@@ -24,6 +24,16 @@ MonteCarloSimulationExecutor* InitMonteCarloSimulation(std::string file_name) {
   bool log_history = ini_file.ReadEnable(section, "log_enable");
   monte_carlo_simulator->SetSaveLogHistoryFlag(log_history);
 
+  unsigned long master_seed = (unsigned long)ini_file.ReadInt(section, "master_seed");
+  monte_carlo_simulator->SetMasterSeed(master_seed);
+
+  int number_of_workers = ini_file.ReadInt(section, "number_of_parallel_workers");
+  if (number_of_workers < 0) number_of_workers = 1;
+  monte_carlo_simulator->SetNumberOfWorkers((unsigned int)number_of_workers);
+
+  double branch_time_s = ini_file.ReadDouble(section, "branch_time_s");
+  monte_carlo_simulator->SetBranchTime_s(branch_time_s);
+
   section = "MONTE_CARLO_RANDOMIZATION";
   std::vector<std::string> so_dot_ip_str_vec = ini_file.ReadStrVector(section, "parameter");
   std::vector<std::string> so_str_vec, ip_str_vec;
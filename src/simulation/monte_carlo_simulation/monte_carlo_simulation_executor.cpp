@@ -5,6 +5,20 @@
 
 #include "monte_carlo_simulation_executor.hpp"
 
+#ifndef WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <library/randomization/global_randomization.hpp>
+#include <set>
+#include <thread>
+
 using std::string;
 
 MonteCarloSimulationExecutor::MonteCarloSimulationExecutor(unsigned long long total_num_of_executions)
@@ -12,6 +26,17 @@ MonteCarloSimulationExecutor::MonteCarloSimulationExecutor(unsigned long long to
   number_of_executions_done_ = 0;
   enabled_ = total_number_of_executions_ > 1 ? true : false;
   save_log_history_flag_ = !enabled_;
+  master_seed_ = 0;
+  number_of_workers_ = 1;
+  branch_time_s_ = 0.0;
+}
+
+void MonteCarloSimulationExecutor::SetNumberOfWorkers(unsigned int number_of_workers) {
+  if (number_of_workers == 0) {
+    number_of_workers = std::thread::hardware_concurrency();
+    if (number_of_workers == 0) number_of_workers = 1;
+  }
+  number_of_workers_ = number_of_workers;
 }
 
 bool MonteCarloSimulationExecutor::WillExecuteNextCase() {
@@ -60,6 +85,12 @@ void MonteCarloSimulationExecutor::GetInitializedMonteCarloParameterQuaternion(s
   }
 }
 
+bool MonteCarloSimulationExecutor::IsInitializedMonteCarloParameterDefined(string so_name, string init_monte_carlo_parameter_name) const {
+  if (!enabled_) return false;
+  string name = so_name + MonteCarloSimulationExecutor::separator_ + init_monte_carlo_parameter_name;
+  return init_parameter_list_.find(name) != init_parameter_list_.end();
+}
+
 void MonteCarloSimulationExecutor::RandomizeAllParameters() {
   for (auto ip : init_parameter_list_) {
     ip.second->Randomize();
@@ -69,3 +100,109 @@ void MonteCarloSimulationExecutor::RandomizeAllParameters() {
 void MonteCarloSimulationExecutor::SetSeed(unsigned long seed, bool is_deterministic) {
   InitializedMonteCarloParameters::SetSeed(seed, is_deterministic);
 }
+
+unsigned long MonteCarloSimulationExecutor::CalcCaseSeed(const unsigned long master_seed, const unsigned long long case_index) {
+  // SplitMix64 hash of the master seed and the case index
+  uint64_t z = (uint64_t)master_seed + ((uint64_t)case_index + 1) * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z = z ^ (z >> 31);
+  // Non-zero positive value for the minimal standard LCG used in global randomization
+  return (unsigned long)(z % 0x7FFFFFFEULL) + 1;
+}
+
+void MonteCarloSimulationExecutor::PrepareCase(const unsigned long long case_index) {
+  number_of_executions_done_ = case_index;
+  const unsigned long seed = CalcCaseSeed(master_seed_, case_index);
+  SetSeed(seed, true);
+  global_randomization.SetSeed((long)seed);
+  RandomizeAllParameters();
+}
+
+bool MonteCarloSimulationExecutor::RunCase(const unsigned long long case_index,
+                                           const std::function<void(const MonteCarloSimulationExecutor&)>& run_case) {
+  try {
+    PrepareCase(case_index);
+    run_case(*this);
+  } catch (const std::exception& e) {
+    std::cerr << "ERROR: Monte-Carlo case " << case_index << " failed: " << e.what() << std::endl;
+    return false;
+  } catch (const char* message) {
+    std::cerr << "ERROR: Monte-Carlo case " << case_index << " failed: " << message << std::endl;
+    return false;
+  }
+  return true;
+}
+
+unsigned long long MonteCarloSimulationExecutor::Execute(const std::function<void(const MonteCarloSimulationExecutor&)>& run_case) {
+  const unsigned long long number_of_cases = enabled_ ? total_number_of_executions_ : 1;
+  unsigned long long number_of_failed_cases = 0;
+  const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+#ifdef WIN32
+  if (number_of_workers_ > 1) {
+    std::cerr << "WARNING: parallel Monte-Carlo execution is not supported on this platform. The cases are executed in order." << std::endl;
+  }
+  for (unsigned long long case_index = 0; case_index < number_of_cases; case_index++) {
+    if (!RunCase(case_index, run_case)) number_of_failed_cases++;
+  }
+  number_of_executions_done_ = number_of_cases;
+#else
+  // Each case runs in a forked process, which starts from the state of this process before any case is executed
+  unsigned long long next_case_index = 0;
+  unsigned long long number_of_finished_cases = 0;
+  std::set<pid_t> worker_pids;
+  while (number_of_finished_cases < number_of_cases) {
+    if (next_case_index < number_of_cases && worker_pids.size() < number_of_workers_) {
+      // Flush the buffers not to output them twice from the worker
+      std::cout.flush();
+      std::cerr.flush();
+      pid_t pid = fork();
+      if (pid == 0) {
+        const bool is_succeeded = RunCase(next_case_index, run_case);
+        std::cout.flush();
+        std::cerr.flush();
+        _exit(is_succeeded ? EXIT_SUCCESS : EXIT_FAILURE);
+      } else if (pid < 0) {
+        std::cerr << "ERROR: Monte-Carlo case " << next_case_index << " cannot be started." << std::endl;
+        number_of_failed_cases++;
+        number_of_finished_cases++;
+      } else {
+        worker_pids.insert(pid);
+      }
+      next_case_index++;
+      continue;
+    }
+
+    // Only the workers are reaped not to take the exit status of the child processes started by the other modules
+    bool is_reaped = false;
+    for (auto worker_pid = worker_pids.begin(); worker_pid != worker_pids.end();) {
+      int status;
+      const pid_t result = waitpid(*worker_pid, &status, WNOHANG);
+      if (result == 0) {
+        worker_pid++;
+        continue;
+      }
+      if (result < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) number_of_failed_cases++;
+      worker_pid = worker_pids.erase(worker_pid);
+      number_of_finished_cases++;
+      is_reaped = true;
+    }
+    if (!is_reaped) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  number_of_executions_done_ = number_of_finished_cases;
+#endif
+
+  // Throughput summary
+  const double elapsed_time_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+  std::cout << std::endl << "Monte-Carlo simulation summary" << std::endl;
+  std::cout << "  Cases: " << number_of_cases << " (failed: " << number_of_failed_cases << ")" << std::endl;
+  std::cout << "  Workers: " << number_of_workers_ << std::endl;
+  if (branch_time_s_ > 0.0) std::cout << "  Branch time: " << branch_time_s_ << " s" << std::endl;
+  std::cout << "  Elapsed time: " << elapsed_time_s << " s" << std::endl;
+  if (elapsed_time_s > 0.0) {
+    std::cout << "  Throughput: " << (double)number_of_cases / elapsed_time_s * 3600.0 << " cases/hour" << std::endl;
+  }
+
+  return number_of_failed_cases;
+}
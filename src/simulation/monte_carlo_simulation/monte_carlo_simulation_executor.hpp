@@ -6,6 +6,7 @@
 #ifndef S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_SIMULATION_EXECUTOR_HPP_
 #define S2E_SIMULATION_MONTE_CARLO_SIMULATION_MONTE_CARLO_SIMULATION_EXECUTOR_HPP_
 
+#include <functional>
 #include <library/math/vector.hpp>
 #include <map>
 #include <string>
@@ -22,6 +23,9 @@ class MonteCarloSimulationExecutor {
   unsigned long long number_of_executions_done_;   //!< Number of executed case
   bool enabled_;                                   //!< Flag to execute Monte-Carlo Simulation or not
   bool save_log_history_flag_;                     //!< Flag to store the log for each case or not
+  unsigned long master_seed_;                      //!< Master seed to derive the seed of each case
+  unsigned int number_of_workers_;                 //!< Number of cases executed concurrently
+  double branch_time_s_;                           //!< Elapsed time to branch the cases from the common snapshot [s] (0: disabled)
 
   std::map<std::string, InitializedMonteCarloParameters*> init_parameter_list_;  //!< List of InitializedMonteCarloParameters read from MCSim.ini
 
@@ -55,6 +59,21 @@ class MonteCarloSimulationExecutor {
    * @brief Set seed of randomization. Use time infomation when is_deterministic = false.
    */
   static void SetSeed(unsigned long seed = 0, bool is_deterministic = false);
+  /**
+   * @fn SetMasterSeed
+   * @brief Set master seed to derive the seed of each case in Execute
+   */
+  inline void SetMasterSeed(unsigned long master_seed) { master_seed_ = master_seed; }
+  /**
+   * @fn SetNumberOfWorkers
+   * @brief Set number of cases executed concurrently in Execute. 0 means the number of hardware threads.
+   */
+  void SetNumberOfWorkers(unsigned int number_of_workers);
+  /**
+   * @fn SetBranchTime_s
+   * @brief Set elapsed time to branch the cases from the common snapshot. 0 means all cases run from the beginning.
+   */
+  inline void SetBranchTime_s(const double branch_time_s) { branch_time_s_ = (branch_time_s > 0.0) ? branch_time_s : 0.0; }
 
   // Getter
   /**
@@ -72,6 +91,16 @@ class MonteCarloSimulationExecutor {
    * @brief Return number of executed case
    */
   inline unsigned long long GetNumberOfExecutionsDone() const { return number_of_executions_done_; }
+  /**
+   * @fn GetNumberOfWorkers
+   * @brief Return number of cases executed concurrently
+   */
+  inline unsigned int GetNumberOfWorkers() const { return number_of_workers_; }
+  /**
+   * @fn GetBranchTime_s
+   * @brief Return elapsed time to branch the cases from the common snapshot [s]
+   */
+  inline double GetBranchTime_s() const { return branch_time_s_; }
   /**
    * @fn GetSaveLogHistoryFlag
    * @brief Return log history flag
@@ -98,6 +127,11 @@ class MonteCarloSimulationExecutor {
    */
   void GetInitializedMonteCarloParameterQuaternion(std::string so_name, std::string init_monte_carlo_parameter_name,
                                                    libra::Quaternion& destination) const;
+  /**
+   * @fn IsInitializedMonteCarloParameterDefined
+   * @brief Return true when the parameter is defined in the initialize file and the Monte-Carlo simulation is enabled
+   */
+  bool IsInitializedMonteCarloParameterDefined(std::string so_name, std::string init_monte_carlo_parameter_name) const;
 
   // Calculation
   /**
@@ -134,6 +168,39 @@ class MonteCarloSimulationExecutor {
    * @brief Randomize all initialized parameter
    */
   void RandomizeAllParameters();
+
+  /**
+   * @fn CalcCaseSeed
+   * @brief Calculate the seed of the case from the master seed and the case index
+   * @note The seed only depends on the arguments, so the randomized results do not depend on the execution order and the number of workers.
+   * @param [in] master_seed: Master seed
+   * @param [in] case_index: Index of the case
+   * @return Seed within [1, 2^31 - 2]
+   */
+  static unsigned long CalcCaseSeed(const unsigned long master_seed, const unsigned long long case_index);
+  /**
+   * @fn PrepareCase
+   * @brief Set the case index, set the seeds derived from the master seed, and randomize all initialized parameters
+   * @param [in] case_index: Index of the case
+   */
+  void PrepareCase(const unsigned long long case_index);
+  /**
+   * @fn Execute
+   * @brief Execute all the cases and print the throughput summary
+   * @details On POSIX systems, each case runs in a forked worker process so that the global registries of a case are isolated from the
+   *          other cases, and the cases are executed concurrently up to the number of workers. On the other systems, the cases run in order.
+   * @param [in] run_case: Function to construct, initialize and run a simulation case with the prepared executor
+   * @return Number of failed cases
+   */
+  unsigned long long Execute(const std::function<void(const MonteCarloSimulationExecutor&)>& run_case);
+
+ private:
+  /**
+   * @fn RunCase
+   * @brief Prepare and run a case with catching the exceptions
+   * @return True when the case finishes without exception
+   */
+  bool RunCase(const unsigned long long case_index, const std::function<void(const MonteCarloSimulationExecutor&)>& run_case);
 };
 
 template <size_t NumElement>
@@ -5,6 +5,8 @@
 
 #include "simulation_object.hpp"
 
+#include <stdexcept>
+
 std::map<std::string, SimulationObject*> SimulationObject::object_list_;
 
 SimulationObject::SimulationObject(std::string name) : name_(name) {
@@ -32,6 +34,18 @@ void SimulationObject::SetAllParameters(const MonteCarloSimulationExecutor& mont
   }
 }
 
+void SimulationObject::CheckAllParametersForBranch(const MonteCarloSimulationExecutor& monte_carlo_simulator) {
+  if (monte_carlo_simulator.GetBranchTime_s() <= 0.0) return;
+  for (auto so : SimulationObject::object_list_) {
+    for (const std::string& parameter_name : so.second->GetInitialStateParameterNames()) {
+      if (monte_carlo_simulator.IsInitializedMonteCarloParameterDefined(so.first, parameter_name)) {
+        throw std::invalid_argument(so.first + MonteCarloSimulationExecutor::separator_ + parameter_name +
+                                    " sets the initial state and cannot be randomized with branch_time_s > 0.");
+      }
+    }
+  }
+}
+
 void SimulationObject::GetInitializedMonteCarloParameterDouble(const MonteCarloSimulationExecutor& monte_carlo_simulator,
                                                                std::string init_monte_carlo_parameter_name, double& destination) const {
   monte_carlo_simulator.GetInitializedMonteCarloParameterDouble(name_, init_monte_carlo_parameter_name, destination);
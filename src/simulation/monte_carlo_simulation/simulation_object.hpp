@@ -61,12 +61,23 @@ class SimulationObject {
    * @brief Virtual function to set the randomized results to target variables
    */
   virtual void SetParameters(const MonteCarloSimulationExecutor& monte_carlo_simulator) = 0;
+  /**
+   * @fn GetInitialStateParameterNames
+   * @brief Virtual function to return the names of the parameters which overwrite the initial state in SetParameters
+   */
+  virtual std::vector<std::string> GetInitialStateParameterNames() const { return {}; }
 
   /**
    * @fn SetAllParameters
    * @brief Execute all SetParameter function for all SimulationObject instance
    */
   static void SetAllParameters(const MonteCarloSimulationExecutor& monte_carlo_simulator);
+  /**
+   * @fn CheckAllParametersForBranch
+   * @brief Throw std::invalid_argument when an initial state parameter is randomized with the branch time
+   * @note The state at the branch time is already propagated, so the randomized initial state would overwrite it.
+   */
+  static void CheckAllParametersForBranch(const MonteCarloSimulationExecutor& monte_carlo_simulator);
 
  private:
   std::string name_;  //!< Name to distinguish the target variable in initialize file for Monte-Carlo simulation
@@ -5,35 +5,27 @@
 
 #include "relative_information.hpp"
 
+#include <algorithm>
+
 RelativeInformation::RelativeInformation() {}
 
 RelativeInformation::~RelativeInformation() {}
 
 void RelativeInformation::Update() {
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < dynamics_database_.size(); reference_spacecraft_id++) {
-      // Position
-      libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetPosition_i_m();
-      libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetPosition_i_m();
-      relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id] = target_sat_pos_i - reference_sat_pos_i;
-      relative_position_list_rtn_m_[target_spacecraft_id][reference_spacecraft_id] =
-          CalcRelativePosition_rtn_m(target_spacecraft_id, reference_spacecraft_id);
-
-      // Distance
-      relative_distance_list_m_[target_spacecraft_id][reference_spacecraft_id] =
-          relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id].CalcNorm();
-
-      // Velocity
-      libra::Vector<3> target_sat_vel_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-      libra::Vector<3> reference_sat_vel_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-      relative_velocity_list_i_m_s_[target_spacecraft_id][reference_spacecraft_id] = target_sat_vel_i - reference_sat_vel_i;
-      relative_velocity_list_rtn_m_s_[target_spacecraft_id][reference_spacecraft_id] =
-          CalcRelativeVelocity_rtn_m_s(target_spacecraft_id, reference_spacecraft_id);
-
-      // Attitude Quaternion
-      relative_attitude_quaternion_list_[target_spacecraft_id][reference_spacecraft_id] =
-          CalcRelativeAttitudeQuaternion(target_spacecraft_id, reference_spacecraft_id);
-    }
+  // RTN frame of each spacecraft
+  for (size_t spacecraft_id = 0; spacecraft_id < dynamics_database_.size(); spacecraft_id++) {
+    const Orbit& orbit = dynamics_database_.at(spacecraft_id)->GetOrbit();
+    quaternion_i2rtn_list_[spacecraft_id] = orbit.CalcQuaternion_i2lvlh();
+
+    libra::Vector<3> position_i_m = orbit.GetPosition_i_m();
+    libra::Vector<3> rotation_vector_i = cross(position_i_m, orbit.GetVelocity_i_m_s());
+    double r2 = position_i_m.CalcNorm() * position_i_m.CalcNorm();
+    rotation_vector_i /= r2;
+    rtn_angular_velocity_list_i_rad_s_[spacecraft_id] = rotation_vector_i;
+  }
+
+  for (const auto& pair : calculated_pairs_) {
+    UpdatePair(pair.first, pair.second);
   }
 }
 
@@ -47,34 +39,37 @@ void RelativeInformation::RemoveDynamicsInfo(const int spacecraft_id) {
   ResizeLists();
 }
 
+void RelativeInformation::RegisterPairOfInterest(const int target_spacecraft_id, const int reference_spacecraft_id) {
+  if (target_spacecraft_id == reference_spacecraft_id) return;
+  // Both directions are calculated, so the pair is stored with the larger ID first
+  std::pair<int, int> pair = std::minmax(target_spacecraft_id, reference_spacecraft_id);
+  std::swap(pair.first, pair.second);
+  if (std::find(pairs_of_interest_.begin(), pairs_of_interest_.end(), pair) != pairs_of_interest_.end()) return;
+  pairs_of_interest_.push_back(pair);
+  UpdateCalculatedPairs();
+}
+
+void RelativeInformation::ClearPairsOfInterest() {
+  pairs_of_interest_.clear();
+  UpdateCalculatedPairs();
+}
+
 std::string RelativeInformation::GetLogHeader() const {
   std::string str_tmp = "";
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(
-          "satellite" + std::to_string(target_spacecraft_id) + "_position_from_satellite" + std::to_string(reference_spacecraft_id), "i", "m", 3);
-    }
+  for (const auto& pair : calculated_pairs_) {
+    str_tmp += WriteVector("satellite" + std::to_string(pair.first) + "_position_from_satellite" + std::to_string(pair.second), "i", "m", 3);
   }
 
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(
-          "satellite" + std::to_string(target_spacecraft_id) + "_velocity_from_satellite" + std::to_string(reference_spacecraft_id), "i", "m/s", 3);
-    }
+  for (const auto& pair : calculated_pairs_) {
+    str_tmp += WriteVector("satellite" + std::to_string(pair.first) + "_velocity_from_satellite" + std::to_string(pair.second), "i", "m/s", 3);
   }
 
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(
-          "satellite" + std::to_string(target_spacecraft_id) + "_position_from_satellite" + std::to_string(reference_spacecraft_id), "rtn", "m", 3);
-    }
+  for (const auto& pair : calculated_pairs_) {
+    str_tmp += WriteVector("satellite" + std::to_string(pair.first) + "_position_from_satellite" + std::to_string(pair.second), "rtn", "m", 3);
   }
 
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(
-          "satellite" + std::to_string(target_spacecraft_id) + "_velocity_from_satellite" + std::to_string(reference_spacecraft_id), "rtn", "m/s", 3);
-    }
+  for (const auto& pair : calculated_pairs_) {
+    str_tmp += WriteVector("satellite" + std::to_string(pair.first) + "_velocity_from_satellite" + std::to_string(pair.second), "rtn", "m/s", 3);
   }
 
   return str_tmp;
@@ -82,28 +77,20 @@ std::string RelativeInformation::GetLogHeader() const {
 
 std::string RelativeInformation::GetLogValue() const {
   std::string str_tmp = "";
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(GetRelativePosition_i_m(target_spacecraft_id, reference_spacecraft_id));
-    }
+  for (const auto& pair : calculated_pairs_) {
+    str_tmp += WriteVector(GetRelativePosition_i_m(pair.first, pair.second));
   }
 
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(GetRelativeVelocity_i_m_s(target_spacecraft_id, reference_spacecraft_id));
-    }
+  for (const auto& pair : calculated_pairs_) {
+    str_tmp += WriteVector(GetRelativeVelocity_i_m_s(pair.first, pair.second));
   }
 
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(GetRelativePosition_rtn_m(target_spacecraft_id, reference_spacecraft_id));
-    }
+  for (const auto& pair : calculated_pairs_) {
+    str_tmp += WriteVector(GetRelativePosition_rtn_m(pair.first, pair.second));
   }
 
-  for (size_t target_spacecraft_id = 0; target_spacecraft_id < dynamics_database_.size(); target_spacecraft_id++) {
-    for (size_t reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
-      str_tmp += WriteVector(GetRelativeVelocity_rtn_m_s(target_spacecraft_id, reference_spacecraft_id));
-    }
+  for (const auto& pair : calculated_pairs_) {
+    str_tmp += WriteVector(GetRelativeVelocity_rtn_m_s(pair.first, pair.second));
   }
 
   return str_tmp;
@@ -111,55 +98,78 @@ std::string RelativeInformation::GetLogValue() const {
 
 void RelativeInformation::LogSetup(Logger& logger) { logger.AddLogList(this); }
 
-libra::Quaternion RelativeInformation::CalcRelativeAttitudeQuaternion(const int target_spacecraft_id, const int reference_spacecraft_id) {
-  // Observer SC Body frame(obs_sat) -> ECI frame(i)
-  libra::Quaternion q_reference_i2b = dynamics_database_.at(reference_spacecraft_id)->GetAttitude().GetQuaternion_i2b();
-  libra::Quaternion q_reference_b2i = q_reference_i2b.Conjugate();
-
-  // ECI frame(i) -> Target SC body frame(main_sat)
-  libra::Quaternion q_target_i2b = dynamics_database_.at(target_spacecraft_id)->GetAttitude().GetQuaternion_i2b();
-
-  return q_target_i2b * q_reference_b2i;
-}
-
-libra::Vector<3> RelativeInformation::CalcRelativePosition_rtn_m(const int target_spacecraft_id, const int reference_spacecraft_id) {
-  libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> relative_pos_i = target_sat_pos_i - reference_sat_pos_i;
-
-  // RTN frame for the reference satellite
-  libra::Quaternion q_i2rtn = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().CalcQuaternion_i2lvlh();
-
-  libra::Vector<3> relative_pos_rtn = q_i2rtn.FrameConversion(relative_pos_i);
-  return relative_pos_rtn;
-}
-
-libra::Vector<3> RelativeInformation::CalcRelativeVelocity_rtn_m_s(const int target_spacecraft_id, const int reference_spacecraft_id) {
-  libra::Vector<3> target_sat_pos_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> reference_sat_pos_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetPosition_i_m();
-  libra::Vector<3> relative_pos_i = target_sat_pos_i - reference_sat_pos_i;
-
-  // RTN frame for the reference satellite
-  libra::Quaternion q_i2rtn = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().CalcQuaternion_i2lvlh();
-
-  // Rotation vector of RTN frame
-  libra::Vector<3> reference_sat_vel_i = dynamics_database_.at(reference_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-  libra::Vector<3> target_sat_vel_i = dynamics_database_.at(target_spacecraft_id)->GetOrbit().GetVelocity_i_m_s();
-  libra::Vector<3> rot_vec_rtn_i = cross(reference_sat_pos_i, reference_sat_vel_i);
-  double r2_ref = reference_sat_pos_i.CalcNorm() * reference_sat_pos_i.CalcNorm();
-  rot_vec_rtn_i /= r2_ref;
-  libra::Vector<3> relative_vel_i = target_sat_vel_i - reference_sat_vel_i - cross(rot_vec_rtn_i, relative_pos_i);
-
-  libra::Vector<3> relative_vel_rtn = q_i2rtn.FrameConversion(relative_vel_i);
-  return relative_vel_rtn;
+void RelativeInformation::UpdatePair(const int target_spacecraft_id, const int reference_spacecraft_id) {
+  const Dynamics* target_dynamics = dynamics_database_.at(target_spacecraft_id);
+  const Dynamics* reference_dynamics = dynamics_database_.at(reference_spacecraft_id);
+
+  // Position and velocity in the inertial frame
+  libra::Vector<3> relative_position_i_m = target_dynamics->GetOrbit().GetPosition_i_m() - reference_dynamics->GetOrbit().GetPosition_i_m();
+  libra::Vector<3> relative_velocity_i_m_s = target_dynamics->GetOrbit().GetVelocity_i_m_s() - reference_dynamics->GetOrbit().GetVelocity_i_m_s();
+  relative_position_list_i_m_[target_spacecraft_id][reference_spacecraft_id] = relative_position_i_m;
+  relative_position_list_i_m_[reference_spacecraft_id][target_spacecraft_id] = -relative_position_i_m;
+  relative_velocity_list_i_m_s_[target_spacecraft_id][reference_spacecraft_id] = relative_velocity_i_m_s;
+  relative_velocity_list_i_m_s_[reference_spacecraft_id][target_spacecraft_id] = -relative_velocity_i_m_s;
+
+  // Distance
+  const double relative_distance_m = relative_position_i_m.CalcNorm();
+  relative_distance_list_m_[target_spacecraft_id][reference_spacecraft_id] = relative_distance_m;
+  relative_distance_list_m_[reference_spacecraft_id][target_spacecraft_id] = relative_distance_m;
+
+  // Position and velocity in the RTN frame of the reference spacecraft
+  const libra::Quaternion& q_i2rtn_reference = quaternion_i2rtn_list_[reference_spacecraft_id];
+  const libra::Quaternion& q_i2rtn_target = quaternion_i2rtn_list_[target_spacecraft_id];
+  relative_position_list_rtn_m_[target_spacecraft_id][reference_spacecraft_id] = q_i2rtn_reference.FrameConversion(relative_position_i_m);
+  relative_position_list_rtn_m_[reference_spacecraft_id][target_spacecraft_id] = q_i2rtn_target.FrameConversion(-relative_position_i_m);
+  libra::Vector<3> relative_velocity_from_reference_i_m_s =
+      relative_velocity_i_m_s - cross(rtn_angular_velocity_list_i_rad_s_[reference_spacecraft_id], relative_position_i_m);
+  libra::Vector<3> relative_velocity_from_target_i_m_s =
+      -relative_velocity_i_m_s + cross(rtn_angular_velocity_list_i_rad_s_[target_spacecraft_id], relative_position_i_m);
+  relative_velocity_list_rtn_m_s_[target_spacecraft_id][reference_spacecraft_id] =
+      q_i2rtn_reference.FrameConversion(relative_velocity_from_reference_i_m_s);
+  relative_velocity_list_rtn_m_s_[reference_spacecraft_id][target_spacecraft_id] =
+      q_i2rtn_target.FrameConversion(relative_velocity_from_target_i_m_s);
+
+  // Attitude quaternion
+  libra::Quaternion q_target_i2b = target_dynamics->GetAttitude().GetQuaternion_i2b();
+  libra::Quaternion q_reference_i2b = reference_dynamics->GetAttitude().GetQuaternion_i2b();
+  relative_attitude_quaternion_list_[target_spacecraft_id][reference_spacecraft_id] = q_target_i2b * q_reference_i2b.Conjugate();
+  relative_attitude_quaternion_list_[reference_spacecraft_id][target_spacecraft_id] = q_reference_i2b * q_target_i2b.Conjugate();
 }
 
 void RelativeInformation::ResizeLists() {
+  // The existing elements are kept, so that the registration of many spacecraft does not rebuild the whole lists every time
   size_t size = dynamics_database_.size();
-  relative_position_list_i_m_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_velocity_list_i_m_s_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_distance_list_m_.assign(size, std::vector<double>(size, 0.0));
-  relative_position_list_rtn_m_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_velocity_list_rtn_m_s_.assign(size, std::vector<libra::Vector<3>>(size, libra::Vector<3>(0)));
-  relative_attitude_quaternion_list_.assign(size, std::vector<libra::Quaternion>(size, libra::Quaternion(0, 0, 0, 1)));
+  relative_position_list_i_m_.resize(size);
+  relative_velocity_list_i_m_s_.resize(size);
+  relative_distance_list_m_.resize(size);
+  relative_position_list_rtn_m_.resize(size);
+  relative_velocity_list_rtn_m_s_.resize(size);
+  relative_attitude_quaternion_list_.resize(size);
+  for (size_t i = 0; i < size; i++) {
+    relative_position_list_i_m_[i].resize(size, libra::Vector<3>(0));
+    relative_velocity_list_i_m_s_[i].resize(size, libra::Vector<3>(0));
+    relative_distance_list_m_[i].resize(size, 0.0);
+    relative_position_list_rtn_m_[i].resize(size, libra::Vector<3>(0));
+    relative_velocity_list_rtn_m_s_[i].resize(size, libra::Vector<3>(0));
+    relative_attitude_quaternion_list_[i].resize(size, libra::Quaternion(0, 0, 0, 1));
+  }
+  quaternion_i2rtn_list_.resize(size, libra::Quaternion(0, 0, 0, 1));
+  rtn_angular_velocity_list_i_rad_s_.resize(size, libra::Vector<3>(0));
+  UpdateCalculatedPairs();
+}
+
+void RelativeInformation::UpdateCalculatedPairs() {
+  const int number_of_spacecraft = (int)dynamics_database_.size();
+  calculated_pairs_.clear();
+  if (pairs_of_interest_.empty()) {
+    for (int target_spacecraft_id = 0; target_spacecraft_id < number_of_spacecraft; target_spacecraft_id++) {
+      for (int reference_spacecraft_id = 0; reference_spacecraft_id < target_spacecraft_id; reference_spacecraft_id++) {
+        calculated_pairs_.push_back(std::make_pair(target_spacecraft_id, reference_spacecraft_id));
+      }
+    }
+    return;
+  }
+  for (const auto& pair : pairs_of_interest_) {
+    if (pair.first < number_of_spacecraft) calculated_pairs_.push_back(pair);
+  }
 }
@@ -7,6 +7,8 @@
 #define S2E_MULTIPLE_SPACECRAFT_RELATIVE_INFORMATION_HPP_
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "../../dynamics/dynamics.hpp"
 #include "../../library/logger/loggable.hpp"
@@ -15,6 +17,9 @@
 /**
  * @class RelativeInformation
  * @brief Base class to manage relative information between spacecraft
+ * @details The relative information is calculated for the pairs of interest registered by RegisterPairOfInterest.
+ *          When no pair is registered, all pairs of the spacecraft are calculated. Each pair is calculated once and both directions are
+ *          stored, and the RTN frame of each spacecraft is calculated once per update.
  */
 class RelativeInformation : public ILoggable {
  public:
@@ -31,7 +36,7 @@ class RelativeInformation : public ILoggable {
 
   /**
    * @fn Update
-   * @brief Update all relative information
+   * @brief Update relative information of the pairs of interest
    */
   void Update();
   /**
@@ -47,6 +52,19 @@ class RelativeInformation : public ILoggable {
    * @param [in] spacecraft_id: ID of target spacecraft
    */
   void RemoveDynamicsInfo(const int spacecraft_id);
+  /**
+   * @fn RegisterPairOfInterest
+   * @brief Register a pair of spacecraft to calculate the relative information
+   * @note The relative information is calculated for both directions of the pair.
+   * @param [in] target_spacecraft_id: ID of target spacecraft
+   * @param [in] reference_spacecraft_id: ID of reference spacecraft
+   */
+  void RegisterPairOfInterest(const int target_spacecraft_id, const int reference_spacecraft_id);
+  /**
+   * @fn ClearPairsOfInterest
+   * @brief Clear the registered pairs, so that all pairs of the spacecraft are calculated
+   */
+  void ClearPairsOfInterest();
 
   // Override classes for ILoggable
   /**
@@ -128,9 +146,16 @@ class RelativeInformation : public ILoggable {
    * @param [in] target_spacecraft_id: ID of the spacecraft
    */
   inline const Dynamics* GetReferenceSatDynamics(const int reference_spacecraft_id) const { return dynamics_database_.at(reference_spacecraft_id); };
+  /**
+   * @fn GetPairsOfInterest
+   * @brief Return the pairs of the calculated relative information (The first ID is larger than the second ID)
+   */
+  inline const std::vector<std::pair<int, int>>& GetPairsOfInterest() const { return calculated_pairs_; }
 
  private:
   std::map<const int, const Dynamics*> dynamics_database_;  //!< Dynamics database of all spacecraft
+  std::vector<std::pair<int, int>> pairs_of_interest_;      //!< Registered pairs of interest (The first ID is larger than the second ID)
+  std::vector<std::pair<int, int>> calculated_pairs_;       //!< Pairs calculated in Update
 
   std::vector<std::vector<libra::Vector<3>>> relative_position_list_i_m_;          //!< Relative position list in the inertial frame in unit [m]
   std::vector<std::vector<libra::Vector<3>>> relative_velocity_list_i_m_s_;        //!< Relative velocity list in the inertial frame in unit [m/s]
@@ -139,33 +164,27 @@ class RelativeInformation : public ILoggable {
   std::vector<std::vector<double>> relative_distance_list_m_;                      //!< Relative distance list in unit [m]
   std::vector<std::vector<libra::Quaternion>> relative_attitude_quaternion_list_;  //!< Relative attitude quaternion list
 
+  std::vector<libra::Quaternion> quaternion_i2rtn_list_;             //!< Quaternion from the inertial frame to the RTN frame of each spacecraft
+  std::vector<libra::Vector<3>> rtn_angular_velocity_list_i_rad_s_;  //!< Angular velocity of the RTN frame of each spacecraft [rad/s]
+
   /**
-   * @fn CalcRelativeAttitudeQuaternion
-   * @brief Calculate and return the relative attitude quaternion
-   * @param [in] target_spacecraft_id: ID of the spacecraft
-   * @param [in] reference_spacecraft_id: ID of reference spacecraft
-   */
-  libra::Quaternion CalcRelativeAttitudeQuaternion(const int target_spacecraft_id, const int reference_spacecraft_id);
-  /**
-   * @fn CalcRelativePosition_rtn_m
-   * @brief Calculate and return the relative position in RTN frame
-   * @param [in] target_spacecraft_id: ID of the spacecraft
-   * @param [in] reference_spacecraft_id: ID of reference spacecraft
-   */
-  libra::Vector<3> CalcRelativePosition_rtn_m(const int target_spacecraft_id, const int reference_spacecraft_id);
-  /**
-   * @fn CalcRelativeVelocity_rtn_m_s
-   * @brief Calculate and return the relative velocity in RTN frame
+   * @fn UpdatePair
+   * @brief Update relative information of both directions of the pair
    * @param [in] target_spacecraft_id: ID of the spacecraft
    * @param [in] reference_spacecraft_id: ID of reference spacecraft
    */
-  libra::Vector<3> CalcRelativeVelocity_rtn_m_s(const int target_spacecraft_id, const int reference_spacecraft_id);
+  void UpdatePair(const int target_spacecraft_id, const int reference_spacecraft_id);
 
   /**
    * @fn ResizeLists
    * @brief Resize list suit with the dynamics database
    */
   void ResizeLists();
+  /**
+   * @fn UpdateCalculatedPairs
+   * @brief Update the calculated pairs with the pairs of interest and the dynamics database
+   */
+  void UpdateCalculatedPairs();
 };
 
 #endif  // S2E_MULTIPLE_SPACECRAFT_RELATIVE_INFORMATION_HPP_
@@ -28,6 +28,13 @@ struct SimulationConfiguration {
   std::string inter_sc_communication_file_;  //!< File name for inter-satellite communication initialization
   std::string gnss_file_;                    //!< File name for GNSS initialization
 
+  double checkpoint_interval_s_;        //!< Interval to save the checkpoint in the simulation time [s] (0: disabled)
+  std::string checkpoint_file_;         //!< File name of the checkpoint
+  bool is_checkpoint_restore_enabled_;  //!< Flag to restart the simulation from the checkpoint file
+
+  bool is_configuration_report_enabled_;  //!< Flag to print the missing and unused keys of the initialize files after the initialization
+  std::string profiler_trace_file_;       //!< File name of the Chrome trace written by the profiler (empty: disabled)
+
   /**
    * @fn ~SimulationConfiguration
    * @brief Destructor
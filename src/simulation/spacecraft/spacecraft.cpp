@@ -7,6 +7,7 @@
 
 #include <library/logger/log_utility.hpp>
 #include <library/logger/logger.hpp>
+#include <library/utilities/profiler.hpp>
 
 Spacecraft::Spacecraft(const SimulationConfiguration* simulation_configuration, const GlobalEnvironment* global_environment, const int spacecraft_id,
                        RelativeInformation* relative_information)
@@ -49,7 +50,30 @@ void Spacecraft::LogSetup(Logger& logger) {
   components_->LogSetup(logger);
 }
 
+void Spacecraft::SaveState(CheckpointWriter& writer) const {
+  writer.BeginSection("Spacecraft");
+  writer.Write(spacecraft_id_);
+  dynamics_->SaveState(writer);
+  local_environment_->SaveState(writer);
+  disturbances_->SaveState(writer);
+  clock_generator_.SaveState(writer);
+}
+
+void Spacecraft::LoadState(CheckpointReader& reader) {
+  reader.BeginSection("Spacecraft");
+  unsigned int spacecraft_id = 0;
+  reader.Read(spacecraft_id);
+  if (reader.IsValid() && spacecraft_id != spacecraft_id_) {
+    reader.SetError("spacecraft " + std::to_string(spacecraft_id_) + " is expected but " + std::to_string(spacecraft_id) + " is found");
+  }
+  dynamics_->LoadState(reader);
+  local_environment_->LoadState(reader, dynamics_);
+  disturbances_->LoadState(reader);
+  clock_generator_.LoadState(reader);
+}
+
 void Spacecraft::Update(const SimulationTime* simulation_time) {
+  S2E_PROFILE_SCOPE("Spacecraft::Update");
   dynamics_->ClearForceTorque();
 
   // Update local environment and disturbance
@@ -64,6 +64,20 @@ class Spacecraft {
    */
   virtual void LogSetup(Logger& logger);
 
+  /**
+   * @fn SaveState
+   * @brief Write the states of the dynamics, the local environment, the disturbances, and the components to the checkpoint
+   * @param [out] writer: Checkpoint writer
+   */
+  virtual void SaveState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadState
+   * @brief Restore the states of the dynamics, the local environment, the disturbances, and the components from the checkpoint
+   * @note Call this after the global environment is restored.
+   * @param [in] reader: Checkpoint reader
+   */
+  virtual void LoadState(CheckpointReader& reader);
+
   // Getters
   /**
    * @fn GetDynamics
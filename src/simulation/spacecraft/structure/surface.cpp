@@ -5,6 +5,8 @@
 
 #include "surface.hpp"
 
+std::atomic<uint64_t> Surface::modification_count_(0);
+
 Surface::Surface(const libra::Vector<3> position_b_m, const libra::Vector<3> normal_b, const double area_m2, const double reflectivity,
                  const double specularity, const double air_specularity)
     : position_b_m_(position_b_m),
@@ -12,4 +14,27 @@ Surface::Surface(const libra::Vector<3> position_b_m, const libra::Vector<3> nor
       area_m2_(area_m2),
       reflectivity_(reflectivity),
       specularity_(specularity),
-      air_specularity_(air_specularity) {}
+      air_specularity_(air_specularity) {
+  CountModification();
+}
+
+Surface::Surface(const Surface& surface)
+    : position_b_m_(surface.position_b_m_),
+      normal_b_(surface.normal_b_),
+      area_m2_(surface.area_m2_),
+      reflectivity_(surface.reflectivity_),
+      specularity_(surface.specularity_),
+      air_specularity_(surface.air_specularity_) {
+  CountModification();
+}
+
+Surface& Surface::operator=(const Surface& surface) {
+  position_b_m_ = surface.position_b_m_;
+  normal_b_ = surface.normal_b_;
+  area_m2_ = surface.area_m2_;
+  reflectivity_ = surface.reflectivity_;
+  specularity_ = surface.specularity_;
+  air_specularity_ = surface.air_specularity_;
+  CountModification();
+  return *this;
+}
@@ -6,6 +6,8 @@
 #ifndef S2E_SIMULATION_SPACECRAFT_STRUCTURE_SURFACE_HPP_
 #define S2E_SIMULATION_SPACECRAFT_STRUCTURE_SURFACE_HPP_
 
+#include <atomic>
+#include <cstdint>
 #include <library/math/vector.hpp>
 
 /**
@@ -20,6 +22,16 @@ class Surface {
    */
   Surface(const libra::Vector<3> position_b_m, const libra::Vector<3> normal_b, const double area_m2, const double reflectivity,
           const double specularity, const double air_specularity);
+  /**
+   * @fn Surface
+   * @brief Copy constructor
+   */
+  Surface(const Surface& surface);
+  /**
+   * @fn operator=
+   * @brief Copy assignment operator
+   */
+  Surface& operator=(const Surface& surface);
   /**
    * @fn ~Surface
    * @brief Destructor
@@ -58,19 +70,32 @@ class Surface {
    */
   inline const double& GetAirSpecularity(void) const { return air_specularity_; }
 
+  /**
+   * @fn GetModificationCount
+   * @brief Return the number of constructions and modifications of all surfaces
+   * @note Users can detect the change of the surfaces by comparing the count without comparing the parameters.
+   */
+  static inline uint64_t GetModificationCount(void) { return modification_count_.load(std::memory_order_relaxed); }
+
   // Setter
   /**
    * @fn SetPosition
    * @brief Set position vector of geometric center of the surface in body frame [m]
    * @param[in] position_b_m: Position vector of geometric center of the surface in body frame [m]
    */
-  inline void SetPosition_b_m(const libra::Vector<3> position_b_m) { position_b_m_ = position_b_m; }
+  inline void SetPosition_b_m(const libra::Vector<3> position_b_m) {
+    position_b_m_ = position_b_m;
+    CountModification();
+  }
   /**
    * @fn SetNormal
    * @brief Set normal vector of the surface in body frame
    * @param[in] normal_b: Normal vector of the surface in body frame
    */
-  inline void SetNormal_b(const libra::Vector<3> normal_b) { normal_b_ = normal_b.CalcNormalizedVector(); }
+  inline void SetNormal_b(const libra::Vector<3> normal_b) {
+    normal_b_ = normal_b.CalcNormalizedVector();
+    CountModification();
+  }
   /**
    * @fn SetArea_m2
    * @brief Set area of the surface
@@ -78,6 +103,7 @@ class Surface {
    */
   inline void SetArea_m2(const double area_m2) {
     if (area_m2 > 0.0) area_m2_ = area_m2;
+    CountModification();
   }
   /**
    * @fn SetReflectivity
@@ -86,6 +112,7 @@ class Surface {
    */
   inline void SetReflectivity(const double reflectivity) {
     if (reflectivity >= 0.0 && reflectivity <= 1.0) reflectivity_ = reflectivity;
+    CountModification();
   }
   /**
    * @fn SetSpecularity
@@ -94,6 +121,7 @@ class Surface {
    */
   inline void SetSpecularity(const double specularity) {
     if (specularity >= 0.0 && specularity <= 1.0) specularity_ = specularity;
+    CountModification();
   }
   /**
    * @fn SetAirSpecularity
@@ -102,6 +130,7 @@ class Surface {
    */
   inline void SetAirSpecularity(const double air_specularity) {
     if (air_specularity >= 0.0 && air_specularity <= 1.0) air_specularity_ = air_specularity;
+    CountModification();
   }
 
  private:
@@ -111,6 +140,14 @@ class Surface {
   double reflectivity_;            //!< Total reflectivity for solar wavelength (1.0 - solar absorption)
   double specularity_;             //!< Ratio of specular reflection in the total reflected light
   double air_specularity_;         //!< Specularity for air drag
+
+  static std::atomic<uint64_t> modification_count_;  //!< Number of constructions and modifications of all surfaces
+
+  /**
+   * @fn CountModification
+   * @brief Increment the modification count
+   */
+  static inline void CountModification(void) { modification_count_.fetch_add(1, std::memory_order_relaxed); }
 };
 
 #endif  // S2E_SIMULATION_SPACECRAFT_STRUCTURE_SURFACE_HPP_
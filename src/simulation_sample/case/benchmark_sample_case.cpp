@@ -0,0 +1,90 @@
+/**
+ * @file benchmark_sample_case.cpp
+ * @brief End-to-end benchmark codes of SampleCase with Google Benchmark
+ * @note The sample case is executed with the initialize file including the log output, in the same way as the S2E executable.
+ *       The path of the file is set by the environment variable S2E_BENCHMARK_INI_FILE, and the sample file is used by default.
+ *       A new log directory is made for each execution.
+ */
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <library/initialize/initialize_file_access.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "sample_case.hpp"
+
+namespace {
+
+const char* kDefaultIniFile = "../../data/sample/initialize_files/sample_simulation_base.ini";
+
+/**
+ * @fn GetIniFile
+ * @brief Return the initialize file of the benchmark
+ */
+std::string GetIniFile() {
+  const char* ini_file_env = getenv("S2E_BENCHMARK_INI_FILE");
+  return ini_file_env != nullptr ? ini_file_env : kDefaultIniFile;
+}
+
+/**
+ * @fn IsIniFileAvailable
+ * @brief Return true when the initialize file, the SPICE kernels, the spacecraft file, and the ground station file exist
+ */
+bool IsIniFileAvailable() {
+  static int is_available = -1;
+  if (is_available >= 0) return is_available == 1;
+
+  is_available = 0;
+  if (!std::filesystem::exists(GetIniFile())) return false;
+  try {
+    IniAccess ini_file(GetIniFile());
+    const char* keywords[] = {"tls", "tpc1", "tpc2", "tpc3", "bsp"};
+    for (size_t i = 0; i < 5; i++) {
+      if (!std::filesystem::exists(ini_file.ReadString("CSPICE_KERNELS", keywords[i]))) return false;
+    }
+    const char* file_lists[] = {"spacecraft_file", "ground_station_file"};
+    for (size_t i = 0; i < 2; i++) {
+      std::vector<std::string> files = ini_file.ReadStrVector("SIMULATION_SETTINGS", file_lists[i]);
+      if (files.empty() || !std::filesystem::exists(files[0])) return false;
+    }
+  } catch (const std::runtime_error&) {
+    return false;
+  }
+  is_available = 1;
+  return true;
+}
+
+}  // namespace
+
+/**
+ * @brief Benchmark of the whole sample case from the start to the end of the simulation
+ * @note The construction and the initialization of the case are not measured.
+ *       The counter simulated_s_per_wall_s is the simulated time per the wall clock time.
+ */
+static void BM_SampleCase(benchmark::State& state) {
+  if (!IsIniFileAvailable()) {
+    state.SkipWithError("Initialize files are not available");
+    return;
+  }
+
+  double simulated_time_s = 0.0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::unique_ptr<SampleCase> simulation_case(new SampleCase(GetIniFile()));
+    simulation_case->Initialize();
+    state.ResumeTiming();
+
+    simulation_case->Main();
+
+    state.PauseTiming();
+    simulated_time_s += simulation_case->GetGlobalEnvironment().GetSimulationTime().GetEndTime_s();
+    simulation_case.reset();
+    state.ResumeTiming();
+  }
+  state.counters["simulated_s_per_wall_s"] = benchmark::Counter(simulated_time_s, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_SampleCase)->Unit(benchmark::kSecond)->UseRealTime();
@@ -7,6 +7,9 @@
 
 SampleCase::SampleCase(std::string initialise_base_file) : SimulationCase(initialise_base_file) {}
 
+SampleCase::SampleCase(const std::string initialise_base_file, const MonteCarloSimulationExecutor& monte_carlo_simulator, const std::string log_path)
+    : SimulationCase(initialise_base_file, monte_carlo_simulator, log_path) {}
+
 SampleCase::~SampleCase() {
   delete sample_spacecraft_;
   delete sample_ground_station_;
@@ -32,6 +35,10 @@ void SampleCase::UpdateTargetObjects() {
   sample_ground_station_->Update(global_environment_->GetCelestialInformation().GetEarthRotation(), *sample_spacecraft_);
 }
 
+void SampleCase::SaveTargetObjectsState(CheckpointWriter& writer) const { sample_spacecraft_->SaveState(writer); }
+
+void SampleCase::LoadTargetObjectsState(CheckpointReader& reader) { sample_spacecraft_->LoadState(reader); }
+
 std::string SampleCase::GetLogHeader() const {
   std::string str_tmp = "";
 
@@ -47,3 +54,7 @@ std::string SampleCase::GetLogValue() const {
 
   return str_tmp;
 }
+
+void SampleCase::PushLogValue(LogValueBuffer& buffer) const {
+  buffer.Push(global_environment_->GetSimulationTime().GetElapsedTime_s());
+}
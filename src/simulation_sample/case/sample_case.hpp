@@ -22,6 +22,11 @@ class SampleCase : public SimulationCase {
    * @brief Constructor
    */
   SampleCase(const std::string initialise_base_file);
+  /**
+   * @fn SampleCase
+   * @brief Constructor for Monte-Carlo simulation
+   */
+  SampleCase(const std::string initialise_base_file, const MonteCarloSimulationExecutor& monte_carlo_simulator, const std::string log_path);
 
   /**
    * @fn ~SampleCase
@@ -39,6 +44,11 @@ class SampleCase : public SimulationCase {
    * @brief Override function of GetLogValue
    */
   virtual std::string GetLogValue() const;
+  /**
+   * @fn PushLogValue
+   * @brief Override PushLogValue function of ILoggable
+   */
+  virtual void PushLogValue(LogValueBuffer& buffer) const;
 
  private:
   SampleSpacecraft* sample_spacecraft_;         //!< Instance of spacecraft
@@ -55,6 +65,18 @@ class SampleCase : public SimulationCase {
    * @brief Override function of Main in SimulationCase
    */
   void UpdateTargetObjects();
+
+  /**
+   * @fn SaveTargetObjectsState
+   * @brief Override function of SaveTargetObjectsState in SimulationCase
+   * @note The ground station is not included since it has no state to be continued.
+   */
+  void SaveTargetObjectsState(CheckpointWriter& writer) const;
+  /**
+   * @fn LoadTargetObjectsState
+   * @brief Override function of LoadTargetObjectsState in SimulationCase
+   */
+  void LoadTargetObjectsState(CheckpointReader& reader);
 };
 
 #endif  // S2E_SIMULATION_SAMPLE_CASE_SAMPLE_CASE_HPP_
@@ -27,10 +27,14 @@ SampleComponents::SampleComponents(const Dynamics* dynamics, Structure* structur
 
   // Components
   obc_ = new OnBoardComputer(1, clock_generator, pcu_->GetPowerPort(0));
-  hils_port_manager_ = new HilsPortManager();
+
+  // HILS ports are polled before the components using them are updated
+  std::string file_name = iniAccess.ReadString("COMPONENT_FILES", "hils_port_file");
+  configuration_->main_logger_->CopyFileToLogDirectory(file_name);
+  hils_port_manager_ = InitHilsPortManager(clock_generator, file_name);
 
   // GyroSensor
-  std::string file_name = iniAccess.ReadString("COMPONENT_FILES", "gyro_file");
+  file_name = iniAccess.ReadString("COMPONENT_FILES", "gyro_file");
   configuration_->main_logger_->CopyFileToLogDirectory(file_name);
   gyro_sensor_ = new GyroSensor(InitGyroSensor(clock_generator, pcu_->GetPowerPort(1), 1, file_name,
                                                global_environment_->GetSimulationTime().GetComponentStepTime_s(), dynamics_));
@@ -25,7 +25,7 @@
 #include <components/real/propulsion/initialize_simple_thruster.hpp>
 #include <dynamics/dynamics.hpp>
 #include <library/math/vector.hpp>
-#include <simulation/hils/hils_port_manager.hpp>
+#include <simulation/hils/initialize_hils_port_manager.hpp>
 #include <simulation/spacecraft/installed_components.hpp>
 #include <simulation/spacecraft/structure/structure.hpp>
 